@@ -0,0 +1,576 @@
+#include "bazaar_search_index.h"
+
+#include <algorithm>
+#include <limits>
+#include "eq_constants.h"
+#include "races.h"
+#include "classes.h"
+#include "rulesys.h"
+#include "strings.h"
+#include "timer.h"
+
+BazaarSearchIndex *BazaarSearchIndex::SetDatabase(SharedDatabase *db)
+{
+	m_database = db;
+
+	return this;
+}
+
+std::vector<uint32> BazaarSearchIndex::GetTrigrams(const std::string &s)
+{
+	std::vector<uint32> l;
+	if (s.size() < 3) {
+		return l;
+	}
+
+	l.reserve(s.size() - 2);
+	for (size_t i = 0; i + 2 < s.size(); ++i) {
+		l.emplace_back(
+			(static_cast<uint32>(static_cast<uint8>(s[i])) << 16) |
+			(static_cast<uint32>(static_cast<uint8>(s[i + 1])) << 8) |
+			static_cast<uint32>(static_cast<uint8>(s[i + 2]))
+		);
+	}
+
+	std::sort(l.begin(), l.end());
+	l.erase(std::unique(l.begin(), l.end()), l.end());
+
+	return l;
+}
+
+void BazaarSearchIndex::EnsureLoaded()
+{
+	if (m_loaded || !m_database) {
+		return;
+	}
+
+	BenchTimer timer;
+
+	std::string criteria = "TRUE";
+
+	LoadListings(TraderRepository::GetBazaarTraderDetails(*m_database, criteria));
+
+	LogTrading(
+		"Loaded [{}] bazaar listings for [{}] items ({}s)",
+		Strings::Commify(m_listings.size()),
+		Strings::Commify(m_items.size()),
+		std::to_string(timer.elapsed())
+	);
+}
+
+void BazaarSearchIndex::LoadListings(const std::vector<TraderRepository::BazaarTraderSearch_Struct> &listings)
+{
+	m_listings.clear();
+	m_changed_traders.clear();
+
+	// items and their trigrams stay, an item that has been listed once is likely to be listed again
+	for (auto &[item_id, item]: m_items) {
+		item.listings.clear();
+	}
+
+	for (const auto &e: listings) {
+		AddListing(e);
+	}
+
+	m_loaded = true;
+}
+
+BazaarSearchIndex::IndexedItem *BazaarSearchIndex::GetIndexedItem(uint32 item_id)
+{
+	auto it = m_items.find(item_id);
+	if (it != m_items.end()) {
+		return &it->second;
+	}
+
+	const EQ::ItemData *data = m_database ? m_database->GetItem(item_id) : nullptr;
+	if (!data) {
+		return nullptr;
+	}
+
+	IndexedItem item;
+	item.data       = data;
+	item.name_lower = Strings::ToLower(data->Name);
+
+	for (const auto &t: GetTrigrams(item.name_lower)) {
+		m_items_by_trigram[t].emplace_back(item_id);
+	}
+
+	return &m_items.emplace(item_id, std::move(item)).first->second;
+}
+
+void BazaarSearchIndex::AddListing(const TraderRepository::BazaarTraderSearch_Struct &e)
+{
+	// the search only ever returned listings of items it could find in the items table
+	auto item = GetIndexedItem(e.trader.item_id);
+	if (!item) {
+		return;
+	}
+
+	auto [it, inserted] = m_listings.emplace(ListingKey{e.trader.char_id, e.trader.id}, Listing{e.trader, e.trader_name});
+	if (inserted) {
+		item->listings.emplace_back(&it->second);
+	}
+}
+
+void BazaarSearchIndex::RemoveTrader(uint32 char_id)
+{
+	auto begin = m_listings.lower_bound(ListingKey{char_id, 0});
+	auto end   = m_listings.upper_bound(ListingKey{char_id, std::numeric_limits<uint64>::max()});
+
+	for (auto it = begin; it != end; ++it) {
+		auto item = m_items.find(it->second.trader.item_id);
+		if (item == m_items.end()) {
+			continue;
+		}
+
+		auto &l = item->second.listings;
+		l.erase(std::remove(l.begin(), l.end(), &it->second), l.end());
+	}
+
+	m_listings.erase(begin, end);
+}
+
+void BazaarSearchIndex::SetTraderListings(
+	uint32 char_id,
+	const std::vector<TraderRepository::BazaarTraderSearch_Struct> &listings
+)
+{
+	RemoveTrader(char_id);
+
+	for (const auto &e: listings) {
+		if (e.trader.char_id == char_id) {
+			AddListing(e);
+		}
+	}
+}
+
+void BazaarSearchIndex::MarkTraderChanged(uint32 char_id)
+{
+	// nothing to keep up to date until the first search loads the listings
+	if (m_loaded) {
+		m_changed_traders.insert(char_id);
+	}
+}
+
+void BazaarSearchIndex::Reload()
+{
+	m_loaded = false;
+	m_listings.clear();
+	m_changed_traders.clear();
+
+	for (auto &[item_id, item]: m_items) {
+		item.listings.clear();
+	}
+}
+
+void BazaarSearchIndex::RefreshChangedTraders()
+{
+	if (m_changed_traders.empty() || !m_database) {
+		return;
+	}
+
+	std::vector<uint32> char_ids(m_changed_traders.begin(), m_changed_traders.end());
+	m_changed_traders.clear();
+
+	std::string criteria = fmt::format("trader.char_id IN ({})", Strings::Join(char_ids, ","));
+
+	const auto listings = TraderRepository::GetBazaarTraderDetails(*m_database, criteria);
+
+	for (const auto &char_id: char_ids) {
+		RemoveTrader(char_id);
+	}
+
+	for (const auto &e: listings) {
+		AddListing(e);
+	}
+
+	LogTradingDetail("Refreshed [{}] changed traders with [{}] listings", char_ids.size(), listings.size());
+}
+
+bool BazaarSearchIndex::MatchesItemCriteria(const EQ::ItemData *item, const BazaarSearchCriteria_Struct &search, uint32 &stat)
+{
+	stat = 0;
+
+	if (search.slot <= EQ::invslot::slotAmmo) {
+		const uint32 slot_bit = 1u << search.slot;
+		if ((item->Slots & slot_bit) != slot_bit) {
+			return false;
+		}
+	}
+
+	if (search.type != std::numeric_limits<uint32>::max()) {
+		const uint8 t = item->ItemType;
+
+		switch (search.type) {
+			case EQ::item::ItemType::ItemTypeBook:
+				if (item->ItemClass != 2 && item->ItemClass != 31) {
+					return false;
+				}
+				break;
+			case EQ::item::ItemType::ItemTypeContainer:
+				if (item->ItemClass != 1 && item->ItemClass != 67) {
+					return false;
+				}
+				break;
+			case EQ::item::ItemType::ItemTypeAllEffects:
+				if (item->Scroll.Effect <= 0 || item->Scroll.Effect >= 65000) {
+					return false;
+				}
+				break;
+			case EQ::item::ItemType::ItemTypeUnknown9:
+				if (item->Worn.Effect != 998) {
+					return false;
+				}
+				break;
+			case EQ::item::ItemType::ItemTypeUnknown10:
+				if (item->Worn.Effect < 1298 || item->Worn.Effect > 1307) {
+					return false;
+				}
+				break;
+			case EQ::item::ItemType::ItemTypeFocusEffect:
+				if (item->Focus.Effect <= 0) {
+					return false;
+				}
+				break;
+			case EQ::item::ItemType::ItemTypeSmallThrowing:
+				if (t != 19 && t != 7) {
+					return false;
+				}
+				break;
+			case EQ::item::ItemType::ItemTypeArmor:
+			case EQ::item::ItemType::ItemType1HBlunt:
+			case EQ::item::ItemType::ItemType1HPiercing:
+			case EQ::item::ItemType::ItemType1HSlash:
+			case EQ::item::ItemType::ItemType2HBlunt:
+			case EQ::item::ItemType::ItemType2HSlash:
+			case EQ::item::ItemType::ItemTypeBow:
+			case EQ::item::ItemType::ItemTypeShield:
+			case EQ::item::ItemType::ItemTypeMisc:
+			case EQ::item::ItemType::ItemTypeFood:
+			case EQ::item::ItemType::ItemTypeDrink:
+			case EQ::item::ItemType::ItemTypeLight:
+			case EQ::item::ItemType::ItemTypeCombinable:
+			case EQ::item::ItemType::ItemTypeBandage:
+			case EQ::item::ItemType::ItemTypeSpell:
+			case EQ::item::ItemType::ItemTypePotion:
+			case EQ::item::ItemType::ItemTypeBrassInstrument:
+			case EQ::item::ItemType::ItemTypeWindInstrument:
+			case EQ::item::ItemType::ItemTypeStringedInstrument:
+			case EQ::item::ItemType::ItemTypePercussionInstrument:
+			case EQ::item::ItemType::ItemTypeArrow:
+			case EQ::item::ItemType::ItemTypeJewelry:
+			case EQ::item::ItemType::ItemTypeNote:
+			case EQ::item::ItemType::ItemTypeKey:
+			case EQ::item::ItemType::ItemType2HPiercing:
+			case EQ::item::ItemType::ItemTypeAlcohol:
+			case EQ::item::ItemType::ItemTypeMartial:
+			case EQ::item::ItemType::ItemTypeAugmentation:
+			case EQ::item::ItemType::ItemTypeAlternateAbility:
+			case EQ::item::ItemType::ItemTypeCount:
+			case EQ::item::ItemType::ItemTypeCollectible:
+				if (t != search.type) {
+					return false;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+
+	if (search.race != std::numeric_limits<uint32>::max()) {
+		const uint32 race_bit = GetPlayerRaceBit(GetRaceIDFromPlayerRaceValue(search.race));
+		if ((item->Races & race_bit) != race_bit) {
+			return false;
+		}
+	}
+
+	if (search._class != std::numeric_limits<uint32>::max()) {
+		const uint32 class_bit = GetPlayerClassBit(search._class);
+		if ((item->Classes & class_bit) != class_bit) {
+			return false;
+		}
+	}
+
+	if (search.item_stat != std::numeric_limits<uint32>::max()) {
+		int64                 value      = 0;
+		EQ::skills::SkillType skill_type = static_cast<EQ::skills::SkillType>(0);
+		bool                  known      = true;
+
+		switch (search.item_stat) {
+			case STAT_AC: value = item->AC; break;
+			case STAT_AGI: value = item->AAgi; break;
+			case STAT_CHA: value = item->ACha; break;
+			case STAT_DEX: value = item->ADex; break;
+			case STAT_INT: value = item->AInt; break;
+			case STAT_STA: value = item->ASta; break;
+			case STAT_STR: value = item->AStr; break;
+			case STAT_WIS: value = item->AWis; break;
+			case STAT_COLD: value = item->CR; break;
+			case STAT_DISEASE: value = item->DR; break;
+			case STAT_FIRE: value = item->FR; break;
+			case STAT_MAGIC: value = item->MR; break;
+			case STAT_POISON: value = item->PR; break;
+			case STAT_HP: value = item->HP; break;
+			case STAT_MANA: value = item->Mana; break;
+			case STAT_ENDURANCE: value = item->Endur; break;
+			case STAT_ATTACK: value = item->Attack; break;
+			case STAT_HP_REGEN: value = item->Regen; break;
+			case STAT_MANA_REGEN: value = item->ManaRegen; break;
+			case STAT_HASTE: value = item->Haste; break;
+			case STAT_DAMAGE_SHIELD: value = item->DamageShield; break;
+			case STAT_DS_MITIGATION: value = item->DSMitigation; break;
+			case STAT_HEAL_AMOUNT: value = item->HealAmt; break;
+			case STAT_SPELL_DAMAGE: value = item->SpellDmg; break;
+			case STAT_CLAIRVOYANCE: value = item->Clairvoyance; break;
+			case STAT_HEROIC_AGILITY: value = item->HeroicAgi; break;
+			case STAT_HEROIC_CHARISMA: value = item->HeroicCha; break;
+			case STAT_HEROIC_DEXTERITY: value = item->HeroicDex; break;
+			case STAT_HEROIC_INTELLIGENCE: value = item->HeroicInt; break;
+			case STAT_HEROIC_STAMINA: value = item->HeroicSta; break;
+			case STAT_HEROIC_STRENGTH: value = item->HeroicStr; break;
+			case STAT_HEROIC_WISDOM: value = item->HeroicWis; break;
+			case STAT_BASH: value = item->SkillModValue; skill_type = EQ::skills::SkillBash; break;
+			case STAT_BACKSTAB: value = item->BackstabDmg; skill_type = EQ::skills::SkillBackstab; break;
+			case STAT_DRAGON_PUNCH: value = item->SkillModValue; skill_type = EQ::skills::SkillDragonPunch; break;
+			case STAT_EAGLE_STRIKE: value = item->SkillModValue; skill_type = EQ::skills::SkillEagleStrike; break;
+			case STAT_FLYING_KICK: value = item->SkillModValue; skill_type = EQ::skills::SkillFlyingKick; break;
+			case STAT_KICK: value = item->SkillModValue; skill_type = EQ::skills::SkillKick; break;
+			case STAT_ROUND_KICK: value = item->SkillModValue; skill_type = EQ::skills::SkillRoundKick; break;
+			case STAT_TIGER_CLAW: value = item->SkillModValue; skill_type = EQ::skills::SkillTigerClaw; break;
+			case STAT_FRENZY: value = item->SkillModValue; skill_type = EQ::skills::SkillFrenzy; break;
+			default: known = false; break;
+		}
+
+		if (known) {
+			// skill stats only need the skill, everything else has to have some of the stat
+			if (skill_type ? item->SkillModType != static_cast<uint32>(skill_type) : value <= 0) {
+				return false;
+			}
+
+			stat = static_cast<uint32>(static_cast<int32>(value));
+		}
+	}
+
+	if (search.augment) {
+		bool fits = false;
+		for (const auto &t: item->AugSlotType) {
+			fits |= t == search.augment;
+		}
+
+		if (!fits) {
+			return false;
+		}
+	}
+
+	if (search.min_level != 1 && item->RecLevel < search.min_level) {
+		return false;
+	}
+
+	if (search.max_level != 100 && item->RecLevel > search.max_level) {
+		return false;
+	}
+
+	if (search.prestige == -1 || search.prestige == -2) {
+		const bool glamour = Strings::BeginsWith(Strings::ToLower(item->Name), "glamour - ");
+		if (glamour != (search.prestige == -1)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+std::vector<BazaarSearchResultsFromDB_Struct> BazaarSearchIndex::Search(
+	const BazaarSearchCriteria_Struct &search,
+	uint32 char_zone_id,
+	int32 char_zone_instance_id
+)
+{
+	EnsureLoaded();
+	RefreshChangedTraders();
+
+	std::vector<BazaarSearchResultsFromDB_Struct> all_entries;
+
+	// the trader side of the search, the same scopes Bazaar::GetSearchResults puts in its query
+	bool convert = false;
+
+	auto trader_matches = [&](const TraderRepository::Trader &t) {
+		if (search.search_scope == NonRoFBazaarSearchScope) {
+			return t.char_entity_id == search.trader_entity_id &&
+				   t.char_zone_id == Zones::BAZAAR &&
+				   t.char_zone_instance_id == char_zone_instance_id;
+		}
+
+		if (search.search_scope == Local_Scope) {
+			return t.char_zone_id == char_zone_id && t.char_zone_instance_id == char_zone_instance_id;
+		}
+
+		if (search.trader_id > 0) {
+			if (RuleB(Bazaar, UseAlternateBazaarSearch) && search.trader_id >= TraderRepository::TRADER_CONVERT_ID) {
+				return t.char_zone_id == Zones::BAZAAR &&
+					   static_cast<uint32>(t.char_zone_instance_id) == search.trader_id - TraderRepository::TRADER_CONVERT_ID;
+			}
+
+			return t.char_id == search.trader_id;
+		}
+
+		return true;
+	};
+
+	if (search.search_scope != NonRoFBazaarSearchScope && search.search_scope != Local_Scope && search.trader_id > 0) {
+		convert = RuleB(Bazaar, UseAlternateBazaarSearch) && search.trader_id >= TraderRepository::TRADER_CONVERT_ID;
+	}
+
+	const uint64 min_cost = static_cast<uint64>(search.min_cost) * 1000;
+	const uint64 max_cost = static_cast<uint64>(search.max_cost) * 1000;
+
+	const std::string name = Strings::ToLower(std::string(search.item_name, strnlen(search.item_name, sizeof(search.item_name))));
+
+	struct Match {
+		const Listing     *listing;
+		const IndexedItem *item;
+		uint32            stat;
+	};
+
+	std::vector<Match> matches;
+
+	auto item_matches = [&](const IndexedItem &item, uint32 &stat) {
+		if (!name.empty() && item.name_lower.find(name) == std::string::npos) {
+			return false;
+		}
+
+		return MatchesItemCriteria(item.data, search, stat);
+	};
+
+	auto listing_matches = [&](const TraderRepository::Trader &t) {
+		if (!trader_matches(t)) {
+			return false;
+		}
+
+		if (search.min_cost != 0 && t.item_cost < min_cost) {
+			return false;
+		}
+
+		return search.max_cost == 0 || t.item_cost <= max_cost;
+	};
+
+	const bool single_trader = search.search_scope != NonRoFBazaarSearchScope &&
+							   search.search_scope != Local_Scope &&
+							   search.trader_id > 0 &&
+							   !convert;
+
+	if (single_trader) {
+		// one trader's listings, fewer than any other way in
+		auto begin = m_listings.lower_bound(ListingKey{search.trader_id, 0});
+		auto end   = m_listings.upper_bound(ListingKey{search.trader_id, std::numeric_limits<uint64>::max()});
+
+		for (auto it = begin; it != end; ++it) {
+			const auto &l    = it->second;
+			auto       item = m_items.find(l.trader.item_id);
+
+			uint32 stat = 0;
+			if (item != m_items.end() && listing_matches(l.trader) && item_matches(item->second, stat)) {
+				matches.push_back({&l, &item->second, stat});
+			}
+		}
+	}
+	else {
+		// the items to look at, narrowed by the rarest trigram of the name when there is one
+		std::vector<const IndexedItem *> candidates;
+
+		const auto trigrams = GetTrigrams(name);
+		if (!trigrams.empty()) {
+			const std::vector<uint32> *rarest = nullptr;
+			for (const auto &t: trigrams) {
+				auto it = m_items_by_trigram.find(t);
+				if (it == m_items_by_trigram.end()) {
+					LogTradingDetail("Bazaar - No items found in bazaar search.");
+					return all_entries;
+				}
+
+				if (!rarest || it->second.size() < rarest->size()) {
+					rarest = &it->second;
+				}
+			}
+
+			for (const auto &item_id: *rarest) {
+				candidates.emplace_back(&m_items.at(item_id));
+			}
+		}
+		else {
+			candidates.reserve(m_items.size());
+			for (const auto &[item_id, item]: m_items) {
+				candidates.emplace_back(&item);
+			}
+		}
+
+		for (const auto item: candidates) {
+			uint32 stat = 0;
+			if (item->listings.empty() || !item_matches(*item, stat)) {
+				continue;
+			}
+
+			for (const auto l: item->listings) {
+				if (listing_matches(l->trader)) {
+					matches.push_back({l, item, stat});
+				}
+			}
+		}
+	}
+
+	if (matches.empty()) {
+		LogTradingDetail("Bazaar - No items found in bazaar search.");
+		return all_entries;
+	}
+
+	auto by_trader = [](const Match &a, const Match &b) {
+		return ListingKey{a.listing->trader.char_id, a.listing->trader.id} <
+			   ListingKey{b.listing->trader.char_id, b.listing->trader.id};
+	};
+
+	if (matches.size() > search.max_results) {
+		std::partial_sort(matches.begin(), matches.begin() + search.max_results, matches.end(), by_trader);
+		matches.resize(search.max_results);
+	}
+	else {
+		std::sort(matches.begin(), matches.end(), by_trader);
+	}
+
+	all_entries.reserve(matches.size());
+
+	for (const auto &m: matches) {
+		const auto &t = m.listing->trader;
+
+		BazaarSearchResultsFromDB_Struct r{};
+		r.count                   = 1;
+		r.trader_id               = t.char_id;
+		r.serial_number           = t.item_sn;
+		r.cost                    = t.item_cost;
+		r.slot_id                 = t.slot_id;
+		r.charges                 = t.item_charges;
+		r.stackable               = m.item->data->Stackable;
+		r.icon_id                 = m.item->data->Icon;
+		r.trader_zone_id          = t.char_zone_id;
+		r.trader_zone_instance_id = t.char_zone_instance_id;
+		r.trader_entity_id        = t.char_entity_id;
+		r.serial_number_RoF       = fmt::format("{:016}\0", t.item_sn);
+		r.item_name               = fmt::format("{:.63}\0", m.item->data->Name);
+		r.trader_name             = fmt::format("{:.63}\0", m.listing->trader_name);
+		r.item_stat               = m.stat;
+
+		if (RuleB(Bazaar, UseAlternateBazaarSearch)) {
+			if (convert ||
+				char_zone_id != Zones::BAZAAR ||
+				(char_zone_id == Zones::BAZAAR && r.trader_zone_instance_id != char_zone_instance_id)
+				) {
+				r.trader_id = TraderRepository::TRADER_CONVERT_ID + r.trader_zone_instance_id;
+			}
+		}
+
+		all_entries.push_back(r);
+	}
+
+	LogTrading("Returning [{}] items from search results", all_entries.size());
+
+	return all_entries;
+}
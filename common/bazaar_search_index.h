@@ -0,0 +1,69 @@
+#ifndef EQEMU_BAZAAR_SEARCH_INDEX_H
+#define EQEMU_BAZAAR_SEARCH_INDEX_H
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "shareddb.h"
+#include "repositories/trader_repository.h"
+
+// Every trader listing held in memory next to the item it sells, so a bazaar search is answered without querying
+// trader or items. Listings are read once on the first search; after that only the traders zones report as changed
+// (ServerOP_BazaarListingsChanged) are read again, in one query, before the next search.
+class BazaarSearchIndex {
+public:
+	using ListingKey = std::pair<uint32, uint64>; // char_id, trader.id, the order search results come back in
+
+	struct Listing {
+		TraderRepository::Trader trader;
+		std::string              trader_name;
+	};
+
+	BazaarSearchIndex *SetDatabase(SharedDatabase *db);
+
+	std::vector<BazaarSearchResultsFromDB_Struct> Search(
+		const BazaarSearchCriteria_Struct &search,
+		uint32 char_zone_id,
+		int32 char_zone_instance_id
+	);
+
+	// the item side of a search (slot, type, race, class, stat, augment, level, prestige), stat is the value reported
+	// back for the searched stat
+	static bool MatchesItemCriteria(const EQ::ItemData *item, const BazaarSearchCriteria_Struct &search, uint32 &stat);
+
+	void LoadListings(const std::vector<TraderRepository::BazaarTraderSearch_Struct> &listings);
+	void SetTraderListings(uint32 char_id, const std::vector<TraderRepository::BazaarTraderSearch_Struct> &listings);
+	void MarkTraderChanged(uint32 char_id);
+	void Reload();
+
+	bool IsLoaded() const { return m_loaded; }
+	size_t GetListingCount() const { return m_listings.size(); }
+	size_t GetItemCount() const { return m_items.size(); }
+
+private:
+	struct IndexedItem {
+		const EQ::ItemData           *data = nullptr;
+		std::string                  name_lower;
+		std::vector<const Listing *> listings;
+	};
+
+	void EnsureLoaded();
+	void RefreshChangedTraders();
+	void AddListing(const TraderRepository::BazaarTraderSearch_Struct &e);
+	void RemoveTrader(uint32 char_id);
+	IndexedItem *GetIndexedItem(uint32 item_id);
+
+	static std::vector<uint32> GetTrigrams(const std::string &s);
+
+	SharedDatabase                                  *m_database = nullptr;
+	bool                                            m_loaded    = false;
+	std::map<ListingKey, Listing>                   m_listings;
+	std::unordered_map<uint32, IndexedItem>         m_items;
+	std::unordered_map<uint32, std::vector<uint32>> m_items_by_trigram; // lower case name trigram => item ids
+	std::unordered_set<uint32>                      m_changed_traders;
+};
+
+#endif //EQEMU_BAZAAR_SEARCH_INDEX_H
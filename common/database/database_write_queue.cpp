@@ -0,0 +1,292 @@
+#include "database_write_queue.h"
+#include "../eqemu_config.h"
+#include "../eqemu_logsys.h"
+#include <algorithm>
+
+// bounds memory used for latency samples between reports
+const size_t MAX_LATENCY_SAMPLES = 65536;
+
+DatabaseWriteQueue::~DatabaseWriteQueue()
+{
+	Stop();
+}
+
+DatabaseWriteQueue *DatabaseWriteQueue::SetDatabase(Database *db)
+{
+	m_fallback_database = db;
+
+	return this;
+}
+
+bool DatabaseWriteQueue::Start(size_t max_depth)
+{
+	if (m_running) {
+		return true;
+	}
+
+	const auto c = EQEmuConfig::get();
+
+	LogInfo(
+		"Connecting to MySQL for write-behind queue [{}]@[{}]:[{}]",
+		c->DatabaseUsername.c_str(),
+		c->DatabaseHost.c_str(),
+		c->DatabasePort
+	);
+
+	if (!m_database.Connect(
+		c->DatabaseHost.c_str(),
+		c->DatabaseUsername.c_str(),
+		c->DatabasePassword.c_str(),
+		c->DatabaseDB.c_str(),
+		c->DatabasePort,
+		"write-behind"
+	)) {
+		LogError("Write-behind queue could not connect, database writes will stay synchronous");
+		return false;
+	}
+
+	m_max_depth = std::max<size_t>(max_depth, 1);
+	m_stopping  = false;
+	m_running   = true;
+	m_thread    = std::thread(&DatabaseWriteQueue::ProcessWork, this);
+
+	LogInfo("Write-behind queue started max depth [{}]", m_max_depth);
+
+	return true;
+}
+
+void DatabaseWriteQueue::Stop()
+{
+	if (!m_running) {
+		return;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		m_stopping = true;
+	}
+
+	// the worker drains everything still queued before it exits
+	m_work_cv.notify_all();
+	m_thread.join();
+
+	m_running = false;
+
+	ReportStats();
+}
+
+void DatabaseWriteQueue::Enqueue(uint32 character_id, const std::string &coalesce_key, Write write)
+{
+	if (!m_running) {
+		if (m_fallback_database) {
+			write(*m_fallback_database);
+		}
+
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	if (m_queue.size() >= m_max_depth) {
+		m_blocked++;
+		m_commit_cv.wait(lock, [this] { return m_queue.size() < m_max_depth; });
+	}
+
+	auto e = std::make_shared<Entry>(
+		Entry{
+			.sequence = m_next_sequence++,
+			.character_id = character_id,
+			.coalesce_key = coalesce_key,
+			.write = std::move(write),
+			.queued_at = Clock::now()
+		}
+	);
+
+	if (!coalesce_key.empty()) {
+		auto it = m_pending_by_key.find(coalesce_key);
+		if (it != m_pending_by_key.end()) {
+			it->second->superseded = true;
+			it->second->write      = nullptr;
+			it->second             = e;
+			m_coalesced++;
+		}
+		else {
+			m_pending_by_key.emplace(coalesce_key, e);
+		}
+	}
+
+	if (character_id) {
+		m_last_sequence_by_character[character_id] = e->sequence;
+	}
+
+	m_queue.emplace_back(std::move(e));
+	m_peak_depth = std::max(m_peak_depth, m_queue.size());
+
+	lock.unlock();
+	m_work_cv.notify_one();
+}
+
+void DatabaseWriteQueue::Flush(uint32 character_id)
+{
+	if (!m_running) {
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	auto it = m_last_sequence_by_character.find(character_id);
+	if (it == m_last_sequence_by_character.end()) {
+		return;
+	}
+
+	const uint64 target = it->second;
+
+	m_commit_cv.wait(lock, [this, target] { return m_committed_sequence >= target; });
+}
+
+void DatabaseWriteQueue::Flush()
+{
+	if (!m_running) {
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	const uint64 target = m_next_sequence - 1;
+
+	m_commit_cv.wait(lock, [this, target] { return m_committed_sequence >= target; });
+}
+
+void DatabaseWriteQueue::SetStatsInterval(uint32 seconds)
+{
+	if (seconds == 0) {
+		m_stats_timer.Disable();
+		return;
+	}
+
+	m_stats_timer.Start(seconds * 1000);
+}
+
+void DatabaseWriteQueue::Process()
+{
+	if (m_stats_timer.Enabled() && m_stats_timer.Check()) {
+		ReportStats();
+	}
+}
+
+void DatabaseWriteQueue::ProcessWork()
+{
+	for (;;) {
+		std::shared_ptr<Entry> e;
+
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_work_cv.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+
+			if (m_queue.empty()) {
+				return; // stopping and fully drained
+			}
+
+			e = std::move(m_queue.front());
+			m_queue.pop_front();
+
+			if (!e->superseded && !e->coalesce_key.empty()) {
+				auto it = m_pending_by_key.find(e->coalesce_key);
+				if (it != m_pending_by_key.end() && it->second == e) {
+					m_pending_by_key.erase(it);
+				}
+			}
+		}
+
+		// a producer may be blocked on a full queue
+		m_commit_cv.notify_all();
+
+		if (!e->superseded && e->write) {
+			try {
+				e->write(m_database);
+			}
+			catch (const std::exception &ex) {
+				LogMySQLError("Write-behind write for character [{}] key [{}] failed [{}]", e->character_id, e->coalesce_key, ex.what());
+			}
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+
+			// strictly FIFO, so everything queued before this entry is committed as well
+			m_committed_sequence = e->sequence;
+
+			if (!e->superseded) {
+				const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - e->queued_at).count();
+				if (m_latencies_us.size() < MAX_LATENCY_SAMPLES) {
+					m_latencies_us.emplace_back(static_cast<uint32>(latency));
+				}
+				else {
+					m_latencies_us[m_committed % MAX_LATENCY_SAMPLES] = static_cast<uint32>(latency);
+				}
+
+				m_committed++;
+			}
+
+			if (e->character_id) {
+				auto it = m_last_sequence_by_character.find(e->character_id);
+				if (it != m_last_sequence_by_character.end() && it->second == e->sequence) {
+					m_last_sequence_by_character.erase(it);
+				}
+			}
+		}
+
+		m_commit_cv.notify_all();
+	}
+}
+
+void DatabaseWriteQueue::ReportStats()
+{
+	std::vector<uint32> latencies;
+	size_t              depth;
+	size_t              peak_depth;
+	uint64              committed;
+	uint64              coalesced;
+	uint64              blocked;
+
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		latencies.swap(m_latencies_us);
+		depth      = m_queue.size();
+		peak_depth = m_peak_depth;
+		committed  = m_committed;
+		coalesced  = m_coalesced;
+		blocked    = m_blocked;
+
+		m_peak_depth = depth;
+		m_committed  = 0;
+		m_coalesced  = 0;
+		m_blocked    = 0;
+	}
+
+	if (committed == 0 && depth == 0) {
+		return;
+	}
+
+	uint32 p50 = 0;
+	uint32 p99 = 0;
+	uint32 max = 0;
+	if (!latencies.empty()) {
+		std::sort(latencies.begin(), latencies.end());
+		p50 = latencies[latencies.size() / 2];
+		p99 = latencies[(latencies.size() * 99) / 100];
+		max = latencies.back();
+	}
+
+	LogInfo(
+		"Write-behind queue depth [{}] peak [{}] committed [{}] coalesced [{}] blocked [{}] enqueue to commit p50 [{}] us p99 [{}] us max [{}] us",
+		depth,
+		peak_depth,
+		committed,
+		coalesced,
+		blocked,
+		p50,
+		p99,
+		max
+	);
+}
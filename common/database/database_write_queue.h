@@ -0,0 +1,93 @@
+#ifndef EQEMU_DATABASE_WRITE_QUEUE_H
+#define EQEMU_DATABASE_WRITE_QUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../database.h"
+#include "../timer.h"
+
+// Write-behind queue for persistence that does not need to be read back right away
+//
+// Writes are closures run against a dedicated database connection on a single worker thread, so the caller (usually
+// the zone main thread) never waits on MySQL. Callers snapshot whatever they are saving into the closure.
+//
+// - Ordering: one worker executes writes strictly in queue order, so writes for a character commit in the order
+//   they were queued.
+// - Coalescing: a write queued with the same coalesce key as one still pending supersedes it; the old one is skipped
+//   and the new one takes its place at the back of the queue.
+// - Bounded: once max depth is reached Enqueue blocks until the worker catches up.
+// - Flush: blocks until everything queued (for a character, or in total) before the call has committed. Use it when
+//   another process is about to read the rows (zoning, camping).
+class DatabaseWriteQueue {
+public:
+	using Write = std::function<void(Database &db)>;
+
+	~DatabaseWriteQueue();
+
+	// writes run synchronously against this connection while the queue is not running
+	DatabaseWriteQueue *SetDatabase(Database *db);
+
+	bool Start(size_t max_depth);
+	void Stop();
+	inline bool IsRunning() const { return m_running; }
+
+	void Enqueue(uint32 character_id, const std::string &coalesce_key, Write write);
+	void Flush(uint32 character_id);
+	void Flush();
+
+	// main thread, periodically reports queue depth and enqueue to commit latency
+	void Process();
+	void SetStatsInterval(uint32 seconds);
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Entry {
+		uint64            sequence;
+		uint32            character_id;
+		std::string       coalesce_key;
+		Write             write;
+		Clock::time_point queued_at;
+		bool              superseded = false;
+	};
+
+	void ProcessWork();
+	void ReportStats();
+
+	Database                                                m_database{};
+	Database                                                *m_fallback_database = nullptr;
+	std::thread                                             m_thread;
+	bool                                                    m_running   = false;
+	bool                                                    m_stopping  = false;
+	size_t                                                  m_max_depth = 0;
+
+	std::mutex                                              m_lock;
+	std::condition_variable                                 m_work_cv;   // worker waits for entries
+	std::condition_variable                                 m_commit_cv; // producers wait for room or flushes
+	std::deque<std::shared_ptr<Entry>>                      m_queue;
+	std::unordered_map<std::string, std::shared_ptr<Entry>> m_pending_by_key;
+	std::unordered_map<uint32, uint64>                      m_last_sequence_by_character;
+	uint64                                                  m_next_sequence      = 1;
+	uint64                                                  m_committed_sequence = 0; // every sequence <= this is done
+
+	// stats since the last report, guarded by m_lock
+	std::vector<uint32>                                     m_latencies_us;
+	size_t                                                  m_peak_depth = 0;
+	uint64                                                  m_committed  = 0;
+	uint64                                                  m_coalesced  = 0;
+	uint64                                                  m_blocked    = 0;
+
+	Timer                                                   m_stats_timer;
+};
+
+extern DatabaseWriteQueue database_write_queue;
+
+#endif //EQEMU_DATABASE_WRITE_QUEUE_H
@@ -0,0 +1,109 @@
+#include "encoded_packet_cache.h"
+#include "eq_packet.h"
+#include "eq_stream_intf.h"
+#include "struct_strategy.h"
+#include <algorithm>
+
+std::array<EncodedPacketCache::Stats, _maxEmuOpcode> EncodedPacketCache::s_stats = {};
+
+namespace {
+
+	// stands in for a client stream while a struct strategy encodes, collecting whatever the encoder queues
+	class CaptureStream : public EQStreamInterface {
+	public:
+		CaptureStream(std::vector<EncodedPacketCache::EncodedPacket> &out) : m_out(out) {}
+
+		virtual void QueuePacket(const EQApplicationPacket *p, bool ack_req = true)
+		{
+			if (p) {
+				m_out.emplace_back(
+					EncodedPacketCache::EncodedPacket{
+						.packet = std::shared_ptr<EQApplicationPacket>(p->Copy()),
+						.ack_req = ack_req
+					}
+				);
+			}
+		}
+
+		virtual void FastQueuePacket(EQApplicationPacket **p, bool ack_req = true)
+		{
+			if (p && *p) {
+				m_out.emplace_back(
+					EncodedPacketCache::EncodedPacket{
+						.packet = std::shared_ptr<EQApplicationPacket>(*p),
+						.ack_req = ack_req
+					}
+				);
+				*p = nullptr;
+			}
+		}
+
+		virtual EQApplicationPacket *PopPacket() { return nullptr; }
+		virtual void Close() {}
+		virtual void ReleaseFromUse() {}
+		virtual void RemoveData() {}
+		virtual std::string GetRemoteAddr() const { return std::string(); }
+		virtual uint32 GetRemoteIP() const { return 0; }
+		virtual uint16 GetRemotePort() const { return 0; }
+		virtual bool CheckState(EQStreamState state) { return state == ESTABLISHED; }
+		virtual std::string Describe() const { return "Encoded Packet Cache Capture"; }
+		virtual EQStreamState GetState() { return ESTABLISHED; }
+		virtual void SetOpcodeManager(OpcodeManager **opm) {}
+		virtual OpcodeManager *GetOpcodeManager() const { return nullptr; }
+		virtual Stats GetStats() const { return Stats{}; }
+		virtual void ResetStats() {}
+		virtual EQStreamManagerInterface *GetManager() const { return nullptr; }
+
+	private:
+		std::vector<EncodedPacketCache::EncodedPacket> &m_out;
+	};
+
+}
+
+EncodedPacketCache::EncodedPacketCache(const EQApplicationPacket *source, bool ack_req)
+	: m_source(source), m_ack_req(ack_req)
+{
+}
+
+const std::vector<EncodedPacketCache::EncodedPacket> &EncodedPacketCache::GetEncoded(const StructStrategy *structs)
+{
+	const auto op = m_source->GetOpcode();
+
+	// at most one entry per client version, a linear walk beats hashing here
+	for (size_t i = 0; i < m_encoded_count; ++i) {
+		if (m_encoded[i].structs == structs) {
+			s_stats[op].reuses++;
+			return m_encoded[i].packets;
+		}
+	}
+
+	// more strategies than client versions should not happen, but never index past the end
+	auto &e = m_encoded[std::min(m_encoded_count, m_encoded.size() - 1)];
+	if (m_encoded_count < m_encoded.size()) {
+		m_encoded_count++;
+	}
+
+	e.structs = structs;
+	e.packets.clear();
+
+	auto &packets = e.packets;
+
+	// the encoder takes ownership of what it is handed, so give it a copy of the source
+	EQApplicationPacket                *p       = m_source->Copy();
+	std::shared_ptr<EQStreamInterface> capture = std::make_shared<CaptureStream>(packets);
+	structs->Encode(&p, capture, m_ack_req);
+
+	s_stats[op].encodes++;
+
+	return packets;
+}
+
+const EncodedPacketCache::Stats &EncodedPacketCache::GetStats(EmuOpcode op)
+{
+	return s_stats[op];
+}
+
+void EncodedPacketCache::ResetStats()
+{
+	s_stats.fill(Stats{});
+}
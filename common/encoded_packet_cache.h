@@ -0,0 +1,53 @@
+#ifndef EQEMU_ENCODED_PACKET_CACHE_H
+#define EQEMU_ENCODED_PACKET_CACHE_H
+
+#include <array>
+#include <memory>
+#include <vector>
+#include "types.h"
+#include "emu_opcodes.h"
+#include "emu_versions.h"
+
+class EQApplicationPacket;
+class StructStrategy;
+
+// Broadcast packets are handed to every client in range; without this each EQStreamProxy runs its patch encoder
+// once per recipient. The cache encodes the source packet once per struct strategy (client version) and every
+// other stream of that version queues the already translated packets.
+class EncodedPacketCache {
+public:
+	struct EncodedPacket {
+		std::shared_ptr<EQApplicationPacket> packet;
+		bool                                 ack_req;
+	};
+
+	struct Stats {
+		uint64 encodes = 0;
+		uint64 reuses  = 0; // encodes saved by handing out a cached result
+	};
+
+	EncodedPacketCache(const EQApplicationPacket *source, bool ack_req);
+
+	inline const EQApplicationPacket *GetSource() const { return m_source; }
+	inline bool IsAckRequired() const { return m_ack_req; }
+
+	const std::vector<EncodedPacket> &GetEncoded(const StructStrategy *structs);
+
+	static const Stats &GetStats(EmuOpcode op);
+	static void ResetStats();
+
+private:
+	struct Entry {
+		const StructStrategy       *structs = nullptr;
+		std::vector<EncodedPacket> packets;
+	};
+
+	const EQApplicationPacket                          *m_source;
+	bool                                               m_ack_req;
+	std::array<Entry, EQ::versions::ClientVersionCount> m_encoded;
+	size_t                                             m_encoded_count = 0;
+
+	static std::array<Stats, _maxEmuOpcode> s_stats;
+};
+
+#endif //EQEMU_ENCODED_PACKET_CACHE_H
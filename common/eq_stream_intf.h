@@ -6,6 +6,7 @@
 #include <string>
 #include "emu_versions.h"
 #include "eq_packet.h"
+#include "encoded_packet_cache.h"
 #include "net/daybreak_connection.h"
 
 typedef enum {
@@ -87,6 +88,8 @@ public:
 
 	virtual void QueuePacket(const EQApplicationPacket *p, bool ack_req=true) = 0;
 	virtual void FastQueuePacket(EQApplicationPacket **p, bool ack_req=true) = 0;
+	//queues a packet that is being broadcast, streams which translate per client version may share the encode
+	virtual void QueueCachedPacket(EncodedPacketCache &cache) { QueuePacket(cache.GetSource(), cache.IsAckRequired()); }
 	virtual EQApplicationPacket *PopPacket() = 0;
 	virtual void Close() = 0;
 	virtual void ReleaseFromUse() = 0;
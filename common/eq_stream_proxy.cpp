@@ -52,6 +52,13 @@ void EQStreamProxy::FastQueuePacket(EQApplicationPacket **p, bool ack_req) {
 	m_structs->Encode(p, m_stream, ack_req);
 }
 
+void EQStreamProxy::QueueCachedPacket(EncodedPacketCache &cache) {
+	//the encoded packets are shared with every other stream of our version, the stream copies them on queue
+	for (const auto &e : cache.GetEncoded(m_structs)) {
+		m_stream->QueuePacket(e.packet.get(), e.ack_req);
+	}
+}
+
 EQApplicationPacket *EQStreamProxy::PopPacket() {
 	EQApplicationPacket *pack = m_stream->PopPacket();
 	if(pack == nullptr)
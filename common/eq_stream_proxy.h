@@ -19,6 +19,7 @@ public:
 	//EQStreamInterface:
 	virtual void QueuePacket(const EQApplicationPacket *p, bool ack_req=true);
 	virtual void FastQueuePacket(EQApplicationPacket **p, bool ack_req=true);
+	virtual void QueueCachedPacket(EncodedPacketCache &cache);
 	virtual EQApplicationPacket *PopPacket();
 	virtual void Close();
 	virtual std::string GetRemoteAddr() const;
@@ -0,0 +1,200 @@
+#include "timer_wheel.h"
+
+EQ::TimerWheel::Entry::~Entry()
+{
+	if (m_wheel) {
+		m_wheel->Cancel(this);
+	}
+}
+
+EQ::TimerWheel::List::List()
+{
+	head.m_prev = &head;
+	head.m_next = &head;
+}
+
+EQ::TimerWheel::TimerWheel() = default;
+
+EQ::TimerWheel::~TimerWheel()
+{
+	// entries outliving the wheel must not try to unlink themselves from it later
+	auto release = [](List &list) {
+		while (!list.Empty()) {
+			Entry *e = list.head.m_next;
+			Unlink(e);
+			e->m_wheel = nullptr;
+		}
+	};
+
+	for (auto &level: m_slots) {
+		for (auto &slot: level) {
+			release(slot);
+		}
+	}
+
+	release(m_due);
+}
+
+void EQ::TimerWheel::Schedule(Entry *e, uint32 delay_ms)
+{
+	if (e->m_wheel) {
+		e->m_wheel->Cancel(e);
+	}
+
+	e->m_wheel   = this;
+	e->m_expires = m_frame + delay_ms;
+	m_size++;
+
+	if (delay_ms == 0) {
+		Link(m_due, e);
+		return;
+	}
+
+	Insert(e);
+}
+
+void EQ::TimerWheel::Cancel(Entry *e)
+{
+	if (e->m_wheel != this) {
+		return;
+	}
+
+	Unlink(e);
+	e->m_wheel = nullptr;
+	m_size--;
+}
+
+size_t EQ::TimerWheel::Advance(uint32 now_ms)
+{
+	if (!m_initialized) {
+		m_last_ms     = now_ms;
+		m_initialized = true;
+	}
+
+	// unsigned difference so the wrapping millisecond clock is handled
+	const uint32 elapsed = now_ms - m_last_ms;
+	m_last_ms = now_ms;
+
+	// entries scheduled from callbacks are relative to the new frame time, not the tick being expired
+	m_frame = m_now + elapsed;
+
+	size_t expired = Expire(m_due);
+
+	while (m_now < m_frame) {
+		if (m_size == 0) {
+			m_now = m_frame;
+			break;
+		}
+
+		m_now++;
+
+		const auto index = static_cast<uint32>(m_now & SLOT_MASK);
+
+		// level 0 wrapped, pull the next slot of each higher level down for as far as the carry goes
+		if (index == 0) {
+			for (int level = 1; level < LEVELS; ++level) {
+				const auto level_index = static_cast<uint32>((m_now >> (level * SLOT_BITS)) & SLOT_MASK);
+				Cascade(level, level_index);
+				if (level_index != 0) {
+					break;
+				}
+			}
+		}
+
+		expired += Expire(m_slots[0][index]);
+	}
+
+	return expired;
+}
+
+void EQ::TimerWheel::Insert(Entry *e)
+{
+	const uint64 delta = e->m_expires - m_now;
+
+	for (int level = 0; level < LEVELS; ++level) {
+		const int shift = level * SLOT_BITS;
+
+		// within this level's span the slot is never reached before the entry is due, see Cascade()
+		if (delta < (static_cast<uint64>(1) << (shift + SLOT_BITS)) || level == LEVELS - 1) {
+			Link(m_slots[level][(e->m_expires >> shift) & SLOT_MASK], e);
+			return;
+		}
+	}
+}
+
+void EQ::TimerWheel::Cascade(int level, uint32 index)
+{
+	// everything in the slot is due within the span of the levels below, so each entry lands lower down
+	List pending;
+	Splice(m_slots[level][index], pending);
+
+	while (!pending.Empty()) {
+		Entry *e = pending.head.m_next;
+		Unlink(e);
+
+		// due this very tick, lands in the level 0 slot that is expired right after the cascade
+		if (e->m_expires < m_now) {
+			e->m_expires = m_now;
+		}
+
+		Insert(e);
+	}
+}
+
+size_t EQ::TimerWheel::Expire(List &list)
+{
+	if (list.Empty()) {
+		return 0;
+	}
+
+	// detach first, callbacks are free to schedule or cancel anything (including entries still in this batch)
+	List fired;
+	Splice(list, fired);
+
+	size_t expired = 0;
+	while (!fired.Empty()) {
+		Entry *e = fired.head.m_next;
+		Unlink(e);
+		e->m_wheel = nullptr;
+		m_size--;
+		expired++;
+
+		e->OnExpire();
+	}
+
+	return expired;
+}
+
+void EQ::TimerWheel::Link(List &list, Entry *e)
+{
+	e->m_prev                = list.head.m_prev;
+	e->m_next                = &list.head;
+	list.head.m_prev->m_next = e;
+	list.head.m_prev         = e;
+}
+
+void EQ::TimerWheel::Unlink(Entry *e)
+{
+	e->m_prev->m_next = e->m_next;
+	e->m_next->m_prev = e->m_prev;
+	e->m_prev         = nullptr;
+	e->m_next         = nullptr;
+}
+
+void EQ::TimerWheel::Splice(List &from, List &to)
+{
+	if (from.Empty()) {
+		return;
+	}
+
+	Entry *first = from.head.m_next;
+	Entry *last  = from.head.m_prev;
+
+	first->m_prev          = to.head.m_prev;
+	to.head.m_prev->m_next = first;
+	last->m_next           = &to.head;
+	to.head.m_prev         = last;
+
+	from.head.m_next = &from.head;
+	from.head.m_prev = &from.head;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "../types.h"
+#include <cstddef>
+
+namespace EQ
+{
+	// Hierarchical timing wheel, millisecond resolution
+	//
+	// Four levels of 256 slots cover the full uint32 range of delays. Advancing only visits the level 0 slot for each
+	// elapsed millisecond and cascades a higher level slot down when the level below wraps, so the cost of a frame is
+	// bound by elapsed time and the number of entries that actually expire, not by how many are scheduled.
+	//
+	// Entries are intrusive, scheduling and cancelling never allocate. The wheel is per thread (like EventLoop) and is
+	// advanced by whoever owns the thread's frame, the zone advances it right after Timer::SetCurrentTime().
+	class TimerWheel
+	{
+	public:
+		class Entry
+		{
+		public:
+			Entry() = default;
+			Entry(const Entry &) = delete;
+			Entry &operator=(const Entry &) = delete;
+			virtual ~Entry();
+
+			inline bool IsScheduled() const { return m_wheel != nullptr; }
+
+		protected:
+			// runs on the owning thread during Advance(), the entry is already unscheduled and may schedule itself again
+			virtual void OnExpire() = 0;
+
+		private:
+			friend class TimerWheel;
+
+			Entry      *m_prev    = nullptr;
+			Entry      *m_next    = nullptr;
+			uint64     m_expires  = 0;
+			TimerWheel *m_wheel   = nullptr;
+		};
+
+		static TimerWheel &Get() {
+			static thread_local TimerWheel inst;
+			return inst;
+		}
+
+		TimerWheel();
+		TimerWheel(const TimerWheel &) = delete;
+		TimerWheel &operator=(const TimerWheel &) = delete;
+		~TimerWheel();
+
+		// expires delay_ms after the time last passed to Advance(), a delay of 0 expires on the next Advance()
+		void Schedule(Entry *e, uint32 delay_ms);
+		void Cancel(Entry *e);
+
+		// advances to now_ms (wrapping millisecond clock, e.g. Timer::GetCurrentTime()), returns entries expired
+		size_t Advance(uint32 now_ms);
+
+		inline uint64 GetTime() const { return m_now; }
+		inline size_t Size() const { return m_size; }
+
+	private:
+		static const int    LEVELS     = 4;
+		static const int    SLOT_BITS  = 8;
+		static const uint32 SLOTS      = 1u << SLOT_BITS;
+		static const uint32 SLOT_MASK  = SLOTS - 1;
+
+		struct Sentinel : Entry {
+			void OnExpire() override { }
+		};
+
+		// circular list with a sentinel head, an empty slot points at itself
+		struct List {
+			Sentinel head;
+			List();
+			inline bool Empty() const { return head.m_next == &head; }
+		};
+
+		void Insert(Entry *e);
+		void Cascade(int level, uint32 index);
+		size_t Expire(List &list);
+
+		static void Link(List &list, Entry *e);
+		static void Unlink(Entry *e);
+		static void Splice(List &from, List &to);
+
+		List   m_slots[LEVELS][SLOTS];
+		List   m_due;
+		uint64 m_now         = 0; // last tick expired
+		uint64 m_frame       = 0; // time last passed to Advance()
+		uint32 m_last_ms     = 0;
+		bool   m_initialized = false;
+		size_t m_size        = 0;
+	};
+}
@@ -12,21 +12,30 @@ constexpr size_t MAX_CLIENT_RECV_BYTES_PER_WINDOW   = 140 * 1024;
 // buffer pools
 SendBufferPool send_buffer_pool;
 
+// recvmmsg reads into 64KB slots, this is 16 datagrams per syscall
+constexpr size_t RECV_MMSG_BUFFER_SIZE = 16 * 65536;
+
 EQ::Net::DaybreakConnectionManager::DaybreakConnectionManager()
+	: m_send_batch(send_buffer_pool)
 {
 	m_attached = nullptr;
 	memset(&m_timer, 0, sizeof(uv_timer_t));
 	memset(&m_socket, 0, sizeof(uv_udp_t));
+	memset(&m_flush_prepare, 0, sizeof(uv_prepare_t));
+	memset(&m_flush_check, 0, sizeof(uv_check_t));
 
 	Attach(EQ::EventLoop::Get().Handle());
 }
 
 EQ::Net::DaybreakConnectionManager::DaybreakConnectionManager(const DaybreakConnectionManagerOptions &opts)
+	: m_send_batch(send_buffer_pool)
 {
 	m_attached = nullptr;
 	m_options = opts;
 	memset(&m_timer, 0, sizeof(uv_timer_t));
 	memset(&m_socket, 0, sizeof(uv_udp_t));
+	memset(&m_flush_prepare, 0, sizeof(uv_prepare_t));
+	memset(&m_flush_check, 0, sizeof(uv_check_t));
 
 	Attach(EQ::EventLoop::Get().Handle());
 }
@@ -51,7 +60,13 @@ void EQ::Net::DaybreakConnectionManager::Attach(uv_loop_t *loop)
 			c->ProcessResend();
 		}, update_rate, update_rate);
 
-		uv_udp_init(loop, &m_socket);
+		if (m_options.batch_recv) {
+			uv_udp_init_ex(loop, &m_socket, AF_INET | UV_UDP_RECVMMSG);
+		}
+		else {
+			uv_udp_init(loop, &m_socket);
+		}
+
 		m_socket.data = this;
 		struct sockaddr_in recv_addr;
 		uv_ip4_addr("0.0.0.0", m_options.port, &recv_addr);
@@ -60,6 +75,16 @@ void EQ::Net::DaybreakConnectionManager::Attach(uv_loop_t *loop)
 		rc = uv_udp_recv_start(
 			&m_socket,
 			[](uv_handle_t *handle, size_t suggested_size, uv_buf_t *buf) {
+				DaybreakConnectionManager *c = (DaybreakConnectionManager*)handle->data;
+
+				// libuv only uses recvmmsg when handed room for several datagrams, it splits this into 64KB slots
+				if (c->m_options.batch_recv) {
+					static thread_local std::unique_ptr<char[]> mmsg_buf(new char[RECV_MMSG_BUFFER_SIZE]);
+					buf->base = mmsg_buf.get();
+					buf->len  = RECV_MMSG_BUFFER_SIZE;
+					return;
+				}
+
 				if (suggested_size > 65536) {
 					buf->base = new char[suggested_size];
 					buf->len  = suggested_size;
@@ -81,11 +106,35 @@ void EQ::Net::DaybreakConnectionManager::Attach(uv_loop_t *loop)
 			auto port = ntohs(((const sockaddr_in*)addr)->sin_port);
 			c->ProcessPacket(endpoint, port, buf->base, nread);
 
-			if (buf->len > 65536) {
+			if (buf->len > 65536 && !c->m_options.batch_recv) {
 				delete[] buf->base;
 			}
 		});
 
+		// flush once after the timers (zone frame, resends) ran and once after the received packets were handled
+		if (m_options.batch_send) {
+			uv_prepare_init(loop, &m_flush_prepare);
+			m_flush_prepare.data = this;
+			uv_prepare_start(&m_flush_prepare, [](uv_prepare_t *handle) {
+				DaybreakConnectionManager *c = (DaybreakConnectionManager*)handle->data;
+				if (c->m_send_batch.Empty()) {
+					return;
+				}
+
+				c->FlushSendBatch();
+
+				// sendmmsg completes inline, there are no send callbacks pending to wake the loop like uv_udp_send
+				// leaves behind, so refresh the loop clock or the poll timeout is still measured from before the frame
+				uv_update_time(handle->loop);
+			});
+
+			uv_check_init(loop, &m_flush_check);
+			m_flush_check.data = this;
+			uv_check_start(&m_flush_check, [](uv_check_t *handle) {
+				((DaybreakConnectionManager*)handle->data)->FlushSendBatch();
+			});
+		}
+
 		m_attached = loop;
 	}
 }
@@ -93,6 +142,12 @@ void EQ::Net::DaybreakConnectionManager::Attach(uv_loop_t *loop)
 void EQ::Net::DaybreakConnectionManager::Detach()
 {
 	if (m_attached) {
+		if (m_options.batch_send) {
+			FlushSendBatch();
+			uv_prepare_stop(&m_flush_prepare);
+			uv_check_stop(&m_flush_check);
+		}
+
 		uv_udp_recv_stop(&m_socket);
 		uv_timer_stop(&m_timer);
 		m_attached = nullptr;
@@ -283,20 +338,66 @@ void EQ::Net::DaybreakConnectionManager::SendDisconnect(const std::string &addr,
 	DynamicPacket out;
 	out.PutSerialize(0, header);
 
-	uv_udp_send_t *send_req = new uv_udp_send_t;
-	sockaddr_in send_addr;
+	auto pooled_opt = send_buffer_pool.acquire();
+	if (!pooled_opt) {
+		return;
+	}
+
+	auto [send_req, data, ctx] = *pooled_opt;
+
+	sockaddr_in send_addr{};
 	uv_ip4_addr(addr.c_str(), port, &send_addr);
-	uv_buf_t send_buffers[1];
 
-	char *data = new char[out.Length()];
 	memcpy(data, out.Data(), out.Length());
-	send_buffers[0] = uv_buf_init(data, out.Length());
-	send_req->data = send_buffers[0].base;
-	int ret = uv_udp_send(send_req, &m_socket, send_buffers, 1, (sockaddr*)&send_addr,
-		[](uv_udp_send_t* req, int status) {
-		delete[](char*)req->data;
-		delete req;
-	});
+	SendDatagram(send_req, data, ctx, out.Length(), send_addr);
+}
+
+void EQ::Net::DaybreakConnectionManager::SendDatagram(
+	uv_udp_send_t *req,
+	char *data,
+	EmbeddedContext *ctx,
+	size_t length,
+	const sockaddr_in &addr
+)
+{
+	if (m_options.batch_send && m_attached) {
+		m_send_batch.Push(req, data, ctx, length, addr);
+		if (m_send_batch.Full()) {
+			FlushSendBatch();
+		}
+
+		return;
+	}
+
+	uv_buf_t send_buffers[1];
+	send_buffers[0] = uv_buf_init(data, length);
+
+	int send_result = uv_udp_send(
+		req, &m_socket, send_buffers, 1, (const sockaddr *)&addr,
+		[](uv_udp_send_t *req, int status) {
+			auto *ctx = reinterpret_cast<EmbeddedContext *>(req->data);
+			if (!ctx) {
+				std::cerr << "Error: send_req->data is null in callback!" << std::endl;
+				return;
+			}
+
+			if (status < 0) {
+				std::cerr << "uv_udp_send failed: " << uv_strerror(status) << std::endl;
+			}
+
+			ctx->pool->release(ctx);
+		}
+	);
+
+	if (send_result < 0) {
+		std::cerr << "uv_udp_send() failed: " << uv_strerror(send_result) << std::endl;
+		ctx->pool->release(ctx);
+	}
+}
+
+void EQ::Net::DaybreakConnectionManager::FlushSendBatch()
+{
+	m_send_batch.Flush(&m_socket);
 }
 
 //new connection made as server
@@ -1367,7 +1468,7 @@ void EQ::Net::DaybreakConnection::InternalSend(Packet &p) {
 
 	sockaddr_in send_addr{};
 	uv_ip4_addr(m_endpoint.c_str(), m_port, &send_addr);
-	uv_buf_t send_buffers[1];
+	size_t length;
 
 	if (PacketCanBeEncoded(p)) {
 		m_stats.bytes_before_encode += p.Length();
@@ -1398,10 +1499,10 @@ void EQ::Net::DaybreakConnection::InternalSend(Packet &p) {
 
 		AppendCRC(out);
 		memcpy(data, out.Data(), out.Length());
-		send_buffers[0] = uv_buf_init(data, out.Length());
+		length = out.Length();
 	} else {
 		memcpy(data, p.Data(), p.Length());
-		send_buffers[0] = uv_buf_init(data, p.Length());
+		length = p.Length();
 	}
 
 	m_stats.sent_bytes += p.Length();
@@ -1413,27 +1514,7 @@ void EQ::Net::DaybreakConnection::InternalSend(Packet &p) {
 		return;
 	}
 
-	int send_result = uv_udp_send(
-		send_req, &m_owner->m_socket, send_buffers, 1, (sockaddr *)&send_addr,
-		[](uv_udp_send_t *req, int status) {
-			auto *ctx = reinterpret_cast<EmbeddedContext *>(req->data);
-			if (!ctx) {
-				std::cerr << "Error: send_req->data is null in callback!" << std::endl;
-				return;
-			}
-
-			if (status < 0) {
-				std::cerr << "uv_udp_send failed: " << uv_strerror(status) << std::endl;
-			}
-
-			ctx->pool->release(ctx);
-		}
-	);
-
-	if (send_result < 0) {
-		std::cerr << "uv_udp_send() failed: " << uv_strerror(send_result) << std::endl;
-		send_buffer_pool.release(ctx);
-	}
+	m_owner->SendDatagram(send_req, data, ctx, length, send_addr);
 }
 
 void EQ::Net::DaybreakConnection::InternalQueuePacket(Packet &p, int stream_id, bool reliable)
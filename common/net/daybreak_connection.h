@@ -278,6 +278,8 @@ namespace EQ
 				resend_timeout = 30000;
 				connection_close_time = 2000;
 				outgoing_data_rate = 0.0;
+				batch_send = false;
+				batch_recv = false;
 			}
 
 			size_t max_packet_size;
@@ -301,6 +303,8 @@ namespace EQ
 			DaybreakEncodeType encode_passes[2];
 			int port;
 			double outgoing_data_rate;
+			bool batch_send; // flush a loop iteration's datagrams together (sendmmsg on linux)
+			bool batch_recv; // read with recvmmsg where libuv supports it
 		};
 
 		class DaybreakConnectionManager
@@ -320,6 +324,7 @@ namespace EQ
 			void OnErrorMessage(std::function<void(const std::string&)> func) { m_on_error_message = func; }
 
 			DaybreakConnectionManagerOptions& GetOptions() { return m_options; }
+			const SendBatchStats& GetSendBatchStats() const { return m_send_batch.GetStats(); }
 		private:
 			void Attach(uv_loop_t *loop);
 			void Detach();
@@ -331,6 +336,9 @@ namespace EQ
 			EQ::Random m_rand;
 			uv_timer_t m_timer;
 			uv_udp_t m_socket;
+			uv_prepare_t m_flush_prepare;
+			uv_check_t m_flush_check;
+			SendBatch m_send_batch;
 			uv_loop_t *m_attached;
 			DaybreakConnectionManagerOptions m_options;
 			std::function<void(std::shared_ptr<DaybreakConnection>)> m_on_new_connection;
@@ -342,6 +350,8 @@ namespace EQ
 			void ProcessPacket(const std::string &endpoint, int port, const char *data, size_t size);
 			std::shared_ptr<DaybreakConnection> FindConnectionByEndpoint(std::string addr, int port);
 			void SendDisconnect(const std::string &addr, int port);
+			void SendDatagram(uv_udp_send_t *req, char *data, EmbeddedContext *ctx, size_t length, const sockaddr_in &addr);
+			void FlushSendBatch();
 
 			friend class DaybreakConnection;
 		};
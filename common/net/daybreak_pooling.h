@@ -7,9 +7,16 @@
 #include <vector>
 #include <mutex>
 #include <iostream>
+#include <algorithm>
+#include <cstring>
 #include "../eqemu_logsys.h"
 #include <uv.h>
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <cerrno>
+#endif
+
 constexpr size_t UDP_BUFFER_SIZE = 512;
 
 struct EmbeddedContext {
@@ -121,3 +128,142 @@ private:
 		return std::nullopt;
 	}
 };
+
+struct SendBatchStats {
+	uint64_t datagrams = 0;
+	uint64_t syscalls  = 0;
+	uint64_t fallbacks = 0;
+};
+
+// Collects pooled datagrams for one socket and writes them out together.
+//
+// On Linux the batch goes out through sendmmsg(), one syscall for up to MAX_MMSG datagrams. Anything the kernel does not
+// take right away (full socket buffer) and everything on other platforms falls back to uv_udp_send() in order, and the
+// direct path is skipped while libuv still has sends queued so datagrams never overtake each other.
+// Only used from the loop thread that owns the socket.
+class SendBatch {
+public:
+	static constexpr size_t MAX_MMSG = 64;
+
+	explicit SendBatch(SendBufferPool &pool) : m_pool(pool)
+	{
+		m_pending.reserve(MAX_MMSG);
+	}
+
+	~SendBatch()
+	{
+		for (auto &e: m_pending) {
+			m_pool.release(e.ctx);
+		}
+	}
+
+	// data must be the buffer acquired together with req and ctx
+	void Push(uv_udp_send_t *req, char *data, EmbeddedContext *ctx, size_t length, const sockaddr_in &addr)
+	{
+		m_pending.push_back(Pending{req, data, ctx, length, addr});
+	}
+
+	bool Empty() const { return m_pending.empty(); }
+	bool Full() const { return m_pending.size() >= MAX_MMSG; }
+	const SendBatchStats &GetStats() const { return m_stats; }
+
+	void Flush(uv_udp_t *socket)
+	{
+		if (m_pending.empty()) {
+			return;
+		}
+
+		size_t sent = 0;
+
+#if defined(__linux__)
+		uv_os_fd_t fd;
+		if (uv_udp_get_send_queue_count(socket) == 0 && uv_fileno((uv_handle_t *) socket, &fd) == 0) {
+			while (sent < m_pending.size()) {
+				const size_t count = std::min(m_pending.size() - sent, MAX_MMSG);
+
+				for (size_t i = 0; i < count; ++i) {
+					auto &e = m_pending[sent + i];
+					m_iov[i].iov_base = e.data;
+					m_iov[i].iov_len  = e.length;
+
+					m_msgs[i]                     = mmsghdr{};
+					m_msgs[i].msg_hdr.msg_name    = &e.addr;
+					m_msgs[i].msg_hdr.msg_namelen = sizeof(e.addr);
+					m_msgs[i].msg_hdr.msg_iov     = &m_iov[i];
+					m_msgs[i].msg_hdr.msg_iovlen  = 1;
+				}
+
+				int rc;
+				do {
+					rc = sendmmsg(fd, m_msgs.data(), (unsigned int) count, MSG_DONTWAIT);
+				} while (rc < 0 && errno == EINTR);
+
+				m_stats.syscalls++;
+
+				if (rc <= 0) {
+					if (rc < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+						LogNetClient("[SendBatch] sendmmsg failed [{}], falling back", strerror(errno));
+					}
+					break;
+				}
+
+				for (int i = 0; i < rc; ++i) {
+					m_pool.release(m_pending[sent + i].ctx);
+				}
+
+				sent += rc;
+				m_stats.datagrams += rc;
+			}
+		}
+#endif
+
+		// whatever is left is handed to libuv, which queues it until the socket is writable
+		for (size_t i = sent; i < m_pending.size(); ++i) {
+			auto     &e  = m_pending[i];
+			uv_buf_t buf = uv_buf_init(e.data, (unsigned int) e.length);
+
+			m_stats.fallbacks++;
+			m_stats.datagrams++;
+
+			int rc = uv_udp_send(e.req, socket, &buf, 1, (const sockaddr *) &e.addr, &SendBatch::OnSendComplete);
+			if (rc < 0) {
+				LogNetClient("[SendBatch] uv_udp_send failed [{}]", uv_strerror(rc));
+				m_pool.release(e.ctx);
+			}
+		}
+
+		m_pending.clear();
+	}
+
+	static void OnSendComplete(uv_udp_send_t *req, int status)
+	{
+		auto *ctx = reinterpret_cast<EmbeddedContext *>(req->data);
+		if (!ctx) {
+			return;
+		}
+
+		if (status < 0) {
+			LogNetClient("[SendBatch] uv_udp_send completed with error [{}]", uv_strerror(status));
+		}
+
+		ctx->pool->release(ctx);
+	}
+
+private:
+	struct Pending {
+		uv_udp_send_t   *req;
+		char            *data;
+		EmbeddedContext *ctx;
+		size_t          length;
+		sockaddr_in     addr;
+	};
+
+	SendBufferPool       &m_pool;
+	std::vector<Pending> m_pending;
+	SendBatchStats       m_stats;
+
+#if defined(__linux__)
+	std::array<mmsghdr, MAX_MMSG> m_msgs{};
+	std::array<iovec, MAX_MMSG>   m_iov{};
+#endif
+};
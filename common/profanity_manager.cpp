@@ -18,6 +18,7 @@
 */
 
 #include "profanity_manager.h"
+#include "profanity_matcher.h"
 #include "eqemu_logsys.h"
 #include "dbcore.h"
 #include "strings.h"
@@ -28,6 +29,7 @@
 
 
 static std::list<std::string> profanity_list;
+static EQ::ProfanityMatcher profanity_matcher; // rebuilt whenever profanity_list changes
 static bool update_originator_flag = false;
 
 bool EQ::ProfanityManager::LoadProfanityList(DBcore *db) {
@@ -78,6 +80,7 @@ bool EQ::ProfanityManager::AddProfanity(DBcore *db, std::string profanity) {
 	}
 
 	profanity_list.push_back(entry);
+	profanity_matcher.Build(profanity_list);
 
 	auto query = fmt::format(
 		"REPLACE INTO `profanity_list` (`word`) VALUES ('{}')",
@@ -106,6 +109,7 @@ bool EQ::ProfanityManager::RemoveProfanity(DBcore *db, std::string profanity) {
 	}
 
 	profanity_list.remove(entry);
+	profanity_matcher.Build(profanity_list);
 
 	auto query = fmt::format(
 		"DELETE FROM `profanity_list` WHERE `word` = '{}'",
@@ -127,35 +131,14 @@ void EQ::ProfanityManager::RedactMessage(char *message) {
 		return;
 	}
 
-	std::string test_message = Strings::ToLower(message);
+	const size_t length = strlen(message);
 	// hard-coded max length based on channel message buffer size (4096 bytes)..
 	// ..will need to change or remove if other sources are used for redaction
-	if (test_message.length() < REDACTION_LENGTH_MIN || test_message.length() >= 4096) {
+	if (length < REDACTION_LENGTH_MIN || length >= 4096) {
 		return;
 	}
 
-	for (const auto &iter : profanity_list) { // consider adding textlink checks if it becomes an issue
-		size_t pos = 0;
-		size_t start_pos = 0;
-
-		while (pos != std::string::npos) {
-			pos = test_message.find(iter, start_pos);
-			if (pos == std::string::npos) {
-				continue;
-			}
-
-			if (
-				(pos + iter.length()) == test_message.length() ||
-				!isalpha(test_message.at(pos + iter.length()))
-			) {
-				if (pos == 0 || !isalpha(test_message.at(pos - 1))) {
-					memset((message + pos), REDACTION_CHARACTER, iter.length());
-				}
-			}
-
-			start_pos = (pos + iter.length());
-		}
-	}
+	profanity_matcher.Redact(message, length, REDACTION_CHARACTER); // consider adding textlink checks if it becomes an issue
 }
 
 void EQ::ProfanityManager::RedactMessage(std::string &message) {
@@ -163,47 +146,15 @@ void EQ::ProfanityManager::RedactMessage(std::string &message) {
 		return;
 	}
 
-	std::string test_message = Strings::ToLower(message);
-
-	for (const auto &iter : profanity_list) {
-		size_t pos = 0;
-		size_t start_pos = 0;
-
-		while (pos != std::string::npos) {
-			pos = test_message.find(iter, start_pos);
-			if (pos == std::string::npos) {
-				continue;
-			}
-
-			if (
-				(pos + iter.length()) == test_message.length() ||
-				!isalpha(test_message.at(pos + iter.length()))
-			) {
-				if (pos == 0 || !isalpha(test_message.at(pos - 1))) {
-					message.replace(pos, iter.length(), iter.length(), REDACTION_CHARACTER);
-				}
-			}
-
-			start_pos = (pos + iter.length());
-		}
-	}
+	profanity_matcher.Redact(&message[0], message.length(), REDACTION_CHARACTER);
 }
 
-
 bool EQ::ProfanityManager::ContainsCensoredLanguage(const std::string &message) {
 	if (message.length() < REDACTION_LENGTH_MIN || message.length() >= 4096) {
 		return false;
 	}
 
-	std::string test_message = Strings::ToLower(message);
-
-	for (const auto &iter : profanity_list) {
-		if (test_message.find(iter) != std::string::npos) {
-			return true;
-		}
-	}
-
-	return false;
+	return profanity_matcher.Contains(message.data(), message.length());
 }
 
 const std::list<std::string> &EQ::ProfanityManager::GetProfanityList() {
@@ -220,6 +171,7 @@ bool EQ::ProfanityManager::load_database_entries(DBcore *db) {
 	}
 
 	profanity_list.clear();
+	profanity_matcher.Clear();
 
 	std::string query = "SELECT `word` FROM `profanity_list`";
 	auto results = db->QueryDatabase(query);
@@ -236,6 +188,8 @@ bool EQ::ProfanityManager::load_database_entries(DBcore *db) {
 		}
 	}
 
+	profanity_matcher.Build(profanity_list);
+
 	LogInfo("Loaded [{}] profanity entries", Strings::Commify(profanity_list.size()));
 
 	return true;
@@ -247,6 +201,7 @@ bool EQ::ProfanityManager::clear_database_entries(DBcore *db) {
 	}
 
 	profanity_list.clear();
+	profanity_matcher.Clear();
 
 	std::string query = "DELETE FROM `profanity_list`";
 	auto results = db->QueryDatabase(query);
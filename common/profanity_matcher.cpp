@@ -0,0 +1,172 @@
+/*	EQEMu: Everquest Server Emulator
+
+	Copyright (C) 2001-2019 EQEmu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#include "profanity_matcher.h"
+
+#include <ctype.h>
+#include <cstring>
+#include <queue>
+#include <utility>
+
+void EQ::ProfanityMatcher::Build(const std::list<std::string> &entries) {
+	Clear();
+
+	// column 0 is every byte no entry uses, those always lead back to the root
+	uint8 column_by_lower[256] = {};
+	for (const auto &e : entries) {
+		for (const auto &c : e) {
+			auto &column = column_by_lower[static_cast<uint8>(c)];
+			if (!column) {
+				column = static_cast<uint8>(m_columns++);
+			}
+		}
+	}
+
+	for (int b = 0; b < 256; ++b) {
+		m_column_by_byte[b] = column_by_lower[static_cast<uint8>(tolower(b))];
+	}
+
+	m_next.assign(m_columns, 0);
+	m_entry.assign(1, -1);
+
+	for (const auto &e : entries) {
+		if (e.empty()) {
+			continue;
+		}
+
+		uint32 state = 0;
+		for (const auto &c : e) {
+			auto &next = m_next[state * m_columns + column_by_lower[static_cast<uint8>(c)]];
+			if (!next) {
+				next = static_cast<uint32>(m_entry.size());
+				m_entry.push_back(-1);
+				m_next.resize(m_next.size() + m_columns, 0);
+			}
+
+			state = m_next[state * m_columns + column_by_lower[static_cast<uint8>(c)]];
+		}
+
+		if (m_entry[state] < 0) {
+			m_entry[state] = static_cast<int32>(m_lengths.size());
+			m_lengths.push_back(static_cast<uint32>(e.length()));
+		}
+	}
+
+	// breadth first so a state's failure is complete before its children read it, missing transitions are filled
+	// with the failure's so a scan never walks the failure chain
+	std::vector<uint32> failure(m_entry.size(), 0);
+	m_output.assign(m_entry.size(), 0);
+
+	std::queue<uint32> pending;
+	pending.push(0);
+
+	while (!pending.empty()) {
+		const uint32 state = pending.front();
+		pending.pop();
+
+		for (uint32 column = 0; column < m_columns; ++column) {
+			auto &next = m_next[state * m_columns + column];
+			const uint32 fallback = state ? m_next[failure[state] * m_columns + column] : 0;
+
+			if (!next) {
+				next = fallback;
+				continue;
+			}
+
+			failure[next]  = fallback;
+			m_output[next] = m_entry[fallback] >= 0 ? fallback : m_output[fallback];
+			pending.push(next);
+		}
+	}
+}
+
+void EQ::ProfanityMatcher::Clear() {
+	m_columns = 1;
+	memset(m_column_by_byte, 0, sizeof(m_column_by_byte));
+	m_next.clear();
+	m_entry.clear();
+	m_output.clear();
+	m_lengths.clear();
+}
+
+void EQ::ProfanityMatcher::Redact(char *message, size_t length, char redaction) const {
+	if (!message || Empty()) {
+		return;
+	}
+
+	// redacted after the scan, the boundary checks look at the message as it was sent
+	std::vector<std::pair<size_t, uint32>> redactions;
+	std::vector<std::pair<int32, size_t>>  next_start; // entry => where its next occurrence may start
+
+	uint32 state = 0;
+	for (size_t i = 0; i < length; ++i) {
+		state = m_next[state * m_columns + m_column_by_byte[static_cast<uint8>(message[i])]];
+
+		for (uint32 s = m_entry[state] >= 0 ? state : m_output[state]; s; s = m_output[s]) {
+			const int32  entry = m_entry[s];
+			const uint32 len   = m_lengths[entry];
+			const size_t start = i + 1 - len;
+
+			auto it = next_start.begin();
+			while (it != next_start.end() && it->first != entry) {
+				++it;
+			}
+
+			if (it == next_start.end()) {
+				next_start.emplace_back(entry, start + len);
+			}
+			else if (start < it->second) {
+				continue;
+			}
+			else {
+				it->second = start + len;
+			}
+
+			if (i + 1 < length && isalpha(static_cast<uint8>(message[i + 1]))) {
+				continue;
+			}
+
+			if (start > 0 && isalpha(static_cast<uint8>(message[start - 1]))) {
+				continue;
+			}
+
+			redactions.emplace_back(start, len);
+		}
+	}
+
+	for (const auto &r : redactions) {
+		memset(message + r.first, redaction, r.second);
+	}
+}
+
+bool EQ::ProfanityMatcher::Contains(const char *message, size_t length) const {
+	if (!message || Empty()) {
+		return false;
+	}
+
+	uint32 state = 0;
+	for (size_t i = 0; i < length; ++i) {
+		state = m_next[state * m_columns + m_column_by_byte[static_cast<uint8>(message[i])]];
+		if (m_entry[state] >= 0 || m_output[state]) {
+			return true;
+		}
+	}
+
+	return false;
+}
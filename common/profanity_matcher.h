@@ -0,0 +1,63 @@
+/*	EQEMu: Everquest Server Emulator
+
+	Copyright (C) 2001-2019 EQEmu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef COMMON_PROFANITY_MATCHER_H
+#define COMMON_PROFANITY_MATCHER_H
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <vector>
+#include "types.h"
+
+namespace EQ
+{
+	// The profanity list compiled into one Aho-Corasick automaton, a message is checked against every entry in a
+	// single pass over it instead of one search per entry.
+	//
+	// Matching is case insensitive, entries are expected in lower case the way ProfanityManager stores them. Bytes no
+	// entry uses share one column of the transition table, which keeps the table a few columns wide for a list of
+	// plain words.
+	class ProfanityMatcher {
+	public:
+		void Build(const std::list<std::string> &entries);
+		void Clear();
+
+		bool Empty() const { return m_lengths.empty(); }
+		size_t GetStateCount() const { return m_entry.size(); }
+
+		// overwrites every whole word occurrence of an entry, an entry counts when it is not preceded or followed by
+		// a letter; like the search per entry it replaces, an occurrence overlapping an earlier one of the same entry
+		// is skipped
+		void Redact(char *message, size_t length, char redaction) const;
+
+		// any occurrence of any entry, whole word or not
+		bool Contains(const char *message, size_t length) const;
+
+	private:
+		uint32              m_columns = 1;
+		uint8               m_column_by_byte[256] = {};
+		std::vector<uint32> m_next;     // state * m_columns + column => state, failures already folded in
+		std::vector<int32>  m_entry;    // state => entry ending there, -1 for none
+		std::vector<uint32> m_output;   // state => nearest state down its failure chain that ends an entry, 0 for none
+		std::vector<uint32> m_lengths;  // entry => length
+	};
+}
+
+#endif /*COMMON_PROFANITY_MATCHER_H*/
@@ -13,6 +13,7 @@
 #define EQEMU_BASE_ITEMS_REPOSITORY_H
 
 #include "../../database.h"
+#include "../../mysql_stmt.h"
 #include "../../strings.h"
 #include <ctime>
 
@@ -3108,6 +3109,322 @@ public:
 		return all_entries;
 	}
 
+	// same rows as GetWhere over the binary protocol, columns arrive typed instead of as text to parse and each row is
+	// handed to f as it is read instead of collected into a vector
+	template<typename F>
+	static bool StreamWhere(Database& db, const std::string &where_filter, F &&f)
+	{
+		try {
+			auto stmt = db.Prepare(
+				fmt::format(
+					"{} WHERE {}",
+					BaseSelect(),
+					where_filter
+				)
+			);
+
+			stmt.Execute();
+
+			for (auto row = stmt.Fetch(); row; row = stmt.Fetch()) {
+				Items e{};
+
+				e.id                  = row.Get<int32_t>(0).value_or(0);
+				e.minstatus           = row.Get<int16_t>(1).value_or(0);
+				e.Name                = row.GetStr(2).value_or("");
+				e.aagi                = row.Get<int32_t>(3).value_or(0);
+				e.ac                  = row.Get<int32_t>(4).value_or(0);
+				e.accuracy            = row.Get<int32_t>(5).value_or(0);
+				e.acha                = row.Get<int32_t>(6).value_or(0);
+				e.adex                = row.Get<int32_t>(7).value_or(0);
+				e.aint                = row.Get<int32_t>(8).value_or(0);
+				e.artifactflag        = row.Get<uint8_t>(9).value_or(0);
+				e.asta                = row.Get<int32_t>(10).value_or(0);
+				e.astr                = row.Get<int32_t>(11).value_or(0);
+				e.attack              = row.Get<int32_t>(12).value_or(0);
+				e.augrestrict         = row.Get<int32_t>(13).value_or(0);
+				e.augslot1type        = row.Get<int8_t>(14).value_or(0);
+				e.augslot1visible     = row.Get<int8_t>(15).value_or(0);
+				e.augslot2type        = row.Get<int8_t>(16).value_or(0);
+				e.augslot2visible     = row.Get<int8_t>(17).value_or(0);
+				e.augslot3type        = row.Get<int8_t>(18).value_or(0);
+				e.augslot3visible     = row.Get<int8_t>(19).value_or(0);
+				e.augslot4type        = row.Get<int8_t>(20).value_or(0);
+				e.augslot4visible     = row.Get<int8_t>(21).value_or(0);
+				e.augslot5type        = row.Get<int8_t>(22).value_or(0);
+				e.augslot5visible     = row.Get<int8_t>(23).value_or(0);
+				e.augslot6type        = row.Get<int8_t>(24).value_or(0);
+				e.augslot6visible     = row.Get<int8_t>(25).value_or(0);
+				e.augtype             = row.Get<int32_t>(26).value_or(0);
+				e.avoidance           = row.Get<int32_t>(27).value_or(0);
+				e.awis                = row.Get<int32_t>(28).value_or(0);
+				e.bagsize             = row.Get<int32_t>(29).value_or(0);
+				e.bagslots            = row.Get<int32_t>(30).value_or(0);
+				e.bagtype             = row.Get<int32_t>(31).value_or(0);
+				e.bagwr               = row.Get<int32_t>(32).value_or(0);
+				e.banedmgamt          = row.Get<int32_t>(33).value_or(0);
+				e.banedmgraceamt      = row.Get<int32_t>(34).value_or(0);
+				e.banedmgbody         = row.Get<int32_t>(35).value_or(0);
+				e.banedmgrace         = row.Get<int32_t>(36).value_or(0);
+				e.bardtype            = row.Get<int32_t>(37).value_or(0);
+				e.bardvalue           = row.Get<int32_t>(38).value_or(0);
+				e.book                = row.Get<int32_t>(39).value_or(0);
+				e.casttime            = row.Get<int32_t>(40).value_or(0);
+				e.casttime_           = row.Get<int32_t>(41).value_or(0);
+				e.charmfile           = row.GetStr(42).value_or("");
+				e.charmfileid         = row.GetStr(43).value_or("");
+				e.classes             = row.Get<int32_t>(44).value_or(0);
+				e.color               = row.Get<uint32_t>(45).value_or(0);
+				e.combateffects       = row.GetStr(46).value_or("");
+				e.extradmgskill       = row.Get<int32_t>(47).value_or(0);
+				e.extradmgamt         = row.Get<int32_t>(48).value_or(0);
+				e.price               = row.Get<int32_t>(49).value_or(0);
+				e.cr                  = row.Get<int32_t>(50).value_or(0);
+				e.damage              = row.Get<int32_t>(51).value_or(0);
+				e.damageshield        = row.Get<int32_t>(52).value_or(0);
+				e.deity               = row.Get<int32_t>(53).value_or(0);
+				e.delay               = row.Get<int32_t>(54).value_or(0);
+				e.augdistiller        = row.Get<uint32_t>(55).value_or(0);
+				e.dotshielding        = row.Get<int32_t>(56).value_or(0);
+				e.dr                  = row.Get<int32_t>(57).value_or(0);
+				e.clicktype           = row.Get<int32_t>(58).value_or(0);
+				e.clicklevel2         = row.Get<int32_t>(59).value_or(0);
+				e.elemdmgtype         = row.Get<int32_t>(60).value_or(0);
+				e.elemdmgamt          = row.Get<int32_t>(61).value_or(0);
+				e.endur               = row.Get<int32_t>(62).value_or(0);
+				e.factionamt1         = row.Get<int32_t>(63).value_or(0);
+				e.factionamt2         = row.Get<int32_t>(64).value_or(0);
+				e.factionamt3         = row.Get<int32_t>(65).value_or(0);
+				e.factionamt4         = row.Get<int32_t>(66).value_or(0);
+				e.factionmod1         = row.Get<int32_t>(67).value_or(0);
+				e.factionmod2         = row.Get<int32_t>(68).value_or(0);
+				e.factionmod3         = row.Get<int32_t>(69).value_or(0);
+				e.factionmod4         = row.Get<int32_t>(70).value_or(0);
+				e.filename            = row.GetStr(71).value_or("");
+				e.focuseffect         = row.Get<int32_t>(72).value_or(0);
+				e.fr                  = row.Get<int32_t>(73).value_or(0);
+				e.fvnodrop            = row.Get<int32_t>(74).value_or(0);
+				e.haste               = row.Get<int32_t>(75).value_or(0);
+				e.clicklevel          = row.Get<int32_t>(76).value_or(0);
+				e.hp                  = row.Get<int32_t>(77).value_or(0);
+				e.regen               = row.Get<int32_t>(78).value_or(0);
+				e.icon                = row.Get<int32_t>(79).value_or(0);
+				e.idfile              = row.GetStr(80).value_or("");
+				e.itemclass           = row.Get<int32_t>(81).value_or(0);
+				e.itemtype            = row.Get<int32_t>(82).value_or(0);
+				e.ldonprice           = row.Get<int32_t>(83).value_or(0);
+				e.ldontheme           = row.Get<int32_t>(84).value_or(0);
+				e.ldonsold            = row.Get<int32_t>(85).value_or(0);
+				e.light               = row.Get<int32_t>(86).value_or(0);
+				e.lore                = row.GetStr(87).value_or("");
+				e.loregroup           = row.Get<int32_t>(88).value_or(0);
+				e.magic               = row.Get<int32_t>(89).value_or(0);
+				e.mana                = row.Get<int32_t>(90).value_or(0);
+				e.manaregen           = row.Get<int32_t>(91).value_or(0);
+				e.enduranceregen      = row.Get<int32_t>(92).value_or(0);
+				e.material            = row.Get<int32_t>(93).value_or(0);
+				e.herosforgemodel     = row.Get<int32_t>(94).value_or(0);
+				e.maxcharges          = row.Get<int32_t>(95).value_or(0);
+				e.mr                  = row.Get<int32_t>(96).value_or(0);
+				e.nodrop              = row.Get<int32_t>(97).value_or(0);
+				e.norent              = row.Get<int32_t>(98).value_or(0);
+				e.pendingloreflag     = row.Get<uint8_t>(99).value_or(0);
+				e.pr                  = row.Get<int32_t>(100).value_or(0);
+				e.procrate            = row.Get<int32_t>(101).value_or(0);
+				e.races               = row.Get<int32_t>(102).value_or(0);
+				e.range_              = row.Get<int32_t>(103).value_or(0);
+				e.reclevel            = row.Get<int32_t>(104).value_or(0);
+				e.recskill            = row.Get<int32_t>(105).value_or(0);
+				e.reqlevel            = row.Get<int32_t>(106).value_or(0);
+				e.sellrate            = row.Get<float>(107).value_or(0);
+				e.shielding           = row.Get<int32_t>(108).value_or(0);
+				e.size                = row.Get<int32_t>(109).value_or(0);
+				e.skillmodtype        = row.Get<int32_t>(110).value_or(0);
+				e.skillmodvalue       = row.Get<int32_t>(111).value_or(0);
+				e.slots               = row.Get<int32_t>(112).value_or(0);
+				e.clickeffect         = row.Get<int32_t>(113).value_or(0);
+				e.spellshield         = row.Get<int32_t>(114).value_or(0);
+				e.strikethrough       = row.Get<int32_t>(115).value_or(0);
+				e.stunresist          = row.Get<int32_t>(116).value_or(0);
+				e.summonedflag        = row.Get<uint8_t>(117).value_or(0);
+				e.tradeskills         = row.Get<int32_t>(118).value_or(0);
+				e.favor               = row.Get<int32_t>(119).value_or(0);
+				e.weight              = row.Get<int32_t>(120).value_or(0);
+				e.UNK012              = row.Get<int32_t>(121).value_or(0);
+				e.UNK013              = row.Get<int32_t>(122).value_or(0);
+				e.benefitflag         = row.Get<int32_t>(123).value_or(0);
+				e.UNK054              = row.Get<int32_t>(124).value_or(0);
+				e.UNK059              = row.Get<int32_t>(125).value_or(0);
+				e.booktype            = row.Get<int32_t>(126).value_or(0);
+				e.recastdelay         = row.Get<int32_t>(127).value_or(0);
+				e.recasttype          = row.Get<int32_t>(128).value_or(0);
+				e.guildfavor          = row.Get<int32_t>(129).value_or(0);
+				e.UNK123              = row.Get<int32_t>(130).value_or(0);
+				e.UNK124              = row.Get<int32_t>(131).value_or(0);
+				e.attuneable          = row.Get<int32_t>(132).value_or(0);
+				e.nopet               = row.Get<int32_t>(133).value_or(0);
+				e.updated             = row.Get<int64_t>(134).value_or(-1);
+				e.comment             = row.GetStr(135).value_or("");
+				e.UNK127              = row.Get<int32_t>(136).value_or(0);
+				e.pointtype           = row.Get<int32_t>(137).value_or(0);
+				e.potionbelt          = row.Get<int32_t>(138).value_or(0);
+				e.potionbeltslots     = row.Get<int32_t>(139).value_or(0);
+				e.stacksize           = row.Get<int32_t>(140).value_or(0);
+				e.notransfer          = row.Get<int32_t>(141).value_or(0);
+				e.stackable           = row.Get<int32_t>(142).value_or(0);
+				e.UNK134              = row.GetStr(143).value_or("");
+				e.UNK137              = row.Get<int32_t>(144).value_or(0);
+				e.proceffect          = row.Get<int32_t>(145).value_or(0);
+				e.proctype            = row.Get<int32_t>(146).value_or(0);
+				e.proclevel2          = row.Get<int32_t>(147).value_or(0);
+				e.proclevel           = row.Get<int32_t>(148).value_or(0);
+				e.UNK142              = row.Get<int32_t>(149).value_or(0);
+				e.worneffect          = row.Get<int32_t>(150).value_or(0);
+				e.worntype            = row.Get<int32_t>(151).value_or(0);
+				e.wornlevel2          = row.Get<int32_t>(152).value_or(0);
+				e.wornlevel           = row.Get<int32_t>(153).value_or(0);
+				e.UNK147              = row.Get<int32_t>(154).value_or(0);
+				e.focustype           = row.Get<int32_t>(155).value_or(0);
+				e.focuslevel2         = row.Get<int32_t>(156).value_or(0);
+				e.focuslevel          = row.Get<int32_t>(157).value_or(0);
+				e.UNK152              = row.Get<int32_t>(158).value_or(0);
+				e.scrolleffect        = row.Get<int32_t>(159).value_or(0);
+				e.scrolltype          = row.Get<int32_t>(160).value_or(0);
+				e.scrolllevel2        = row.Get<int32_t>(161).value_or(0);
+				e.scrolllevel         = row.Get<int32_t>(162).value_or(0);
+				e.UNK157              = row.Get<int32_t>(163).value_or(0);
+				e.serialized          = row.Get<int64_t>(164).value_or(-1);
+				e.verified            = row.Get<int64_t>(165).value_or(-1);
+				e.serialization       = row.GetStr(166).value_or("");
+				e.source              = row.GetStr(167).value_or("");
+				e.UNK033              = row.Get<int32_t>(168).value_or(0);
+				e.lorefile            = row.GetStr(169).value_or("");
+				e.UNK014              = row.Get<int32_t>(170).value_or(0);
+				e.svcorruption        = row.Get<int32_t>(171).value_or(0);
+				e.skillmodmax         = row.Get<int32_t>(172).value_or(0);
+				e.UNK060              = row.Get<int32_t>(173).value_or(0);
+				e.augslot1unk2        = row.Get<int32_t>(174).value_or(0);
+				e.augslot2unk2        = row.Get<int32_t>(175).value_or(0);
+				e.augslot3unk2        = row.Get<int32_t>(176).value_or(0);
+				e.augslot4unk2        = row.Get<int32_t>(177).value_or(0);
+				e.augslot5unk2        = row.Get<int32_t>(178).value_or(0);
+				e.augslot6unk2        = row.Get<int32_t>(179).value_or(0);
+				e.UNK120              = row.Get<int32_t>(180).value_or(0);
+				e.UNK121              = row.Get<int32_t>(181).value_or(0);
+				e.questitemflag       = row.Get<int32_t>(182).value_or(0);
+				e.UNK132              = row.GetStr(183).value_or("");
+				e.clickunk5           = row.Get<int32_t>(184).value_or(0);
+				e.clickunk6           = row.GetStr(185).value_or("");
+				e.clickunk7           = row.Get<int32_t>(186).value_or(0);
+				e.procunk1            = row.Get<int32_t>(187).value_or(0);
+				e.procunk2            = row.Get<int32_t>(188).value_or(0);
+				e.procunk3            = row.Get<int32_t>(189).value_or(0);
+				e.procunk4            = row.Get<int32_t>(190).value_or(0);
+				e.procunk6            = row.GetStr(191).value_or("");
+				e.procunk7            = row.Get<int32_t>(192).value_or(0);
+				e.wornunk1            = row.Get<int32_t>(193).value_or(0);
+				e.wornunk2            = row.Get<int32_t>(194).value_or(0);
+				e.wornunk3            = row.Get<int32_t>(195).value_or(0);
+				e.wornunk4            = row.Get<int32_t>(196).value_or(0);
+				e.wornunk5            = row.Get<int32_t>(197).value_or(0);
+				e.wornunk6            = row.GetStr(198).value_or("");
+				e.wornunk7            = row.Get<int32_t>(199).value_or(0);
+				e.focusunk1           = row.Get<int32_t>(200).value_or(0);
+				e.focusunk2           = row.Get<int32_t>(201).value_or(0);
+				e.focusunk3           = row.Get<int32_t>(202).value_or(0);
+				e.focusunk4           = row.Get<int32_t>(203).value_or(0);
+				e.focusunk5           = row.Get<int32_t>(204).value_or(0);
+				e.focusunk6           = row.GetStr(205).value_or("");
+				e.focusunk7           = row.Get<int32_t>(206).value_or(0);
+				e.scrollunk1          = row.Get<uint32_t>(207).value_or(0);
+				e.scrollunk2          = row.Get<int32_t>(208).value_or(0);
+				e.scrollunk3          = row.Get<int32_t>(209).value_or(0);
+				e.scrollunk4          = row.Get<int32_t>(210).value_or(0);
+				e.scrollunk5          = row.Get<int32_t>(211).value_or(0);
+				e.scrollunk6          = row.GetStr(212).value_or("");
+				e.scrollunk7          = row.Get<int32_t>(213).value_or(0);
+				e.UNK193              = row.Get<int32_t>(214).value_or(0);
+				e.purity              = row.Get<int32_t>(215).value_or(0);
+				e.evoitem             = row.Get<int32_t>(216).value_or(0);
+				e.evoid               = row.Get<int32_t>(217).value_or(0);
+				e.evolvinglevel       = row.Get<int32_t>(218).value_or(0);
+				e.evomax              = row.Get<int32_t>(219).value_or(0);
+				e.clickname           = row.GetStr(220).value_or("");
+				e.procname            = row.GetStr(221).value_or("");
+				e.wornname            = row.GetStr(222).value_or("");
+				e.focusname           = row.GetStr(223).value_or("");
+				e.scrollname          = row.GetStr(224).value_or("");
+				e.dsmitigation        = row.Get<int16_t>(225).value_or(0);
+				e.heroic_str          = row.Get<int16_t>(226).value_or(0);
+				e.heroic_int          = row.Get<int16_t>(227).value_or(0);
+				e.heroic_wis          = row.Get<int16_t>(228).value_or(0);
+				e.heroic_agi          = row.Get<int16_t>(229).value_or(0);
+				e.heroic_dex          = row.Get<int16_t>(230).value_or(0);
+				e.heroic_sta          = row.Get<int16_t>(231).value_or(0);
+				e.heroic_cha          = row.Get<int16_t>(232).value_or(0);
+				e.heroic_pr           = row.Get<int16_t>(233).value_or(0);
+				e.heroic_dr           = row.Get<int16_t>(234).value_or(0);
+				e.heroic_fr           = row.Get<int16_t>(235).value_or(0);
+				e.heroic_cr           = row.Get<int16_t>(236).value_or(0);
+				e.heroic_mr           = row.Get<int16_t>(237).value_or(0);
+				e.heroic_svcorrup     = row.Get<int16_t>(238).value_or(0);
+				e.healamt             = row.Get<int16_t>(239).value_or(0);
+				e.spelldmg            = row.Get<int16_t>(240).value_or(0);
+				e.clairvoyance        = row.Get<int16_t>(241).value_or(0);
+				e.backstabdmg         = row.Get<int16_t>(242).value_or(0);
+				e.created             = row.GetStr(243).value_or("");
+				e.elitematerial       = row.Get<int16_t>(244).value_or(0);
+				e.ldonsellbackrate    = row.Get<int16_t>(245).value_or(0);
+				e.scriptfileid        = row.Get<int32_t>(246).value_or(0);
+				e.expendablearrow     = row.Get<int16_t>(247).value_or(0);
+				e.powersourcecapacity = row.Get<int32_t>(248).value_or(0);
+				e.bardeffect          = row.Get<int32_t>(249).value_or(0);
+				e.bardeffecttype      = row.Get<int16_t>(250).value_or(0);
+				e.bardlevel2          = row.Get<int16_t>(251).value_or(0);
+				e.bardlevel           = row.Get<int16_t>(252).value_or(0);
+				e.bardunk1            = row.Get<int16_t>(253).value_or(0);
+				e.bardunk2            = row.Get<int16_t>(254).value_or(0);
+				e.bardunk3            = row.Get<int16_t>(255).value_or(0);
+				e.bardunk4            = row.Get<int16_t>(256).value_or(0);
+				e.bardunk5            = row.Get<int16_t>(257).value_or(0);
+				e.bardname            = row.GetStr(258).value_or("");
+				e.bardunk7            = row.Get<int16_t>(259).value_or(0);
+				e.UNK214              = row.Get<int16_t>(260).value_or(0);
+				e.subtype             = row.Get<int32_t>(261).value_or(0);
+				e.UNK220              = row.Get<int32_t>(262).value_or(0);
+				e.UNK221              = row.Get<int32_t>(263).value_or(0);
+				e.heirloom            = row.Get<int32_t>(264).value_or(0);
+				e.UNK223              = row.Get<int32_t>(265).value_or(0);
+				e.UNK224              = row.Get<int32_t>(266).value_or(0);
+				e.UNK225              = row.Get<int32_t>(267).value_or(0);
+				e.UNK226              = row.Get<int32_t>(268).value_or(0);
+				e.UNK227              = row.Get<int32_t>(269).value_or(0);
+				e.UNK228              = row.Get<int32_t>(270).value_or(0);
+				e.UNK229              = row.Get<int32_t>(271).value_or(0);
+				e.UNK230              = row.Get<int32_t>(272).value_or(0);
+				e.UNK231              = row.Get<int32_t>(273).value_or(0);
+				e.UNK232              = row.Get<int32_t>(274).value_or(0);
+				e.UNK233              = row.Get<int32_t>(275).value_or(0);
+				e.UNK234              = row.Get<int32_t>(276).value_or(0);
+				e.placeable           = row.Get<int32_t>(277).value_or(0);
+				e.UNK236              = row.Get<int32_t>(278).value_or(0);
+				e.UNK237              = row.Get<int32_t>(279).value_or(0);
+				e.UNK238              = row.Get<int32_t>(280).value_or(0);
+				e.UNK239              = row.Get<int32_t>(281).value_or(0);
+				e.UNK240              = row.Get<int32_t>(282).value_or(0);
+				e.UNK241              = row.Get<int32_t>(283).value_or(0);
+				e.epicitem            = row.Get<int32_t>(284).value_or(0);
+
+				f(std::move(e));
+			}
+		}
+		catch (const std::exception &) {
+			// the statement has already logged the error
+			return false;
+		}
+
+		return true;
+	}
+
 	static int DeleteWhere(Database& db, const std::string &where_filter)
 	{
 		auto results = db.QueryDatabase(
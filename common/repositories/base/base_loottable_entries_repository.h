@@ -13,6 +13,7 @@
 #define EQEMU_BASE_LOOTTABLE_ENTRIES_REPOSITORY_H
 
 #include "../../database.h"
+#include "../../mysql_stmt.h"
 #include "../../strings.h"
 #include <ctime>
 
@@ -318,6 +319,43 @@ public:
 		return all_entries;
 	}
 
+	// same rows as GetWhere over the binary protocol, columns arrive typed instead of as text to parse and each row is
+	// handed to f as it is read instead of collected into a vector
+	template<typename F>
+	static bool StreamWhere(Database& db, const std::string &where_filter, F &&f)
+	{
+		try {
+			auto stmt = db.Prepare(
+				fmt::format(
+					"{} WHERE {}",
+					BaseSelect(),
+					where_filter
+				)
+			);
+
+			stmt.Execute();
+
+			for (auto row = stmt.Fetch(); row; row = stmt.Fetch()) {
+				LoottableEntries e{};
+
+				e.loottable_id = row.Get<uint32_t>(0).value_or(0);
+				e.lootdrop_id  = row.Get<uint32_t>(1).value_or(0);
+				e.multiplier   = row.Get<uint8_t>(2).value_or(1);
+				e.droplimit    = row.Get<uint8_t>(3).value_or(0);
+				e.mindrop      = row.Get<uint8_t>(4).value_or(0);
+				e.probability  = row.Get<float>(5).value_or(100);
+
+				f(std::move(e));
+			}
+		}
+		catch (const std::exception &) {
+			// the statement has already logged the error
+			return false;
+		}
+
+		return true;
+	}
+
 	static int DeleteWhere(Database& db, const std::string &where_filter)
 	{
 		auto results = db.QueryDatabase(
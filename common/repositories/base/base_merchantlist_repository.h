@@ -13,6 +13,7 @@
 #define EQEMU_BASE_MERCHANTLIST_REPOSITORY_H
 
 #include "../../database.h"
+#include "../../mysql_stmt.h"
 #include "../../strings.h"
 #include <ctime>
 
@@ -428,6 +429,54 @@ public:
 		return all_entries;
 	}
 
+	// same rows as GetWhere over the binary protocol, columns arrive typed instead of as text to parse and each row is
+	// handed to f as it is read instead of collected into a vector
+	template<typename F>
+	static bool StreamWhere(Database& db, const std::string &where_filter, F &&f)
+	{
+		try {
+			auto stmt = db.Prepare(
+				fmt::format(
+					"{} WHERE {}",
+					BaseSelect(),
+					where_filter
+				)
+			);
+
+			stmt.Execute();
+
+			for (auto row = stmt.Fetch(); row; row = stmt.Fetch()) {
+				Merchantlist e{};
+
+				e.merchantid             = row.Get<int32_t>(0).value_or(0);
+				e.slot                   = row.Get<uint32_t>(1).value_or(0);
+				e.item                   = row.Get<int32_t>(2).value_or(0);
+				e.faction_required       = row.Get<int16_t>(3).value_or(-100);
+				e.level_required         = row.Get<uint8_t>(4).value_or(0);
+				e.min_status             = row.Get<uint8_t>(5).value_or(0);
+				e.max_status             = row.Get<uint8_t>(6).value_or(255);
+				e.alt_currency_cost      = row.Get<uint16_t>(7).value_or(0);
+				e.classes_required       = row.Get<int32_t>(8).value_or(65535);
+				e.probability            = row.Get<int32_t>(9).value_or(100);
+				e.bucket_name            = row.GetStr(10).value_or("");
+				e.bucket_value           = row.GetStr(11).value_or("");
+				e.bucket_comparison      = row.Get<uint8_t>(12).value_or(0);
+				e.min_expansion          = row.Get<int8_t>(13).value_or(-1);
+				e.max_expansion          = row.Get<int8_t>(14).value_or(-1);
+				e.content_flags          = row.GetStr(15).value_or("");
+				e.content_flags_disabled = row.GetStr(16).value_or("");
+
+				f(std::move(e));
+			}
+		}
+		catch (const std::exception &) {
+			// the statement has already logged the error
+			return false;
+		}
+
+		return true;
+	}
+
 	static int DeleteWhere(Database& db, const std::string &where_filter)
 	{
 		auto results = db.QueryDatabase(
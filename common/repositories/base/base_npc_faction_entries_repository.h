@@ -13,6 +13,7 @@
 #define EQEMU_BASE_NPC_FACTION_ENTRIES_REPOSITORY_H
 
 #include "../../database.h"
+#include "../../mysql_stmt.h"
 #include "../../strings.h"
 #include <ctime>
 
@@ -308,6 +309,42 @@ public:
 		return all_entries;
 	}
 
+	// same rows as GetWhere over the binary protocol, columns arrive typed instead of as text to parse and each row is
+	// handed to f as it is read instead of collected into a vector
+	template<typename F>
+	static bool StreamWhere(Database& db, const std::string &where_filter, F &&f)
+	{
+		try {
+			auto stmt = db.Prepare(
+				fmt::format(
+					"{} WHERE {}",
+					BaseSelect(),
+					where_filter
+				)
+			);
+
+			stmt.Execute();
+
+			for (auto row = stmt.Fetch(); row; row = stmt.Fetch()) {
+				NpcFactionEntries e{};
+
+				e.npc_faction_id = row.Get<uint32_t>(0).value_or(0);
+				e.faction_id     = row.Get<uint32_t>(1).value_or(0);
+				e.value          = row.Get<int32_t>(2).value_or(0);
+				e.npc_value      = row.Get<int8_t>(3).value_or(0);
+				e.temp           = row.Get<int8_t>(4).value_or(0);
+
+				f(std::move(e));
+			}
+		}
+		catch (const std::exception &) {
+			// the statement has already logged the error
+			return false;
+		}
+
+		return true;
+	}
+
 	static int DeleteWhere(Database& db, const std::string &where_filter)
 	{
 		auto results = db.QueryDatabase(
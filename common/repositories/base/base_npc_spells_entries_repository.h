@@ -13,6 +13,7 @@
 #define EQEMU_BASE_NPC_SPELLS_ENTRIES_REPOSITORY_H
 
 #include "../../database.h"
+#include "../../mysql_stmt.h"
 #include "../../strings.h"
 #include <ctime>
 
@@ -417,6 +418,53 @@ public:
 		return all_entries;
 	}
 
+	// same rows as GetWhere over the binary protocol, columns arrive typed instead of as text to parse and each row is
+	// handed to f as it is read instead of collected into a vector
+	template<typename F>
+	static bool StreamWhere(Database& db, const std::string &where_filter, F &&f)
+	{
+		try {
+			auto stmt = db.Prepare(
+				fmt::format(
+					"{} WHERE {}",
+					BaseSelect(),
+					where_filter
+				)
+			);
+
+			stmt.Execute();
+
+			for (auto row = stmt.Fetch(); row; row = stmt.Fetch()) {
+				NpcSpellsEntries e{};
+
+				e.id                     = row.Get<uint32_t>(0).value_or(0);
+				e.npc_spells_id          = row.Get<int32_t>(1).value_or(0);
+				e.spellid                = row.Get<uint16_t>(2).value_or(0);
+				e.type                   = row.Get<uint32_t>(3).value_or(0);
+				e.minlevel               = row.Get<uint8_t>(4).value_or(0);
+				e.maxlevel               = row.Get<uint8_t>(5).value_or(255);
+				e.manacost               = row.Get<int16_t>(6).value_or(-1);
+				e.recast_delay           = row.Get<int32_t>(7).value_or(-1);
+				e.priority               = row.Get<int16_t>(8).value_or(0);
+				e.resist_adjust          = row.Get<int32_t>(9).value_or(0);
+				e.min_hp                 = row.Get<int16_t>(10).value_or(0);
+				e.max_hp                 = row.Get<int16_t>(11).value_or(0);
+				e.min_expansion          = row.Get<int8_t>(12).value_or(-1);
+				e.max_expansion          = row.Get<int8_t>(13).value_or(-1);
+				e.content_flags          = row.GetStr(14).value_or("");
+				e.content_flags_disabled = row.GetStr(15).value_or("");
+
+				f(std::move(e));
+			}
+		}
+		catch (const std::exception &) {
+			// the statement has already logged the error
+			return false;
+		}
+
+		return true;
+	}
+
 	static int DeleteWhere(Database& db, const std::string &where_filter)
 	{
 		auto results = db.QueryDatabase(
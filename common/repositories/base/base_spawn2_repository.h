@@ -13,6 +13,7 @@
 #define EQEMU_BASE_SPAWN2_REPOSITORY_H
 
 #include "../../database.h"
+#include "../../mysql_stmt.h"
 #include "../../strings.h"
 #include <ctime>
 
@@ -447,6 +448,56 @@ public:
 		return all_entries;
 	}
 
+	// same rows as GetWhere over the binary protocol, columns arrive typed instead of as text to parse and each row is
+	// handed to f as it is read instead of collected into a vector
+	template<typename F>
+	static bool StreamWhere(Database& db, const std::string &where_filter, F &&f)
+	{
+		try {
+			auto stmt = db.Prepare(
+				fmt::format(
+					"{} WHERE {}",
+					BaseSelect(),
+					where_filter
+				)
+			);
+
+			stmt.Execute();
+
+			for (auto row = stmt.Fetch(); row; row = stmt.Fetch()) {
+				Spawn2 e{};
+
+				e.id                     = row.Get<int32_t>(0).value_or(0);
+				e.spawngroupID           = row.Get<int32_t>(1).value_or(0);
+				e.zone                   = row.GetStr(2).value_or("");
+				e.version                = row.Get<int16_t>(3).value_or(0);
+				e.x                      = row.Get<float>(4).value_or(0.000000);
+				e.y                      = row.Get<float>(5).value_or(0.000000);
+				e.z                      = row.Get<float>(6).value_or(0.000000);
+				e.heading                = row.Get<float>(7).value_or(0.000000);
+				e.respawntime            = row.Get<int32_t>(8).value_or(0);
+				e.variance               = row.Get<int32_t>(9).value_or(0);
+				e.pathgrid               = row.Get<int32_t>(10).value_or(0);
+				e.path_when_zone_idle    = row.Get<int8_t>(11).value_or(0);
+				e._condition             = row.Get<uint32_t>(12).value_or(0);
+				e.cond_value             = row.Get<int32_t>(13).value_or(1);
+				e.animation              = row.Get<uint8_t>(14).value_or(0);
+				e.min_expansion          = row.Get<int8_t>(15).value_or(-1);
+				e.max_expansion          = row.Get<int8_t>(16).value_or(-1);
+				e.content_flags          = row.GetStr(17).value_or("");
+				e.content_flags_disabled = row.GetStr(18).value_or("");
+
+				f(std::move(e));
+			}
+		}
+		catch (const std::exception &) {
+			// the statement has already logged the error
+			return false;
+		}
+
+		return true;
+	}
+
 	static int DeleteWhere(Database& db, const std::string &where_filter)
 	{
 		auto results = db.QueryDatabase(
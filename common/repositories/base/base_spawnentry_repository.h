@@ -13,6 +13,7 @@
 #define EQEMU_BASE_SPAWNENTRY_REPOSITORY_H
 
 #include "../../database.h"
+#include "../../mysql_stmt.h"
 #include "../../strings.h"
 #include <ctime>
 
@@ -358,6 +359,47 @@ public:
 		return all_entries;
 	}
 
+	// same rows as GetWhere over the binary protocol, columns arrive typed instead of as text to parse and each row is
+	// handed to f as it is read instead of collected into a vector
+	template<typename F>
+	static bool StreamWhere(Database& db, const std::string &where_filter, F &&f)
+	{
+		try {
+			auto stmt = db.Prepare(
+				fmt::format(
+					"{} WHERE {}",
+					BaseSelect(),
+					where_filter
+				)
+			);
+
+			stmt.Execute();
+
+			for (auto row = stmt.Fetch(); row; row = stmt.Fetch()) {
+				Spawnentry e{};
+
+				e.spawngroupID           = row.Get<int32_t>(0).value_or(0);
+				e.npcID                  = row.Get<int32_t>(1).value_or(0);
+				e.chance                 = row.Get<int16_t>(2).value_or(0);
+				e.condition_value_filter = row.Get<int32_t>(3).value_or(1);
+				e.min_time               = row.Get<int16_t>(4).value_or(0);
+				e.max_time               = row.Get<int16_t>(5).value_or(0);
+				e.min_expansion          = row.Get<int8_t>(6).value_or(-1);
+				e.max_expansion          = row.Get<int8_t>(7).value_or(-1);
+				e.content_flags          = row.GetStr(8).value_or("");
+				e.content_flags_disabled = row.GetStr(9).value_or("");
+
+				f(std::move(e));
+			}
+		}
+		catch (const std::exception &) {
+			// the statement has already logged the error
+			return false;
+		}
+
+		return true;
+	}
+
 	static int DeleteWhere(Database& db, const std::string &where_filter)
 	{
 		auto results = db.QueryDatabase(
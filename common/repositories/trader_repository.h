@@ -314,7 +314,7 @@ public:
 			e.trader.char_zone_id          = row[14] ? static_cast<uint32_t>(strtoul(row[14], nullptr, 10)) : 0;
 			e.trader.char_zone_instance_id = row[15] ? static_cast<int32_t>(atoi(row[15])) : 0;
 			e.trader.active_transaction    = row[16] ? static_cast<uint8_t>(strtoul(row[16], nullptr, 10)) : 0;
-			e.trader_name                  = row[17] ? row[17] : std::string("");
+			e.trader_name                  = row[18] ? row[18] : std::string(""); // row[17] is trader.listing_date
 
 			all_entries.push_back(e);
 		}
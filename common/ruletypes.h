@@ -234,6 +234,7 @@ RULE_BOOL(Character, EnableQuestExperience, true, "Whether or not Quest experien
 RULE_BOOL(Character, EnableHackedFastCampForGM, false, "Enables hacked fast camp for GM clients, if the GM doesn't have a hacked client they'll camp like normal")
 RULE_BOOL(Character, AlwaysAllowNameChange, false, "Enable this option to allow /changename to work without enabling a name change via scripts.")
 RULE_INT(Character, SecondsBeforeAFK, 300, "Seconds before a player is considered AFK")
+RULE_BOOL(Character, ValidateBonusLayers, false, "Recompute every bonus layer from scratch after a partial CalcBonuses and log any difference, the full result is kept. Debugging aid, doubles the cost of CalcBonuses")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Mercs)
@@ -307,6 +308,11 @@ RULE_CATEGORY_END()
 
 RULE_CATEGORY(World)
 RULE_INT(World, ZoneAutobootTimeoutMS, 60000, "Time out for automatic booting of zones in milliseconds")
+RULE_INT(World, WarmZonePoolSize, 0, "Zones world keeps booted ahead of demand on idle zone processes, picked from recent entries for the hour of day. 0 disables the pool")
+RULE_INT(World, WarmZonePoolIdleReserve, 2, "Idle zone processes the warm zone pool always leaves free for zones it did not predict")
+RULE_STRING(World, WarmZonePoolZones, "", "Comma-delimited zone short names the warm zone pool keeps booted before any predicted zone. Example: poknowledge,guildlobby")
+RULE_INT(World, WarmZonePoolHoldSeconds, 3600, "How long a zone the warm zone pool booted is held waiting for its first client before it is released and may be booted again. 0 holds it for as long as the pool predicts it")
+RULE_INT(World, WarmZonePoolInstanceHoldSeconds, 600, "How long the instance of a new dynamic zone is held booted waiting for its first member. 0 disables booting dynamic zone instances ahead of time")
 RULE_BOOL(World, UseBannedIPsTable, false, "Toggle whether or not to check incoming client connections against the banned_ips table. Set this value to false to disable this feature")
 RULE_BOOL(World, EnableTutorialButton, true, "Setting whether the Tutorial button should be active. At least in RoF2 you can always press the button, but it loses its effect")
 RULE_BOOL(World, EnableReturnHomeButton, true, "Setting whether the Return Home button should be active")
@@ -386,6 +392,13 @@ RULE_BOOL(Zone, StateSaveBuffs, true, "Set to true if you want buffs to be saved
 RULE_INT(Zone, StateSaveClearDays, 7, "Clears state save data older than this many days")
 RULE_BOOL(Zone, StateSavingOnShutdown, true, "Set to true if you want zones to save state on shutdown (npcs, corpses, loot, entity variables, buffs etc.)")
 RULE_INT(Zone, UpdateWhoTimer, 120, "Seconds between updates to /who list, CLE stale timer")
+RULE_BOOL(Zone, ParallelAIPrepare, false, "Computes NPC hate targets and line of sight on worker threads before the mob list is processed. Results are applied serially in the usual order")
+RULE_INT(Zone, ParallelAIThreads, 4, "Worker threads used by Zone:ParallelAIPrepare")
+RULE_INT(Zone, ParallelAIMinMobs, 64, "Minimum number of thinking NPCs in a tick before Zone:ParallelAIPrepare hands work to the worker threads")
+RULE_BOOL(Zone, AsyncDatabaseWrites, false, "Commits character currency, binds, buffs and account kill counts on a dedicated connection and worker thread instead of the zone main thread. Read at zone boot")
+RULE_INT(Zone, AsyncDatabaseWriteQueueMax, 10000, "Maximum pending writes for Zone:AsyncDatabaseWrites before saves block until the worker catches up")
+RULE_INT(Zone, AsyncDatabaseWriteStatsInterval, 60, "Seconds between write-behind queue depth and latency reports, 0 to disable")
+RULE_BOOL(Zone, TickProfiler, false, "Records per tick timings of the zone loop phases and hot functions from boot, can also be toggled with #profiler")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Map)
@@ -407,6 +420,10 @@ RULE_BOOL(Pathing, Fear, true, "Enable pathing for fear")
 RULE_REAL(Pathing, NavmeshStepSize, 100.0f, "Step size for the movement manager")
 RULE_REAL(Pathing, ShortMovementUpdateRange, 130.0f, "Range for short movement updates")
 RULE_INT(Pathing, MaxNavmeshNodes, 4092, "Maximum navmesh nodes in a traversable path")
+RULE_INT(Pathing, RouteCacheSize, 2048, "Routes kept in the per zone least recently used route cache, 0 disables the cache")
+RULE_REAL(Pathing, RouteCacheCellSize, 4.0f, "Requests whose start and end points fall in the same cells of this size (and on the same navmesh polys) share a cached route")
+RULE_BOOL(Pathing, AsyncPathRequests, false, "Ground and underwater path searches run on worker threads, mobs keep their current movement until the route is applied on a later tick")
+RULE_INT(Pathing, AsyncPathThreads, 2, "Worker threads used by Pathing:AsyncPathRequests")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Watermap)
@@ -546,6 +563,7 @@ RULE_INT(Spells, PointBlankAOEMaxTargets, 0, "Max number of targets a Point-Blan
 RULE_INT(Spells, DefaultAOEMaxTargets, 0, "Max number of targets that an AOE spell which does not meet other descriptions can cast on. Set to 0 for no limit.")
 RULE_BOOL(Spells, AllowFocusOnSkillDamageSpells, false, "Allow focus effects 185, 459, and 482 to enhance SkillAttack spell effect 193")
 RULE_STRING(Spells, AlwaysStackSpells, "", "Comma-Seperated list of spell IDs to always stack with every other spell, except themselves.")
+RULE_BOOL(Spells, UseFocusCache, true, "Cache the item, AA and worn focus totals of clients and bots per focus type and spell, rebuilt whenever their bonuses are recalculated")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Combat)
@@ -966,6 +984,7 @@ RULE_INT(Bazaar, VoucherDeliveryCost, 200, "Number of vouchers for direct delive
 RULE_BOOL(Bazaar, EnableParcelDelivery, true, "Enable bazaar purchases via parcel delivery.  Default is True.")
 RULE_INT(Bazaar, MaxBuyerInventorySearchResults, 200, "Maximum number of search results when a Buyer searches the global item list. Default is 200. RoF+ Only.")
 RULE_BOOL(Bazaar, UseAlternateBazaarSearch, false, "Allows the bazaar search window to search across bazaar shards. Default is false.")
+RULE_BOOL(Bazaar, UseSearchIndex, true, "Answer bazaar searches from listings held in memory instead of querying the trader and items tables on every search. Default is true.")
 RULE_STRING(Bazaar, ParcelDeliveryCostExemptZones, "", "Comma seperated list of zone IDs to exempt from charging Bazaar Parcel Delivery cost")
 RULE_CATEGORY_END()
 
@@ -1025,6 +1044,7 @@ RULE_INT(Network, ResendDelayMinMS, 300, "Minimum timespan between two send retr
 RULE_INT(Network, ResendDelayMaxMS, 5000, "Maximum timespan between two send retries (milliseconds)")
 RULE_REAL(Network, ClientDataRate, 0.0, "KB / sec, 0.0 disabled")
 RULE_BOOL(Network, CompressZoneStream, true, "Setting whether the zone stream should be compressed for transmission")
+RULE_BOOL(Network, BatchedDatagramIO, false, "Collect outgoing datagrams and flush them once per event loop pass (sendmmsg/recvmmsg on Linux)")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(QueryServ)
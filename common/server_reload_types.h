@@ -37,6 +37,7 @@ namespace ServerReload {
 		StaticZoneData,
 		Tasks,
 		Titles,
+		TradeskillRecipes,
 		Traps,
 		Variables,
 		VeteranRewards,
@@ -78,6 +79,7 @@ namespace ServerReload {
 		"Static Zone Data",
 		"Tasks",
 		"Titles",
+		"Tradeskill Recipes",
 		"Traps",
 		"Variables",
 		"Veteran Rewards",
@@ -141,6 +141,7 @@
 #define ServerOP_TraderMessaging    0x0120
 #define ServerOP_BazaarPurchase     0x0121
 #define ServerOP_BuyerMessaging     0x0122
+#define ServerOP_BazaarListingsChanged 0x0123
 
 #define ServerOP_InstanceUpdateTime			0x014F
 #define ServerOP_AdventureRequest			0x0150
@@ -451,6 +452,7 @@ struct ServerZoneStateChange_Struct {
 	uint32 zone_id;
 	uint16 instance_id;
 	bool   is_static;
+	bool   is_warm; // booted by world ahead of demand, held up while empty until the first client enters
 	char   admin_name[64];
 };
 
@@ -1765,6 +1767,10 @@ struct TraderMessaging_Struct {
 	char   trader_name[64];
 };
 
+struct BazaarListingsChanged_Struct {
+	uint32 char_id;
+};
+
 struct BazaarPurchaseMessaging_Struct {
 	TraderBuy_Struct trader_buy_struct;
 	uint32           item_aug_1;
@@ -1868,7 +1868,12 @@ int SharedDatabase::GetMaxSpellID() {
 	return Strings::ToInt(row[0]);
 }
 
-bool SharedDatabase::LoadSpells(const std::string &prefix, int32 *records, const SPDat_Spell_Struct **sp) {
+bool SharedDatabase::LoadSpells(
+	const std::string &prefix,
+	int32 *records,
+	const SPDat_Spell_Struct **sp,
+	const SPDat_Spell_Traits **traits
+) {
 	spells_mmf.reset(nullptr);
 
 	try {
@@ -1881,6 +1886,17 @@ bool SharedDatabase::LoadSpells(const std::string &prefix, int32 *records, const
 		LogInfo("Loading [{}]", file_name);
 		*records = *static_cast<uint32*>(spells_mmf->Get());
 		*sp = reinterpret_cast<const SPDat_Spell_Struct*>(static_cast<char*>(spells_mmf->Get()) + 4);
+
+		// traits follow the spell records, a file written by an older shared_memory does not have them
+		const size_t traits_offset = sizeof(uint32) + static_cast<size_t>(*records) * sizeof(SPDat_Spell_Struct);
+		if (spells_mmf->Size() >= traits_offset + static_cast<size_t>(*records) * sizeof(SPDat_Spell_Traits)) {
+			*traits = reinterpret_cast<const SPDat_Spell_Traits*>(static_cast<char*>(spells_mmf->Get()) + traits_offset);
+		}
+		else {
+			*traits = nullptr;
+			LogWarning("Shared spells have no precomputed traits, run shared_memory to rebuild them");
+		}
+
 		mutex.Unlock();
 
 		LogInfo("Loaded [{}] spells via shared memory", Strings::Commify(m_shared_spells_count));
@@ -79,11 +79,17 @@
 #include "../common/rulesys.h"
 #include "../common/strings.h"
 
+#include <string.h>
+#include <utility>
+#include <vector>
+
 #ifndef WIN32
 #include <stdlib.h>
 #include "unix.h"
 #endif
 
+const SPDat_Spell_Traits* spell_traits = nullptr;
+
 ///////////////////////////////////////////////////////////////////////////////
 // spell property testing functions
 
@@ -93,6 +99,10 @@ bool IsTargetableAESpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::TargetableAE);
+	}
+
 	return (
 		spells[spell_id].target_type == ST_AETarget ||
 		spells[spell_id].target_type == ST_TargetAETap ||
@@ -114,6 +124,10 @@ bool IsLifetapSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::Lifetap);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	if (
@@ -150,6 +164,10 @@ bool IsSummonSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::Summon);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	for (int i = 0; i < EFFECT_COUNT; i++) {
@@ -172,6 +190,10 @@ bool IsDamageSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::Damage);
+	}
+
 	if (!IsValidSpell(spell_id)) {
 		return false;
 	}
@@ -201,6 +223,10 @@ bool IsAnyDamageSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::AnyDamage);
+	}
+
 	if (IsLifetapSpell(spell_id)) {
 		return false;
 	}
@@ -233,6 +259,10 @@ bool IsDamageOverTimeSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::DamageOverTime);
+	}
+
 	if (IsLifetapSpell(spell_id)) {
 		return false;
 	}
@@ -363,6 +393,10 @@ bool IsBeneficialSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::Beneficial);
+	}
+
 	// You'd think just checking goodEffect flag would be enough?
 	if (spells[spell_id].good_effect == BENEFICIAL_EFFECT) {
 		// If the target type is ST_Self or ST_Pet and is a SE_CancleMagic spell
@@ -570,6 +604,10 @@ bool IsAEDurationSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::AEDuration);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	/*
@@ -597,6 +635,10 @@ bool IsPureNukeSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::PureNuke);
+	}
+
 	auto effect_count = 0;
 
 	for (int i = 0; i < EFFECT_COUNT; i++) {
@@ -623,6 +665,10 @@ bool IsAENukeSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::AENuke);
+	}
+
 	if (
 		IsPureNukeSpell(spell_id) &&
 		spells[spell_id].aoe_range > 0
@@ -639,6 +685,10 @@ bool IsPBAENukeSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::PBAENuke);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	if (
@@ -657,6 +707,10 @@ bool IsAERainNukeSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::AERainNuke);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	if (
@@ -675,6 +729,10 @@ bool IsAnyNukeOrStunSpell(uint16 spell_id) {
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::AnyNukeOrStun);
+	}
+
 	if (IsSelfConversionSpell(spell_id) || IsEscapeSpell(spell_id)) {
 		return false;
 	}
@@ -697,6 +755,10 @@ bool IsAnyAESpell(uint16 spell_id) {
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::AnyAE);
+	}
+
 	return (
 		IsTargetableAESpell(spell_id) ||
 		IsAESpell(spell_id) ||
@@ -714,6 +776,10 @@ bool IsAESpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::AE);
+	}
+
 	switch (spells[spell_id].target_type) {
 		case ST_TargetOptional:
 		case ST_GroupTeleport :
@@ -756,6 +822,10 @@ bool IsPBAESpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::PBAE);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	if (
@@ -774,6 +844,10 @@ bool IsAERainSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::AERain);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	if (
@@ -792,6 +866,10 @@ bool IsPartialResistableSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::PartialResistable);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	if (spell.no_partial_resist) {
@@ -837,6 +915,10 @@ bool IsGroupSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::GroupSpell);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	return (
@@ -871,6 +953,10 @@ bool IsBardSong(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::BardSong);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	if (
@@ -889,6 +975,10 @@ bool IsEffectInSpell(uint16 spell_id, int effect_id)
 		return false;
 	}
 
+	if (spell_traits && effect_id >= 0 && effect_id < SPELL_TRAIT_EFFECT_LIMIT) {
+		return spell_traits[spell_id].HasEffect(effect_id);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	for (int i = 0; i < EFFECT_COUNT; i++) {
@@ -1043,6 +1133,16 @@ int GetSpellEffectIndex(uint16 spell_id, int effect_id)
 		return -1;
 	}
 
+	// most lookups are for an effect the spell does not have, only a present one needs the slots scanned
+	if (
+		spell_traits &&
+		effect_id >= 0 &&
+		effect_id < SPELL_TRAIT_EFFECT_LIMIT &&
+		!spell_traits[spell_id].HasEffect(effect_id)
+	) {
+		return -1;
+	}
+
 	const auto& spell = spells[spell_id];
 
 	for (int i = 0; i < EFFECT_COUNT; i++) {
@@ -2276,6 +2376,10 @@ bool IsTargetRequiredForSpell(uint16 spell_id)
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].Has(SpellTraits::TargetRequired);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	if (
@@ -2806,6 +2910,10 @@ int8 SpellEffectsCount(uint16 spell_id) {
 		return false;
 	}
 
+	if (spell_traits) {
+		return spell_traits[spell_id].effect_count;
+	}
+
 	int8 x = 0;
 
 	for (int i = 0; i < EFFECT_COUNT; i++) {
@@ -3033,3 +3141,69 @@ bool IsDisciplineTome(const EQ::ItemData* item)
 
 	return true;
 }
+
+void BuildSpellTraits(const SPDat_Spell_Struct *sp, int32 records, SPDat_Spell_Traits *traits)
+{
+	// the predicates read the globals, point them at the spells being built and force the scanning path so every
+	// trait is computed by the same code that answers without traits
+	const auto saved_spells  = spells;
+	const auto saved_records = SPDAT_RECORDS;
+	const auto saved_traits  = spell_traits;
+
+	spells        = sp;
+	SPDAT_RECORDS = records;
+	spell_traits  = nullptr;
+
+	const std::vector<std::pair<bool (*)(uint16), uint32>> predicates = {
+		{ IsBeneficialSpell,        SpellTraits::Beneficial },
+		{ IsGroupSpell,             SpellTraits::GroupSpell },
+		{ IsBardSong,               SpellTraits::BardSong },
+		{ IsTargetableAESpell,      SpellTraits::TargetableAE },
+		{ IsAESpell,                SpellTraits::AE },
+		{ IsPBAESpell,              SpellTraits::PBAE },
+		{ IsAERainSpell,            SpellTraits::AERain },
+		{ IsAEDurationSpell,        SpellTraits::AEDuration },
+		{ IsAnyAESpell,             SpellTraits::AnyAE },
+		{ IsPureNukeSpell,          SpellTraits::PureNuke },
+		{ IsAENukeSpell,            SpellTraits::AENuke },
+		{ IsPBAENukeSpell,          SpellTraits::PBAENuke },
+		{ IsAERainNukeSpell,        SpellTraits::AERainNuke },
+		{ IsAnyNukeOrStunSpell,     SpellTraits::AnyNukeOrStun },
+		{ IsPartialResistableSpell, SpellTraits::PartialResistable },
+		{ IsDamageSpell,            SpellTraits::Damage },
+		{ IsAnyDamageSpell,         SpellTraits::AnyDamage },
+		{ IsDamageOverTimeSpell,    SpellTraits::DamageOverTime },
+		{ IsLifetapSpell,           SpellTraits::Lifetap },
+		{ IsSummonSpell,            SpellTraits::Summon },
+		{ IsTargetRequiredForSpell, SpellTraits::TargetRequired },
+	};
+
+	for (int32 spell_id = 0; spell_id < records; ++spell_id) {
+		auto &t = traits[spell_id];
+		memset(&t, 0, sizeof(SPDat_Spell_Traits));
+
+		// every predicate rejects invalid spells before looking at the traits
+		if (!IsValidSpell(spell_id)) {
+			continue;
+		}
+
+		for (int i = 0; i < EFFECT_COUNT; i++) {
+			const int effect_id = sp[spell_id].effect_id[i];
+			if (effect_id >= 0 && effect_id < SPELL_TRAIT_EFFECT_LIMIT) {
+				t.effects[effect_id >> 5] |= (1u << (effect_id & 31));
+			}
+		}
+
+		t.effect_count = SpellEffectsCount(spell_id);
+
+		for (const auto &p : predicates) {
+			if (p.first(spell_id)) {
+				t.flags |= p.second;
+			}
+		}
+	}
+
+	spells        = saved_spells;
+	SPDAT_RECORDS = saved_records;
+	spell_traits  = saved_traits;
+}
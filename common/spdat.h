@@ -1787,6 +1787,57 @@ struct SPDat_Spell_Struct
 extern const SPDat_Spell_Struct* spells;
 extern int32 SPDAT_RECORDS;
 
+// Spell traits
+//
+// Built once per spell by shared_memory and stored right behind the spell array in the spells file, so the hot
+// predicates (IsEffectInSpell, IsBeneficialSpell, IsAESpell, IsPureNukeSpell...) answer with a lookup instead of
+// scanning the effect slots every call. While spell_traits is null (an old spells file, or the traits are being
+// built) the predicates fall back to scanning.
+#define SPELL_TRAIT_EFFECT_LIMIT 576 // effect ids below this get a presence bit, anything above is scanned for
+
+namespace SpellTraits
+{
+	constexpr uint32	Beneficial        = (1 << 0);
+	constexpr uint32	GroupSpell        = (1 << 1);
+	constexpr uint32	BardSong          = (1 << 2);
+	constexpr uint32	TargetableAE      = (1 << 3);
+	constexpr uint32	AE                = (1 << 4);
+	constexpr uint32	PBAE              = (1 << 5);
+	constexpr uint32	AERain            = (1 << 6);
+	constexpr uint32	AEDuration        = (1 << 7);
+	constexpr uint32	AnyAE             = (1 << 8);
+	constexpr uint32	PureNuke          = (1 << 9);
+	constexpr uint32	AENuke            = (1 << 10);
+	constexpr uint32	PBAENuke          = (1 << 11);
+	constexpr uint32	AERainNuke        = (1 << 12);
+	constexpr uint32	AnyNukeOrStun     = (1 << 13);
+	constexpr uint32	PartialResistable = (1 << 14);
+	constexpr uint32	Damage            = (1 << 15);
+	constexpr uint32	AnyDamage         = (1 << 16);
+	constexpr uint32	DamageOverTime    = (1 << 17);
+	constexpr uint32	Lifetap           = (1 << 18);
+	constexpr uint32	Summon            = (1 << 19);
+	constexpr uint32	TargetRequired    = (1 << 20);
+}
+
+struct SPDat_Spell_Traits
+{
+	uint32 effects[SPELL_TRAIT_EFFECT_LIMIT / 32]; // one bit per effect id present in any slot
+	uint32 flags;                                  // SpellTraits
+	int8   effect_count;                           // non blank effect slots
+	uint8  unused[3];
+
+	inline bool HasEffect(int effect_id) const { return (effects[effect_id >> 5] >> (effect_id & 31)) & 1; }
+	inline bool Has(uint32 flag) const { return (flags & flag) != 0; }
+};
+
+// the spells file lays the traits out right after the 4 byte aligned spell array
+static_assert(sizeof(SPDat_Spell_Traits) % 4 == 0, "SPDat_Spell_Traits must keep 4 byte alignment in the spells file");
+
+extern const SPDat_Spell_Traits* spell_traits;
+
+void BuildSpellTraits(const SPDat_Spell_Struct *sp, int32 records, SPDat_Spell_Traits *traits);
+
 bool IsTargetableAESpell(uint16 spell_id);
 bool IsSacrificeSpell(uint16 spell_id);
 bool IsLifetapSpell(uint16 spell_id);
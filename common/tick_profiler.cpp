@@ -0,0 +1,248 @@
+#include "tick_profiler.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <fmt/format.h>
+
+std::atomic<bool> TickProfiler::s_enabled{false};
+
+namespace {
+	struct Phase {
+		const char                                      *name  = nullptr;
+		uint64                                          calls = 0;
+		std::array<uint32, TickProfiler::PHASE_SAMPLES> samples_ns{};
+	};
+
+	// owned by the recording thread, the lock is only ever contended while a dump or reset reads it
+	struct ThreadBuffer {
+		std::mutex                       lock;
+		uint32                           thread_id = 0;
+		std::vector<TickProfiler::Event> events;
+		size_t                           next      = 0;
+		size_t                           count     = 0;
+		std::vector<Phase>               phases;
+	};
+
+	std::mutex                                 s_buffers_lock;
+	std::vector<std::shared_ptr<ThreadBuffer>> s_buffers;
+	std::atomic<uint32>                        s_next_thread_id{1};
+
+	const auto s_epoch = std::chrono::steady_clock::now();
+
+	inline uint64 NowNs()
+	{
+		return static_cast<uint64>(
+			std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_epoch).count()
+		);
+	}
+
+	// registered on first use and kept alive by the registry, a thread that exits still shows up in dumps
+	ThreadBuffer &LocalBuffer()
+	{
+		thread_local std::shared_ptr<ThreadBuffer> buffer;
+		if (!buffer) {
+			buffer            = std::make_shared<ThreadBuffer>();
+			buffer->thread_id = s_next_thread_id++;
+			buffer->events.resize(TickProfiler::MAX_EVENTS);
+
+			std::lock_guard<std::mutex> guard(s_buffers_lock);
+			s_buffers.emplace_back(buffer);
+		}
+
+		return *buffer;
+	}
+
+	std::string EscapeJson(const char *s)
+	{
+		std::string out;
+		for (; *s; ++s) {
+			if (*s == '"' || *s == '\\') {
+				out += '\\';
+			}
+			out += *s;
+		}
+
+		return out;
+	}
+}
+
+void TickProfiler::SetEnabled(bool enabled)
+{
+	s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void TickProfiler::Reset()
+{
+	std::lock_guard<std::mutex> guard(s_buffers_lock);
+	for (auto &b: s_buffers) {
+		std::lock_guard<std::mutex> buffer_guard(b->lock);
+		b->next  = 0;
+		b->count = 0;
+		b->phases.clear();
+	}
+}
+
+uint64 TickProfiler::Begin()
+{
+	return NowNs();
+}
+
+void TickProfiler::End(const char *name, uint64 start_ns)
+{
+	const uint64 duration_ns = NowNs() - start_ns;
+
+	auto &b = LocalBuffer();
+
+	std::lock_guard<std::mutex> guard(b.lock);
+
+	b.events[b.next] = Event{.name = name, .start_ns = start_ns, .duration_ns = duration_ns};
+	b.next           = (b.next + 1) % MAX_EVENTS;
+	b.count          = std::min(b.count + 1, MAX_EVENTS);
+
+	// a handful of phases per thread, comparing the literal's address beats hashing the name
+	Phase *phase = nullptr;
+	for (auto &p: b.phases) {
+		if (p.name == name) {
+			phase = &p;
+			break;
+		}
+	}
+
+	if (!phase) {
+		phase       = &b.phases.emplace_back();
+		phase->name = name;
+	}
+
+	phase->samples_ns[phase->calls % PHASE_SAMPLES] = static_cast<uint32>(std::min<uint64>(duration_ns, UINT32_MAX));
+	phase->calls++;
+}
+
+std::vector<TickProfiler::PhaseSummary> TickProfiler::GetSummary()
+{
+	struct Merged {
+		uint64              calls = 0;
+		std::vector<uint32> samples;
+	};
+
+	// the same name can live at different addresses in different translation units, merge on the string
+	std::map<std::string, Merged> merged;
+
+	{
+		std::lock_guard<std::mutex> guard(s_buffers_lock);
+		for (auto &b: s_buffers) {
+			std::lock_guard<std::mutex> buffer_guard(b->lock);
+			for (const auto &p: b->phases) {
+				auto &m = merged[p.name];
+				m.calls += p.calls;
+				m.samples.insert(
+					m.samples.end(),
+					p.samples_ns.begin(),
+					p.samples_ns.begin() + std::min<uint64>(p.calls, PHASE_SAMPLES)
+				);
+			}
+		}
+	}
+
+	std::vector<PhaseSummary> summary;
+	summary.reserve(merged.size());
+
+	for (auto &[name, m]: merged) {
+		if (m.samples.empty()) {
+			continue;
+		}
+
+		std::sort(m.samples.begin(), m.samples.end());
+
+		const size_t last  = m.samples.size() - 1;
+		uint64       total = 0;
+		for (auto s: m.samples) {
+			total += s;
+		}
+
+		summary.emplace_back(
+			PhaseSummary{
+				.name     = name,
+				.calls    = m.calls,
+				.p50_us   = m.samples[last * 50 / 100] / 1000.0,
+				.p99_us   = m.samples[last * 99 / 100] / 1000.0,
+				.max_us   = m.samples[last] / 1000.0,
+				.total_ms = total / 1000000.0,
+			}
+		);
+	}
+
+	std::sort(
+		summary.begin(),
+		summary.end(),
+		[](const PhaseSummary &a, const PhaseSummary &b) {
+			return a.p99_us > b.p99_us;
+		}
+	);
+
+	return summary;
+}
+
+bool TickProfiler::WriteChromeTrace(const std::string &file_name, size_t &event_count)
+{
+	struct ThreadEvents {
+		uint32             thread_id;
+		std::vector<Event> events;
+	};
+
+	// copy out under the locks, formatting happens without holding up the recording threads
+	std::vector<ThreadEvents> threads;
+
+	{
+		std::lock_guard<std::mutex> guard(s_buffers_lock);
+		for (auto &b: s_buffers) {
+			std::lock_guard<std::mutex> buffer_guard(b->lock);
+
+			ThreadEvents t{.thread_id = b->thread_id};
+			t.events.reserve(b->count);
+
+			// oldest first, once the ring wrapped the oldest entry is the one about to be overwritten
+			const size_t first = b->count < MAX_EVENTS ? 0 : b->next;
+			for (size_t i = 0; i < b->count; ++i) {
+				t.events.emplace_back(b->events[(first + i) % MAX_EVENTS]);
+			}
+
+			threads.emplace_back(std::move(t));
+		}
+	}
+
+	std::ofstream out(file_name, std::ios::out | std::ios::trunc);
+	if (!out.is_open()) {
+		return false;
+	}
+
+	event_count = 0;
+
+	fmt::memory_buffer buf;
+	fmt::format_to(std::back_inserter(buf), "{{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+	for (const auto &t: threads) {
+		for (const auto &e: t.events) {
+			fmt::format_to(
+				std::back_inserter(buf),
+				"{}{{\"name\":\"{}\",\"cat\":\"tick\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{}}}",
+				event_count ? "," : "",
+				EscapeJson(e.name),
+				e.start_ns / 1000.0,
+				e.duration_ns / 1000.0,
+				t.thread_id
+			);
+
+			event_count++;
+		}
+	}
+
+	fmt::format_to(std::back_inserter(buf), "]}}\n");
+
+	out.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+
+	return out.good();
+}
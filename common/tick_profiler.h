@@ -0,0 +1,82 @@
+#ifndef EQEMU_TICK_PROFILER_H
+#define EQEMU_TICK_PROFILER_H
+
+#include "types.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+// Scoped timings for the phases of a server frame
+//
+// Every thread records into its own ring buffer of the most recent scopes, the rings are only read when someone asks
+// for a dump so recording never contends. Disabled (the default) a scope costs a relaxed atomic load.
+//
+// Scope names are not copied, pass string literals.
+class TickProfiler {
+public:
+	// ring buffer slots per thread and samples kept per phase for the percentile summary
+	static constexpr size_t MAX_EVENTS    = 65536;
+	static constexpr size_t PHASE_SAMPLES = 1024;
+
+	struct Event {
+		const char *name;
+		uint64     start_ns;
+		uint64     duration_ns;
+	};
+
+	struct PhaseSummary {
+		std::string name;
+		uint64      calls;
+		double      p50_us;
+		double      p99_us;
+		double      max_us;
+		double      total_ms; // over the sample window
+	};
+
+	class Scope {
+	public:
+		explicit Scope(const char *name)
+		{
+			if (TickProfiler::IsEnabled()) {
+				m_name  = name;
+				m_start = TickProfiler::Begin();
+			}
+		}
+
+		~Scope()
+		{
+			if (m_name) {
+				TickProfiler::End(m_name, m_start);
+			}
+		}
+
+		Scope(const Scope &) = delete;
+		Scope &operator=(const Scope &) = delete;
+
+	private:
+		const char *m_name  = nullptr;
+		uint64     m_start = 0;
+	};
+
+	static inline bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+	static void SetEnabled(bool enabled);
+	static void Reset();
+
+	// phases across all threads, slowest p99 first
+	static std::vector<PhaseSummary> GetSummary();
+
+	// writes the buffered scopes of every thread as Chrome trace event JSON (chrome://tracing, Perfetto)
+	static bool WriteChromeTrace(const std::string &file_name, size_t &event_count);
+
+private:
+	static uint64 Begin();
+	static void End(const char *name, uint64 start_ns);
+
+	static std::atomic<bool> s_enabled;
+};
+
+#define TICK_PROFILE_CONCAT_INNER(a, b) a##b
+#define TICK_PROFILE_CONCAT(a, b) TICK_PROFILE_CONCAT_INNER(a, b)
+#define TICK_PROFILE(name) TickProfiler::Scope TICK_PROFILE_CONCAT(tick_profile_scope_, __LINE__)(name)
+
+#endif //EQEMU_TICK_PROFILER_H
@@ -0,0 +1,196 @@
+#include "wheel_timer.h"
+#include <algorithm>
+#include <cstdint>
+
+WheelTimer::WheelTimer()
+{
+	timer_time        = 0;
+	start_time        = Timer::GetCurrentTime();
+	set_at_trigger    = timer_time;
+	pUseAcurateTiming = false;
+	enabled           = false;
+}
+
+WheelTimer::WheelTimer(uint32 in_timer_time, bool iUseAcurateTiming)
+{
+	timer_time        = in_timer_time;
+	start_time        = Timer::GetCurrentTime();
+	set_at_trigger    = timer_time;
+	pUseAcurateTiming = iUseAcurateTiming;
+	enabled           = timer_time != 0;
+
+	Reschedule();
+}
+
+WheelTimer::WheelTimer(uint32 start, uint32 timer, bool iUseAcurateTiming)
+{
+	timer_time        = timer;
+	start_time        = start;
+	set_at_trigger    = timer_time;
+	pUseAcurateTiming = iUseAcurateTiming;
+	enabled           = timer_time != 0;
+
+	Reschedule();
+}
+
+WheelTimer::WheelTimer(const WheelTimer &o)
+	: EQ::TimerWheel::Entry()
+{
+	*this = o;
+}
+
+WheelTimer &WheelTimer::operator=(const WheelTimer &o)
+{
+	if (this == &o) {
+		return *this;
+	}
+
+	start_time        = o.start_time;
+	timer_time        = o.timer_time;
+	enabled           = o.enabled;
+	set_at_trigger    = o.set_at_trigger;
+	pUseAcurateTiming = o.pUseAcurateTiming;
+	m_callback        = o.m_callback;
+
+	Reschedule();
+
+	return *this;
+}
+
+bool WheelTimer::Fire(bool iReset)
+{
+	if (iReset) {
+		if (pUseAcurateTiming) {
+			start_time += timer_time;
+		}
+		else {
+			start_time = Timer::GetCurrentTime();
+		}
+
+		timer_time = set_at_trigger;
+
+		Reschedule();
+	}
+
+	return true;
+}
+
+void WheelTimer::Disable()
+{
+	enabled = false;
+
+	Reschedule();
+}
+
+void WheelTimer::Enable()
+{
+	enabled = true;
+
+	Reschedule();
+}
+
+void WheelTimer::Start(uint32 set_timer_time, bool ChangeResetTimer)
+{
+	start_time = Timer::GetCurrentTime();
+	enabled    = true;
+	if (set_timer_time != 0) {
+		timer_time = set_timer_time;
+		if (ChangeResetTimer) {
+			set_at_trigger = set_timer_time;
+		}
+	}
+
+	Reschedule();
+}
+
+void WheelTimer::SetTimer(uint32 set_timer_time)
+{
+	if (!enabled) {
+		start_time = Timer::GetCurrentTime();
+		enabled    = true;
+	}
+
+	if (set_timer_time != 0) {
+		timer_time     = set_timer_time;
+		set_at_trigger = set_timer_time;
+	}
+
+	Reschedule();
+}
+
+uint32 WheelTimer::GetRemainingTime() const
+{
+	if (!enabled) {
+		return 0xFFFFFFFF;
+	}
+
+	const uint32 elapsed = Timer::GetCurrentTime() - start_time;
+
+	return elapsed > timer_time ? 0 : timer_time - elapsed;
+}
+
+void WheelTimer::SetAtTrigger(uint32 in_set_at_trigger, bool iEnableIfDisabled, bool ChangeTimerTime)
+{
+	set_at_trigger = in_set_at_trigger;
+	if (!enabled && iEnableIfDisabled) {
+		enabled = true;
+	}
+
+	if (ChangeTimerTime) {
+		timer_time = set_at_trigger;
+	}
+
+	Reschedule();
+}
+
+void WheelTimer::Trigger()
+{
+	enabled    = true;
+	timer_time = set_at_trigger;
+	start_time = Timer::GetCurrentTime() - timer_time - 1;
+
+	Reschedule();
+}
+
+void WheelTimer::SetCallback(Callback cb)
+{
+	m_callback = std::move(cb);
+
+	Reschedule();
+}
+
+void WheelTimer::OnExpire()
+{
+	m_ready = true;
+
+	if (m_callback) {
+		m_callback(this);
+	}
+}
+
+void WheelTimer::Reschedule()
+{
+	auto &wheel = EQ::TimerWheel::Get();
+
+	wheel.Cancel(this);
+	m_ready = false;
+
+	if (!enabled) {
+		return;
+	}
+
+	// same test as Timer::Check(), due once more than timer_time has elapsed
+	const uint32 elapsed = Timer::GetCurrentTime() - start_time;
+	if (elapsed > timer_time) {
+		if (m_callback) {
+			wheel.Schedule(this, 0);
+		}
+		else {
+			m_ready = true;
+		}
+
+		return;
+	}
+
+	wheel.Schedule(this, static_cast<uint32>(std::min<uint64>(static_cast<uint64>(timer_time) - elapsed + 1, UINT32_MAX)));
+}
@@ -0,0 +1,60 @@
+#ifndef WHEEL_TIMER_H
+#define WHEEL_TIMER_H
+
+#include "types.h"
+#include "timer.h"
+#include "event/timer_wheel.h"
+#include <functional>
+
+// Drop in replacement for Timer backed by the thread's EQ::TimerWheel
+//
+// Same interface and semantics as Timer, but instead of comparing clocks on every Check() the timer sits in the wheel
+// and is flagged ready when it comes due, so a member can be migrated by changing its type. Timers that should not be
+// polled at all can register a callback, which runs from TimerWheel::Advance() every time the timer comes due; it
+// normally calls Check() (to restart) or Disable(), otherwise the timer simply stays ready like an unchecked Timer.
+//
+// Only fires on threads that advance the wheel every frame (zone main thread).
+class WheelTimer : private EQ::TimerWheel::Entry
+{
+public:
+	using Callback = std::function<void(WheelTimer *)>;
+
+	WheelTimer();
+	WheelTimer(uint32 timer_time, bool iUseAcurateTiming = false);
+	WheelTimer(uint32 start, uint32 timer, bool iUseAcurateTiming);
+	WheelTimer(const WheelTimer &o);
+	WheelTimer &operator=(const WheelTimer &o);
+	~WheelTimer() override { }
+
+	inline bool Check(bool iReset = true) { return m_ready && Fire(iReset); }
+	void Enable();
+	void Disable();
+	void Start(uint32 set_timer_time = 0, bool ChangeResetTimer = true);
+	void SetTimer(uint32 set_timer_time = 0);
+	uint32 GetRemainingTime() const;
+	inline const uint32 &GetTimerTime() { return timer_time; }
+	inline const uint32 &GetSetAtTrigger() { return set_at_trigger; }
+	void Trigger();
+	void SetAtTrigger(uint32 set_at_trigger, bool iEnableIfDisabled = false, bool ChangeTimerTime = false);
+
+	inline bool Enabled() { return enabled; }
+	inline uint32 GetStartTime() { return (start_time); }
+	inline uint32 GetDuration() { return (timer_time); }
+
+	void SetCallback(Callback cb);
+
+private:
+	void OnExpire() override;
+	bool Fire(bool iReset);
+	void Reschedule();
+
+	uint32   start_time;
+	uint32   timer_time;
+	bool     enabled;
+	uint32   set_at_trigger;
+	bool     pUseAcurateTiming;
+	bool     m_ready = false;
+	Callback m_callback;
+};
+
+#endif
@@ -34,6 +34,7 @@
 #include "../common/path_manager.h"
 #include "../common/events/player_event_logs.h"
 #include "../common/evolving_items.h"
+#include "../common/spdat.h"
 
 EQEmuLogSys          LogSys;
 WorldContentService  content_service;
@@ -42,6 +43,10 @@ PathManager          path;
 PlayerEventLogs      player_event_logs;
 EvolvingItemsManager evolving_items_manager;
 
+// the spell predicates used to build the spell traits read these, they only point at the spells while building
+const SPDat_Spell_Struct *spells        = nullptr;
+int32                    SPDAT_RECORDS = -1;
+
 #ifdef _WINDOWS
 #include <direct.h>
 #else
@@ -32,7 +32,8 @@ void LoadSpells(SharedDatabase *database, const std::string &prefix) {
 		EQ_EXCEPT("Shared Memory", "Unable to get any spells from the database.");
 	}
 
-	uint32 size = records * sizeof(SPDat_Spell_Struct) + sizeof(uint32);
+	// spell records followed by the traits the zone predicates read instead of scanning the effect slots
+	uint32 size = records * sizeof(SPDat_Spell_Struct) + sizeof(uint32) + records * sizeof(SPDat_Spell_Traits);
 
 	auto Config = EQEmuConfig::get();
 	std::string file_name = Config->SharedMemDir + prefix + std::string("spells");
@@ -41,6 +42,13 @@ void LoadSpells(SharedDatabase *database, const std::string &prefix) {
 
 	void *ptr = mmf.Get();
 	database->LoadSpells(ptr, records);
+
+	auto sp     = reinterpret_cast<const SPDat_Spell_Struct *>(static_cast<char *>(ptr) + sizeof(uint32));
+	auto traits = reinterpret_cast<SPDat_Spell_Traits *>(
+		static_cast<char *>(ptr) + sizeof(uint32) + records * sizeof(SPDat_Spell_Struct)
+	);
+
+	BuildSpellTraits(sp, records, traits);
 	mutex.Unlock();
 }
 
@@ -32,6 +32,8 @@
 #include "data_verification_test.h"
 #include "skills_util_test.h"
 #include "task_state_test.h"
+#include "timer_wheel_test.h"
+#include "profanity_matcher_test.h"
 
 const EQEmuConfig *Config;
 EQEmuLogSys       LogSys;
@@ -58,6 +60,8 @@ int main()
 		tests.add(new DataVerificationTest());
 		tests.add(new SkillsUtilsTest());
 		tests.add(new TaskStateTest());
+		tests.add(new TimerWheelTest());
+		tests.add(new ProfanityMatcherTest());
 		tests.run(*output, true);
 	}
 	catch (std::exception &ex) {
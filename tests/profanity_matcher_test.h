@@ -0,0 +1,101 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2013 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#ifndef __EQEMU_TESTS_PROFANITY_MATCHER_H
+#define __EQEMU_TESTS_PROFANITY_MATCHER_H
+
+#include "cppunit/cpptest.h"
+#include "../common/profanity_matcher.h"
+
+class ProfanityMatcherTest : public Test::Suite {
+	typedef void(ProfanityMatcherTest::*TestFunction)(void);
+public:
+	ProfanityMatcherTest() {
+		TEST_ADD(ProfanityMatcherTest::WholeWordTest);
+		TEST_ADD(ProfanityMatcherTest::CaseTest);
+		TEST_ADD(ProfanityMatcherTest::OverlapTest);
+		TEST_ADD(ProfanityMatcherTest::ContainsTest);
+		TEST_ADD(ProfanityMatcherTest::RebuildTest);
+	}
+
+	~ProfanityMatcherTest() {
+	}
+
+	private:
+	static std::string Redact(const EQ::ProfanityMatcher &m, std::string message) {
+		m.Redact(&message[0], message.length(), '*');
+		return message;
+	}
+
+	void WholeWordTest() {
+		EQ::ProfanityMatcher m;
+		m.Build({"darn", "heck"});
+
+		TEST_ASSERT(Redact(m, "darn it") == "**** it");
+		TEST_ASSERT(Redact(m, "oh heck") == "oh ****");
+		TEST_ASSERT(Redact(m, "what the heck, darn!") == "what the ****, ****!");
+		TEST_ASSERT(Redact(m, "darned") == "darned");
+		TEST_ASSERT(Redact(m, "checking") == "checking");
+		TEST_ASSERT(Redact(m, "darn1") == "****1");
+	}
+
+	void CaseTest() {
+		EQ::ProfanityMatcher m;
+		m.Build({"darn"});
+
+		TEST_ASSERT(Redact(m, "DaRn you") == "**** you");
+		TEST_ASSERT(Redact(m, "DARN") == "****");
+	}
+
+	void OverlapTest() {
+		EQ::ProfanityMatcher m;
+		m.Build({"dar", "darn", "darn it", "it all"});
+
+		// every entry is checked against the message as sent, not as redacted by another entry
+		TEST_ASSERT(Redact(m, "dar darn") == "*** ****");
+		TEST_ASSERT(Redact(m, "darn it all") == "***********");
+
+		// an occurrence overlapping an earlier one of the same entry is skipped
+		m.Build({"x x"});
+		TEST_ASSERT(Redact(m, "x x x") == "*** x");
+	}
+
+	void ContainsTest() {
+		EQ::ProfanityMatcher m;
+		TEST_ASSERT(!m.Contains("darn", 4));
+
+		m.Build({"darn"});
+		TEST_ASSERT(m.Contains("darned", 6));
+		TEST_ASSERT(m.Contains("oh DARN", 7));
+		TEST_ASSERT(!m.Contains("dar n", 5));
+	}
+
+	void RebuildTest() {
+		EQ::ProfanityMatcher m;
+		m.Build({"darn"});
+		m.Build({"heck"});
+
+		TEST_ASSERT(Redact(m, "darn heck") == "darn ****");
+
+		m.Clear();
+		TEST_ASSERT(m.Empty());
+		TEST_ASSERT(Redact(m, "darn heck") == "darn heck");
+	}
+};
+
+#endif
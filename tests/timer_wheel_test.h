@@ -0,0 +1,161 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2013 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#ifndef __EQEMU_TESTS_TIMER_WHEEL_H
+#define __EQEMU_TESTS_TIMER_WHEEL_H
+
+#include "cppunit/cpptest.h"
+#include "../common/event/timer_wheel.h"
+
+class TimerWheelTest : public Test::Suite {
+	typedef void(TimerWheelTest::*TestFunction)(void);
+public:
+	TimerWheelTest() {
+		TEST_ADD(TimerWheelTest::ExpireTest);
+		TEST_ADD(TimerWheelTest::CancelTest);
+		TEST_ADD(TimerWheelTest::CascadeTest);
+		TEST_ADD(TimerWheelTest::WrapTest);
+		TEST_ADD(TimerWheelTest::RescheduleTest);
+	}
+
+	~TimerWheelTest() {
+	}
+
+	private:
+	struct Entry : EQ::TimerWheel::Entry {
+		EQ::TimerWheel *wheel     = nullptr;
+		int            fired      = 0;
+		uint64         fired_at   = 0;
+		uint32         reschedule = 0;
+
+		void OnExpire() override {
+			fired++;
+			fired_at = wheel->GetTime();
+			if (reschedule) {
+				wheel->Schedule(this, reschedule);
+			}
+		}
+	};
+
+	void ExpireTest() {
+		EQ::TimerWheel wheel;
+		wheel.Advance(1000);
+
+		Entry e;
+		e.wheel = &wheel;
+		wheel.Schedule(&e, 100);
+
+		wheel.Advance(1099);
+		TEST_ASSERT(e.fired == 0);
+
+		wheel.Advance(1100);
+		TEST_ASSERT(e.fired == 1);
+		TEST_ASSERT(e.fired_at == 100);
+		TEST_ASSERT(!e.IsScheduled());
+		TEST_ASSERT(wheel.Size() == 0);
+	}
+
+	void CancelTest() {
+		EQ::TimerWheel wheel;
+		wheel.Advance(0);
+
+		Entry e;
+		e.wheel = &wheel;
+		wheel.Schedule(&e, 10);
+		wheel.Cancel(&e);
+
+		wheel.Advance(100);
+		TEST_ASSERT(e.fired == 0);
+		TEST_ASSERT(wheel.Size() == 0);
+
+		{
+			Entry scoped;
+			wheel.Schedule(&scoped, 10);
+		}
+
+		TEST_ASSERT(wheel.Size() == 0);
+	}
+
+	void CascadeTest() {
+		EQ::TimerWheel wheel;
+		wheel.Advance(0);
+
+		const uint32 delays[] = {255, 256, 257, 65535, 65536, 70000, 16777216, 20000000};
+
+		Entry e[8];
+		for (int i = 0; i < 8; ++i) {
+			e[i].wheel = &wheel;
+			wheel.Schedule(&e[i], delays[i]);
+		}
+
+		// large uneven steps, entries must still expire on their exact tick
+		uint32 now = 0;
+		while (now < 20000000) {
+			now += 997;
+			wheel.Advance(now);
+		}
+
+		for (int i = 0; i < 8; ++i) {
+			TEST_ASSERT(e[i].fired == 1);
+			TEST_ASSERT(e[i].fired_at == delays[i]);
+		}
+	}
+
+	void WrapTest() {
+		EQ::TimerWheel wheel;
+		wheel.Advance(0xFFFFFF00);
+
+		Entry e;
+		e.wheel = &wheel;
+		wheel.Schedule(&e, 512);
+
+		wheel.Advance(0x00000050);
+		TEST_ASSERT(e.fired == 0);
+
+		wheel.Advance(0x00000100);
+		TEST_ASSERT(e.fired == 1);
+	}
+
+	void RescheduleTest() {
+		EQ::TimerWheel wheel;
+		wheel.Advance(0);
+
+		Entry e;
+		e.wheel      = &wheel;
+		e.reschedule = 100;
+		wheel.Schedule(&e, 100);
+
+		for (uint32 now = 100; now <= 1000; now += 100) {
+			wheel.Advance(now);
+		}
+
+		TEST_ASSERT(e.fired == 10);
+
+		// a frame longer than the period only fires once, the next expiry is relative to the frame time
+		wheel.Advance(1350);
+		TEST_ASSERT(e.fired == 11);
+
+		wheel.Advance(1449);
+		TEST_ASSERT(e.fired == 11);
+
+		wheel.Advance(1450);
+		TEST_ASSERT(e.fired == 12);
+	}
+};
+
+#endif
@@ -58,6 +58,8 @@ echo "# Running NPC hand-in tests"
 ./bin/zone tests:npc-handins-multiquest 2>&1 | tee -a test_output.log
 ./bin/zone tests:databuckets 2>&1 | tee -a test_output.log
 ./bin/zone tests:zone-state 2>&1 | tee -a test_output.log
+./bin/zone tests:bonus-layers 2>&1 | tee -a test_output.log
+./bin/zone tests:bazaar-search 2>&1 | tee -a test_output.log
 
 if grep -E -q "QueryErr|Error|FAILED" test_output.log; then
     echo "Error found in test output! Failing build."
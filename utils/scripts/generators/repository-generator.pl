@@ -223,6 +223,7 @@ foreach my $table_to_generate (@tables) {
     my $cereal_columns             = "";
     my $update_one_entries         = "";
     my $all_entries                = "";
+    my $stmt_entries               = "";
     my $index                      = 0;
     my %table_data                 = ();
     my %table_primary_key          = ();
@@ -330,39 +331,48 @@ foreach my $table_to_generate (@tables) {
             if ($data_type =~ /bigint/) {
                 $all_entries      .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? strtoull(row[%s], nullptr, 10) : %s;\n", $column_name_formatted, $index, $index, $default_value);
                 $find_one_entries .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? strtoull(row[%s], nullptr, 10) : %s;\n", $column_name_formatted, $index, $index, $default_value);
+                $stmt_entries     .= sprintf("\t\t\t\te.%-${longest_column_length}s = row.Get<uint64_t>(%s).value_or(%s);\n", $column_name_formatted, $index, $default_value);
             }
             elsif ($data_type =~ /int/) {
                 $all_entries      .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? static_cast<%s>(strtoul(row[%s], nullptr, 10)) : %s;\n", $column_name_formatted, $index, $struct_data_type, $index, $default_value);
                 $find_one_entries .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? static_cast<%s>(strtoul(row[%s], nullptr, 10)) : %s;\n", $column_name_formatted, $index, $struct_data_type, $index, $default_value);
+                $stmt_entries     .= sprintf("\t\t\t\te.%-${longest_column_length}s = row.Get<%s>(%s).value_or(%s);\n", $column_name_formatted, $struct_data_type, $index, $default_value);
             }
             elsif ($data_type =~ /float|decimal/) {
                 $all_entries      .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? (strtof(row[%s], nullptr) > 0.0f ? strtof(row[%s], nullptr) : %s) : %s;\n", $column_name_formatted, $index, $index, $index, $default_value, $default_value);
                 $find_one_entries .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? (strtof(row[%s], nullptr) > 0.0f ? strtof(row[%s], nullptr) : %s) : %s;\n", $column_name_formatted, $index, $index, $index, $default_value, $default_value);
+                $stmt_entries     .= sprintf("\t\t\t\te.%-${longest_column_length}s = row.Get<float>(%s).value_or(0.0f) > 0.0f ? *row.Get<float>(%s) : %s;\n", $column_name_formatted, $index, $index, $default_value);
             }
         }
         elsif ($data_type =~ /bigint/) {
             $all_entries      .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? strtoll(row[%s], nullptr, 10) : %s;\n", $column_name_formatted, $index, $index, $default_value);
             $find_one_entries .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? strtoll(row[%s], nullptr, 10) : %s;\n", $column_name_formatted, $index, $index, $default_value);
+            $stmt_entries     .= sprintf("\t\t\t\te.%-${longest_column_length}s = row.Get<int64_t>(%s).value_or(%s);\n", $column_name_formatted, $index, $default_value);
         }
         elsif ($data_type =~ /datetime|timestamp/) {
             $all_entries      .= sprintf("\t\t\te.%-${longest_column_length}s = strtoll(row[%s] ? row[%s] : \"-1\", nullptr, 10);\n", $column_name_formatted, $index, $index);
             $find_one_entries .= sprintf("\t\t\te.%-${longest_column_length}s = strtoll(row[%s] ? row[%s] : \"-1\", nullptr, 10);\n", $column_name_formatted, $index, $index);
+            $stmt_entries     .= sprintf("\t\t\t\te.%-${longest_column_length}s = row.Get<int64_t>(%s).value_or(-1);\n", $column_name_formatted, $index);
         }
         elsif ($data_type =~ /int/) {
             $all_entries      .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? static_cast<%s>(atoi(row[%s])) : %s;\n", $column_name_formatted, $index, $struct_data_type, $index, $default_value);
             $find_one_entries .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? static_cast<%s>(atoi(row[%s])) : %s;\n", $column_name_formatted, $index, $struct_data_type, $index, $default_value);
+            $stmt_entries     .= sprintf("\t\t\t\te.%-${longest_column_length}s = row.Get<%s>(%s).value_or(%s);\n", $column_name_formatted, $struct_data_type, $index, $default_value);
         }
         elsif ($data_type =~ /float|decimal/) {
             $all_entries      .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? strtof(row[%s], nullptr) : %s;\n", $column_name_formatted, $index, $index, $default_value);
             $find_one_entries .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? strtof(row[%s], nullptr) : %s;\n", $column_name_formatted, $index, $index, $default_value);
+            $stmt_entries     .= sprintf("\t\t\t\te.%-${longest_column_length}s = row.Get<float>(%s).value_or(%s);\n", $column_name_formatted, $index, $default_value);
         }
         elsif ($data_type =~ /double/) {
             $all_entries      .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? strtod(row[%s], nullptr) : %s;\n", $column_name_formatted, $index, $index, $default_value);
             $find_one_entries .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? strtod(row[%s], nullptr) : %s;\n", $column_name_formatted, $index, $index, $default_value);
+            $stmt_entries     .= sprintf("\t\t\t\te.%-${longest_column_length}s = row.Get<double>(%s).value_or(%s);\n", $column_name_formatted, $index, $default_value);
         }
         else {
             $all_entries      .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? row[%s] : %s;\n", $column_name_formatted, $index, $index, $default_value);
             $find_one_entries .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? row[%s] : %s;\n", $column_name_formatted, $index, $index, $default_value);
+            $stmt_entries     .= sprintf("\t\t\t\te.%-${longest_column_length}s = row.GetStr(%s).value_or(%s);\n", $column_name_formatted, $index, $default_value);
         }
 
         # print $column_name . "\n";
@@ -452,6 +462,7 @@ foreach my $table_to_generate (@tables) {
     chomp($insert_one_entries);
     chomp($insert_many_entries);
     chomp($all_entries);
+    chomp($stmt_entries);
 
     use POSIX qw(strftime);
     my $generated_date = strftime "%b%e, %Y", localtime;
@@ -478,6 +489,7 @@ foreach my $table_to_generate (@tables) {
     $new_base_repository =~ s/\{\{INSERT_ONE_ENTRIES}}/$insert_one_entries/g;
     $new_base_repository =~ s/\{\{INSERT_MANY_ENTRIES}}/$insert_many_entries/g;
     $new_base_repository =~ s/\{\{ALL_ENTRIES}}/$all_entries/g;
+    $new_base_repository =~ s/\{\{STMT_ENTRIES}}/$stmt_entries/g;
     $new_base_repository =~ s/\{\{GENERATED_DATE}}/$generated_date/g;
     $new_base_repository =~ s/\{\{ADDITIONAL_INCLUDES}}\n/$additional_includes/g;
 
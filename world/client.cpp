@@ -1422,6 +1422,13 @@ void Client::EnterWorld(bool TryBootup) {
 		zone_server = zoneserver_list.FindByZoneID(zone_id);
 	}
 
+	// time to enter world runs from the first attempt until the client is sent on to the zone
+	if (TryBootup && !enter_world_started) {
+		enter_world_started       = Timer::GetCurrentTime();
+		enter_world_needed_bootup = false;
+		zoneserver_list.RecordZoneEntry(zone_id, instance_id);
+	}
+
 	const char *zone_name = ZoneName(zone_id, true);
 	if (zone_server) {
 		if (false == enter_world_triggered) {
@@ -1439,6 +1446,7 @@ void Client::EnterWorld(bool TryBootup) {
 		if (TryBootup) {
 			LogInfo("Attempting autobootup of [{}] [{}] [{}]", zone_name, zone_id, instance_id);
 			autobootup_timeout.Start();
+			enter_world_needed_bootup = true;
 			zone_waiting_for_bootup = zoneserver_list.TriggerBootup(zone_id, instance_id);
 			if (zone_waiting_for_bootup == 0) {
 				LogInfo("No zoneserver available to boot up");
@@ -1583,6 +1591,11 @@ void Client::Clearance(int8 response)
 	QueuePacket(outapp);
 	safe_delete(outapp);
 
+	if (enter_world_started) {
+		zoneserver_list.RecordEnterWorldTime(Timer::GetCurrentTime() - enter_world_started, enter_world_needed_bootup);
+		enter_world_started = 0;
+	}
+
 	if (cle)
 		cle->SetOnline(CLE_Status::Zoning);
 }
@@ -1599,6 +1612,7 @@ void Client::TellClientZoneUnavailable() {
 	zone_id = 0;
 	zone_waiting_for_bootup = 0;
 	enter_world_triggered = false;
+	enter_world_started = 0;
 	autobootup_timeout.Disable();
 }
 
@@ -88,6 +88,8 @@ private:
 	Timer	autobootup_timeout;
 	uint32	zone_waiting_for_bootup;
 	bool	enter_world_triggered;
+	uint32	enter_world_started = 0; // Timer::GetCurrentTime() of the first attempt to enter the zone, 0 when not entering
+	bool	enter_world_needed_bootup = false;
 
 	bool StartInTutorial;
 	EQ::versions::ClientVersion m_ClientVersion;
@@ -58,6 +58,8 @@ DynamicZone* DynamicZoneManager::TryCreate(DynamicZone& dz_request, const std::v
 	auto pack = dz->CreateServerPacket(0, 0);
 	zoneserver_list.SendPacket(pack.get());
 
+	zoneserver_list.WarmDynamicZone(dz->GetZoneID(), dz->GetInstanceID());
+
 	auto inserted = dynamic_zone_cache.emplace(dz_id, std::move(dz));
 	return inserted.first->second.get();
 }
@@ -73,10 +75,15 @@ void DynamicZoneManager::CacheNewDynamicZone(ServerPacket* pack)
 	// reserialize with member statuses cached before forwarding (restore origin zone)
 	auto repack = new_dz->CreateServerPacket(buf->origin_zone_id, buf->origin_instance_id);
 
+	const uint32 zone_id     = new_dz->GetZoneID();
+	const uint32 instance_id = new_dz->GetInstanceID();
+
 	dynamic_zone_cache.emplace(buf->dz_id, std::move(new_dz));
 	LogDynamicZones("Cached new dynamic zone [{}]", buf->dz_id);
 
 	zoneserver_list.SendPacket(repack.get());
+
+	zoneserver_list.WarmDynamicZone(zone_id, instance_id);
 }
 
 void DynamicZoneManager::CacheAllFromDatabase()
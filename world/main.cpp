@@ -354,6 +354,8 @@ int main(int argc, char **argv)
 	opts.daybreak_options.resend_delay_min    = RuleI(Network, ResendDelayMinMS);
 	opts.daybreak_options.resend_delay_max    = RuleI(Network, ResendDelayMaxMS);
 	opts.daybreak_options.outgoing_data_rate  = RuleR(Network, ClientDataRate);
+	opts.daybreak_options.batch_send          = RuleB(Network, BatchedDatagramIO);
+	opts.daybreak_options.batch_recv          = RuleB(Network, BatchedDatagramIO);
 
 	EQ::Net::EQStreamManager eqsm(opts);
 
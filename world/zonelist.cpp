@@ -21,6 +21,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "worlddb.h"
 #include "world_config.h"
 #include "../common/misc_functions.h"
+#include "../common/rulesys.h"
 #include "../common/servertalk.h"
 #include "../common/strings.h"
 #include "../common/random.h"
@@ -39,6 +40,9 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "clientlist.h"
 #include "clientlist.h"
 
+#include <algorithm>
+#include <ctime>
+
 extern uint32 numzones;
 extern EQ::Random emu_random;
 extern WebInterfaceList web_interface;
@@ -48,6 +52,11 @@ extern ClientList client_list;
 volatile bool UCSServerAvailable_ = false;
 void CatchSignal(int sig_num);
 
+// how often the warm zone pool is topped up, and how many time to enter world samples are kept
+static constexpr uint32 WARM_ZONE_POOL_INTERVAL_MS = 30000;
+static constexpr size_t ENTER_WORLD_SAMPLES        = 1024;
+static constexpr uint32 WARM_ZONE_ENTRY_GRACE_MS   = 60000;
+
 ZSList::ZSList()
 {
 	NextID = 1;
@@ -55,6 +64,11 @@ ZSList::ZSList()
 	memset(pLockedZones, 0, sizeof(pLockedZones));
 
 	m_tick = std::make_unique<EQ::Timer>(5000, true, std::bind(&ZSList::OnTick, this, std::placeholders::_1));
+	m_warm_pool_tick = std::make_unique<EQ::Timer>(
+		WARM_ZONE_POOL_INTERVAL_MS,
+		true,
+		std::bind(&ZSList::OnWarmZonePoolTick, this, std::placeholders::_1)
+	);
 }
 
 ZSList::~ZSList() {
@@ -1001,3 +1015,283 @@ void ZSList::SendServerReload(ServerReload::Type type, uchar *packet)
 		++counter;
 	}
 }
+
+static int LocalHour()
+{
+	const std::time_t now = std::time(nullptr);
+	return std::localtime(&now)->tm_hour;
+}
+
+void ZSList::RecordZoneEntry(uint32 zone_id, uint32 instance_id)
+{
+	if (!zone_id) {
+		return;
+	}
+
+	// left in the pool until the client is in, the zone keeps its hold when the client never arrives
+	for (auto &e: m_warm_zones) {
+		if (e.second.zone_id == zone_id && e.second.instance_id == instance_id) {
+			if (!e.second.requested_at) {
+				m_warm_zone_hits++;
+			}
+
+			e.second.requested_at = Timer::GetCurrentTime();
+			break;
+		}
+	}
+
+	// instances are booted for one group at a time, their entries say nothing about the next one
+	if (instance_id) {
+		return;
+	}
+
+	m_zone_entries[zone_id][LocalHour()] += 1.0f;
+}
+
+void ZSList::RecordEnterWorldTime(uint32 milliseconds, bool needed_bootup)
+{
+	auto &s = needed_bootup ? m_enter_world_bootup : m_enter_world_booted;
+	if (s.samples.size() < ENTER_WORLD_SAMPLES) {
+		s.samples.emplace_back(milliseconds);
+	}
+	else {
+		s.samples[s.next] = milliseconds;
+	}
+
+	s.next = (s.next + 1) % ENTER_WORLD_SAMPLES;
+	s.count++;
+}
+
+void ZSList::WarmDynamicZone(uint32 zone_id, uint32 instance_id)
+{
+	if (!zone_id || !instance_id || RuleI(World, WarmZonePoolInstanceHoldSeconds) <= 0) {
+		return;
+	}
+
+	// the members are on their way in, when there is no room it boots on entry as before
+	if (!FindByInstanceID(instance_id)) {
+		BootWarmZone(zone_id, instance_id);
+	}
+}
+
+bool ZSList::BootWarmZone(uint32 zone_id, uint32 instance_id)
+{
+	ZoneServer *zs  = nullptr;
+	size_t     idle = 0;
+	for (auto &e: zone_server_list) {
+		if (e->GetZoneID() == 0 && !e->IsBootingUp()) {
+			zs = e.get();
+			idle++;
+		}
+	}
+
+	if (!zs || idle <= static_cast<size_t>(std::max(RuleI(World, WarmZonePoolIdleReserve), 0))) {
+		return false;
+	}
+
+	LogInfo(
+		"Warm zone pool booting [{}] ({}) instance [{}] on zone server [{}]",
+		ZoneName(zone_id),
+		zone_id,
+		instance_id,
+		zs->GetID()
+	);
+
+	zs->TriggerBootup(zone_id, instance_id, nullptr, false, true);
+	m_warm_zones[zs->GetID()] = WarmZone{.zone_id = zone_id, .instance_id = instance_id, .booted_at = Timer::GetCurrentTime()};
+	m_warm_zone_boots++;
+
+	return true;
+}
+
+void ZSList::ShutdownWarmZone(ZoneServer *zs)
+{
+	LogInfo(
+		"Warm zone pool releasing [{}] ({}) instance [{}] on zone server [{}]",
+		ZoneName(zs->GetZoneID()),
+		zs->GetZoneID(),
+		zs->GetInstanceID(),
+		zs->GetID()
+	);
+
+	ServerPacket pack(ServerOP_ZoneShutdown, sizeof(ServerZoneStateChange_Struct));
+
+	auto s = (ServerZoneStateChange_Struct *) pack.pBuffer;
+	s->zone_server_id = zs->GetID();
+	s->zone_id        = zs->GetZoneID();
+	s->instance_id    = zs->GetInstanceID();
+	strn0cpy(s->admin_name, "Warm Zone Pool", sizeof(s->admin_name));
+
+	zs->SendPacket(&pack);
+}
+
+void ZSList::OnWarmZonePoolTick(EQ::Timer *t)
+{
+	const int hour = LocalHour();
+	if (hour != m_zone_entries_hour) {
+		if (m_zone_entries_hour != -1) {
+			for (auto &e: m_zone_entries) {
+				e.second[hour] *= 0.5f;
+			}
+		}
+
+		m_zone_entries_hour = hour;
+	}
+
+	const uint32 now           = Timer::GetCurrentTime();
+	const uint32 instance_hold = static_cast<uint32>(std::max(RuleI(World, WarmZonePoolInstanceHoldSeconds), 0)) * 1000;
+	const uint32 hold          = static_cast<uint32>(std::max(RuleI(World, WarmZonePoolHoldSeconds), 0)) * 1000;
+	const size_t pool_size     = static_cast<size_t>(std::max(RuleI(World, WarmZonePoolSize), 0));
+
+	// zones the pool should hold for this hour, the configured ones first
+	std::vector<uint32> targets;
+	if (pool_size) {
+		for (auto &name: Strings::Split(RuleS(World, WarmZonePoolZones), ',')) {
+			const uint32 zone_id = ZoneID(Strings::Trim(name));
+			if (zone_id && targets.size() < pool_size && std::find(targets.begin(), targets.end(), zone_id) == targets.end()) {
+				targets.emplace_back(zone_id);
+			}
+		}
+
+		// what players did at this hour on recent days, with a look at the next hour so a zone is up before its rush
+		std::vector<std::pair<float, uint32>> scored;
+		for (const auto &e: m_zone_entries) {
+			const float score = e.second[hour] + e.second[(hour + 1) % 24] * 0.5f;
+			if (score >= 1.0f) {
+				scored.emplace_back(score, e.first);
+			}
+		}
+
+		std::sort(
+			scored.begin(),
+			scored.end(),
+			[](const auto &a, const auto &b) {
+				return a.first > b.first;
+			}
+		);
+
+		for (const auto &e: scored) {
+			if (targets.size() >= pool_size) {
+				break;
+			}
+
+			if (std::find(targets.begin(), targets.end(), e.second) == targets.end()) {
+				targets.emplace_back(e.second);
+			}
+		}
+	}
+
+	// forget zones that were entered or went away, release the ones that are no longer wanted
+	for (auto e = m_warm_zones.begin(); e != m_warm_zones.end();) {
+		auto zs = FindByID(e->first);
+		if (
+			!zs ||
+			zs->GetZoneID() != e->second.zone_id ||
+			zs->GetInstanceID() != e->second.instance_id ||
+			zs->NumPlayers() > 0
+		) {
+			e = m_warm_zones.erase(e);
+			continue;
+		}
+
+		const uint32 held   = now - e->second.booted_at;
+		const bool   wanted = e->second.instance_id ?
+			held < instance_hold :
+			(!hold || held < hold) && std::find(targets.begin(), targets.end(), e->second.zone_id) != targets.end();
+
+		// a client asked for it a moment ago and is still zoning in
+		const bool entering = e->second.requested_at && now - e->second.requested_at < WARM_ZONE_ENTRY_GRACE_MS;
+
+		if (!wanted && !entering && !zs->IsBootingUp()) {
+			ShutdownWarmZone(zs);
+			e = m_warm_zones.erase(e);
+			continue;
+		}
+
+		++e;
+	}
+
+	for (auto zone_id: targets) {
+		if (!FindByZoneID(zone_id) && !BootWarmZone(zone_id, 0)) {
+			break;
+		}
+	}
+}
+
+void ZSList::SendWarmZonePoolStatus(const char *to, WorldTCPConnection *connection)
+{
+	const std::string nl  = connection->IsConsole() ? "\r\n" : "^";
+	const uint32      now = Timer::GetCurrentTime();
+
+	std::string out = fmt::format(
+		"Warm Zone Pool | Size [{}] Idle Reserve [{}] | Held [{}] | Boots [{}] Entered [{}]{}",
+		RuleI(World, WarmZonePoolSize),
+		RuleI(World, WarmZonePoolIdleReserve),
+		m_warm_zones.size(),
+		m_warm_zone_boots,
+		m_warm_zone_hits,
+		nl
+	);
+
+	for (const auto &e: m_warm_zones) {
+		out += fmt::format(
+			"  {} ({}) instance [{}] zone server [{}] held [{}]{}",
+			ZoneName(e.second.zone_id),
+			e.second.zone_id,
+			e.second.instance_id,
+			e.first,
+			Strings::SecondsToTime((now - e.second.booted_at) / 1000),
+			nl
+		);
+	}
+
+	if (m_zone_entries_hour != -1) {
+		std::vector<std::pair<float, uint32>> l;
+		for (const auto &e: m_zone_entries) {
+			l.emplace_back(e.second[m_zone_entries_hour], e.first);
+		}
+
+		std::sort(
+			l.begin(),
+			l.end(),
+			[](const auto &a, const auto &b) {
+				return a.first > b.first;
+			}
+		);
+
+		out += fmt::format("Most entered around hour [{}]{}", m_zone_entries_hour, nl);
+		for (size_t i = 0; i < l.size() && i < 10; ++i) {
+			out += fmt::format("  {} ({}) [{:.1f}]{}", ZoneName(l[i].second), l[i].second, l[i].first, nl);
+		}
+	}
+
+	auto percentiles = [&](const std::string &name, const EnterWorldSamples &s) {
+		if (s.samples.empty()) {
+			out += fmt::format("Enter World | {} | no samples{}", name, nl);
+			return;
+		}
+
+		std::vector<uint32> l = s.samples;
+		std::sort(l.begin(), l.end());
+
+		auto at = [&](double p) {
+			return l[std::min(l.size() - 1, static_cast<size_t>(p * l.size()))];
+		};
+
+		out += fmt::format(
+			"Enter World | {} | [{}] entries (last [{}]) | p50 [{}] ms p90 [{}] ms p99 [{}] ms{}",
+			name,
+			s.count,
+			l.size(),
+			at(0.50),
+			at(0.90),
+			at(0.99),
+			nl
+		);
+	};
+
+	percentiles("Zone Up", m_enter_world_booted);
+	percentiles("Zone Booted", m_enter_world_bootup);
+
+	connection->SendEmoteMessageRaw(to, 0, AccountStatus::Player, Chat::NPCQuestSay, out.c_str());
+}
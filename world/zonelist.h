@@ -6,9 +6,11 @@
 #include "../common/timer.h"
 #include "../common/event/timer.h"
 #include "../common/server_reload_types.h"
+#include <array>
 #include <vector>
 #include <memory>
 #include <deque>
+#include <unordered_map>
 
 class WorldTCPConnection;
 class ServerPacket;
@@ -73,8 +75,17 @@ public:
 
 	const std::list<std::unique_ptr<ZoneServer>> &getZoneServerList() const;
 	void SendServerReload(ServerReload::Type type, uchar *packet = nullptr);
+
+	// warm zone pool
+	void RecordZoneEntry(uint32 zone_id, uint32 instance_id);
+	void RecordEnterWorldTime(uint32 milliseconds, bool needed_bootup);
+	void WarmDynamicZone(uint32 zone_id, uint32 instance_id);
+	void SendWarmZonePoolStatus(const char *to, WorldTCPConnection *connection);
 private:
 	void OnTick(EQ::Timer *t);
+	void OnWarmZonePoolTick(EQ::Timer *t);
+	bool BootWarmZone(uint32 zone_id, uint32 instance_id);
+	void ShutdownWarmZone(ZoneServer *zs);
 	uint32 NextID;
 	uint16	pLockedZones[MaxLockedZones];
 	uint32 CurGroupID;
@@ -83,6 +94,34 @@ private:
 	std::unique_ptr<EQ::Timer> m_keepalive;
 
 	std::list<std::unique_ptr<ZoneServer>> zone_server_list;
+
+	// Entries per zone for each local hour of the day. When an hour comes around again the counts from the previous
+	// days are halved, so the pool follows what players did lately at this time of day.
+	std::unordered_map<uint32, std::array<float, 24>> m_zone_entries;
+	int                                               m_zone_entries_hour = -1;
+
+	struct WarmZone {
+		uint32 zone_id;
+		uint32 instance_id;
+		uint32 booted_at;
+		uint32 requested_at = 0;
+	};
+
+	// zone server id to the zone the pool booted on it, until a client enters it
+	std::unordered_map<uint32, WarmZone> m_warm_zones;
+	std::unique_ptr<EQ::Timer>           m_warm_pool_tick;
+	uint64                               m_warm_zone_hits  = 0;
+	uint64                               m_warm_zone_boots = 0;
+
+	// the last time to enter world samples, kept apart for zones that were up and zones that had to be booted
+	struct EnterWorldSamples {
+		std::vector<uint32> samples;
+		size_t              next  = 0;
+		uint64              count = 0;
+	};
+
+	EnterWorldSamples m_enter_world_booted;
+	EnterWorldSamples m_enter_world_bootup;
 };
 
 #endif /*ZONELIST_H_*/
@@ -848,6 +848,8 @@ void ZoneServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p) {
 					break;
 				}
 
+				zoneserver_list.RecordZoneEntry(ztz->requested_zone_id, ztz->requested_instance_id);
+
 				auto ingress_server = (
 					ztz->requested_instance_id ?
 					zoneserver_list.FindByInstanceID(ztz->requested_instance_id) :
@@ -1365,6 +1367,7 @@ void ZoneServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p) {
 			QSLink.SendPacket(pack);
 			break;
 		}
+		case ServerOP_BazaarListingsChanged:
 		case ServerOP_CZDialogueWindow:
 		case ServerOP_CZLDoNUpdate:
 		case ServerOP_CZMarquee:
@@ -1807,7 +1810,7 @@ void ZoneServer::ChangeWID(uint32 iCharID, uint32 iWID) {
 }
 
 
-void ZoneServer::TriggerBootup(uint32 in_zone_id, uint32 in_instance_id, const char* admin_name, bool is_static_zone) {
+void ZoneServer::TriggerBootup(uint32 in_zone_id, uint32 in_instance_id, const char* admin_name, bool is_static_zone, bool is_warm) {
 	is_booting_up       = true;
 	zone_server_zone_id = in_zone_id;
 	instance_id         = in_instance_id;
@@ -1820,6 +1823,7 @@ void ZoneServer::TriggerBootup(uint32 in_zone_id, uint32 in_instance_id, const c
 	s->zone_id     = in_zone_id ? in_zone_id : GetZoneID();
 	s->instance_id = in_instance_id;
 	s->is_static   = is_static_zone;
+	s->is_warm     = is_warm;
 
 	if (admin_name) {
 		strn0cpy(s->admin_name, admin_name, sizeof(s->admin_name));
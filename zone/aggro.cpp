@@ -371,8 +371,10 @@ void NPC::DescribeAggro(Client *to_who, Mob *mob, bool verbose) {
 /*
 	If you change this function, you should update the above function
 	to keep the #aggro command accurate.
+
+	Everything CheckWillAggro looks at except line of sight, so scans over many mobs can cast their rays in one batch.
 */
-bool Mob::CheckWillAggro(Mob *mob) {
+bool Mob::CheckWillAggroExceptLoS(Mob *mob) {
 	if(!mob) {
 		return false;
 	}
@@ -530,10 +532,7 @@ bool Mob::CheckWillAggro(Mob *mob) {
 			)
 		)
 	) {
-		if(CheckLosFN(mob)) {
-			LogAggro("Check aggro for [{}] target [{}]", GetName(), mob->GetName());
-			return true;
-		}
+		return true;
 	} else {
 		if (
 			(
@@ -559,10 +558,7 @@ bool Mob::CheckWillAggro(Mob *mob) {
 				)
 			)
 		) {
-			if(CheckLosFN(mob)) {
-				LogAggro("Check aggro for [{}] target [{}]", GetName(), mob->GetName());
-				return true;
-			}
+			return true;
 		}
 	}
 
@@ -577,6 +573,20 @@ bool Mob::CheckWillAggro(Mob *mob) {
 	return false;
 }
 
+bool Mob::CheckWillAggro(Mob *mob) {
+	if (!CheckWillAggroExceptLoS(mob)) {
+		return false;
+	}
+
+	if (!CheckLosFN(mob)) {
+		LogAggro("[{}] can not see [{}]", GetName(), mob->GetName());
+		return false;
+	}
+
+	LogAggro("Check aggro for [{}] target [{}]", GetName(), mob->GetName());
+	return true;
+}
+
 bool Mob::IsPetAggroExempt(Mob* pet_owner) {
 	if (!pet_owner) {
 		return false;
@@ -1303,6 +1313,18 @@ bool Mob::CheckLosFN(Mob *other)
 	return Result;
 }
 
+#define LOS_DEFAULT_HEIGHT 6.0f
+
+void Mob::GetLosEndpoints(float posX, float posY, float posZ, float mobSize, glm::vec3 &myloc, glm::vec3 &oloc) {
+	myloc.x = GetX();
+	myloc.y = GetY();
+	myloc.z = GetZ() + (GetSize()==0.0?LOS_DEFAULT_HEIGHT:GetSize())/2 * HEAD_POSITION;
+
+	oloc.x = posX;
+	oloc.y = posY;
+	oloc.z = posZ + (mobSize==0.0?LOS_DEFAULT_HEIGHT:mobSize)/2 * SEE_POSITION;
+}
+
 bool Mob::CheckLosFN(float posX, float posY, float posZ, float mobSize) {
 	if(zone->zonemap == nullptr) {
 		//not sure what the best return is on error
@@ -1317,19 +1339,22 @@ bool Mob::CheckLosFN(float posX, float posY, float posZ, float mobSize) {
 	glm::vec3 myloc;
 	glm::vec3 oloc;
 
-#define LOS_DEFAULT_HEIGHT 6.0f
-
-	myloc.x = GetX();
-	myloc.y = GetY();
-	myloc.z = GetZ() + (GetSize()==0.0?LOS_DEFAULT_HEIGHT:GetSize())/2 * HEAD_POSITION;
-
-	oloc.x = posX;
-	oloc.y = posY;
-	oloc.z = posZ + (mobSize==0.0?LOS_DEFAULT_HEIGHT:mobSize)/2 * SEE_POSITION;
+	GetLosEndpoints(posX, posY, posZ, mobSize, myloc, oloc);
 
 #if LOSDEBUG>=5
 	LogDebug("LOS from ([{}], [{}], [{}]) to ([{}], [{}], [{}]) sizes: ([{}], [{}])", myloc.x, myloc.y, myloc.z, oloc.x, oloc.y, oloc.z, GetSize(), mobSize);
 #endif
+
+	// the parallel prepare phase already cast this exact ray this tick
+	if (
+		m_ai_intent.has_los &&
+		m_ai_intent.frame == entity_list.GetParallelAI().GetFrame() &&
+		m_ai_intent.los_from == myloc &&
+		m_ai_intent.los_to == oloc
+	) {
+		return m_ai_intent.los;
+	}
+
 	return zone->zonemap->CheckLoS(myloc, oloc);
 }
 
@@ -21,6 +21,7 @@
 #include "../common/item_instance.h"
 #include "../common/rulesys.h"
 #include "../common/spdat.h"
+#include "../common/tick_profiler.h"
 
 #include "client.h"
 #include "entity.h"
@@ -39,6 +40,8 @@
 
 void Mob::CalcBonuses()
 {
+	TICK_PROFILE("Mob::CalcBonuses");
+
 	CalcSpellBonuses(&spellbonuses);
 	CalcAABonuses(&aabonuses);
 	CalcMaxHP();
@@ -55,8 +58,18 @@ void Mob::CalcBonuses()
 	rooted = FindType(SE_Root);
 }
 
+// only clients keep the layers apart, everyone else recalculates everything
+void Mob::CalcBonusLayers(uint8 layers)
+{
+	m_calc_bonus_layers = layers;
+	CalcBonuses();
+	m_calc_bonus_layers = BonusLayer::All;
+}
+
 void NPC::CalcBonuses()
 {
+	TICK_PROFILE("NPC::CalcBonuses");
+
 	memset(&itembonuses, 0, sizeof(StatBonuses));
 
 	if (GetOwner() || RuleB(NPC, UseItemBonusesForNonPets)) {
@@ -69,12 +82,52 @@ void NPC::CalcBonuses()
 
 void Client::CalcBonuses()
 {
-	memset(&itembonuses, 0, sizeof(StatBonuses));
-	CalcItemBonuses(&itembonuses);
-	CalcHeroicBonuses(&itembonuses);
-	CalcEdibleBonuses(&itembonuses);
-	CalcSpellBonuses(&spellbonuses);
-	CalcAABonuses(&aabonuses);
+	TICK_PROFILE("Client::CalcBonuses");
+
+	InvalidateFocusCache();
+
+	// layers asked for plus anything marked dirty or never built
+	const uint8 layers = m_calc_bonus_layers | m_dirty_bonus_layers | (BonusLayer::All & ~m_valid_bonus_layers);
+
+	m_dirty_bonus_layers = 0;
+	m_valid_bonus_layers = BonusLayer::All;
+
+	if (layers & BonusLayer::Items) {
+		CalcItemBonusLayer();
+	}
+
+	if (layers & BonusLayer::AAs) {
+		CalcAABonuses(&m_aa_bonus_layer);
+	}
+
+	memcpy(&itembonuses, &m_item_bonus_layer, sizeof(StatBonuses));
+
+	// negation zeroes parts of the item and spell bonuses in place, it runs again on the copies whenever the buffs
+	// are not recalculated. AA bonuses are copied after it just like they used to be recalculated after it
+	if (layers & BonusLayer::Spells) {
+		CalcSpellBonuses(&spellbonuses);
+		memcpy(&m_spell_bonus_layer, &spellbonuses, sizeof(StatBonuses));
+	}
+	else {
+		memcpy(&spellbonuses, &m_spell_bonus_layer, sizeof(StatBonuses));
+		NegateBuffBonuses();
+	}
+
+	memcpy(&aabonuses, &m_aa_bonus_layer, sizeof(StatBonuses));
+
+	// item ATK is capped with the spell and AA ItemATKCap, a buff or AA that moved them rebuilds the item layer
+	// against the new totals instead of leaving item ATK clamped at the old cap
+	if (spellbonuses.ItemATKCap + aabonuses.ItemATKCap != m_item_bonus_layer_atk_cap) {
+		CalcItemBonusLayer();
+
+		memcpy(&itembonuses, &m_item_bonus_layer, sizeof(StatBonuses));
+		NegateBuffBonuses();
+		memcpy(&aabonuses, &m_aa_bonus_layer, sizeof(StatBonuses));
+	}
+
+	if (layers != BonusLayer::All && RuleB(Character, ValidateBonusLayers)) {
+		ValidateBonusLayers(layers);
+	}
 
 	CalcSeeInvisibleLevel();
 	CalcInvisibleLevel();
@@ -127,6 +180,64 @@ void Client::CalcBonuses()
 	}
 }
 
+void Client::CalcItemBonusLayer()
+{
+	m_item_bonus_layer_atk_cap = spellbonuses.ItemATKCap + aabonuses.ItemATKCap;
+
+	memset(&m_item_bonus_layer, 0, sizeof(StatBonuses));
+	CalcItemBonuses(&m_item_bonus_layer);
+	CalcHeroicBonuses(&m_item_bonus_layer);
+	CalcEdibleBonuses(&m_item_bonus_layer);
+}
+
+// the full recalculation is kept, a mismatch means some change skipped the layer it touched
+void Client::ValidateBonusLayers(uint8 layers)
+{
+	auto layered = std::make_unique<StatBonuses[]>(3);
+
+	memcpy(&layered[0], &itembonuses, sizeof(StatBonuses));
+	memcpy(&layered[1], &spellbonuses, sizeof(StatBonuses));
+	memcpy(&layered[2], &aabonuses, sizeof(StatBonuses));
+
+	memset(&itembonuses, 0, sizeof(StatBonuses));
+	CalcItemBonuses(&itembonuses);
+	CalcHeroicBonuses(&itembonuses);
+	CalcEdibleBonuses(&itembonuses);
+	CalcSpellBonuses(&spellbonuses);
+	CalcAABonuses(&aabonuses);
+
+	const std::vector<std::pair<std::string, const StatBonuses *>> l = {
+		{"item",  &itembonuses},
+		{"spell", &spellbonuses},
+		{"aa",    &aabonuses},
+	};
+
+	bool mismatch = false;
+	for (size_t i = 0; i < l.size(); ++i) {
+		const auto *a = reinterpret_cast<const uint8 *>(&layered[i]);
+		const auto *b = reinterpret_cast<const uint8 *>(l[i].second);
+
+		for (size_t offset = 0; offset < sizeof(StatBonuses); ++offset) {
+			if (a[offset] != b[offset]) {
+				LogError(
+					"Bonus layer mismatch for [{}] recalculating layers [{}], [{}] bonuses differ first at byte [{}]",
+					GetCleanName(),
+					layers,
+					l[i].first,
+					offset
+				);
+				mismatch = true;
+				break;
+			}
+		}
+	}
+
+	// raw layers cannot be recovered from the negated results, build them again next time
+	if (mismatch) {
+		m_valid_bonus_layers = 0;
+	}
+}
+
 int Mob::CalcRecommendedLevelBonus(uint8 current_level, uint8 recommended_level, int base_stat)
 {
 	if (recommended_level && current_level < recommended_level) {
@@ -355,7 +466,7 @@ void Mob::AddItemBonuses(const EQ::ItemInstance* inst, StatBonuses* b, bool is_a
 	b->EnduranceRegen += CalcItemBonus(item->EnduranceRegen);
 
 	// These have rule-configured caps.
-	b->ATK              = CalcCappedItemBonus(b->ATK, item->Attack, RuleI(Character, ItemATKCap) + itembonuses.ItemATKCap + spellbonuses.ItemATKCap + aabonuses.ItemATKCap);
+	b->ATK              = CalcCappedItemBonus(b->ATK, item->Attack, RuleI(Character, ItemATKCap) + b->ItemATKCap + spellbonuses.ItemATKCap + aabonuses.ItemATKCap);
 	b->DamageShield     = CalcCappedItemBonus(b->DamageShield, item->DamageShield, RuleI(Character, ItemDamageShieldCap));
 	b->SpellShield      = CalcCappedItemBonus(b->SpellShield, item->SpellShield, RuleI(Character, ItemSpellShieldingCap));
 	b->MeleeMitigation  = CalcCappedItemBonus(b->MeleeMitigation, item->Shielding, RuleI(Character, ItemShieldingCap));
@@ -1892,13 +2003,7 @@ void Mob::CalcSpellBonuses(StatBonuses* newbon)
 	if (IsNPC())
 		CastToNPC()->ApplyAISpellEffects(newbon);
 
-	//Disables a specific spell effect bonus completely, can also be limited to negate only item, AA or spell bonuses.
-	if (spellbonuses.NegateEffects){
-		for(i = 0; i < buff_count; i++) {
-			if(IsValidSpell(buffs[i].spellid) && (IsEffectInSpell(buffs[i].spellid, SE_NegateSpellEffect)) )
-				NegateSpellEffectBonuses(buffs[i].spellid);
-		}
-	}
+	NegateBuffBonuses();
 
 	if (!RuleB(Custom, MulticlassingEnabled)) {
 		if (HasClass(Class::Bard))
@@ -1906,6 +2011,21 @@ void Mob::CalcSpellBonuses(StatBonuses* newbon)
 	}
 }
 
+//Disables a specific spell effect bonus completely, can also be limited to negate only item, AA or spell bonuses.
+void Mob::NegateBuffBonuses()
+{
+	if (!spellbonuses.NegateEffects) {
+		return;
+	}
+
+	const int buff_count = GetMaxTotalSlots();
+	for (int i = 0; i < buff_count; i++) {
+		if (IsValidSpell(buffs[i].spellid) && IsEffectInSpell(buffs[i].spellid, SE_NegateSpellEffect)) {
+			NegateSpellEffectBonuses(buffs[i].spellid);
+		}
+	}
+}
+
 void Mob::ApplySpellsBonuses(uint16 spell_id, uint8 casterlevel, StatBonuses *new_bonus, uint16 casterId,
 			     uint8 WornType, int32 ticsremaining, int buffslot, int instrument_mod,
 			     bool IsAISpellEffect, uint16 effect_id, int32 se_base, int32 se_limit, int32 se_max)
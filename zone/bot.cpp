@@ -28,6 +28,7 @@
 #include "../common/data_verification.h"
 #include "../common/repositories/criteria/content_filter_criteria.h"
 #include "../common/skill_caps.h"
+#include "../common/tick_profiler.h"
 
 /*
 TODO bot rewrite:
@@ -2106,6 +2107,8 @@ void Bot::AI_Process()
 #define PASSIVE (GetBotStance() == Stance::Passive)
 #define NOT_PASSIVE (GetBotStance() != Stance::Passive)
 
+	TICK_PROFILE("Bot::AI_Process");
+
 	Client* bot_owner = (GetBotOwner() && GetBotOwner()->IsClient() ? GetBotOwner()->CastToClient() : nullptr);
 
 	if (!bot_owner) {
@@ -2762,7 +2765,7 @@ bool Bot::TryMeditate() {
 			}
 
 			for (auto mob : hate_list.GetHateList()) {
-				auto tar = mob->entity_on_hatelist;
+				auto tar = mob->GetEnt();
 
 				if (tar) {
 					Mob* tar_target = tar->GetTarget();
@@ -3313,7 +3316,7 @@ bool Bot::PullingFlagChecks(Client* bot_owner) {
 
 		return false;
 	}
-	else if (GetTarget()->GetHateList().size()) {
+	else if (GetTarget()->GetHateListCount()) {
 		SetPullingFlag(false);
 		SetReturningFlag();
 
@@ -6263,6 +6266,10 @@ bool Bot::DoFinishedSpellGroupTarget(uint16 spell_id, Mob* spellTarget, EQ::spel
 }
 
 void Bot::CalcBonuses() {
+	TICK_PROFILE("Bot::CalcBonuses");
+
+	InvalidateFocusCache();
+
 	memset(&itembonuses, 0, sizeof(StatBonuses));
 	GenerateBaseStats();
 	CalcItemBonuses(&itembonuses);
@@ -7492,6 +7499,7 @@ void EntityList::AddBot(Bot *new_bot, bool send_spawn_packet, bool dont_queue) {
 		new_bot->SetID(GetFreeID());
 		bot_list.emplace(std::pair<uint16, Bot*>(new_bot->GetID(), new_bot));
 		mob_list.emplace(std::pair<uint16, Mob*>(new_bot->GetID(), new_bot));
+		m_spatial_grid.Add(new_bot);
 
 		if (parse->BotHasQuestSub(EVENT_SPAWN)) {
 			parse->EventBot(EVENT_SPAWN, new_bot, nullptr, "", 0);
@@ -12667,8 +12675,54 @@ const std::vector<BotSpells_wIndex>& Bot::BotGetSpellsByType(uint16 spell_type)
 	return it->second;
 }
 
+const std::vector<BotSpellCandidate>& Bot::GetBotSpellCandidates(uint16 spell_type) {
+	auto it = m_bot_spell_candidates.find(spell_type);
+
+	if (it != m_bot_spell_candidates.end()) {
+		return it->second;
+	}
+
+	// everything here only depends on the spell and the type, built the first time a type is asked for after the
+	// list is (re)loaded and kept in the order the lookups have always walked it, lowest priority value first
+	auto& l = m_bot_spell_candidates[spell_type];
+
+	const std::vector<BotSpells_wIndex>& bot_spell_list = BotGetSpellsByType(spell_type);
+
+	for (int i = bot_spell_list.size() - 1; i >= 0; i--) {
+		const auto& s = bot_spell_list[i];
+
+		if (!IsValidSpell(s.spellid)) {
+			continue;
+		}
+
+		if (
+			(s.type != spell_type && s.type != GetParentSpellType(spell_type)) ||
+			!IsValidSpellTypeBySpellID(spell_type, s.spellid)
+		) {
+			continue;
+		}
+
+		l.emplace_back(
+			BotSpellCandidate{
+				.index             = s.index,
+				.spellid           = static_cast<uint16>(s.spellid),
+				.manacost          = s.manacost,
+				.priority          = s.priority,
+				.requires_los      = BotRequiresLoSToCast(spell_type, s.spellid),
+				.is_any_ae         = IsAnyAESpell(s.spellid),
+				.is_group          = IsGroupSpell(s.spellid),
+				.is_pbae           = IsPBAESpell(s.spellid),
+				.is_tgb_compatible = IsTGBCompatibleSpell(s.spellid)
+			}
+		);
+	}
+
+	return l;
+}
+
 void Bot::AssignBotSpellsToTypes(std::vector<BotSpells>& AIBot_spells, std::unordered_map<uint16, std::vector<BotSpells_wIndex>>& AIBot_spells_by_type) {
 	AIBot_spells_by_type.clear();
+	m_bot_spell_candidates.clear();
 
 	for (size_t i = 0; i < AIBot_spells.size(); ++i) {
 		const auto& spell = AIBot_spells[i];
@@ -324,6 +324,8 @@ public:
 	uint32 BotGetSpellType(int spellslot) { return AIBot_spells[spellslot].type; }
 	uint16 BotGetSpellPriority(int spellslot) { return AIBot_spells[spellslot].priority; }
 	const std::vector<BotSpells_wIndex>& BotGetSpellsByType(uint16 spell_type) const;
+	const std::vector<BotSpellCandidate>& GetBotSpellCandidates(uint16 spell_type);
+	void ClearBotSpellCandidates() { m_bot_spell_candidates.clear(); }
 	float GetProcChances(float ProcBonus, uint16 hand) override;
 	int GetHandToHandDamage(void) override;
 	bool TryFinishingBlow(Mob *defender, int64 &damage) override;
@@ -750,8 +752,9 @@ public:
 
 	static std::list<BotSpell> GetBotSpellsForSpellEffect(Bot* caster, uint16 spell_type, int spell_effect);
 	static std::list<BotSpell> GetBotSpellsForSpellEffectAndTargetType(Bot* caster, uint16 spell_type, int spell_effect, SpellTargetType target_type);
-	static std::list<BotSpell> GetBotSpellsBySpellType(Bot* caster, uint16 spell_type);
-	static std::vector<BotSpell_wPriority> GetPrioritizedBotSpellsBySpellType(Bot* caster, uint16 spell_type, Mob* tar, bool AE = false, uint16 sub_target_type = UINT16_MAX, uint16 sub_type = UINT16_MAX);
+	// both return a buffer owned by the caster, valid until the next call for that bot
+	static const std::vector<BotSpell>& GetBotSpellsBySpellType(Bot* caster, uint16 spell_type);
+	static const std::vector<BotSpell_wPriority>& GetPrioritizedBotSpellsBySpellType(Bot* caster, uint16 spell_type, Mob* tar, bool AE = false, uint16 sub_target_type = UINT16_MAX, uint16 sub_type = UINT16_MAX);
 
 	static BotSpell GetFirstBotSpellBySpellType(Bot* caster, uint16 spell_type);
 	BotSpell GetSpellByHealType(uint16 spell_type, Mob* tar);
@@ -1148,6 +1151,9 @@ protected:
 	std::vector<BotSpells> AIBot_spells;
 	std::vector<BotSpells> AIBot_spells_enforced;
 	std::unordered_map<uint16, std::vector<BotSpells_wIndex>> AIBot_spells_by_type;
+	std::unordered_map<uint16, std::vector<BotSpellCandidate>> m_bot_spell_candidates;
+	std::vector<BotSpell> m_bot_spell_results;
+	std::vector<BotSpell_wPriority> m_prioritized_bot_spell_results;
 
 	std::vector<BotTimer> bot_timers;
 	std::vector<BotBlockedBuffs> bot_blocked_buffs;
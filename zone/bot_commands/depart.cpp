@@ -145,9 +145,9 @@ void bot_command_depart(Client* c, const Seperator* sep)
 			continue;
 		}
 
-		std::vector<BotSpell_wPriority> bot_spell_list_itr = bot_iter->GetPrioritizedBotSpellsBySpellType(bot_iter, BotSpellTypes::Teleport, tar);
+		const std::vector<BotSpell_wPriority>& bot_spell_list_itr = bot_iter->GetPrioritizedBotSpellsBySpellType(bot_iter, BotSpellTypes::Teleport, tar);
 
-		for (std::vector<BotSpell_wPriority>::iterator itr = bot_spell_list_itr.begin(); itr != bot_spell_list_itr.end(); ++itr) {
+		for (std::vector<BotSpell_wPriority>::const_iterator itr = bot_spell_list_itr.begin(); itr != bot_spell_list_itr.end(); ++itr) {
 			if (!IsValidSpell(itr->SpellId)) {
 				continue;
 			}
@@ -54,7 +54,7 @@ void bot_command_pull(Client *c, const Seperator *sep)
 		return;
 	}
 
-	if (target_mob->IsNPC() && target_mob->GetHateList().size()) {
+	if (target_mob->IsNPC() && target_mob->GetHateListCount()) {
 
 		c->Message(Chat::White, "Your current target is already engaged!");
 		return;
@@ -100,6 +100,20 @@ struct BotSpells_wIndex {
 	uint8		bucket_comparison;
 };
 
+// an AIBot_spells entry that passed the static checks for one requested spell type, only recast and LoS are left
+// to check when casting
+struct BotSpellCandidate {
+	uint32		index;			//index of AIBot_spells
+	uint16		spellid;
+	int16		manacost;
+	int16		priority;
+	bool		requires_los;
+	bool		is_any_ae;
+	bool		is_group;
+	bool		is_pbae;
+	bool		is_tgb_compatible;
+};
+
 struct BotTimer {
 	uint32		timer_id;
 	uint32		timer_value;
@@ -215,7 +215,7 @@ bool Bot::AICastSpell(Mob* tar, uint8 chance, uint16 spell_type, uint16 sub_targ
 			break;
 	}
 
-	std::vector<BotSpell_wPriority> bot_spell_list = GetPrioritizedBotSpellsBySpellType(this, spell_type, tar, (IsAEBotSpellType(spell_type) || sub_target_type == CommandedSubTypes::AETarget), sub_target_type, sub_type);
+	const std::vector<BotSpell_wPriority>& bot_spell_list = GetPrioritizedBotSpellsBySpellType(this, spell_type, tar, (IsAEBotSpellType(spell_type) || sub_target_type == CommandedSubTypes::AETarget), sub_target_type, sub_type);
 
 	for (const auto& s : bot_spell_list) {
 		if (!IsValidSpell(s.SpellId)) {
@@ -273,7 +273,7 @@ bool Bot::AICastSpell(Mob* tar, uint8 chance, uint16 spell_type, uint16 sub_targ
 }
 
 bool Bot::BotCastMez(Mob* tar, uint8 bot_class, BotSpell& bot_spell, uint16 spell_type) {
-	std::vector<BotSpell_wPriority> bot_spell_list = GetPrioritizedBotSpellsBySpellType(this, spell_type, tar, IsAEBotSpellType(spell_type));
+	const std::vector<BotSpell_wPriority>& bot_spell_list = GetPrioritizedBotSpellsBySpellType(this, spell_type, tar, IsAEBotSpellType(spell_type));
 
 	for (const auto& s : bot_spell_list) {
 		if (!IsValidSpell(s.SpellId)) {
@@ -468,7 +468,7 @@ bool Bot::BotCastNuke(Mob* tar, uint8 bot_class, BotSpell& bot_spell, uint16 spe
 	}
 
 	if (!IsValidSpell(bot_spell.SpellId)) {
-		std::vector<BotSpell_wPriority> bot_spell_list = GetPrioritizedBotSpellsBySpellType(this, spell_type, tar, IsAEBotSpellType(spell_type));
+		const std::vector<BotSpell_wPriority>& bot_spell_list = GetPrioritizedBotSpellsBySpellType(this, spell_type, tar, IsAEBotSpellType(spell_type));
 
 		for (const auto& s : bot_spell_list) {
 			if (!IsValidSpell(s.SpellId)) {
@@ -926,27 +926,19 @@ std::list<BotSpell> Bot::GetBotSpellsForSpellEffect(Bot* caster, uint16 spell_ty
 	}
 
 	if (caster->AI_HasSpells()) {
-		const std::vector<BotSpells_wIndex>& bot_spell_list = caster->BotGetSpellsByType(spell_type);
-
-		for (int i = bot_spell_list.size() - 1; i >= 0; i--) {
-			if (!IsValidSpell(bot_spell_list[i].spellid)) {
-				continue;
-			}
-
-			if (BotRequiresLoSToCast(spell_type, bot_spell_list[i].spellid) && !caster->HasLoS()) {
+		for (const auto& c : caster->GetBotSpellCandidates(spell_type)) {
+			if (c.requires_los && !caster->HasLoS()) {
 				continue;
 			}
 
 			if (
-				caster->CheckSpellRecastTimer(bot_spell_list[i].spellid) &&
-				(bot_spell_list[i].type == spell_type || bot_spell_list[i].type == GetParentSpellType(spell_type)) &&
-				caster->IsValidSpellTypeBySpellID(spell_type, bot_spell_list[i].spellid) &&
-				(IsEffectInSpell(bot_spell_list[i].spellid, spell_effect) || GetSpellTriggerSpellID(bot_spell_list[i].spellid, spell_effect))
+				caster->CheckSpellRecastTimer(c.spellid) &&
+				(IsEffectInSpell(c.spellid, spell_effect) || GetSpellTriggerSpellID(c.spellid, spell_effect))
 			) {
 				BotSpell bot_spell;
-				bot_spell.SpellId = bot_spell_list[i].spellid;
-				bot_spell.SpellIndex = bot_spell_list[i].index;
-				bot_spell.ManaCost = bot_spell_list[i].manacost;
+				bot_spell.SpellId = c.spellid;
+				bot_spell.SpellIndex = c.index;
+				bot_spell.ManaCost = c.manacost;
 
 				result.push_back(bot_spell);
 			}
@@ -968,31 +960,23 @@ std::list<BotSpell> Bot::GetBotSpellsForSpellEffectAndTargetType(Bot* caster, ui
 	}
 
 	if (caster->AI_HasSpells()) {
-		const std::vector<BotSpells_wIndex>& bot_spell_list = caster->BotGetSpellsByType(spell_type);
-
-		for (int i = bot_spell_list.size() - 1; i >= 0; i--) {
-			if (!IsValidSpell(bot_spell_list[i].spellid)) {
-				continue;
-			}
-
-			if (BotRequiresLoSToCast(spell_type, bot_spell_list[i].spellid) && !caster->HasLoS()) {
+		for (const auto& c : caster->GetBotSpellCandidates(spell_type)) {
+			if (c.requires_los && !caster->HasLoS()) {
 				continue;
 			}
 
 			if (
-				caster->CheckSpellRecastTimer(bot_spell_list[i].spellid) &&
-				(bot_spell_list[i].type == spell_type || bot_spell_list[i].type == GetParentSpellType(spell_type)) &&
-				caster->IsValidSpellTypeBySpellID(spell_type, bot_spell_list[i].spellid) &&
+				caster->CheckSpellRecastTimer(c.spellid) &&
 				(
-					IsEffectInSpell(bot_spell_list[i].spellid, spell_effect) ||
-					GetSpellTriggerSpellID(bot_spell_list[i].spellid, spell_effect)
+					IsEffectInSpell(c.spellid, spell_effect) ||
+					GetSpellTriggerSpellID(c.spellid, spell_effect)
 				) &&
-				(target_type == ST_TargetOptional || spells[bot_spell_list[i].spellid].target_type == target_type)
+				(target_type == ST_TargetOptional || spells[c.spellid].target_type == target_type)
 			) {
 				BotSpell bot_spell;
-				bot_spell.SpellId = bot_spell_list[i].spellid;
-				bot_spell.SpellIndex = bot_spell_list[i].index;
-				bot_spell.ManaCost = bot_spell_list[i].manacost;
+				bot_spell.SpellId = c.spellid;
+				bot_spell.SpellIndex = c.index;
+				bot_spell.ManaCost = c.manacost;
 				result.push_back(bot_spell);
 			}
 		}
@@ -1001,40 +985,35 @@ std::list<BotSpell> Bot::GetBotSpellsForSpellEffectAndTargetType(Bot* caster, ui
 	return result;
 }
 
-std::list<BotSpell> Bot::GetBotSpellsBySpellType(Bot* caster, uint16 spell_type) {
-	std::list<BotSpell> result;
+const std::vector<BotSpell>& Bot::GetBotSpellsBySpellType(Bot* caster, uint16 spell_type) {
+	static const std::vector<BotSpell> empty;
 
 	if (!caster) {
-		return result;
+		return empty;
 	}
 
+	auto& result = caster->m_bot_spell_results;
+
+	// cleared rather than rebuilt, the buffer keeps its capacity between calls
+	result.clear();
+
 	if (auto bot_owner = caster->GetBotOwner(); !bot_owner) {
 		return result;
 	}
 
 	if (caster->AI_HasSpells()) {
-		const std::vector<BotSpells_wIndex>& bot_spell_list = caster->BotGetSpellsByType(spell_type);
-
-		for (int i = bot_spell_list.size() - 1; i >= 0; i--) {
-			if (!IsValidSpell(bot_spell_list[i].spellid)) {
+		for (const auto& c : caster->GetBotSpellCandidates(spell_type)) {
+			if (c.requires_los && !caster->HasLoS()) {
 				continue;
 			}
 
-			if (BotRequiresLoSToCast(spell_type, bot_spell_list[i].spellid) && !caster->HasLoS()) {
-				continue;
-			}
-
-			if (
-				caster->CheckSpellRecastTimer(bot_spell_list[i].spellid) &&
-				(bot_spell_list[i].type == spell_type || bot_spell_list[i].type == GetParentSpellType(spell_type)) &&
-				caster->IsValidSpellTypeBySpellID(spell_type, bot_spell_list[i].spellid)
-			) {
+			if (caster->CheckSpellRecastTimer(c.spellid)) {
 				BotSpell bot_spell;
-				bot_spell.SpellId = bot_spell_list[i].spellid;
-				bot_spell.SpellIndex = bot_spell_list[i].index;
-				bot_spell.ManaCost = bot_spell_list[i].manacost;
+				bot_spell.SpellId = c.spellid;
+				bot_spell.SpellIndex = c.index;
+				bot_spell.ManaCost = c.manacost;
 
-				result.push_back(bot_spell);
+				result.emplace_back(bot_spell);
 			}
 		}
 	}
@@ -1042,46 +1021,44 @@ std::list<BotSpell> Bot::GetBotSpellsBySpellType(Bot* caster, uint16 spell_type)
 	return result;
 }
 
-std::vector<BotSpell_wPriority> Bot::GetPrioritizedBotSpellsBySpellType(Bot* caster, uint16 spell_type, Mob* tar, bool AE, uint16 sub_target_type, uint16 sub_type) {
-	std::vector<BotSpell_wPriority> result;
+const std::vector<BotSpell_wPriority>& Bot::GetPrioritizedBotSpellsBySpellType(Bot* caster, uint16 spell_type, Mob* tar, bool AE, uint16 sub_target_type, uint16 sub_type) {
+	static const std::vector<BotSpell_wPriority> empty;
 
-	if (caster && caster->AI_HasSpells()) {
-		const std::vector<BotSpells_wIndex>& bot_spell_list = caster->BotGetSpellsByType(spell_type);
+	if (!caster) {
+		return empty;
+	}
 
-		for (int i = bot_spell_list.size() - 1; i >= 0; i--) {
-			if (!IsValidSpell(bot_spell_list[i].spellid)) {
-				continue;
-			}
+	auto& result = caster->m_prioritized_bot_spell_results;
 
-			if (BotRequiresLoSToCast(spell_type, bot_spell_list[i].spellid) && !caster->HasLoS()) {
+	result.clear();
+
+	if (caster->AI_HasSpells()) {
+		for (const auto& c : caster->GetBotSpellCandidates(spell_type)) {
+			if (c.requires_los && !caster->HasLoS()) {
 				continue;
 			}
 
 			if (spell_type == BotSpellTypes::HateRedux && caster->GetClass() == Class::Bard) {
-				if (spells[bot_spell_list[i].spellid].target_type != ST_Target) {
+				if (spells[c.spellid].target_type != ST_Target) {
 					continue;
 				}
 			}
 
-			if (
-				caster->CheckSpellRecastTimer(bot_spell_list[i].spellid) &&
-				(bot_spell_list[i].type == spell_type || bot_spell_list[i].type == GetParentSpellType(spell_type)) &&
-				caster->IsValidSpellTypeBySpellID(spell_type, bot_spell_list[i].spellid)
-			) {
+			if (caster->CheckSpellRecastTimer(c.spellid)) {
 				if (
 					caster->IsCommandedSpell() &&
 					(
-						!caster->IsValidSpellTypeSubType(spell_type, sub_target_type, bot_spell_list[i].spellid) ||
-						!caster->IsValidSpellTypeSubType(spell_type, sub_type, bot_spell_list[i].spellid)
+						!caster->IsValidSpellTypeSubType(spell_type, sub_target_type, c.spellid) ||
+						!caster->IsValidSpellTypeSubType(spell_type, sub_type, c.spellid)
 					)
 				) {
 					continue;
 				}
 
-				if (!AE && IsAnyAESpell(bot_spell_list[i].spellid) && !IsGroupSpell(bot_spell_list[i].spellid)) {
+				if (!AE && c.is_any_ae && !c.is_group) {
 					continue;
 				}
-				else if (AE && !IsAnyAESpell(bot_spell_list[i].spellid)) {
+				else if (AE && !c.is_any_ae) {
 					continue;
 				}
 
@@ -1090,15 +1067,15 @@ std::vector<BotSpell_wPriority> Bot::GetPrioritizedBotSpellsBySpellType(Bot* cas
 					(
 						!RuleB(Bots, EnableBotTGB) ||
 						(
-							IsGroupSpell(bot_spell_list[i].spellid) &&
-							!IsTGBCompatibleSpell(bot_spell_list[i].spellid)
+							c.is_group &&
+							!c.is_tgb_compatible
 						)
 					)
 				) {
 					continue;
 				}
 
-				if (!IsPBAESpell(bot_spell_list[i].spellid) && !caster->CastChecks(bot_spell_list[i].spellid, tar, spell_type, false, IsAEBotSpellType(spell_type))) {
+				if (!c.is_pbae && !caster->CastChecks(c.spellid, tar, spell_type, false, IsAEBotSpellType(spell_type))) {
 					continue;
 				}
 
@@ -1106,23 +1083,26 @@ std::vector<BotSpell_wPriority> Bot::GetPrioritizedBotSpellsBySpellType(Bot* cas
 					caster->IsCommandedSpell() ||
 					!AE ||
 					!BotSpellTypeRequiresAEChecks(spell_type) ||
-					caster->HasValidAETarget(caster, bot_spell_list[i].spellid, spell_type, tar)
+					caster->HasValidAETarget(caster, c.spellid, spell_type, tar)
 				) {
 					BotSpell_wPriority bot_spell;
-					bot_spell.SpellId = bot_spell_list[i].spellid;
-					bot_spell.SpellIndex = bot_spell_list[i].index;
-					bot_spell.ManaCost = bot_spell_list[i].manacost;
-					bot_spell.Priority = bot_spell_list[i].priority;
+					bot_spell.SpellId = c.spellid;
+					bot_spell.SpellIndex = c.index;
+					bot_spell.ManaCost = c.manacost;
+					bot_spell.Priority = c.priority;
 
 					result.emplace_back(bot_spell);
 				}
 			}
 		}
 
-		if (result.size() > 1) {
-			std::sort(result.begin(), result.end(), [](BotSpell_wPriority const& l, BotSpell_wPriority const& r) {
-				return l.Priority < r.Priority;
-			});
+		// the candidates are already in priority order, this only matters for priorities outside of 0-255
+		auto by_priority = [](BotSpell_wPriority const& l, BotSpell_wPriority const& r) {
+			return l.Priority < r.Priority;
+		};
+
+		if (result.size() > 1 && !std::is_sorted(result.begin(), result.end(), by_priority)) {
+			std::sort(result.begin(), result.end(), by_priority);
 		}
 	}
 
@@ -1137,25 +1117,15 @@ BotSpell Bot::GetFirstBotSpellBySpellType(Bot* caster, uint16 spell_type) {
 	result.ManaCost = 0;
 
 	if (caster && caster->AI_HasSpells()) {
-		const std::vector<BotSpells_wIndex>& bot_spell_list = caster->BotGetSpellsByType(spell_type);
-
-		for (int i = bot_spell_list.size() - 1; i >= 0; i--) {
-			if (!IsValidSpell(bot_spell_list[i].spellid)) {
+		for (const auto& c : caster->GetBotSpellCandidates(spell_type)) {
+			if (c.requires_los && !caster->HasLoS()) {
 				continue;
 			}
 
-			if (BotRequiresLoSToCast(spell_type, bot_spell_list[i].spellid) && !caster->HasLoS()) {
-				continue;
-			}
-
-			if (
-				caster->CheckSpellRecastTimer(bot_spell_list[i].spellid) &&
-				(bot_spell_list[i].type == spell_type || bot_spell_list[i].type == GetParentSpellType(spell_type)) &&
-				caster->IsValidSpellTypeBySpellID(spell_type, bot_spell_list[i].spellid)
-			) {
-				result.SpellId = bot_spell_list[i].spellid;
-				result.SpellIndex = bot_spell_list[i].index;
-				result.ManaCost = bot_spell_list[i].manacost;
+			if (caster->CheckSpellRecastTimer(c.spellid)) {
+				result.SpellId = c.spellid;
+				result.SpellIndex = c.index;
+				result.ManaCost = c.manacost;
 
 				break;
 			}
@@ -1246,21 +1216,14 @@ BotSpell Bot::GetBestBotSpellForPercentageHeal(Bot* caster, Mob* tar, uint16 spe
 	result.ManaCost = 0;
 
 	if (caster && caster->AI_HasSpells()) {
-		const std::vector<BotSpells_wIndex>& bot_spell_list = caster->BotGetSpellsByType(spell_type);
-		for (int i = bot_spell_list.size() - 1; i >= 0; i--) {
-			if (!IsValidSpell(bot_spell_list[i].spellid)) {
-				continue;
-			}
-
+		for (const auto& c : caster->GetBotSpellCandidates(spell_type)) {
 			if (
-				(bot_spell_list[i].type == spell_type || bot_spell_list[i].type == GetParentSpellType(spell_type)) &&
-				caster->IsValidSpellTypeBySpellID(spell_type, bot_spell_list[i].spellid) &&
-				IsCompleteHealSpell(bot_spell_list[i].spellid) &&
-				caster->CastChecks(bot_spell_list[i].spellid, tar, spell_type)
+				IsCompleteHealSpell(c.spellid) &&
+				caster->CastChecks(c.spellid, tar, spell_type)
 			) {
-				result.SpellId = bot_spell_list[i].spellid;
-				result.SpellIndex = bot_spell_list[i].index;
-				result.ManaCost = bot_spell_list[i].manacost;
+				result.SpellId = c.spellid;
+				result.SpellIndex = c.index;
+				result.ManaCost = c.manacost;
 
 				break;
 			}
@@ -1631,7 +1594,7 @@ std::string Bot::GetBotMagicianPetType(Bot* caster) {
 			uint8 earth_min_level = 255;
 			uint8 monster_min_level = 255;
 			uint8 epic_min_level = 255;
-			std::list<BotSpell> bot_spell_list = caster->GetBotSpellsBySpellType(caster, BotSpellTypes::Pet);
+			const std::vector<BotSpell>& bot_spell_list = caster->GetBotSpellsBySpellType(caster, BotSpellTypes::Pet);
 
 			for (const auto& s : bot_spell_list) {
 				if (!IsValidSpell(s.SpellId)) {
@@ -2032,7 +1995,7 @@ BotSpell Bot::GetBestBotSpellForCure(Bot* caster, Mob* tar, uint16 spell_type) {
 	}
 
 	if (caster) {
-		std::vector<BotSpell_wPriority> bot_spell_list_itr = GetPrioritizedBotSpellsBySpellType(caster, spell_type, tar);
+		const std::vector<BotSpell_wPriority>& bot_spell_list_itr = GetPrioritizedBotSpellsBySpellType(caster, spell_type, tar);
 
 		if (IsGroupBotSpellType(spell_type)) {
 			int count_needs_cured = 0;
@@ -2041,7 +2004,7 @@ BotSpell Bot::GetBestBotSpellForCure(Bot* caster, Mob* tar, uint16 spell_type) {
 			uint16 count_cursed = 0;
 			uint16 count_corrupted = 0;
 
-			for (std::vector<BotSpell_wPriority>::iterator itr = bot_spell_list_itr.begin(); itr != bot_spell_list_itr.end(); ++itr) {
+			for (std::vector<BotSpell_wPriority>::const_iterator itr = bot_spell_list_itr.begin(); itr != bot_spell_list_itr.end(); ++itr) {
 				if (!IsValidSpell(itr->SpellId) || !IsGroupSpell(itr->SpellId)) {
 					continue;
 				}
@@ -2080,7 +2043,7 @@ BotSpell Bot::GetBestBotSpellForCure(Bot* caster, Mob* tar, uint16 spell_type) {
 			}
 		}
 		else {
-			for (std::vector<BotSpell_wPriority>::iterator itr = bot_spell_list_itr.begin(); itr != bot_spell_list_itr.end(); ++itr) {
+			for (std::vector<BotSpell_wPriority>::const_iterator itr = bot_spell_list_itr.begin(); itr != bot_spell_list_itr.end(); ++itr) {
 				if (!IsValidSpell(itr->SpellId) || IsGroupSpell(itr->SpellId)) {
 					continue;
 				}
@@ -2190,6 +2153,7 @@ bool Bot::AI_AddBotSpells(uint32 bot_spell_id) {
 	AIBot_spells.clear();
 	AIBot_spells_enforced.clear();
 	AIBot_spells_by_type.clear();
+	m_bot_spell_candidates.clear();
 
 	if (!bot_spell_id) {
 		AIautocastspell_timer->Disable();
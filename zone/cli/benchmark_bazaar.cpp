@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include "../../common/bazaar_search_index.h"
+#include "../../common/eqemu_logsys.h"
+#include "../zonedb.h"
+
+// every listing checked one by one, what answering a search without the index would take
+static std::vector<uint32> BenchmarkBazaarScan(
+	const std::vector<TraderRepository::BazaarTraderSearch_Struct> &listings,
+	const BazaarSearchCriteria_Struct &search
+)
+{
+	const std::string name = Strings::ToLower(search.item_name);
+
+	std::vector<std::pair<BazaarSearchIndex::ListingKey, uint32>> matches;
+	for (const auto &e: listings) {
+		const auto &t = e.trader;
+		if (search.trader_id && t.char_id != search.trader_id) {
+			continue;
+		}
+
+		if (search.min_cost && t.item_cost < static_cast<uint64>(search.min_cost) * 1000) {
+			continue;
+		}
+
+		if (search.max_cost && t.item_cost > static_cast<uint64>(search.max_cost) * 1000) {
+			continue;
+		}
+
+		const auto item = database.GetItem(t.item_id);
+		if (!item || Strings::ToLower(item->Name).find(name) == std::string::npos) {
+			continue;
+		}
+
+		uint32 stat = 0;
+		if (BazaarSearchIndex::MatchesItemCriteria(item, search, stat)) {
+			matches.push_back({{t.char_id, t.id}, t.item_sn});
+		}
+	}
+
+	std::sort(matches.begin(), matches.end());
+
+	std::vector<uint32> l;
+	for (size_t i = 0; i < matches.size() && i < search.max_results; ++i) {
+		l.emplace_back(matches[i].second);
+	}
+
+	return l;
+}
+
+void ZoneCLI::BenchmarkBazaar(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark bazaar searches over synthetic trader listings, the in-memory search index vs checking every "
+				  "listing, with mixed search criteria. Options: --listings=50000 --traders=500 --searches=2000";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	auto option = [&](const std::string &name, uint32 fallback) {
+		return cmd(name).str().empty() ? fallback : std::max(1u, Strings::ToUnsignedInt(cmd(name).str()));
+	};
+
+	const uint32 listing_count = option("--listings", 50000);
+	const uint32 trader_count  = option("--traders", 500);
+	const uint32 search_count  = option("--searches", 2000);
+
+	std::vector<const EQ::ItemData *> items;
+
+	uint32 id = 0;
+	for (auto item = database.IterateItems(&id); item; item = database.IterateItems(&id)) {
+		if (item->NoDrop != 0 && item->Name[0]) {
+			items.emplace_back(item);
+		}
+	}
+
+	if (items.empty()) {
+		std::cout << "❌ No tradeable items loaded\n";
+		return;
+	}
+
+	std::mt19937                          rng(listing_count);
+	std::uniform_int_distribution<size_t> pick_item(0, items.size() - 1);
+	std::uniform_int_distribution<uint32> pick_trader(1, trader_count);
+	std::uniform_int_distribution<uint32> pick_cost(1, 5000);
+
+	std::vector<TraderRepository::BazaarTraderSearch_Struct> listings;
+	listings.reserve(listing_count);
+	for (uint32 i = 0; i < listing_count; ++i) {
+		TraderRepository::BazaarTraderSearch_Struct e{};
+		e.trader.id             = i + 1;
+		e.trader.char_id        = pick_trader(rng);
+		e.trader.item_id        = items[pick_item(rng)]->ID;
+		e.trader.item_sn        = i + 1;
+		e.trader.item_cost      = pick_cost(rng) * 1000;
+		e.trader.slot_id        = i % 200;
+		e.trader.char_zone_id   = Zones::BAZAAR;
+		e.trader.char_entity_id = e.trader.char_id;
+		e.trader_name           = fmt::format("Trader{}", e.trader.char_id);
+
+		listings.emplace_back(std::move(e));
+	}
+
+	// a mix of what players search for, names, a slot or a stat, a price range, one trader
+	std::vector<BazaarSearchCriteria_Struct> searches;
+	for (uint32 i = 0; i < search_count; ++i) {
+		BazaarSearchCriteria_Struct s{};
+		s.search_scope = AllTraders_Scope;
+		s._class       = std::numeric_limits<uint32>::max();
+		s.race         = std::numeric_limits<uint32>::max();
+		s.item_stat    = std::numeric_limits<uint32>::max();
+		s.slot         = std::numeric_limits<uint32>::max();
+		s.type         = std::numeric_limits<uint32>::max();
+		s.min_level    = 1;
+		s.max_level    = 100;
+		s.max_results  = 200;
+
+		switch (i % 5) {
+			case 0: {
+				const std::string name = items[pick_item(rng)]->Name;
+				const size_t      len  = std::min<size_t>(name.size(), 3 + i % 6);
+				strn0cpy(s.item_name, name.substr(0, len).c_str(), sizeof(s.item_name));
+				break;
+			}
+			case 1:
+				s.slot     = i % (EQ::invslot::slotAmmo + 1);
+				s.max_cost = 1000;
+				break;
+			case 2:
+				s.item_stat = STAT_HP;
+				s._class    = 1 + i % 16;
+				break;
+			case 3:
+				s.type      = EQ::item::ItemTypeArmor;
+				s.min_level = 30;
+				s.max_level = 70;
+				break;
+			default:
+				s.trader_id = pick_trader(rng);
+				break;
+		}
+
+		searches.emplace_back(s);
+	}
+
+	using clock = std::chrono::high_resolution_clock;
+
+	LogSys.SilenceConsoleLogging();
+
+	BazaarSearchIndex index;
+	index.SetDatabase(&database);
+
+	auto start = clock::now();
+	index.LoadListings(listings);
+	const std::chrono::duration<double, std::milli> load_time = clock::now() - start;
+
+	std::vector<std::vector<uint32>> scanned(searches.size()), indexed(searches.size());
+
+	start = clock::now();
+	for (size_t i = 0; i < searches.size(); ++i) {
+		scanned[i] = BenchmarkBazaarScan(listings, searches[i]);
+	}
+	const std::chrono::duration<double> scan_time = clock::now() - start;
+
+	start = clock::now();
+	for (size_t i = 0; i < searches.size(); ++i) {
+		for (const auto &r: index.Search(searches[i], Zones::BAZAAR, 0)) {
+			indexed[i].emplace_back(r.serial_number);
+		}
+	}
+	const std::chrono::duration<double> index_time = clock::now() - start;
+
+	// a trader changing their listings, the way a ServerOP_BazaarListingsChanged is applied
+	std::vector<std::vector<TraderRepository::BazaarTraderSearch_Struct>> by_trader(trader_count + 1);
+	for (const auto &e: listings) {
+		by_trader[e.trader.char_id].emplace_back(e);
+	}
+
+	start = clock::now();
+	for (uint32 char_id = 1; char_id <= trader_count; ++char_id) {
+		index.SetTraderListings(char_id, by_trader[char_id]);
+	}
+	const std::chrono::duration<double> update_time = clock::now() - start;
+
+	LogSys.EnableConsoleLogging();
+
+	size_t mismatches = 0, results = 0;
+	for (size_t i = 0; i < searches.size(); ++i) {
+		mismatches += scanned[i] != indexed[i];
+		results += indexed[i].size();
+	}
+
+	auto rate = [](size_t count, std::chrono::duration<double> elapsed) {
+		return Strings::Commify(static_cast<uint64>(elapsed.count() > 0 ? count / elapsed.count() : 0));
+	};
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📌 " << Strings::Commify(listings.size()) << " listings from " << Strings::Commify(trader_count)
+			  << " traders, " << Strings::Commify(index.GetItemCount()) << " distinct items\n";
+	std::cout << "📌 " << Strings::Commify(searches.size()) << " searches, " << Strings::Commify(results)
+			  << " results\n";
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "📥 Index load     | " << load_time.count() << " ms\n";
+	std::cout << "🐢 Every listing  | " << rate(searches.size(), scan_time) << " searches/s\n";
+	std::cout << "🚀 Search index   | " << rate(searches.size(), index_time) << " searches/s | "
+			  << (index_time.count() > 0 ? scan_time / index_time : 0.0) << "x\n";
+	std::cout << "🔁 Trader updates | " << rate(trader_count, update_time) << " traders/s\n";
+
+	if (mismatches) {
+		std::cout << "❌ " << Strings::Commify(mismatches) << " searches returned different listings\n";
+	}
+	else {
+		std::cout << "✅ Every search returned the same listings\n";
+	}
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+}
@@ -0,0 +1,133 @@
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include "../../common/eqemu_logsys.h"
+#include "../../common/platform.h"
+#include "../zone.h"
+#include "../npc.h"
+#include "../bot.h"
+
+extern Zone *zone;
+
+void ZoneCLI::BenchmarkBotAI(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark bot spell selection, N bots of every class checking each spell type against a target dummy per tick. "
+				  "Options: --zone=qrg --npc-type=754008 --bots=72 --level=65 --ticks=100";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const std::string zone_short_name = cmd("--zone").str().empty() ? "qrg" : cmd("--zone").str();
+	const uint32      npc_type_id     = cmd("--npc-type").str().empty() ? 754008 : Strings::ToUnsignedInt(cmd("--npc-type").str());
+	const uint32      bot_count       = cmd("--bots").str().empty() ? 72 : Strings::ToUnsignedInt(cmd("--bots").str());
+	const uint8       level           = cmd("--level").str().empty() ? 65 : Strings::ToUnsignedInt(cmd("--level").str());
+	const uint32      ticks           = cmd("--ticks").str().empty() ? 100 : Strings::ToUnsignedInt(cmd("--ticks").str());
+
+	LogSys.SilenceConsoleLogging();
+
+	Zone::Bootup(ZoneID(zone_short_name), 0, false);
+	zone->StopShutdownTimer();
+	entity_list.Process();
+	entity_list.MobProcess();
+
+	LogSys.EnableConsoleLogging();
+
+	auto npc_type = content_db.LoadNPCTypesData(npc_type_id);
+	if (!npc_type) {
+		std::cerr << "Unable to load npc_type [" << npc_type_id << "]\n";
+		return;
+	}
+
+	LogSys.SilenceConsoleLogging();
+
+	auto dummy = new NPC(npc_type, nullptr, glm::vec4(0.0f, 0.0f, 0.0f, 0.0f), GravityBehavior::Flying);
+	entity_list.AddNPC(dummy, false);
+
+	auto owner = new Client();
+
+	std::vector<Bot *> bots;
+	bots.reserve(bot_count);
+	for (uint32 i = 0; i < bot_count; ++i) {
+		const uint8 bot_class = Class::Warrior + (i % Class::Berserker);
+
+		auto bot_type = Bot::CreateDefaultNPCTypeStructForBot(
+			fmt::format("Benchbot{:03}", i),
+			"",
+			level,
+			Race::Human,
+			bot_class,
+			Gender::Male
+		);
+
+		// the npc constructor only sets up the bot AI for the bot spell list ids
+		bot_type->npc_spells_id = EQ::constants::BotSpellIDs::Warrior + (bot_class - Class::Warrior);
+
+		auto bot = new Bot(bot_type, owner);
+		bot->AI_AddBotSpells(bot->GetBotSpellID());
+		bot->SetTarget(dummy);
+
+		bots.emplace_back(bot);
+	}
+
+	LogSys.EnableConsoleLogging();
+
+	size_t indexed_spells = 0;
+	for (auto b: bots) {
+		for (uint16 spell_type = BotSpellTypes::START; spell_type <= BotSpellTypes::END; ++spell_type) {
+			indexed_spells += b->GetBotSpellCandidates(spell_type).size();
+		}
+	}
+
+	// one tick is every bot looking at every spell type, which is what a bot with everything enabled does when its
+	// cast timer comes up
+	auto run = [&](bool rebuild) {
+		uint64 results = 0;
+		auto   start   = std::chrono::high_resolution_clock::now();
+		for (uint32 tick = 0; tick < ticks; ++tick) {
+			for (auto b: bots) {
+				if (rebuild) {
+					b->ClearBotSpellCandidates();
+				}
+
+				for (uint16 spell_type = BotSpellTypes::START; spell_type <= BotSpellTypes::END; ++spell_type) {
+					results += Bot::GetPrioritizedBotSpellsBySpellType(b, spell_type, dummy, IsAEBotSpellType(spell_type)).size();
+					results += Bot::GetBotSpellsBySpellType(b, spell_type).size();
+				}
+			}
+		}
+
+		return std::make_pair(std::chrono::high_resolution_clock::now() - start, results);
+	};
+
+	auto report = [&](const std::string &name, std::chrono::duration<double> elapsed, uint64 results) {
+		const double tick_us = std::chrono::duration<double, std::micro>(elapsed).count() / ticks;
+		std::cout << name << " | " << std::fixed << std::setprecision(2)
+				  << tick_us / 1000.0 << " ms per tick | "
+				  << (bots.empty() ? 0.0 : tick_us / bots.size()) << " us per bot | "
+				  << Strings::Commify(results) << " candidates\n";
+	};
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📌 " << Strings::Commify(bots.size()) << " level " << static_cast<int>(level) << " bots x "
+			  << BotSpellTypes::END - BotSpellTypes::START + 1 << " spell types x " << ticks << " ticks in ["
+			  << zone_short_name << "], " << Strings::Commify(indexed_spells) << " indexed spells\n";
+	std::cout << Strings::Repeat("-", 70) << "\n";
+
+	const auto [rebuild_time, rebuild_results] = run(true);
+	report("🐢 Index rebuilt every tick", rebuild_time, rebuild_results);
+
+	const auto [indexed_time, indexed_results] = run(false);
+	report("🚀 Index kept between ticks", indexed_time, indexed_results);
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+
+	if (rebuild_results != indexed_results) {
+		std::cout << "❌ Selections differ between the rebuilt and the kept index\n";
+	}
+	else if (indexed_time.count() > 0) {
+		std::cout << "✅ Speedup " << (rebuild_time / indexed_time) << "x\n";
+	}
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+}
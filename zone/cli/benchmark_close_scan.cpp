@@ -0,0 +1,118 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "../../common/eqemu_logsys.h"
+#include "../../common/platform.h"
+#include "../zone.h"
+#include "../npc.h"
+
+extern Zone *zone;
+
+void ZoneCLI::BenchmarkCloseScan(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark close mob scanning (full mob list vs spatial grid) with synthetic NPCs. "
+				  "Options: --zone=qrg --npc-type=754008 --mobs=2000 --area=4000";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const std::string zone_short_name = cmd("--zone").str().empty() ? "qrg" : cmd("--zone").str();
+	const uint32      npc_type_id     = cmd("--npc-type").str().empty() ? 754008 : Strings::ToUnsignedInt(cmd("--npc-type").str());
+	const uint32      mob_count       = cmd("--mobs").str().empty() ? 2000 : Strings::ToUnsignedInt(cmd("--mobs").str());
+	const float       area            = cmd("--area").str().empty() ? 4000.0f : Strings::ToFloat(cmd("--area").str());
+
+	LogSys.SilenceConsoleLogging();
+
+	Zone::Bootup(ZoneID(zone_short_name), 0, false);
+	zone->StopShutdownTimer();
+	entity_list.Process();
+	entity_list.MobProcess();
+
+	LogSys.EnableConsoleLogging();
+
+	auto npc_type = content_db.LoadNPCTypesData(npc_type_id);
+	if (!npc_type) {
+		std::cerr << "Unable to load npc_type [" << npc_type_id << "]\n";
+		return;
+	}
+
+	std::mt19937                          rng(1337);
+	std::uniform_real_distribution<float> position_dist(-area / 2.0f, area / 2.0f);
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📌 Spawning " << Strings::Commify(mob_count) << " synthetic NPCs across " << area << "x" << area << " units in [" << zone_short_name << "]\n";
+
+	LogSys.SilenceConsoleLogging();
+
+	std::vector<Mob *> mobs;
+	mobs.reserve(mob_count);
+	for (uint32 i = 0; i < mob_count; ++i) {
+		auto npc = new NPC(
+			npc_type,
+			nullptr,
+			glm::vec4(position_dist(rng), position_dist(rng), 0.0f, 0.0f),
+			GravityBehavior::Flying
+		);
+
+		entity_list.AddNPC(npc, false);
+		mobs.emplace_back(npc);
+	}
+
+	LogSys.EnableConsoleLogging();
+
+	const float scan_range = RuleI(Range, MobCloseScanDistance);
+	const auto  &mob_list  = entity_list.GetMobList();
+
+	// 🐢 **Full Mob List Scan (previous implementation)**
+	size_t legacy_close = 0;
+	auto   legacy_start = std::chrono::high_resolution_clock::now();
+	for (auto scanning_mob: mobs) {
+		std::unordered_map<uint16, Mob *> close_mobs;
+		close_mobs.reserve(mob_list.size());
+
+		for (auto &e: mob_list) {
+			auto mob = e.second;
+			if (mob->GetID() <= 0 || mob->IsZoneController()) {
+				continue;
+			}
+
+			float distance = Distance(scanning_mob->GetPosition(), mob->GetPosition());
+			if (distance <= scan_range || mob->GetAggroRange() >= scan_range) {
+				close_mobs[mob->GetID()] = mob;
+			}
+		}
+
+		legacy_close += close_mobs.size();
+	}
+	auto                          legacy_end  = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> legacy_time = legacy_end - legacy_start;
+
+	// 🚀 **Spatial Grid Scan**
+	size_t grid_close = 0;
+	auto   grid_start = std::chrono::high_resolution_clock::now();
+	for (auto scanning_mob: mobs) {
+		entity_list.ScanCloseMobs(scanning_mob);
+		grid_close += scanning_mob->GetCloseMobList().size();
+	}
+	auto                          grid_end  = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> grid_time = grid_end - grid_start;
+
+	auto &grid = entity_list.GetSpatialGrid();
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📊 Scan range [" << scan_range << "] grid cells [" << Strings::Commify(static_cast<uint64>(grid.GetCellCount()))
+			  << "] tracked mobs [" << Strings::Commify(static_cast<uint64>(grid.GetMobCount())) << "]\n";
+	std::cout << "🐢 Full list scan    | " << legacy_time.count() << " seconds | "
+			  << (legacy_time.count() * 1000000.0 / mobs.size()) << " us/scan | avg close list "
+			  << (mobs.empty() ? 0 : legacy_close / mobs.size()) << "\n";
+	std::cout << "🚀 Spatial grid scan | " << grid_time.count() << " seconds | "
+			  << (grid_time.count() * 1000000.0 / mobs.size()) << " us/scan | avg close list "
+			  << (mobs.empty() ? 0 : grid_close / mobs.size()) << "\n";
+
+	if (grid_time.count() > 0) {
+		std::cout << "✅ Speedup " << (legacy_time.count() / grid_time.count()) << "x\n";
+	}
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <random>
@@ -6,6 +7,7 @@
 #include "../sidecar_api/sidecar_api.h"
 #include "../../common/platform.h"
 #include "../data_bucket.h"
+#include "../data_bucket_cache.h"
 #include "../zonedb.h"
 #include "../../common/repositories/data_buckets_repository.h"
 
@@ -249,15 +251,92 @@ void RunBenchmarkCycle(uint64_t target_rows)
 			  << " seconds.\n";
 }
 
+extern DataBucketCache g_data_bucket_cache;
+
+void RunCacheHitBenchmark(uint64_t cached_rows)
+{
+	const size_t      READS_PER_TEST  = 100000;
+	const uint32      CHARACTER_COUNT = 5000;
+	const uint64      SYNTHETIC_ID    = 1000000000000ULL; // well clear of real bucket ids
+	const std::string test_key_prefix = "test_key_cache_";
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "⚡ Cache Hit Latency at " << Strings::Commify(cached_rows) << " Cached Entries...\n";
+	std::cout << Strings::Repeat("-", 70) << "\n";
+
+	DataBucket::ClearCache();
+
+	// 📌 **Fill The Zone Cache Directly, No Database Involved**
+	const auto now        = static_cast<uint32>(std::time(nullptr));
+	auto       fill_start = std::chrono::high_resolution_clock::now();
+	for (uint64_t i = 0; i < cached_rows; ++i) {
+		DataBucketsRepository::DataBuckets e{};
+		e.id           = SYNTHETIC_ID + i;
+		e.key_         = test_key_prefix + std::to_string(i);
+		e.value        = "value_" + std::to_string(i);
+		e.expires      = (i % 4 == 0) ? now + 3600 : 0;
+		e.character_id = (i % CHARACTER_COUNT) + 1;
+
+		g_data_bucket_cache.Set(e);
+	}
+	auto                          fill_end  = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> fill_time = fill_end - fill_start;
+	std::cout << "✅ Cached " << Strings::Commify(cached_rows) << " entries in " << fill_time.count() << " seconds.\n";
+
+	// 🔍 **Measure Cache Hits Through DataBucket::GetData**
+	std::mt19937                            rng(1337);
+	std::uniform_int_distribution<uint64_t> row_dist(0, cached_rows - 1);
+
+	std::vector<DataBucketKey> keys;
+	keys.reserve(READS_PER_TEST);
+	for (size_t i = 0; i < READS_PER_TEST; ++i) {
+		const uint64_t row = row_dist(rng);
+		keys.emplace_back(
+			DataBucketKey{
+				.key = test_key_prefix + std::to_string(row),
+				.character_id = (row % CHARACTER_COUNT) + 1
+			}
+		);
+	}
+
+	std::vector<double> latencies;
+	latencies.reserve(READS_PER_TEST);
+
+	size_t hits       = 0;
+	auto   read_start = std::chrono::high_resolution_clock::now();
+	for (const auto &k: keys) {
+		auto s = std::chrono::high_resolution_clock::now();
+		auto e = DataBucket::GetData(k);
+		auto f = std::chrono::high_resolution_clock::now();
+
+		latencies.emplace_back(std::chrono::duration<double, std::nano>(f - s).count());
+		hits += e.id > 0 ? 1 : 0;
+	}
+	auto                          read_end  = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> read_time = read_end - read_start;
+
+	std::sort(latencies.begin(), latencies.end());
+
+	std::cout << "✅ Completed " << Strings::Commify(READS_PER_TEST) << " cached reads (" << Strings::Commify(hits)
+			  << " hits) in " << read_time.count() << " seconds.\n";
+	std::cout << "📊 Hit latency avg " << (read_time.count() * 1000000000.0 / READS_PER_TEST) << " ns | p50 "
+			  << latencies[latencies.size() / 2] << " ns | p99 " << latencies[(latencies.size() * 99) / 100] << " ns\n";
+
+	DataBucket::ClearCache();
+}
+
 void ZoneCLI::BenchmarkDatabuckets(int argc, char **argv, argh::parser &cmd, std::string &description)
 {
-	description = "Benchmark individual reads/writes/deletes in data_buckets at different table sizes.";
+	description = "Benchmark individual reads/writes/deletes in data_buckets at different table sizes. "
+				  "Options: --cache-only (only measure cache hit latency, skips the database)";
 
 	if (cmd[{"-h", "--help"}]) {
-		std::cout << "Usage: BenchmarkDatabuckets\n";
+		std::cout << "Usage: BenchmarkDatabuckets [--cache-only]\n";
 		return;
 	}
 
+	const bool cache_only = cmd[{"--cache-only"}];
+
 	if (std::getenv("DEBUG")) {
 		LogSys.SetDatabase(&database)->LoadLogDatabaseSettings();
 	}
@@ -267,7 +346,11 @@ void ZoneCLI::BenchmarkDatabuckets(int argc, char **argv, argh::parser &cmd, std
 	std::vector<uint64_t> benchmark_sizes = {10000, 100000, 1000000};
 
 	for (auto size: benchmark_sizes) {
-		RunBenchmarkCycle(size);
+		if (!cache_only) {
+			RunBenchmarkCycle(size);
+		}
+
+		RunCacheHitBenchmark(size);
 	}
 
 	// 🚀 **Total Benchmark Time**
@@ -0,0 +1,196 @@
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include "../../common/net/daybreak_connection.h"
+#include "../../common/event/timer.h"
+
+// cpu time of the calling thread, the clients run on their own thread so they do not count against the server
+static double BenchmarkThreadCpuSeconds()
+{
+#if defined(__linux__)
+	timespec ts{};
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) / 1000000000.0;
+#else
+	return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+void ZoneCLI::BenchmarkDaybreak(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Stress the daybreak UDP path with loopback clients, per datagram sends vs batched sendmmsg/recvmmsg. "
+				  "Options: --clients=200 --packets=20 --size=64 --seconds=5 --frame-ms=16 --port=7999";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const uint32 client_count = cmd("--clients").str().empty() ? 200 : Strings::ToUnsignedInt(cmd("--clients").str());
+	const uint32 packets      = cmd("--packets").str().empty() ? 20 : Strings::ToUnsignedInt(cmd("--packets").str());
+	const uint32 size         = cmd("--size").str().empty() ? 64 : Strings::ToUnsignedInt(cmd("--size").str());
+	const uint32 seconds      = cmd("--seconds").str().empty() ? 5 : Strings::ToUnsignedInt(cmd("--seconds").str());
+	const uint32 frame_ms     = cmd("--frame-ms").str().empty() ? 16 : Strings::ToUnsignedInt(cmd("--frame-ms").str());
+	const uint32 port         = cmd("--port").str().empty() ? 7999 : Strings::ToUnsignedInt(cmd("--port").str());
+
+	struct PassResult {
+		uint32 connected = 0;
+		uint64 app_sent  = 0;
+		uint64 app_recv  = 0;
+		uint64 datagrams = 0;
+		uint64 syscalls  = 0;
+		double wall_s    = 0.0;
+		double cpu_s     = 0.0;
+	};
+
+	// server and clients each get a thread and therefore their own event loop. Managers never detach their handles from
+	// a loop (the servers keep theirs for the life of the process) so they are left to the process exit here as well
+	auto run_pass = [&](bool batched, uint32 pass_port) {
+		PassResult r;
+
+		std::atomic<uint64> app_recv{0};
+		std::atomic<bool>   done{false};
+
+		std::thread client_thread(
+			[&]() {
+				auto &loop = EQ::EventLoop::Get();
+
+				// clients stand in for game clients and stay on the plain path, only the server side is compared
+				for (uint32 i = 0; i < client_count; ++i) {
+					auto c = new EQ::Net::DaybreakConnectionManager();
+					c->OnPacketRecv(
+						[&app_recv](std::shared_ptr<EQ::Net::DaybreakConnection>, const EQ::Net::Packet &) {
+							app_recv.fetch_add(1, std::memory_order_relaxed);
+						}
+					);
+					c->Connect("127.0.0.1", pass_port);
+				}
+
+				EQ::Timer poll_done(
+					50, true, [&](EQ::Timer *) {
+						if (done.load()) {
+							loop.Shutdown();
+						}
+					}
+				);
+
+				loop.Run();
+			}
+		);
+
+		std::thread server_thread(
+			[&]() {
+				auto &loop = EQ::EventLoop::Get();
+
+				EQ::Net::DaybreakConnectionManagerOptions opts;
+				opts.port       = pass_port;
+				opts.batch_send = batched;
+				opts.batch_recv = batched;
+
+				auto server = new EQ::Net::DaybreakConnectionManager(opts);
+
+				std::vector<std::shared_ptr<EQ::Net::DaybreakConnection>> connections;
+				server->OnNewConnection(
+					[&](std::shared_ptr<EQ::Net::DaybreakConnection> c) {
+						connections.emplace_back(c);
+					}
+				);
+
+				// handshake, give up after a few seconds with whoever made it
+				auto handshake = std::chrono::steady_clock::now();
+				while (connections.size() < client_count &&
+					   std::chrono::steady_clock::now() - handshake < std::chrono::seconds(5)) {
+					loop.Process();
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+
+				r.connected = static_cast<uint32>(connections.size());
+
+				EQ::Net::DynamicPacket payload;
+				for (uint32 i = 0; i < size; ++i) {
+					payload.PutUInt8(i, 0x42);
+				}
+
+				uint64 datagrams_before = 0;
+				for (auto &c: connections) {
+					datagrams_before += c->GetStats().sent_packets;
+				}
+
+				const auto before_stats = server->GetSendBatchStats();
+				const auto recv_before  = app_recv.load();
+
+				EQ::Timer frame(
+					frame_ms, true, [&](EQ::Timer *) {
+						for (auto &c: connections) {
+							for (uint32 i = 0; i < packets; ++i) {
+								c->QueuePacket(payload, 0, false);
+								r.app_sent++;
+							}
+						}
+					}
+				);
+
+				EQ::Timer stop(
+					seconds * 1000, false, [&](EQ::Timer *) {
+						loop.Shutdown();
+					}
+				);
+
+				const auto wall_start = std::chrono::steady_clock::now();
+				const auto cpu_start  = BenchmarkThreadCpuSeconds();
+
+				loop.Run();
+
+				r.cpu_s    = BenchmarkThreadCpuSeconds() - cpu_start;
+				r.wall_s   = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+				r.app_recv = app_recv.load() - recv_before;
+
+				for (auto &c: connections) {
+					r.datagrams += c->GetStats().sent_packets;
+				}
+
+				r.datagrams -= datagrams_before;
+
+				if (batched) {
+					const auto &after_stats = server->GetSendBatchStats();
+					r.syscalls = (after_stats.syscalls - before_stats.syscalls) +
+								 (after_stats.fallbacks - before_stats.fallbacks);
+				}
+				else {
+					r.syscalls = r.datagrams;
+				}
+
+				frame.Stop();
+				stop.Stop();
+			}
+		);
+
+		server_thread.join();
+		done = true;
+		client_thread.join();
+
+		return r;
+	};
+
+	auto report = [&](const std::string &name, const PassResult &r) {
+		const double cpu_us = r.datagrams ? r.cpu_s * 1000000.0 / r.datagrams : 0.0;
+
+		std::cout << name << " | " << r.connected << "/" << client_count << " connected | "
+				  << Strings::Commify(static_cast<uint64>(r.datagrams / r.wall_s)) << " datagrams/s | "
+				  << Strings::Commify(static_cast<uint64>(r.app_recv / r.wall_s)) << " packets/s recv | "
+				  << std::fixed << std::setprecision(2) << cpu_us << " us server cpu/datagram | "
+				  << Strings::Commify(r.syscalls) << " send syscalls\n";
+	};
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📌 " << Strings::Commify(client_count) << " loopback clients, " << packets << " x " << size
+			  << " byte packets per client every " << frame_ms << "ms for " << seconds << "s\n";
+	std::cout << Strings::Repeat("-", 70) << "\n";
+
+	report("🐢 uv_udp_send per datagram", run_pass(false, port));
+	report("🚀 sendmmsg/recvmmsg batch ", run_pass(true, port + 1));
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+}
@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <unordered_set>
+#include "../../common/profanity_manager.h"
+#include "../../common/profanity_matcher.h"
+
+// what redacting a message took before the automaton, one search of the message per entry
+static void BenchmarkProfanityLegacyRedact(std::string &message, const std::list<std::string> &entries)
+{
+	const std::string test_message = Strings::ToLower(message);
+
+	for (const auto &iter: entries) {
+		size_t pos       = 0;
+		size_t start_pos = 0;
+
+		while (pos != std::string::npos) {
+			pos = test_message.find(iter, start_pos);
+			if (pos == std::string::npos) {
+				continue;
+			}
+
+			if (
+				(pos + iter.length()) == test_message.length() ||
+				!isalpha(test_message.at(pos + iter.length()))
+			) {
+				if (pos == 0 || !isalpha(test_message.at(pos - 1))) {
+					message.replace(pos, iter.length(), iter.length(), EQ::ProfanityManager::REDACTION_CHARACTER);
+				}
+			}
+
+			start_pos = (pos + iter.length());
+		}
+	}
+}
+
+void ZoneCLI::BenchmarkProfanity(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark redacting chat through the compiled profanity list vs searching the message once per entry, "
+				  "over synthetic entries and chat lines. Options: --terms=5000 --lines=100000";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	auto option = [&](const std::string &name, uint32 fallback) {
+		return cmd(name).str().empty() ? fallback : std::max(1u, Strings::ToUnsignedInt(cmd(name).str()));
+	};
+
+	const uint32 term_count = option("--terms", 5000);
+	const uint32 line_count = option("--lines", 100000);
+
+	std::mt19937 rng(term_count);
+
+	// made up words from syllables, lists in the wild are mostly plain words with a few phrases and leetspeak
+	const std::vector<std::string> syllables = {
+		"ba", "ck", "da", "er", "fu", "gr", "ho", "ib", "ja", "ke", "lo", "mu", "nt", "op", "qu", "ra", "sh", "tw",
+		"ub", "vo", "wa", "xe", "yo", "zz", "th", "st", "ch", "rk", "3", "0", "1", "$"
+	};
+
+	std::uniform_int_distribution<size_t> pick_syllable(0, syllables.size() - 1);
+
+	std::list<std::string>          entries;
+	std::unordered_set<std::string> seen;
+	while (entries.size() < term_count) {
+		std::string term;
+		const int   parts = 2 + static_cast<int>(rng() % 4);
+		for (int i = 0; i < parts; ++i) {
+			term += syllables[pick_syllable(rng)];
+		}
+
+		if (rng() % 20 == 0) {
+			term += " " + syllables[pick_syllable(rng)] + syllables[pick_syllable(rng)];
+		}
+
+		if (term.length() >= EQ::ProfanityManager::REDACTION_LENGTH_MIN && seen.insert(term).second) {
+			entries.emplace_back(term);
+		}
+	}
+
+	const std::vector<std::string> phrases = {
+		"LFG {} can tank or pull, pst", "WTS {} 500pp obo", "anyone have a port to {}?", "{} train to zone!!",
+		"inc {} at the bridge", "selling {} in the bazaar, /bazaar search for it", "who can rez in {}",
+		"lol {}", "need a cleric for {} raid tonight", "{} drops off the named, camp check?",
+		"guild recruiting for {}, all classes welcome", "Where do I turn in {}?", "heal pls {}",
+		"buying {} and spider silks", "{}"
+	};
+
+	const std::vector<std::string> words = {
+		"Crushbone", "Lower Guk", "the Karanas", "Fungus Covered Scale Tunic", "Jboots", "Shadowknight", "bard",
+		"Sebilis", "Plane of Fear", "Cazic", "Kunark", "Ring of the Ancients", "aggro", "mana", "Befallen",
+		"orc pawn", "gnoll", "Qeynos", "Freeport", "Velious", "the Hole", "Thurgadin", "Sol B", "Mistmoore"
+	};
+
+	std::vector<std::string> entry_list(entries.begin(), entries.end());
+
+	std::uniform_int_distribution<size_t> pick_phrase(0, phrases.size() - 1);
+	std::uniform_int_distribution<size_t> pick_word(0, words.size() - 1);
+	std::uniform_int_distribution<size_t> pick_entry(0, entry_list.size() - 1);
+
+	// about one line in ten carries an entry, sometimes as part of a longer word which must be left alone
+	std::vector<std::string> lines;
+	lines.reserve(line_count);
+	for (uint32 i = 0; i < line_count; ++i) {
+		std::string fill = words[pick_word(rng)];
+		switch (rng() % 20) {
+			case 0:
+				fill = entry_list[pick_entry(rng)];
+				break;
+			case 1:
+				fill += " " + Strings::ToUpper(entry_list[pick_entry(rng)]) + "!";
+				break;
+			case 2:
+				fill = entry_list[pick_entry(rng)] + "ing " + fill;
+				break;
+			default:
+				break;
+		}
+
+		lines.emplace_back(fmt::format(fmt::runtime(phrases[pick_phrase(rng)]), fill));
+	}
+
+	using clock = std::chrono::high_resolution_clock;
+
+	auto start = clock::now();
+	EQ::ProfanityMatcher matcher;
+	matcher.Build(entries);
+	const std::chrono::duration<double, std::milli> build_time = clock::now() - start;
+
+	std::vector<std::string> legacy = lines, compiled = lines;
+
+	start = clock::now();
+	for (auto &l: legacy) {
+		BenchmarkProfanityLegacyRedact(l, entries);
+	}
+	const std::chrono::duration<double> legacy_time = clock::now() - start;
+
+	start = clock::now();
+	for (auto &l: compiled) {
+		matcher.Redact(&l[0], l.length(), EQ::ProfanityManager::REDACTION_CHARACTER);
+	}
+	const std::chrono::duration<double> compiled_time = clock::now() - start;
+
+	size_t mismatches = 0, redacted = 0;
+	for (size_t i = 0; i < lines.size(); ++i) {
+		mismatches += legacy[i] != compiled[i];
+		redacted += compiled[i] != lines[i];
+	}
+
+	auto rate = [&](std::chrono::duration<double> elapsed) {
+		return Strings::Commify(static_cast<uint64>(elapsed.count() > 0 ? lines.size() / elapsed.count() : 0));
+	};
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📌 " << Strings::Commify(entries.size()) << " entries compiled to " << Strings::Commify(matcher.GetStateCount())
+			  << " states in " << std::fixed << std::setprecision(2) << build_time.count() << " ms\n";
+	std::cout << "📌 " << Strings::Commify(lines.size()) << " chat lines, " << Strings::Commify(redacted) << " redacted\n";
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "🐢 Search per entry | " << rate(legacy_time) << " lines/s\n";
+	std::cout << "🚀 Automaton        | " << rate(compiled_time) << " lines/s | "
+			  << (compiled_time.count() > 0 ? legacy_time / compiled_time : 0.0) << "x\n";
+
+	if (mismatches) {
+		std::cout << "❌ " << Strings::Commify(mismatches) << " lines were redacted differently\n";
+	}
+	else {
+		std::cout << "✅ Every line was redacted the same way\n";
+	}
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+}
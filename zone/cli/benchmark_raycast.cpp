@@ -0,0 +1,129 @@
+#include <chrono>
+#include <memory>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include "../../common/eqemu_logsys.h"
+#include "../map.h"
+#include "../raycast_mesh.h"
+
+void ZoneCLI::BenchmarkRaycast(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark raycasts over zone maps, one ray per call vs packed batches, for sight lines and ground probes. "
+				  "Options: --zone=qrg,poknowledge --rays=100000";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const std::vector<std::string> zones = Strings::Split(
+		Strings::ToLower(cmd("--zone").str().empty() ? "qrg,poknowledge" : cmd("--zone").str()),
+		','
+	);
+
+	const uint32 ray_count = cmd("--rays").str().empty() ? 100000 : Strings::ToUnsignedInt(cmd("--rays").str());
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📌 " << Strings::Commify(ray_count) << " rays per set, batches packed with " << getRaycastBatchKernel() << "\n";
+	std::cout << Strings::Repeat("-", 70) << "\n";
+
+	for (const auto &z: zones) {
+		LogSys.SilenceConsoleLogging();
+		std::unique_ptr<Map> map(Map::LoadMapFile(z));
+		LogSys.EnableConsoleLogging();
+
+		if (!map) {
+			std::cout << "❌ Unable to load map [" << z << "]\n";
+			continue;
+		}
+
+		glm::vec3 bmin, bmax;
+		map->GetBounds(bmin, bmax);
+
+		std::mt19937                          rng(ray_count);
+		std::uniform_real_distribution<float> rx(bmin.x, bmax.x);
+		std::uniform_real_distribution<float> ry(bmin.y, bmax.y);
+		std::uniform_real_distribution<float> offset(-150.0f, 150.0f);
+
+		auto ground = [&](float x, float y, glm::vec3 &out) {
+			return map->LineIntersectsZone(glm::vec3(x, y, bmax.z + 10.0f), glm::vec3(x, y, bmin.z - 10.0f), 0.0f, &out);
+		};
+
+		// sight lines between points on the ground up to 150 units apart, like an aggro scan, and straight down probes
+		// from the same kind of points, like FixZ
+		std::vector<glm::vec3> los_from, los_to, probe_from, probe_to;
+		for (uint32 attempt = 0; los_from.size() < ray_count && attempt < ray_count * 20; ++attempt) {
+			glm::vec3 a, b;
+			const float x = rx(rng), y = ry(rng);
+			if (!ground(x, y, a) || !ground(x + offset(rng), y + offset(rng), b)) {
+				continue;
+			}
+
+			los_from.emplace_back(a.x, a.y, a.z + 6.0f);
+			los_to.emplace_back(b.x, b.y, b.z + 6.0f);
+			probe_from.emplace_back(a.x, a.y, a.z + 10.0f);
+			probe_to.emplace_back(a.x, a.y, BEST_Z_INVALID);
+		}
+
+		const size_t count = los_from.size();
+		if (!count) {
+			std::cout << "❌ No ground found on map [" << z << "]\n";
+			continue;
+		}
+
+		using clock = std::chrono::high_resolution_clock;
+
+		std::vector<uint8>     los_single(count), los_batch(count), probe_single(count), probe_batch(count);
+		std::vector<glm::vec3> hit_single(count), hit_batch(count);
+
+		auto start = clock::now();
+		for (size_t i = 0; i < count; ++i) {
+			los_single[i] = map->CheckLoS(los_from[i], los_to[i]);
+		}
+		const std::chrono::duration<double> los_single_time = clock::now() - start;
+
+		start = clock::now();
+		map->CheckLoSBatch(los_from.data(), los_to.data(), los_batch.data(), count);
+		const std::chrono::duration<double> los_batch_time = clock::now() - start;
+
+		start = clock::now();
+		for (size_t i = 0; i < count; ++i) {
+			probe_single[i] = map->LineIntersectsZone(probe_from[i], probe_to[i], 0.0f, &hit_single[i]);
+		}
+		const std::chrono::duration<double> probe_single_time = clock::now() - start;
+
+		start = clock::now();
+		map->LineIntersectsZoneBatch(probe_from.data(), probe_to.data(), probe_batch.data(), hit_batch.data(), count);
+		const std::chrono::duration<double> probe_batch_time = clock::now() - start;
+
+		size_t mismatches = 0;
+		for (size_t i = 0; i < count; ++i) {
+			mismatches += los_single[i] != los_batch[i];
+			mismatches += probe_single[i] != probe_batch[i] || (probe_single[i] && hit_single[i] != hit_batch[i]);
+		}
+
+		auto rate = [&](std::chrono::duration<double> elapsed) {
+			return Strings::Commify(static_cast<uint64>(elapsed.count() > 0 ? count / elapsed.count() : 0));
+		};
+
+		auto speedup = [](std::chrono::duration<double> a, std::chrono::duration<double> b) {
+			return b.count() > 0 ? a / b : 0.0;
+		};
+
+		std::cout << "🗺️ " << z << " | " << Strings::Commify(count) << " rays\n";
+		std::cout << std::fixed << std::setprecision(2);
+		std::cout << "  👀 Sight lines  | single " << rate(los_single_time) << " rays/s | batch "
+				  << rate(los_batch_time) << " rays/s | " << speedup(los_single_time, los_batch_time) << "x\n";
+		std::cout << "  ⬇️ Ground probes | single " << rate(probe_single_time) << " rays/s | batch "
+				  << rate(probe_batch_time) << " rays/s | " << speedup(probe_single_time, probe_batch_time) << "x\n";
+
+		if (mismatches) {
+			std::cout << "  ❌ " << Strings::Commify(mismatches) << " answers differ between single and batch\n";
+		}
+		else {
+			std::cout << "  ✅ Every answer matches\n";
+		}
+
+		std::cout << Strings::Repeat("-", 70) << "\n";
+	}
+}
@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include "../../common/eqemu_logsys.h"
+#include "../../common/repositories/items_repository.h"
+#include "../../common/repositories/lootdrop_entries_repository.h"
+#include "../../common/repositories/loottable_entries_repository.h"
+#include "../../common/repositories/merchantlist_repository.h"
+#include "../../common/repositories/npc_faction_entries_repository.h"
+#include "../../common/repositories/npc_spells_entries_repository.h"
+#include "../../common/repositories/npc_types_repository.h"
+#include "../../common/repositories/spawn2_repository.h"
+#include "../../common/repositories/spawnentry_repository.h"
+#include "../zonedb.h"
+
+// loads a whole table through GetWhere and through StreamWhere, best of runs, and checks both paths read the same rows
+template<typename Repository, typename Key>
+static void BenchmarkRepositoryLoad(uint32 runs, Key key)
+{
+	using clock = std::chrono::high_resolution_clock;
+
+	std::chrono::duration<double, std::milli> text_best{}, binary_best{};
+
+	size_t text_rows = 0, binary_rows = 0;
+	uint64 text_sum  = 0, binary_sum = 0;
+	bool   ok        = true;
+
+	for (uint32 run = 0; run < runs; ++run) {
+		auto start = clock::now();
+
+		const auto entries = Repository::GetWhere(content_db, "TRUE");
+
+		text_rows = entries.size();
+		text_sum  = 0;
+		for (const auto &e: entries) {
+			text_sum += key(e);
+		}
+
+		const std::chrono::duration<double, std::milli> text_time = clock::now() - start;
+
+		start       = clock::now();
+		binary_rows = 0;
+		binary_sum  = 0;
+		ok          = Repository::StreamWhere(
+			content_db,
+			"TRUE",
+			[&](const auto &e) {
+				++binary_rows;
+				binary_sum += key(e);
+			}
+		);
+
+		const std::chrono::duration<double, std::milli> binary_time = clock::now() - start;
+
+		if (!run || text_time < text_best) {
+			text_best = text_time;
+		}
+
+		if (!run || binary_time < binary_best) {
+			binary_best = binary_time;
+		}
+	}
+
+	std::cout << std::left << std::setw(22) << Repository::TableName() << std::right
+			  << std::setw(10) << Strings::Commify(text_rows) << std::fixed << std::setprecision(2)
+			  << std::setw(12) << text_best.count() << std::setw(12) << binary_best.count()
+			  << std::setw(9) << (binary_best.count() > 0 ? text_best / binary_best : 0.0) << "x  ";
+
+	if (!ok) {
+		std::cout << "❌ statement failed\n";
+	}
+	else if (text_rows != binary_rows || text_sum != binary_sum) {
+		std::cout << "❌ rows differ (" << Strings::Commify(binary_rows) << " binary)\n";
+	}
+	else {
+		std::cout << "✅\n";
+	}
+}
+
+void ZoneCLI::BenchmarkRepositories(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark loading the largest content tables through the text protocol repositories (GetWhere) vs "
+				  "the binary prepared statement path (StreamWhere). Options: --runs=3";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const uint32 runs = cmd("--runs").str().empty() ? 3 : std::max(1u, Strings::ToUnsignedInt(cmd("--runs").str()));
+
+	std::cout << Strings::Repeat("-", 75) << "\n";
+	std::cout << "📌 Best of " << runs << " run(s), times in ms\n";
+	std::cout << Strings::Repeat("-", 75) << "\n";
+	std::cout << std::left << std::setw(22) << "Table" << std::right << std::setw(10) << "Rows"
+			  << std::setw(12) << "Text" << std::setw(12) << "Binary" << std::setw(10) << "Speedup" << "\n";
+	std::cout << Strings::Repeat("-", 75) << "\n";
+
+	// statements are logged when MySQL query logging is on, which would be most of what gets measured
+	LogSys.SilenceConsoleLogging();
+
+	// every column the key reads has to come through the same in both paths for the sums to match
+	BenchmarkRepositoryLoad<ItemsRepository>(
+		runs,
+		[](const auto &e) { return static_cast<uint64>(e.id) + e.price + e.icon + static_cast<uint64>(e.Name.size()); }
+	);
+	BenchmarkRepositoryLoad<NpcTypesRepository>(
+		runs,
+		[](const auto &e) { return static_cast<uint64>(e.id) + e.level + e.loottable_id + static_cast<uint64>(e.name.size()); }
+	);
+	BenchmarkRepositoryLoad<LootdropEntriesRepository>(
+		runs,
+		[](const auto &e) { return static_cast<uint64>(e.lootdrop_id) + e.item_id + static_cast<uint64>(e.chance * 100.0f); }
+	);
+	BenchmarkRepositoryLoad<LoottableEntriesRepository>(
+		runs,
+		[](const auto &e) { return static_cast<uint64>(e.loottable_id) + e.lootdrop_id + e.multiplier; }
+	);
+	BenchmarkRepositoryLoad<MerchantlistRepository>(
+		runs,
+		[](const auto &e) { return static_cast<uint64>(e.merchantid) + e.slot + e.item; }
+	);
+	BenchmarkRepositoryLoad<NpcFactionEntriesRepository>(
+		runs,
+		[](const auto &e) { return static_cast<uint64>(e.npc_faction_id) + e.faction_id + e.value; }
+	);
+	BenchmarkRepositoryLoad<NpcSpellsEntriesRepository>(
+		runs,
+		[](const auto &e) { return static_cast<uint64>(e.id) + e.npc_spells_id + e.spellid; }
+	);
+	BenchmarkRepositoryLoad<Spawn2Repository>(
+		runs,
+		[](const auto &e) { return static_cast<uint64>(e.id) + e.spawngroupID + static_cast<int64>(e.x) + e.zone.size(); }
+	);
+	BenchmarkRepositoryLoad<SpawnentryRepository>(
+		runs,
+		[](const auto &e) { return static_cast<uint64>(e.spawngroupID) + e.npcID + e.chance; }
+	);
+
+	LogSys.EnableConsoleLogging();
+
+	std::cout << Strings::Repeat("-", 75) << "\n";
+}
@@ -0,0 +1,136 @@
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include "../../common/spdat.h"
+
+void ZoneCLI::BenchmarkSpellTraits(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark the spell predicates over every spell id, scanning the effect slots vs the precomputed traits. "
+				  "Options: --passes=20";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const uint32 passes = cmd("--passes").str().empty() ? 20 : Strings::ToUnsignedInt(cmd("--passes").str());
+
+	if (!spells || SPDAT_RECORDS <= 0) {
+		std::cout << "Spells are not loaded\n";
+		return;
+	}
+
+	if (!spell_traits) {
+		std::cout << "Shared spells have no precomputed traits, run shared_memory first\n";
+		return;
+	}
+
+	const std::vector<bool (*)(uint16)> predicates = {
+		IsBeneficialSpell,
+		IsGroupSpell,
+		IsBardSong,
+		IsTargetableAESpell,
+		IsAESpell,
+		IsPBAESpell,
+		IsAERainSpell,
+		IsAEDurationSpell,
+		IsAnyAESpell,
+		IsPureNukeSpell,
+		IsAENukeSpell,
+		IsPBAENukeSpell,
+		IsAERainNukeSpell,
+		IsAnyNukeOrStunSpell,
+		IsPartialResistableSpell,
+		IsDamageSpell,
+		IsAnyDamageSpell,
+		IsDamageOverTimeSpell,
+		IsLifetapSpell,
+		IsSummonSpell,
+		IsTargetRequiredForSpell,
+	};
+
+	// effects looked up all over the spell and bonus code, most spells do not carry them
+	const std::vector<int> effects = {SE_CurrentHP, SE_Stun, SE_Mez, SE_Charm, SE_Illusion, SE_SummonPet, SE_Root};
+
+	const auto traits = spell_traits;
+
+	// answers from both paths, anything that differs means the traits were built from different spells
+	auto collect = [&]() {
+		std::vector<uint8> l;
+		l.reserve(static_cast<size_t>(SPDAT_RECORDS) * (predicates.size() + effects.size() * 2 + 1));
+		for (int32 spell_id = 0; spell_id < SPDAT_RECORDS; ++spell_id) {
+			for (const auto &p: predicates) {
+				l.emplace_back(p(spell_id));
+			}
+
+			for (auto e: effects) {
+				l.emplace_back(IsEffectInSpell(spell_id, e));
+				l.emplace_back(static_cast<uint8>(GetSpellEffectIndex(spell_id, e)));
+			}
+
+			l.emplace_back(static_cast<uint8>(SpellEffectsCount(spell_id)));
+		}
+
+		return l;
+	};
+
+	auto run = [&]() {
+		uint64 hits  = 0;
+		auto   start = std::chrono::high_resolution_clock::now();
+		for (uint32 pass = 0; pass < passes; ++pass) {
+			for (int32 spell_id = 0; spell_id < SPDAT_RECORDS; ++spell_id) {
+				for (const auto &p: predicates) {
+					hits += p(spell_id);
+				}
+
+				for (auto e: effects) {
+					hits += IsEffectInSpell(spell_id, e);
+					hits += GetSpellEffectIndex(spell_id, e) >= 0;
+				}
+
+				hits += SpellEffectsCount(spell_id);
+			}
+		}
+
+		return std::make_pair(std::chrono::high_resolution_clock::now() - start, hits);
+	};
+
+	const uint64 calls = static_cast<uint64>(passes) * SPDAT_RECORDS * (predicates.size() + effects.size() * 2 + 1);
+
+	auto report = [&](const std::string &name, std::chrono::duration<double> elapsed, uint64 hits) {
+		const double per_call_ns = std::chrono::duration<double, std::nano>(elapsed).count() / calls;
+		std::cout << name << " | " << std::fixed << std::setprecision(2)
+				  << std::chrono::duration<double, std::milli>(elapsed).count() << " ms | "
+				  << per_call_ns << " ns per call | " << Strings::Commify(hits) << " hits\n";
+	};
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📌 " << Strings::Commify(SPDAT_RECORDS) << " spells x " << predicates.size() + effects.size() * 2 + 1
+			  << " checks x " << passes << " passes (" << Strings::Commify(calls) << " calls)\n";
+	std::cout << Strings::Repeat("-", 70) << "\n";
+
+	spell_traits = nullptr;
+	const auto scanned                = collect();
+	const auto [scan_time, scan_hits] = run();
+	report("🐢 Effect slot scan  ", scan_time, scan_hits);
+
+	spell_traits = traits;
+	const auto precomputed                = collect();
+	const auto [traits_time, traits_hits] = run();
+	report("🚀 Precomputed traits", traits_time, traits_hits);
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+
+	size_t mismatches = 0;
+	for (size_t i = 0; i < scanned.size(); ++i) {
+		mismatches += scanned[i] != precomputed[i];
+	}
+
+	if (mismatches) {
+		std::cout << "❌ " << Strings::Commify(mismatches) << " answers differ between the scan and the traits\n";
+	}
+	else {
+		std::cout << "✅ Every answer matches\n";
+	}
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+}
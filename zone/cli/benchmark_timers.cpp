@@ -0,0 +1,126 @@
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include "../../common/timer.h"
+#include "../../common/wheel_timer.h"
+#include "../../common/event/timer_wheel.h"
+
+// Timer reads this clock, the benchmark steps it directly so every pass sees the same frames
+extern uint32 current_time;
+
+void ZoneCLI::BenchmarkTimers(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark per tick timer cost, polled Timer::Check() vs the timer wheel. "
+				  "Options: --entities=5000 --timers=40 --ticks=2000 --frame-ms=32";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const uint32 entity_count   = cmd("--entities").str().empty() ? 5000 : Strings::ToUnsignedInt(cmd("--entities").str());
+	const uint32 timers_per_mob = cmd("--timers").str().empty() ? 40 : Strings::ToUnsignedInt(cmd("--timers").str());
+	const uint32 ticks          = cmd("--ticks").str().empty() ? 2000 : Strings::ToUnsignedInt(cmd("--ticks").str());
+	const uint32 frame_ms       = cmd("--frame-ms").str().empty() ? 32 : Strings::ToUnsignedInt(cmd("--frame-ms").str());
+	const size_t timer_count    = static_cast<size_t>(entity_count) * timers_per_mob;
+
+	// mostly idle timers like the ones on Mob and Client, a few fast ones, the rest seconds to minutes or disabled
+	std::mt19937                    rng(1337);
+	std::uniform_int_distribution<> kind_dist(0, 99);
+	std::uniform_int_distribution<> fast_dist(100, 1000);
+	std::uniform_int_distribution<> slow_dist(2000, 120000);
+
+	std::vector<uint32> durations;
+	durations.reserve(timer_count);
+	for (size_t i = 0; i < timer_count; ++i) {
+		const int kind = kind_dist(rng);
+		durations.emplace_back(kind < 10 ? fast_dist(rng) : (kind < 60 ? slow_dist(rng) : 0));
+	}
+
+	auto report = [&](const std::string &name, std::chrono::duration<double> elapsed, uint64 fired) {
+		const double per_tick_us = std::chrono::duration<double, std::micro>(elapsed).count() / ticks;
+		std::cout << name << " | " << std::fixed << std::setprecision(2) << per_tick_us << " us per tick | "
+				  << Strings::Commify(fired) << " fired\n";
+	};
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📌 " << Strings::Commify(entity_count) << " entities x " << timers_per_mob << " timers ("
+			  << Strings::Commify(timer_count) << " timers), " << Strings::Commify(ticks) << " ticks of " << frame_ms << "ms\n";
+	std::cout << Strings::Repeat("-", 70) << "\n";
+
+	// 🐢 **Polled Timer (every timer checked every tick)**
+	{
+		std::vector<Timer> timers;
+		timers.reserve(timer_count);
+		for (auto d: durations) {
+			timers.emplace_back(d);
+		}
+
+		uint64 fired = 0;
+		auto   start = std::chrono::high_resolution_clock::now();
+		for (uint32 t = 0; t < ticks; ++t) {
+			current_time += frame_ms;
+			for (auto &e: timers) {
+				if (e.Check()) {
+					fired++;
+				}
+			}
+		}
+
+		report("🐢 Timer::Check() polled  ", std::chrono::high_resolution_clock::now() - start, fired);
+	}
+
+	// 🔁 **WheelTimer shim (still polled, ready flag set by the wheel)**
+	{
+		EQ::TimerWheel::Get().Advance(current_time);
+
+		std::vector<WheelTimer> timers;
+		timers.reserve(timer_count);
+		for (auto d: durations) {
+			timers.emplace_back(d);
+		}
+
+		uint64 fired = 0;
+		auto   start = std::chrono::high_resolution_clock::now();
+		for (uint32 t = 0; t < ticks; ++t) {
+			current_time += frame_ms;
+			EQ::TimerWheel::Get().Advance(current_time);
+			for (auto &e: timers) {
+				if (e.Check()) {
+					fired++;
+				}
+			}
+		}
+
+		report("🔁 WheelTimer polled      ", std::chrono::high_resolution_clock::now() - start, fired);
+	}
+
+	// 🚀 **WheelTimer callbacks (only fired timers are touched)**
+	{
+		EQ::TimerWheel::Get().Advance(current_time);
+
+		uint64 fired = 0;
+
+		std::vector<WheelTimer> timers;
+		timers.reserve(timer_count);
+		for (auto d: durations) {
+			timers.emplace_back(d);
+			timers.back().SetCallback(
+				[&fired](WheelTimer *timer) {
+					timer->Check();
+					fired++;
+				}
+			);
+		}
+
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32 t = 0; t < ticks; ++t) {
+			current_time += frame_ms;
+			EQ::TimerWheel::Get().Advance(current_time);
+		}
+
+		report("🚀 WheelTimer callbacks   ", std::chrono::high_resolution_clock::now() - start, fired);
+	}
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+}
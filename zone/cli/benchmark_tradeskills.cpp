@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include "../../common/eqemu_logsys.h"
+#include "../tradeskill_recipes.h"
+#include "../zonedb.h"
+
+struct BenchmarkCombine {
+	uint32              recipe_id = 0;
+	uint8               c_type    = 0;
+	uint32              some_id   = 0;
+	std::vector<uint32> item_ids;
+};
+
+// the queries a combine used to run before the recipe index, the lookup by components then the outputs of the match
+static uint32 LegacyCombineLookup(const BenchmarkCombine &c)
+{
+	const std::string containers = c.some_id ? fmt::format("IN ({}, {})", c.c_type, c.some_id) : fmt::format("= {}", c.c_type);
+
+	uint32 sum = 0;
+	for (const auto &id: c.item_ids) {
+		sum += id;
+	}
+
+	auto results = content_db.QueryDatabase(
+		fmt::format(
+			"SELECT tre.recipe_id FROM tradeskill_recipe_entries AS tre "
+			"INNER JOIN tradeskill_recipe AS tr ON (tre.recipe_id = tr.id) "
+			"WHERE tr.enabled AND ((tre.item_id IN ({}) AND tre.componentcount > 0) "
+			"OR (tre.item_id {} AND tre.iscontainer = 1))"
+			"GROUP BY tre.recipe_id HAVING SUM(tre.componentcount) = {} "
+			"AND SUM(tre.item_id * tre.componentcount) = {}",
+			Strings::Join(c.item_ids, ", "),
+			containers,
+			c.item_ids.size(),
+			sum
+		)
+	);
+
+	if (!results.Success() || !results.RowCount()) {
+		return 0;
+	}
+
+	std::vector<std::string> recipe_ids;
+	for (auto row: results) {
+		recipe_ids.emplace_back(row[0]);
+	}
+
+	if (recipe_ids.size() > 1) {
+		results = content_db.QueryDatabase(
+			fmt::format(
+				"SELECT tre.recipe_id FROM tradeskill_recipe_entries AS tre WHERE tre.recipe_id IN ({}) AND tre.item_id = {}",
+				Strings::Join(recipe_ids, ", "),
+				c.some_id ? c.some_id : c.c_type
+			)
+		);
+
+		if (!results.Success() || !results.RowCount()) {
+			return 0;
+		}
+	}
+
+	const uint32 recipe_id = Strings::ToUnsignedInt(results.begin()[0]);
+
+	for (const auto &column: {"componentcount", "successcount", "failcount", "salvagecount"}) {
+		content_db.QueryDatabase(
+			fmt::format(
+				"SELECT item_id, {} FROM tradeskill_recipe_entries WHERE {} > 0 AND recipe_id = {}",
+				column,
+				column,
+				recipe_id
+			)
+		);
+	}
+
+	return recipe_id;
+}
+
+void ZoneCLI::BenchmarkTradeskills(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark resolving tradeskill combines through the in-memory recipe index vs the queries they used to run. "
+				  "Replays a log of recipe ids, one per line, or random enabled recipes. Options: --log=combines.txt --combines=5000";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const uint32 combine_count = cmd("--combines").str().empty() ? 5000 : Strings::ToUnsignedInt(cmd("--combines").str());
+
+	LogSys.SilenceConsoleLogging();
+
+	auto start = std::chrono::high_resolution_clock::now();
+	tradeskill_recipes.Reload();
+	const size_t recipe_count = tradeskill_recipes.GetRecipeCount();
+	const std::chrono::duration<double, std::milli> load_time = std::chrono::high_resolution_clock::now() - start;
+
+	LogSys.EnableConsoleLogging();
+
+	std::vector<uint32> log;
+	if (!cmd("--log").str().empty()) {
+		std::ifstream in(cmd("--log").str());
+		if (!in) {
+			std::cout << "❌ Unable to open [" << cmd("--log").str() << "]\n";
+			return;
+		}
+
+		for (std::string line; std::getline(in, line);) {
+			Strings::Trim(line);
+			if (Strings::IsNumber(line)) {
+				log.emplace_back(Strings::ToUnsignedInt(line));
+			}
+		}
+	}
+	else {
+		auto results = content_db.QueryDatabase(
+			fmt::format("SELECT id FROM tradeskill_recipe WHERE enabled ORDER BY RAND() LIMIT {}", combine_count)
+		);
+
+		for (auto row: results) {
+			log.emplace_back(Strings::ToUnsignedInt(row[0]));
+		}
+	}
+
+	// the components in the order a player might drop them in, in the first container the recipe lists
+	std::mt19937                  rng(combine_count);
+	std::vector<BenchmarkCombine> combines;
+	for (const auto &recipe_id: log) {
+		const auto r = tradeskill_recipes.GetRecipe(recipe_id);
+		if (!r || r->components.empty() || r->components.size() > 10) {
+			continue;
+		}
+
+		auto container = std::find_if(
+			r->entries.begin(),
+			r->entries.end(),
+			[](const auto &e) { return e.iscontainer > 0; }
+		);
+		if (container == r->entries.end()) {
+			continue;
+		}
+
+		BenchmarkCombine c;
+		c.recipe_id = recipe_id;
+		c.item_ids  = r->components;
+
+		// world containers go by object type, anything else is a bag in inventory
+		if (container->item_id <= 0xFF) {
+			c.c_type = static_cast<uint8>(container->item_id);
+		}
+		else {
+			c.some_id = container->item_id;
+		}
+
+		std::shuffle(c.item_ids.begin(), c.item_ids.end(), rng);
+		combines.emplace_back(std::move(c));
+	}
+
+	if (combines.empty()) {
+		std::cout << "❌ No combines to replay\n";
+		return;
+	}
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📌 " << Strings::Commify(recipe_count) << " recipes, " << Strings::Commify(tradeskill_recipes.GetEntryCount())
+			  << " entries indexed in " << std::fixed << std::setprecision(2) << load_time.count() << " ms\n";
+	std::cout << "📌 Replaying " << Strings::Commify(combines.size()) << " combines\n";
+	std::cout << Strings::Repeat("-", 70) << "\n";
+
+	using clock = std::chrono::high_resolution_clock;
+
+	std::vector<uint32> legacy(combines.size()), indexed(combines.size());
+
+	LogSys.SilenceConsoleLogging();
+
+	start = clock::now();
+	for (size_t i = 0; i < combines.size(); ++i) {
+		legacy[i] = LegacyCombineLookup(combines[i]);
+	}
+	const std::chrono::duration<double> legacy_time = clock::now() - start;
+
+	start = clock::now();
+	for (size_t i = 0; i < combines.size(); ++i) {
+		const auto &c = combines[i];
+		const auto r  = tradeskill_recipes.FindByComponents(c.item_ids, c.c_type, c.some_id);
+		indexed[i] = r ? r->id : 0;
+	}
+	const std::chrono::duration<double> indexed_time = clock::now() - start;
+
+	LogSys.EnableConsoleLogging();
+
+	size_t mismatches = 0, unresolved = 0;
+	for (size_t i = 0; i < combines.size(); ++i) {
+		mismatches += legacy[i] != indexed[i];
+		unresolved += indexed[i] != combines[i].recipe_id;
+	}
+
+	auto rate = [&](std::chrono::duration<double> elapsed) {
+		return Strings::Commify(static_cast<uint64>(elapsed.count() > 0 ? combines.size() / elapsed.count() : 0));
+	};
+
+	std::cout << "🐢 SQL queries  | " << rate(legacy_time) << " combines/s\n";
+	std::cout << "🚀 Recipe index | " << rate(indexed_time) << " combines/s | "
+			  << (indexed_time.count() > 0 ? legacy_time / indexed_time : 0.0) << "x\n";
+
+	if (mismatches) {
+		// the queries matched on the sum of item ids, which a different set of components can share
+		std::cout << "❌ " << Strings::Commify(mismatches) << " combines resolved to a different recipe than the queries\n";
+	}
+	else {
+		std::cout << "✅ Every combine resolved to the same recipe\n";
+	}
+
+	if (unresolved) {
+		std::cout << "⚠️ " << Strings::Commify(unresolved)
+				  << " combines resolved to another recipe made from the same components\n";
+	}
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+}
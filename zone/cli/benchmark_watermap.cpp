@@ -0,0 +1,130 @@
+#include <chrono>
+#include <memory>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include "../../common/eqemu_logsys.h"
+#include "../water_map_v2.h"
+
+void ZoneCLI::BenchmarkWatermap(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark water map region lookups, every region in file order vs the grid index, one at a time and batched. "
+				  "Options: --zone=qeynos,kedge --points=200000";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const std::vector<std::string> zones = Strings::Split(
+		Strings::ToLower(cmd("--zone").str().empty() ? "qeynos,kedge" : cmd("--zone").str()),
+		','
+	);
+
+	const uint32 point_count = cmd("--points").str().empty() ? 200000 : Strings::ToUnsignedInt(cmd("--points").str());
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📌 " << Strings::Commify(point_count) << " points per zone\n";
+	std::cout << Strings::Repeat("-", 70) << "\n";
+
+	for (const auto &z: zones) {
+		LogSys.SilenceConsoleLogging();
+		std::unique_ptr<WaterMap> map(WaterMap::LoadWaterMapfile(z));
+		LogSys.EnableConsoleLogging();
+
+		auto v2 = dynamic_cast<WaterMapV2 *>(map.get());
+		if (!v2) {
+			std::cout << "❌ Unable to load a v2 water map for [" << z << "]\n";
+			continue;
+		}
+
+		const size_t region_count = v2->GetRegionCount();
+		if (!region_count) {
+			std::cout << "❌ Water map [" << z << "] has no regions\n";
+			continue;
+		}
+
+		glm::vec3 zmin, zmax;
+		v2->GetRegionBounds(0, zmin, zmax);
+		for (size_t i = 1; i < region_count; ++i) {
+			glm::vec3 rmin, rmax;
+			v2->GetRegionBounds(i, rmin, rmax);
+			zmin = glm::min(zmin, rmin);
+			zmax = glm::max(zmax, rmax);
+		}
+
+		// half the points inside the bounds of a random region, where the index has real work to do, and half anywhere
+		// over the water map, the way most mob and client positions are
+		std::mt19937                          rng(point_count);
+		std::uniform_int_distribution<size_t> pick(0, region_count - 1);
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+		std::vector<glm::vec3> points;
+		points.reserve(point_count);
+		for (uint32 i = 0; i < point_count; ++i) {
+			glm::vec3 lo = zmin, hi = zmax;
+			if (i & 1) {
+				v2->GetRegionBounds(pick(rng), lo, hi);
+			}
+
+			points.emplace_back(
+				lo.x + (hi.x - lo.x) * unit(rng),
+				lo.y + (hi.y - lo.y) * unit(rng),
+				lo.z + (hi.z - lo.z) * unit(rng)
+			);
+		}
+
+		using clock = std::chrono::high_resolution_clock;
+
+		const size_t                 count = points.size();
+		std::vector<WaterRegionType> linear(count), indexed(count), batch(count);
+
+		auto start = clock::now();
+		for (size_t i = 0; i < count; ++i) {
+			linear[i] = v2->ReturnRegionTypeUnindexed(points[i]);
+		}
+		const std::chrono::duration<double> linear_time = clock::now() - start;
+
+		start = clock::now();
+		for (size_t i = 0; i < count; ++i) {
+			indexed[i] = v2->ReturnRegionType(points[i]);
+		}
+		const std::chrono::duration<double> indexed_time = clock::now() - start;
+
+		start = clock::now();
+		v2->ReturnRegionTypeBatch(points.data(), batch.data(), count);
+		const std::chrono::duration<double> batch_time = clock::now() - start;
+
+		size_t mismatches = 0;
+		size_t in_region  = 0;
+		for (size_t i = 0; i < count; ++i) {
+			mismatches += linear[i] != indexed[i] || linear[i] != batch[i];
+			in_region += linear[i] != RegionTypeNormal;
+		}
+
+		auto rate = [&](std::chrono::duration<double> elapsed) {
+			return Strings::Commify(static_cast<uint64>(elapsed.count() > 0 ? count / elapsed.count() : 0));
+		};
+
+		auto speedup = [](std::chrono::duration<double> a, std::chrono::duration<double> b) {
+			return b.count() > 0 ? a / b : 0.0;
+		};
+
+		std::cout << "🌊 " << z << " | " << Strings::Commify(region_count) << " regions | "
+				  << Strings::Commify(in_region) << " points inside a region\n";
+		std::cout << std::fixed << std::setprecision(2);
+		std::cout << "  🐢 Every region | " << rate(linear_time) << " lookups/s\n";
+		std::cout << "  🚀 Grid index   | " << rate(indexed_time) << " lookups/s | "
+				  << speedup(linear_time, indexed_time) << "x\n";
+		std::cout << "  📦 Grid batch   | " << rate(batch_time) << " lookups/s | "
+				  << speedup(linear_time, batch_time) << "x\n";
+
+		if (mismatches) {
+			std::cout << "  ❌ " << Strings::Commify(mismatches) << " answers differ from the file order scan\n";
+		}
+		else {
+			std::cout << "  ✅ Every answer matches\n";
+		}
+
+		std::cout << Strings::Repeat("-", 70) << "\n";
+	}
+}
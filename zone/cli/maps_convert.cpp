@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include "../../common/eqemu_logsys.h"
+#include "../../common/path_manager.h"
+#include "../../common/serverinfo.h"
+#include "../map.h"
+
+// anonymous (process private) resident memory, the part of RSS that is not shared through the page cache
+static size_t GetPrivateRSS()
+{
+	std::ifstream status("/proc/self/status");
+	std::string   line;
+	while (std::getline(status, line)) {
+		if (line.rfind("RssAnon:", 0) == 0) {
+			return std::strtoull(line.c_str() + 8, nullptr, 10) * 1024;
+		}
+	}
+
+	return 0;
+}
+
+void ZoneCLI::MapsConvert(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Converts .map files to mapped meshes that zones map in place instead of building, "
+				  "reporting load time and memory for both. Options: --zone=poknowledge,nexus (default every map)";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const std::string base_path = fmt::format("{}/base", path.GetMapsPath());
+
+	std::vector<std::string> zones;
+	if (!cmd("--zone").str().empty()) {
+		zones = Strings::Split(Strings::ToLower(cmd("--zone").str()), ',');
+	}
+	else {
+		std::error_code ec;
+		for (const auto &e: fs::directory_iterator(base_path, ec)) {
+			if (e.path().extension() == ".map") {
+				zones.emplace_back(e.path().stem().string());
+			}
+		}
+
+		std::sort(zones.begin(), zones.end());
+	}
+
+	if (zones.empty()) {
+		std::cout << "No maps found in [" << base_path << "]\n";
+		return;
+	}
+
+	struct Sample {
+		double load_ms    = 0.0;
+		double rss_mb     = 0.0;
+		double private_mb = 0.0;
+	};
+
+	auto measure = [](const std::function<Map *()> &load, Sample &s) {
+		const size_t rss         = EQ::GetRSS();
+		const size_t private_rss = GetPrivateRSS();
+		const auto   start       = std::chrono::high_resolution_clock::now();
+
+		Map *m = load();
+
+		s.load_ms    = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		s.rss_mb     = (static_cast<double>(EQ::GetRSS()) - rss) / 1048576.0;
+		s.private_mb = (static_cast<double>(GetPrivateRSS()) - private_rss) / 1048576.0;
+
+		return m;
+	};
+
+	LogSys.SilenceConsoleLogging();
+
+	std::vector<std::tuple<std::string, Sample, Sample>> results;
+	std::vector<std::string>                             failed;
+
+	for (const auto &z: zones) {
+		const std::string file_name = fmt::format("{}/{}.map", base_path, z);
+
+		Sample source;
+		auto   m = measure(
+			[&]() -> Map * {
+				auto n = new Map();
+				if (!n->LoadSource(file_name)) {
+					delete n;
+					return nullptr;
+				}
+
+				return n;
+			},
+			source
+		);
+
+		if (!m || !m->SaveMapped(file_name)) {
+			failed.emplace_back(z);
+			delete m;
+			continue;
+		}
+
+		delete m;
+
+		// straight through Map::Load, the same path a booting zone takes
+		Sample mapped;
+		m = measure([&]() { return Map::LoadMapFile(z); }, mapped);
+		if (!m) {
+			failed.emplace_back(z);
+			continue;
+		}
+
+		delete m;
+
+		results.emplace_back(z, source, mapped);
+	}
+
+	LogSys.EnableConsoleLogging();
+
+	std::cout << Strings::Repeat("-", 94) << "\n";
+	std::cout << std::left << std::setw(22) << "Zone" << std::right
+			  << std::setw(12) << ".map ms" << std::setw(12) << "mapped ms"
+			  << std::setw(12) << ".map RSS" << std::setw(12) << "mapped RSS"
+			  << std::setw(12) << ".map priv" << std::setw(12) << "mapped priv" << "\n";
+	std::cout << Strings::Repeat("-", 94) << "\n";
+
+	Sample source_total, mapped_total;
+	for (const auto &[z, s, m]: results) {
+		std::cout << std::left << std::setw(22) << z << std::right << std::fixed << std::setprecision(2)
+				  << std::setw(12) << s.load_ms << std::setw(12) << m.load_ms
+				  << std::setw(12) << s.rss_mb << std::setw(12) << m.rss_mb
+				  << std::setw(12) << s.private_mb << std::setw(12) << m.private_mb << "\n";
+
+		source_total.load_ms += s.load_ms;
+		source_total.rss_mb += s.rss_mb;
+		source_total.private_mb += s.private_mb;
+		mapped_total.load_ms += m.load_ms;
+		mapped_total.rss_mb += m.rss_mb;
+		mapped_total.private_mb += m.private_mb;
+	}
+
+	std::cout << Strings::Repeat("-", 94) << "\n";
+	std::cout << "📌 Memory in MB. Mapped RSS is page cache shared by every zone with the map open, priv is per process\n";
+	std::cout << "✅ Converted " << Strings::Commify(results.size()) << " map(s) | load " << std::fixed << std::setprecision(2)
+			  << source_total.load_ms << " ms -> " << mapped_total.load_ms << " ms | RSS "
+			  << source_total.rss_mb << " MB -> " << mapped_total.rss_mb << " MB | private "
+			  << source_total.private_mb << " MB -> " << mapped_total.private_mb << " MB\n";
+
+	for (const auto &z: failed) {
+		std::cout << "❌ Failed to convert [" << z << "]\n";
+	}
+
+	std::cout << Strings::Repeat("-", 94) << "\n";
+}
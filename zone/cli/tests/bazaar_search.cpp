@@ -0,0 +1,143 @@
+#include "../../common/eqemu_logsys.h"
+#include "../../common/bazaar.h"
+#include "../../common/bazaar_search_index.h"
+#include "../../common/repositories/character_data_repository.h"
+#include "../../common/repositories/trader_repository.h"
+#include "../../zone.h"
+
+extern Zone              *zone;
+extern BazaarSearchIndex bazaar_search_index;
+
+// results in serial number order, the index and the queries do not return listings of one trader in the same order
+static std::string SerializeBazaarResults(std::vector<BazaarSearchResultsFromDB_Struct> l)
+{
+	std::sort(
+		l.begin(),
+		l.end(),
+		[](const auto &a, const auto &b) {
+			return a.serial_number < b.serial_number;
+		}
+	);
+
+	std::vector<std::string> entries;
+	for (const auto &r: l) {
+		entries.emplace_back(
+			fmt::format(
+				"{}:{}:{}:{}:{}:{}",
+				r.serial_number,
+				r.cost,
+				r.charges,
+				r.trader_id,
+				r.item_name.c_str(),
+				r.trader_name.c_str()
+			)
+		);
+	}
+
+	return entries.empty() ? "none" : Strings::Join(entries, ",");
+}
+
+void ZoneCLI::TestBazaarSearch(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	SetupZone("qrg");
+
+	std::cout << "===========================================\n";
+	std::cout << "⚙\uFE0F> Running Bazaar Search Tests...\n";
+	std::cout << "===========================================\n\n";
+
+	// two tradeable items that do not stack, so a price change matches on charges
+	std::vector<const EQ::ItemData *> items;
+
+	uint32 id = 0;
+	for (auto i = database.IterateItems(&id); i && items.size() < 2; i = database.IterateItems(&id)) {
+		if (i->NoDrop != 0 && !i->Stackable && i->Name[0]) {
+			items.emplace_back(i);
+		}
+	}
+
+	if (items.size() < 2) {
+		std::cerr << "[❌] No tradeable items in the database to test with\n";
+		std::exit(1);
+	}
+
+	// listings join character_data for the trader name
+	const std::string trader_name = "BazaarSearchTest";
+
+	auto characters = CharacterDataRepository::GetWhere(database, fmt::format("`name` = '{}'", trader_name));
+	auto trader     = characters.empty() ? CharacterDataRepository::NewEntity() : characters.front();
+	if (characters.empty()) {
+		trader.name = trader_name;
+		trader      = CharacterDataRepository::InsertOne(database, trader);
+	}
+
+	TraderRepository::DeleteWhere(database, fmt::format("`char_id` = {}", trader.id));
+
+	std::vector<TraderRepository::Trader> listings;
+	for (uint32 i = 0; i < 3; ++i) {
+		auto e = TraderRepository::NewEntity();
+		e.char_id               = trader.id;
+		e.item_id               = items[i == 2 ? 1 : 0]->ID;
+		e.item_sn               = 900000 + i;
+		e.item_charges          = 1;
+		e.item_cost             = 1000 * (i + 1);
+		e.slot_id               = i;
+		e.char_entity_id        = 1;
+		e.char_zone_id          = zone->GetZoneID();
+		e.char_zone_instance_id = zone->GetInstanceID();
+		e.listing_date          = time(nullptr);
+
+		listings.emplace_back(e);
+	}
+
+	TraderRepository::InsertMany(database, listings);
+
+	BazaarSearchCriteria_Struct search{};
+	search.search_scope = AllTraders_Scope;
+	search.trader_id    = trader.id;
+	search._class       = std::numeric_limits<uint32>::max();
+	search.race         = std::numeric_limits<uint32>::max();
+	search.item_stat    = std::numeric_limits<uint32>::max();
+	search.slot         = std::numeric_limits<uint32>::max();
+	search.type         = std::numeric_limits<uint32>::max();
+	search.min_level    = 1;
+	search.max_level    = 100;
+	search.max_results  = 200;
+
+	auto search_both = [&](const std::string &test_name) {
+		const auto queried = SerializeBazaarResults(
+			Bazaar::GetSearchResults(database, content_db, search, zone->GetZoneID(), zone->GetInstanceID())
+		);
+		const auto indexed = SerializeBazaarResults(
+			bazaar_search_index.Search(search, zone->GetZoneID(), zone->GetInstanceID())
+		);
+
+		RunTest(test_name, queried, indexed);
+
+		return indexed;
+	};
+
+	bazaar_search_index.Reload();
+	search_both("Index matches the queries for new listings");
+
+	// what ServerOP_BazaarListingsChanged delivers to every zone after a trader write
+	database.UpdateTraderItemPrice(trader.id, items[0]->ID, 1, 7000);
+	bazaar_search_index.MarkTraderChanged(trader.id);
+	const auto repriced = search_both("Index matches the queries after a price change");
+	RunTest("Price change is searchable", true, repriced.find(":7000:") != std::string::npos);
+
+	database.UpdateTraderItemPrice(trader.id, items[0]->ID, 1, 0);
+	bazaar_search_index.MarkTraderChanged(trader.id);
+	const auto removed = search_both("Index matches the queries after a removal");
+	RunTest("Removed listings are not searchable", false, removed.find(":7000:") != std::string::npos);
+
+	TraderRepository::DeleteWhere(database, fmt::format("`char_id` = {}", trader.id));
+	CharacterDataRepository::DeleteOne(database, trader.id);
+
+	std::cout << "\n===========================================\n";
+	std::cout << "✅ All Bazaar Search Tests Completed!\n";
+	std::cout << "===========================================\n";
+}
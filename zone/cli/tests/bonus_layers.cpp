@@ -0,0 +1,82 @@
+#include "../../common/eqemu_logsys.h"
+#include "../../common/rulesys.h"
+#include "../../zone.h"
+#include "../../client.h"
+
+extern Zone *zone;
+
+void ZoneCLI::TestBonusLayers(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	SetupZone("qrg");
+
+	std::cout << "===========================================\n";
+	std::cout << "⚙\uFE0F> Running Bonus Layer Tests...\n";
+	std::cout << "===========================================\n\n";
+
+	// an item with more ATK than the cap allows, and a buff that raises the cap
+	const EQ::ItemData *item = nullptr;
+
+	uint32 id = 0;
+	for (auto i = database.IterateItems(&id); i; i = database.IterateItems(&id)) {
+		if (
+			i->ItemClass == EQ::item::ItemClassCommon &&
+			i->Attack > 0 &&
+			!i->ReqLevel &&
+			!i->RecLevel &&
+			(i->Slots & (1 << EQ::invslot::slotChest)) &&
+			i->IsEquipable(Race::Human, GetPlayerClassBit(Class::Warrior))
+		) {
+			item = i;
+			break;
+		}
+	}
+
+	uint16 spell_id = 0;
+	for (int i = 0; i < SPDAT_RECORDS && !spell_id; ++i) {
+		if (IsValidSpell(i) && IsBeneficialSpell(i) && spells[i].buff_duration > 0) {
+			for (int e = 0; e < EFFECT_COUNT; ++e) {
+				if (spells[i].effect_id[e] == SE_ItemAttackCapIncrease && spells[i].base_value[e] > 0) {
+					spell_id = i;
+					break;
+				}
+			}
+		}
+	}
+
+	if (!item || !spell_id) {
+		std::cerr << "[❌] No chest item with ATK or ItemATKCap buff in the database to test with\n";
+		std::exit(1);
+	}
+
+	RuleManager::Instance()->SetRule("Character:ItemATKCap", "0");
+
+	auto c = new Client();
+	c->GetPP().race    = Race::Human;
+	c->GetPP().class_  = Class::Warrior;
+	c->GetPP().classes = GetPlayerClassBit(Class::Warrior);
+
+	auto inst = database.CreateItem(item->ID);
+	c->GetInv().PutItem(EQ::invslot::slotChest, *inst);
+	safe_delete(inst);
+
+	c->CalcBonuses();
+	RunTest("Item ATK is held at a cap of 0", 0, c->GetItemBonuses().ATK);
+
+	// AddBuff only recalculates the spell layer, the item layer has to follow the cap it raised
+	c->AddBuff(c, spell_id, 10, 65);
+
+	const int cap = c->GetSpellBonuses().ItemATKCap;
+	RunTest("ItemATKCap buff raises the cap", true, cap > 0);
+	RunTest("ItemATKCap buff raises item ATK", std::min<int>(item->Attack, cap), c->GetItemBonuses().ATK);
+
+	c->BuffFadeBySpellID(spell_id);
+	RunTest("Fading the buff lowers item ATK again", 0, c->GetItemBonuses().ATK);
+
+	std::cout << "\n===========================================\n";
+	std::cout << "✅ All Bonus Layer Tests Completed!\n";
+	std::cout << "===========================================\n";
+}
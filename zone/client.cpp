@@ -41,6 +41,7 @@ extern volatile bool RunLoops;
 #include "../common/strings.h"
 #include "../common/data_verification.h"
 #include "../common/profanity_manager.h"
+#include "../common/database/database_write_queue.h"
 #include "data_bucket.h"
 #include "dynamic_zone.h"
 #include "expedition_request.h"
@@ -50,6 +51,7 @@ extern volatile bool RunLoops;
 #include "petitions.h"
 #include "command.h"
 #include "water_map.h"
+#include "map.h"
 #include "bot_command.h"
 #include "string_ids.h"
 #include "dialogue_window.h"
@@ -292,6 +294,7 @@ Client::Client() : Mob(
 	SetMerc(0);
 	if (RuleI(World, PVPMinLevel) > 0 && level >= RuleI(World, PVPMinLevel) && m_pp.pvp == 0) SetPVP(true, false);
 	dynamiczone_removal_timer.Disable();
+	SetTimerCallbacks();
 
 	//for good measure:
 	memset(&m_pp, 0, sizeof(m_pp));
@@ -607,6 +610,7 @@ Client::Client(EQStreamInterface *ieqs) : Mob(
 	SetMerc(0);
 	if (RuleI(World, PVPMinLevel) > 0 && level >= RuleI(World, PVPMinLevel) && m_pp.pvp == 0) SetPVP(true, false);
 	dynamiczone_removal_timer.Disable();
+	SetTimerCallbacks();
 
 	//for good measure:
 	memset(&m_pp, 0, sizeof(m_pp));
@@ -753,6 +757,7 @@ Client::~Client() {
 
 	if (IsTrader()) {
 		TraderRepository::DeleteWhere(database, fmt::format("`char_id` = '{}'", CharacterID()));
+		worldserver.SendBazaarListingsChanged(CharacterID());
 
 		SendBecomeTraderToWorld(this, TraderOff);
 		SendTraderMode(TraderOff);
@@ -1068,7 +1073,13 @@ bool Client::Save(uint8 iCommitNow) {
         });
     }
 	if (!entries.empty()) {
-		AccountKillCountsRepository::ReplaceMany(database, entries);
+		database_write_queue.Enqueue(
+			CharacterID(),
+			fmt::format("account_kill_counts:{}", account_id),
+			[entries = std::move(entries)](Database &db) {
+				AccountKillCountsRepository::ReplaceMany(db, entries);
+			}
+		);
 	}
 
 	/* Save Character Currency */
@@ -1169,6 +1180,11 @@ bool Client::Save(uint8 iCommitNow) {
 		database.botdb.SaveBotSettings(this);
 	}
 
+	// the next zone (or world on camp) reads these rows back, they have to be committed before we hand off
+	if (iCommitNow == 2) {
+		database_write_queue.Flush(CharacterID());
+	}
+
 	return true;
 }
 
@@ -2082,6 +2098,23 @@ void Client::QueuePacket(const EQApplicationPacket* app, bool ack_req, CLIENT_CO
     }
 }
 
+void Client::QueueCachedPacket(EncodedPacketCache& cache, CLIENT_CONN_STATUS required_state) {
+	const EQApplicationPacket* app = cache.GetSource();
+
+	// fancy model rewrites and packets held until we are connected are per client, they can't share an encode
+	if (
+		(app->GetOpcode() == OP_NewSpawn && m_fancy_models) ||
+		(required_state != CLIENT_CONNECTINGALL && client_state != required_state)
+	) {
+		QueuePacket(app, cache.IsAckRequired(), required_state);
+		return;
+	}
+
+	if (eqs) {
+		eqs->QueueCachedPacket(cache);
+	}
+}
+
 void Client::FastQueuePacket(EQApplicationPacket** app, bool ack_req, CLIENT_CONN_STATUS required_state) {
 	if (m_fancy_models == -1) {
 		m_fancy_models = GetBucket("DisableFancyModels").empty() ? 1 : 0;
@@ -13323,30 +13356,18 @@ void Client::SetTrackingID(uint32 entity_id)
 
 int Client::GetRecipeMadeCount(uint32 recipe_id)
 {
-	auto r = CharRecipeListRepository::GetWhere(
-		database,
-		fmt::format("char_id = {} AND recipe_id = {}", CharacterID(), recipe_id)
-	);
+	LoadLearnedRecipes();
 
-	if (!r.empty() && r[0].recipe_id) {
-		return r[0].madecount;
-	}
+	auto it = m_learned_recipes.find(recipe_id);
 
-	return 0;
+	return it != m_learned_recipes.end() ? it->second : 0;
 }
 
 bool Client::HasRecipeLearned(uint32 recipe_id)
 {
-	auto r = CharRecipeListRepository::GetWhere(
-		database,
-		fmt::format("char_id = {} AND recipe_id = {}", CharacterID(), recipe_id)
-	);
+	LoadLearnedRecipes();
 
-	if (!r.empty() && r[0].recipe_id) {
-		return true;
-	}
-
-	return false;
+	return m_learned_recipes.find(recipe_id) != m_learned_recipes.end();
 }
 
 bool Client::IsLockSavePosition() const
@@ -14683,6 +14704,11 @@ void Client::ClientToNpcAggroProcess()
 {
 	if (zone->CanDoCombat() && !GetFeigned() && m_client_npc_aggro_scan_timer.Check()) {
 		int npc_scan_count = 0;
+
+		// everything but line of sight first, then the sight lines of whoever is left go out as one batch
+		std::vector<Mob *>     candidates;
+		std::vector<glm::vec3> los_from;
+		std::vector<glm::vec3> los_to;
 		for (auto& close_mob : GetCloseMobList()) {
 			Mob* mob = close_mob.second;
 			if (!mob) {
@@ -14693,13 +14719,46 @@ void Client::ClientToNpcAggroProcess()
 				continue;
 			}
 
-			if (mob->CheckWillAggro(this) && !mob->CheckAggro(this)) {
-				mob->AddToHateList(this, 25);
+			if (mob->CheckWillAggroExceptLoS(this) && !mob->CheckAggro(this)) {
+				glm::vec3 from, to;
+				mob->GetLosEndpoints(GetX(), GetY(), GetZ(), GetSize(), from, to);
+
+				candidates.emplace_back(mob);
+				los_from.emplace_back(from);
+				los_to.emplace_back(to);
 			}
 
 			npc_scan_count++;
 		}
-		LogAggro("Checking Reverse Aggro (client->npc) scanned_npcs ([{}])", npc_scan_count);
+
+		std::vector<uint8> los(candidates.size());
+		if (zone->zonemap) {
+			zone->zonemap->CheckLoSBatch(los_from.data(), los_to.data(), los.data(), candidates.size());
+		}
+		else {
+			for (size_t i = 0; i < candidates.size(); ++i) {
+				los[i] = candidates[i]->CheckLosFN(this);
+			}
+		}
+
+		for (size_t i = 0; i < candidates.size(); ++i) {
+			Mob *mob = candidates[i];
+			mob->SetLastLosState(los[i]);
+
+			// an earlier add in this scan may have pulled this one in already
+			if (!los[i] || mob->CheckAggro(this)) {
+				continue;
+			}
+
+			LogAggro("Check aggro for [{}] target [{}]", mob->GetName(), GetName());
+			mob->AddToHateList(this, 25);
+		}
+
+		LogAggro(
+			"Checking Reverse Aggro (client->npc) scanned_npcs ([{}]) line of sight checks ([{}])",
+			npc_scan_count,
+			candidates.size()
+		);
 	}
 }
 
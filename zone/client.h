@@ -41,6 +41,7 @@ namespace EQ
 }
 
 #include "../common/timer.h"
+#include "../common/wheel_timer.h"
 #include "../common/ptimer.h"
 #include "../common/emu_opcodes.h"
 #include "../common/eq_packet_structs.h"
@@ -67,6 +68,7 @@ namespace EQ
 #include "../common/zone_store.h"
 #include "task_manager.h"
 #include "task_client_state.h"
+#include "tradeskill_recipes.h"
 #include "cheat_manager.h"
 #include "../common/events/player_events.h"
 #include "../common/data_verification.h"
@@ -470,6 +472,7 @@ public:
 	void FixModel(Spawn_Struct* npc);
 	void QueuePacket(const EQApplicationPacket* app, bool ack_req = true, CLIENT_CONN_STATUS = CLIENT_CONNECTINGALL, eqFilterType filter=FilterNone);
 	void FastQueuePacket(EQApplicationPacket** app, bool ack_req = true, CLIENT_CONN_STATUS = CLIENT_CONNECTINGALL);
+	void QueueCachedPacket(EncodedPacketCache& cache, CLIENT_CONN_STATUS required_state = CLIENT_CONNECTINGALL);
 	void ChannelMessageReceived(uint8 chan_num, uint8 language, uint8 lang_skill, const char* orig_message, const char* targetname = nullptr, bool is_silent = false);
 	void ChannelMessageSend(const char* from, const char* to, uint8 channel_id, uint8 language_id, uint8 language_skill, const char* message, ...);
 	void Message(uint32 type, const char* message, ...);
@@ -479,8 +482,9 @@ public:
 	void LearnRecipe(uint32 recipe_id);
 	int GetRecipeMadeCount(uint32 recipe_id);
 	bool HasRecipeLearned(uint32 recipe_id);
+	void SetRecipeMadeCount(uint32 recipe_id, uint32 made_count);
 	bool CanIncreaseTradeskill(EQ::skills::SkillType tradeskill);
-	void ScribeRecipes(uint32_t item_id) const;
+	void ScribeRecipes(uint32_t item_id);
 
 	bool GetRevoked() const { return revoked; }
 	void SetRevoked(bool rev) { revoked = rev; }
@@ -980,7 +984,7 @@ public:
 	uint8 GetSkillTrainLevel(EQ::skills::SkillType skill_id, uint8 class_id);
 	void MaxSkills();
 
-	void SendTradeskillSearchResults(const std::string &query, unsigned long objtype, unsigned long someid);
+	void SendTradeskillSearchResults(const std::vector<const TradeskillRecipes::Recipe *> &recipes, unsigned long objtype, unsigned long someid);
 	void SendTradeskillDetails(uint32 recipe_id);
 	bool TradeskillExecute(DBTradeskillRecipe_Struct *spec);
 	void CheckIncreaseTradeskill(int16 bonusstat, int16 stat_modifier, float skillup_modifier, uint16 success_modifier, EQ::skills::SkillType tradeskill);
@@ -2102,6 +2106,16 @@ protected:
 
 private:
 
+	// raw bonus layers, CalcBonuses copies them into itembonuses, spellbonuses and aabonuses before negation and caps
+	StatBonuses m_item_bonus_layer;
+	StatBonuses m_spell_bonus_layer;
+	StatBonuses m_aa_bonus_layer;
+	uint8       m_valid_bonus_layers = 0;
+	int32       m_item_bonus_layer_atk_cap = 0; // spell and AA ItemATKCap the item layer was built against
+
+	void CalcItemBonusLayer();
+	void ValidateBonusLayers(uint8 layers);
+
 	eqFilterMode ClientFilters[_FilterCount];
 	int32 HandlePacket(const EQApplicationPacket *app);
 	void OPTGB(const EQApplicationPacket *app);
@@ -2256,6 +2270,11 @@ private:
 
 	// https://github.com/EQEmu/Server/pull/2479
 	bool m_lock_save_position = false;
+
+	// char_recipe_list for this character, recipe_id => madecount, read once on the first tradeskill lookup
+	std::unordered_map<uint32, uint32> m_learned_recipes;
+	bool                               m_learned_recipes_loaded = false;
+	void LoadLearnedRecipes();
 public:
 	bool IsLockSavePosition() const;
 	void SetLockSavePosition(bool lock_save_position);
@@ -2310,18 +2329,20 @@ private:
 
 	WaterRegionType last_region_type;
 
+	void SetTimerCallbacks();
+
 	PTimerList p_timers; //persistent timers
 	Timer hpupdate_timer;
-	Timer camp_timer;
+	WheelTimer camp_timer;
 	Timer bot_camp_timer;
 	Timer process_timer;
-	Timer consume_food_timer;
+	WheelTimer consume_food_timer;
 	Timer zoneinpacket_timer;
-	Timer linkdead_timer;
-	Timer dead_timer;
+	WheelTimer linkdead_timer;
+	WheelTimer dead_timer;
 	Timer global_channel_timer;
-	Timer fishing_timer;
-	Timer endupkeep_timer;
+	WheelTimer fishing_timer;
+	WheelTimer endupkeep_timer;
 	Timer autosave_timer;
 	Timer tribute_timer;
 	Timer fast_tic_timer;
@@ -2334,14 +2355,14 @@ private:
 	Timer charm_cast_timer;
 	Timer qglobal_purge_timer;
 	Timer TrackingTimer;
-	Timer RespawnFromHoverTimer;
+	WheelTimer RespawnFromHoverTimer;
 	Timer merc_timer;
 	Timer anon_toggle_timer;
 	Timer afk_toggle_timer;
 	Timer helm_toggle_timer;
 	Timer aggro_meter_timer;
 	Timer consent_throttle_timer;
-	Timer dynamiczone_removal_timer;
+	WheelTimer dynamiczone_removal_timer;
 	Timer task_request_timer;
 	Timer pick_lock_timer;
 	Timer parcel_timer;	//Used to limit the number of parcels to one every 30 seconds (default).  Changable via rule.
@@ -2381,6 +2402,7 @@ private:
 	bool bZoning;
 	bool tgb;
 	bool instalog;
+	bool m_process_remove = false;
 	int32 last_reported_mana;
 	int32 last_reported_endurance;
 
@@ -887,6 +887,7 @@ void Client::CompleteConnect()
 	if (zone->GetZoneID() == Zones::BAZAAR) {
 		if (IsTrader()) {
 			TraderRepository::DeleteWhere(database, fmt::format("`char_id` = '{}'", CharacterID()));
+			worldserver.SendBazaarListingsChanged(CharacterID());
 
 			SendBecomeTraderToWorld(this, TraderOff);
 			SendTraderMode(TraderOff);
@@ -5187,6 +5188,7 @@ void Client::Handle_OP_ClientUpdate(const EQApplicationPacket *app) {
 	m_Position.x = cx;
 	m_Position.y = cy;
 	m_Position.z = cz;
+	entity_list.GetSpatialGrid().Update(this);
 
 	/* Visual Debugging */
 	if (RuleB(Character, OPClientUpdateVisualDebug)) {
@@ -12747,16 +12749,12 @@ void Client::Handle_OP_RecipesFavorite(const EQApplicationPacket *app)
 	// results show that object_type is combiner type
 	// some_id = 0 if world combiner, item number otherwise
 
-	// make where clause segment for container(s)
-	std::string containers;
 	uint32 combineObjectSlots;
 	if (tsf->some_id == 0) {
-		containers += StringFormat(" = %u ", tsf->object_type); // world combiner so no item number
-		combineObjectSlots = 10;
+		combineObjectSlots = 10; // world combiner so no item number
 	}
 	else {
-		containers += StringFormat(" in (%u, %u) ", tsf->object_type, tsf->some_id); // container in inventory
-		auto item = database.GetItem(tsf->some_id);
+		auto item = database.GetItem(tsf->some_id); // container in inventory
 		if (!item)
 		{
 			LogError("Invalid container ID: [{}]. GetItem returned null. Defaulting to BagSlots = 10.\n", tsf->some_id);
@@ -12768,71 +12766,22 @@ void Client::Handle_OP_RecipesFavorite(const EQApplicationPacket *app)
 		}
 	}
 
-	std::string favoriteIDs; //gotta be big enough for 500 IDs
-	bool first = true;
-	//Assumes item IDs are <10 characters long
-	for (uint16 favoriteIndex = 0; favoriteIndex < 500; ++favoriteIndex) {
-		if (tsf->favorite_recipes[favoriteIndex] == 0)
-			continue;
+	TradeskillRecipes::SearchCriteria c;
+	c.object_type = tsf->object_type;
+	c.some_id     = tsf->some_id;
+	c.bag_slots   = combineObjectSlots;
+	c.limit       = 100;
 
-		if (first) {
-			favoriteIDs += StringFormat("%u", tsf->favorite_recipes[favoriteIndex]);
-			first = false;
+	for (uint16 favoriteIndex = 0; favoriteIndex < 500; ++favoriteIndex) {
+		if (tsf->favorite_recipes[favoriteIndex] != 0) {
+			c.recipe_ids.emplace_back(tsf->favorite_recipes[favoriteIndex]);
 		}
-		else
-			favoriteIDs += StringFormat(",%u", tsf->favorite_recipes[favoriteIndex]);
 	}
 
-	if (first)	//no favorites....
+	if (c.recipe_ids.empty())	//no favorites....
 		return;
 
-	// TODO: Clean this up
-	const std::string query = StringFormat(
-		SQL (
-			SELECT
-			tr.id,
-			tr.name,
-			tr.trivial,
-			SUM(tre.componentcount),
-			tr.tradeskill,
-			tr.must_learn
-				FROM
-				tradeskill_recipe AS tr
-				LEFT JOIN tradeskill_recipe_entries AS tre ON tr.id = tre.recipe_id
-				WHERE
-				tr.enabled <> 0
-				AND tr.id IN (%s)
-				AND tr.must_learn & 0x20 <> 0x20
-				AND (
-			(
-				tr.must_learn & 0x3 <> 0
-			)
-				OR (tr.must_learn & 0x3 = 0)
-			)
-				%s
-				GROUP BY
-				tr.id
-				HAVING
-				sum(
-				if(
-				tre.item_id %s
-				AND tre.iscontainer > 0,
-				1,
-				0
-			)
-			) > 0
-				AND SUM(tre.componentcount) <= %u
-
-				LIMIT
-				100
-		),
-		favoriteIDs.c_str(),
-		ContentFilterCriteria::apply().c_str(),
-		containers.c_str(),
-		combineObjectSlots
-	);
-
-	SendTradeskillSearchResults(query, tsf->object_type, tsf->some_id);
+	SendTradeskillSearchResults(tradeskill_recipes.Search(c), tsf->object_type, tsf->some_id);
 }
 
 void Client::Handle_OP_RecipesSearch(const EQApplicationPacket *app)
@@ -12856,16 +12805,13 @@ void Client::Handle_OP_RecipesSearch(const EQApplicationPacket *app)
 		p_recipes_search_struct->some_id
 	);
 
-	char   containers_where_clause[30];
 	uint32 combine_object_slots;
 	if (p_recipes_search_struct->some_id == 0) {
 		// world combiner so no item number
-		snprintf(containers_where_clause, 29, "= %u", p_recipes_search_struct->object_type);
 		combine_object_slots = 10;
 	}
 	else {
 		// container in inventory
-		snprintf(containers_where_clause, 29, "in (%u,%u)", p_recipes_search_struct->object_type, p_recipes_search_struct->some_id);
 		auto item = database.GetItem(p_recipes_search_struct->some_id);
 		if (!item) {
 			LogError(
@@ -12879,64 +12825,21 @@ void Client::Handle_OP_RecipesSearch(const EQApplicationPacket *app)
 		}
 	}
 
-	std::string search_clause;
-	if (p_recipes_search_struct->query[0] != 0) {
-		char buf[120];	//larger than 2X rss->query
-		database.DoEscapeString(buf, p_recipes_search_struct->query, strlen(p_recipes_search_struct->query));
-		search_clause = StringFormat("name rlike '%s' AND", buf);
-	}
-
 	//arbitrary limit of 200 recipes, makes sense to me.
-	// TODO: Clean this up
-	std::string query = fmt::format(
-		SQL(
-			SELECT
-			tr.id,
-			tr.name,
-			tr.trivial,
-			SUM(tre.componentcount),
-			tr.tradeskill,
-			tr.must_learn
-				FROM
-				tradeskill_recipe AS tr
-				LEFT JOIN tradeskill_recipe_entries AS tre ON tr.id = tre.recipe_id
-				WHERE
-				{} tr.trivial >= {}
-				AND tr.trivial <= {}
-				AND tr.enabled <> 0
-				AND tr.must_learn & 0x20 <> 0x20
-				AND (
-					(
-						tr.must_learn & 0x3 <> 0
-					)
-				OR (tr.must_learn & 0x3 = 0)
-			)
-			{}
-				GROUP BY
-				tr.id
-				HAVING
-				sum(
-				if (
-				tre.item_id {}
-				AND tre.iscontainer > 0,
-				1,
-				0
-			)
-			) > 0
-				AND SUM(tre.componentcount) <= {}
-
-				LIMIT
-				200
-		),
-		search_clause,
-		p_recipes_search_struct->mintrivial,
-		p_recipes_search_struct->maxtrivial,
-		ContentFilterCriteria::apply(),
-		containers_where_clause,
-		combine_object_slots
+	TradeskillRecipes::SearchCriteria c;
+	c.object_type = p_recipes_search_struct->object_type;
+	c.some_id     = p_recipes_search_struct->some_id;
+	c.bag_slots   = combine_object_slots;
+	c.name        = p_recipes_search_struct->query;
+	c.min_trivial = p_recipes_search_struct->mintrivial;
+	c.max_trivial = p_recipes_search_struct->maxtrivial;
+	c.limit       = 200;
+
+	SendTradeskillSearchResults(
+		tradeskill_recipes.Search(c),
+		p_recipes_search_struct->object_type,
+		p_recipes_search_struct->some_id
 	);
-
-	SendTradeskillSearchResults(query, p_recipes_search_struct->object_type, p_recipes_search_struct->some_id);
 }
 
 void Client::Handle_OP_ReloadUI(const EQApplicationPacket *app)
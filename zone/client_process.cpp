@@ -63,6 +63,11 @@ extern EntityList entity_list;
 bool Client::Process() {
 	bool ret = true;
 
+	// ended by one of the timer callbacks since the last process
+	if (m_process_remove) {
+		return false;
+	}
+
 	if (Connected() || IsLD()) {
 		// try to send all packets that weren't sent before
 		if (!IsLD() && zoneinpacket_timer.Check()) {
@@ -107,8 +112,6 @@ bool Client::Process() {
 
 		if (dead) {
 			SetHP(-100);
-			if (RespawnFromHoverTimer.Check())
-				HandleRespawnFromHover(0);
 		}
 
 		if (IsTracking() && (ClientVersion() >= EQ::versions::ClientVersion::SoD) && TrackingTimer.Check())
@@ -128,30 +131,6 @@ bool Client::Process() {
 		if (mana_timer.Check())
 			CheckManaEndUpdate();
 
-		if (dead && dead_timer.Check()) {
-			database.MoveCharacterToZone(GetName(), m_pp.binds[0].zone_id);
-
-			m_pp.zone_id = m_pp.binds[0].zone_id;
-			m_pp.zoneInstance = m_pp.binds[0].instance_id;
-			m_pp.x = m_pp.binds[0].x;
-			m_pp.y = m_pp.binds[0].y;
-			m_pp.z = m_pp.binds[0].z;
-			Save();
-
-			Group *mygroup = GetGroup();
-			if (mygroup)
-			{
-				entity_list.MessageGroup(this, true, 15, "%s died.", GetName());
-				mygroup->MemberZoned(this);
-			}
-			Raid *myraid = entity_list.GetRaidByClient(this);
-			if (myraid)
-			{
-				myraid->MemberZoned(this);
-			}
-			return(false);
-		}
-
 		if (charm_update_timer.Check()) {
 			CalcItemScale();
 		}
@@ -159,86 +138,12 @@ bool Client::Process() {
 		if (TaskPeriodic_Timer.Check() && task_state)
 			task_state->TaskPeriodicChecks(this);
 
-		if (dynamiczone_removal_timer.Check() && zone && zone->GetInstanceID() != 0)
-		{
-			dynamiczone_removal_timer.Disable();
-			GoToDzSafeReturnOrBind(zone->GetDynamicZone());
-		}
-
-		if (linkdead_timer.Check()) {
-			LeaveGroup();
-			Save();
-			if (GetMerc()) {
-				GetMerc()->Save();
-				GetMerc()->Depop();
-			}
-
-			Raid *myraid = entity_list.GetRaidByClient(this);
-			if (myraid) {
-				myraid->MemberZoned(this);
-			}
-			if (IsInAGuild()) {
-				guild_mgr.UpdateDbMemberOnline(CharacterID(), false);
-				guild_mgr.SendGuildMemberUpdateToWorld(GetName(), GuildID(), 0, time(nullptr));
-			}
-
-			if (IsTrader()) {
-				TraderRepository::DeleteWhere(database, fmt::format("`char_id` = '{}'", CharacterID()));
-
-				SendBecomeTraderToWorld(this, TraderOff);
-				SendTraderMode(TraderOff);
-
-				WithCustomer(0);
-				SetTrader(false);
-			}
-
-			SetDynamicZoneMemberStatus(DynamicZoneMemberStatus::Offline);
-
-			RecordPlayerEventLog(PlayerEvent::WENT_OFFLINE, PlayerEvent::EmptyEvent{});
-
-			if (parse->PlayerHasQuestSub(EVENT_DISCONNECT)) {
-				parse->EventPlayer(EVENT_DISCONNECT, this, "", 0);
-			}
-
-			return false; //delete client
-		}
-
 		if (RuleB(Bots, Enabled)) {
 			if (bot_camp_timer.Check()) {
 				CampAllBots();
 			}
 		}
 
-		if (camp_timer.Check()) {
-			Raid *myraid = entity_list.GetRaidByClient(this);
-			if (myraid) {
-				myraid->MemberZoned(this);
-			}
-			LeaveGroup();
-			Save();
-			if (IsInAGuild()) {
-				guild_mgr.UpdateDbMemberOnline(CharacterID(), false);
-				guild_mgr.SendGuildMemberUpdateToWorld(GetName(), GuildID(), 0, time(nullptr));
-			}
-
-			if (IsTrader()) {
-				TraderRepository::DeleteWhere(database, fmt::format("`char_id` = '{}'", CharacterID()));
-
-				SendBecomeTraderToWorld(this, TraderOff);
-				SendTraderMode(TraderOff);
-
-				WithCustomer(0);
-				SetTrader(false);
-			}
-
-			if (GetMerc())
-			{
-				GetMerc()->Save();
-				GetMerc()->Depop();
-			}
-			instalog = true;
-		}
-
 		if (IsStunned() && stunned_timer.Check())
 			Mob::UnStun();
 
@@ -569,14 +474,6 @@ bool Client::Process() {
 		}
 
 		SpellProcess();
-		if (endupkeep_timer.Check() && !dead) {
-			DoEnduranceUpkeep();
-		}
-
-		// this is independent of the tick timer
-		if (consume_food_timer.Check())
-			DoStaminaHungerUpdate();
-
 		if (!focused_pet_id || !entity_list.GetNPCByID(focused_pet_id)) {
 			if (GetPet()) {
 				ValidatePetList();
@@ -633,10 +530,6 @@ bool Client::Process() {
 				ToggleTribute(true);	//re-activate the tribute.
 			}
 
-			if (fishing_timer.Check()) {
-				GoFish();
-			}
-
 			if (autosave_timer.Check()) {
 				Save(0);
 			}
@@ -722,6 +615,7 @@ bool Client::Process() {
 
 			if (IsTrader()) {
 				TraderRepository::DeleteWhere(database, fmt::format("`char_id` = '{}'", CharacterID()));
+				worldserver.SendBazaarListingsChanged(CharacterID());
 
 				SendBecomeTraderToWorld(this, TraderOff);
 				SendTraderMode(TraderOff);
@@ -2350,6 +2244,172 @@ void Client::DoTracking()
 	}
 }
 
+// These timers run from the timer wheel rather than being checked on every Process(). The callbacks run at the start of
+// the frame, one that ends the client sets m_process_remove and its next Process() removes it.
+void Client::SetTimerCallbacks()
+{
+	camp_timer.SetCallback(
+		[this](WheelTimer *t) {
+			t->Check();
+			if (!Connected() && !IsLD()) {
+				return;
+			}
+
+			Raid *myraid = entity_list.GetRaidByClient(this);
+			if (myraid) {
+				myraid->MemberZoned(this);
+			}
+			LeaveGroup();
+			Save();
+			if (IsInAGuild()) {
+				guild_mgr.UpdateDbMemberOnline(CharacterID(), false);
+				guild_mgr.SendGuildMemberUpdateToWorld(GetName(), GuildID(), 0, time(nullptr));
+			}
+
+			if (IsTrader()) {
+				TraderRepository::DeleteWhere(database, fmt::format("`char_id` = '{}'", CharacterID()));
+				worldserver.SendBazaarListingsChanged(CharacterID());
+
+				SendBecomeTraderToWorld(this, TraderOff);
+				SendTraderMode(TraderOff);
+
+				WithCustomer(0);
+				SetTrader(false);
+			}
+
+			if (GetMerc())
+			{
+				GetMerc()->Save();
+				GetMerc()->Depop();
+			}
+			instalog = true;
+		}
+	);
+
+	linkdead_timer.SetCallback(
+		[this](WheelTimer *t) {
+			t->Disable();
+			if (!Connected() && !IsLD()) {
+				return;
+			}
+
+			LeaveGroup();
+			Save();
+			if (GetMerc()) {
+				GetMerc()->Save();
+				GetMerc()->Depop();
+			}
+
+			Raid *myraid = entity_list.GetRaidByClient(this);
+			if (myraid) {
+				myraid->MemberZoned(this);
+			}
+			if (IsInAGuild()) {
+				guild_mgr.UpdateDbMemberOnline(CharacterID(), false);
+				guild_mgr.SendGuildMemberUpdateToWorld(GetName(), GuildID(), 0, time(nullptr));
+			}
+
+			if (IsTrader()) {
+				TraderRepository::DeleteWhere(database, fmt::format("`char_id` = '{}'", CharacterID()));
+				worldserver.SendBazaarListingsChanged(CharacterID());
+
+				SendBecomeTraderToWorld(this, TraderOff);
+				SendTraderMode(TraderOff);
+
+				WithCustomer(0);
+				SetTrader(false);
+			}
+
+			SetDynamicZoneMemberStatus(DynamicZoneMemberStatus::Offline);
+
+			RecordPlayerEventLog(PlayerEvent::WENT_OFFLINE, PlayerEvent::EmptyEvent{});
+
+			if (parse->PlayerHasQuestSub(EVENT_DISCONNECT)) {
+				parse->EventPlayer(EVENT_DISCONNECT, this, "", 0);
+			}
+
+			m_process_remove = true;
+		}
+	);
+
+	dead_timer.SetCallback(
+		[this](WheelTimer *t) {
+			t->Disable();
+			if (!dead || (!Connected() && !IsLD())) {
+				return;
+			}
+
+			database.MoveCharacterToZone(GetName(), m_pp.binds[0].zone_id);
+
+			m_pp.zone_id = m_pp.binds[0].zone_id;
+			m_pp.zoneInstance = m_pp.binds[0].instance_id;
+			m_pp.x = m_pp.binds[0].x;
+			m_pp.y = m_pp.binds[0].y;
+			m_pp.z = m_pp.binds[0].z;
+			Save();
+
+			Group *mygroup = GetGroup();
+			if (mygroup)
+			{
+				entity_list.MessageGroup(this, true, 15, "%s died.", GetName());
+				mygroup->MemberZoned(this);
+			}
+			Raid *myraid = entity_list.GetRaidByClient(this);
+			if (myraid)
+			{
+				myraid->MemberZoned(this);
+			}
+			m_process_remove = true;
+		}
+	);
+
+	RespawnFromHoverTimer.SetCallback(
+		[this](WheelTimer *t) {
+			t->Disable();
+			if (dead && (Connected() || IsLD())) {
+				HandleRespawnFromHover(0);
+			}
+		}
+	);
+
+	fishing_timer.SetCallback(
+		[this](WheelTimer *t) {
+			t->Disable();
+			if (!dead && (Connected() || IsLD())) {
+				GoFish();
+			}
+		}
+	);
+
+	dynamiczone_removal_timer.SetCallback(
+		[this](WheelTimer *t) {
+			t->Disable();
+			if ((Connected() || IsLD()) && zone && zone->GetInstanceID() != 0) {
+				GoToDzSafeReturnOrBind(zone->GetDynamicZone());
+			}
+		}
+	);
+
+	endupkeep_timer.SetCallback(
+		[this](WheelTimer *t) {
+			t->Check();
+			if (!dead && (Connected() || IsLD())) {
+				DoEnduranceUpkeep();
+			}
+		}
+	);
+
+	// this is independent of the tick timer
+	consume_food_timer.SetCallback(
+		[this](WheelTimer *t) {
+			t->Check();
+			if (Connected() || IsLD()) {
+				DoStaminaHungerUpdate();
+			}
+		}
+	);
+}
+
 void Client::HandleRespawnFromHover(uint32 Option)
 {
 	RespawnFromHoverTimer.Disable();
@@ -149,6 +149,7 @@ void command_petcmd(Client *c, const Seperator *sep);
 void command_petitems(Client *c, const Seperator *sep);
 void command_picklock(Client *c, const Seperator *sep);
 void command_profanity(Client *c, const Seperator *sep);
+void command_profiler(Client *c, const Seperator *sep);
 void command_push(Client *c, const Seperator *sep);
 void command_raidloot(Client* c, const Seperator* sep);
 void command_randomfeatures(Client *c, const Seperator *sep);
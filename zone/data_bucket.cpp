@@ -1,4 +1,5 @@
 #include "data_bucket.h"
+#include "data_bucket_cache.h"
 #include "zonedb.h"
 #include "mob.h"
 #include "worldserver.h"
@@ -11,7 +12,7 @@ using json = nlohmann::json;
 extern WorldServer worldserver;
 const std::string  NESTED_KEY_DELIMITER = ".";
 
-std::vector<DataBucketsRepository::DataBuckets> g_data_bucket_cache = {};
+DataBucketCache g_data_bucket_cache;
 
 void DataBucket::SetData(const std::string &bucket_key, const std::string &bucket_value, std::string expires_time)
 {
@@ -134,13 +135,8 @@ void DataBucket::SetData(const DataBucketKey &k_)
 
 	if (bucket_id) {
 		// update the cache if it exists
-		if (CanCache(k)) {
-			for (auto &e: g_data_bucket_cache) {
-				if (CheckBucketMatch(e, k)) {
-					e = b;
-					break;
-				}
-			}
+		if (CanCache(k) && g_data_bucket_cache.Erase(k)) {
+			g_data_bucket_cache.Set(b);
 		}
 
 		DataBucketsRepository::UpdateOne(database, b);
@@ -151,7 +147,7 @@ void DataBucket::SetData(const DataBucketKey &k_)
 		// add to cache if it doesn't exist
 		if (CanCache(k) && !ExistsInCache(b)) {
 			DeleteFromMissesCache(b);
-			g_data_bucket_cache.emplace_back(b);
+			g_data_bucket_cache.Set(b);
 		}
 	}
 }
@@ -234,22 +230,24 @@ DataBucketsRepository::DataBuckets DataBucket::GetData(const DataBucketKey &k_,
 
 	// Attempt to retrieve the value from the cache
 	if (can_cache) {
-		for (const auto &e : g_data_bucket_cache) {
-			if (CheckBucketMatch(e, k)) {
-				if (e.expires > 0 && e.expires < std::time(nullptr)) {
-					LogDataBuckets("Attempted to read expired key [{}] removing from cache", e.key_);
-					DeleteData(k);
-					return DataBucketsRepository::NewEntity();
-				}
-
-				LogDataBuckets("Returning key [{}] value [{}] from cache", e.key_, e.value);
+		// only looks at the top of the expiry heap unless something actually expired
+		g_data_bucket_cache.ReapExpired(std::time(nullptr));
+
+		const auto *e = g_data_bucket_cache.Find(k);
+		if (e) {
+			if (e->expires > 0 && e->expires < std::time(nullptr)) {
+				LogDataBuckets("Attempted to read expired key [{}] removing from cache", e->key_);
+				DeleteData(k);
+				return DataBucketsRepository::NewEntity();
+			}
 
-				if (is_nested_key && !k_.key.empty()) {
-					return ExtractNestedValue(e, k_.key);
-				}
+			LogDataBuckets("Returning key [{}] value [{}] from cache", e->key_, e->value);
 
-				return e;
+			if (is_nested_key && !k_.key.empty()) {
+				return ExtractNestedValue(*e, k_.key);
 			}
+
+			return *e;
 		}
 	}
 
@@ -266,9 +264,9 @@ DataBucketsRepository::DataBuckets DataBucket::GetData(const DataBucketKey &k_,
 	if (r.empty()) {
 		// Handle cache misses
 		if (!ignore_misses_cache && can_cache) {
-			size_t size_before = g_data_bucket_cache.size();
+			size_t size_before = g_data_bucket_cache.Size();
 
-			g_data_bucket_cache.emplace_back(
+			g_data_bucket_cache.Set(
 				DataBucketsRepository::DataBuckets{
 					.id = 0,
 					.key_ = k.key,
@@ -293,7 +291,7 @@ DataBucketsRepository::DataBuckets DataBucket::GetData(const DataBucketKey &k_,
 				k.zone_id,
 				k.instance_id,
 				size_before,
-				g_data_bucket_cache.size()
+				g_data_bucket_cache.Size()
 			);
 		}
 
@@ -309,18 +307,8 @@ DataBucketsRepository::DataBuckets DataBucket::GetData(const DataBucketKey &k_,
 	}
 
 	// Add the value to the cache if it doesn't exist
-	if (can_cache) {
-		bool has_cache = false;
-		for (const auto &e : g_data_bucket_cache) {
-			if (e.id == bucket.id) {
-				has_cache = true;
-				break;
-			}
-		}
-
-		if (!has_cache) {
-			g_data_bucket_cache.emplace_back(bucket);
-		}
+	if (can_cache && !ExistsInCache(bucket)) {
+		g_data_bucket_cache.Set(bucket);
 	}
 
 	// Handle nested key extraction
@@ -373,17 +361,7 @@ bool DataBucket::DeleteData(const DataBucketKey &k)
 	if (!is_nested_key) {
 		// Update cache
 		if (CanCache(k)) {
-			// delete from cache where contents match
-			g_data_bucket_cache.erase(
-				std::remove_if(
-					g_data_bucket_cache.begin(),
-					g_data_bucket_cache.end(),
-					[&](DataBucketsRepository::DataBuckets &e) {
-						return CheckBucketMatch(e, k);
-					}
-				),
-				g_data_bucket_cache.end()
-			);
+			g_data_bucket_cache.Erase(k);
 		}
 
 		// Regular key deletion, no nesting involved
@@ -445,16 +423,7 @@ bool DataBucket::DeleteData(const DataBucketKey &k)
 
 		// delete cache
 		if (CanCache(k)) {
-			g_data_bucket_cache.erase(
-				std::remove_if(
-					g_data_bucket_cache.begin(),
-					g_data_bucket_cache.end(),
-					[&](DataBucketsRepository::DataBuckets &e) {
-						return CheckBucketMatch(e, top_level_k);
-					}
-				),
-				g_data_bucket_cache.end()
-			);
+			g_data_bucket_cache.Erase(top_level_k);
 		}
 
 		return DataBucketsRepository::DeleteWhere(
@@ -469,11 +438,9 @@ bool DataBucket::DeleteData(const DataBucketKey &k)
 
 	// Update cache
 	if (CanCache(k)) {
-		for (auto &e : g_data_bucket_cache) {
-			if (CheckBucketMatch(e, top_level_k)) {
-				e.value = r.value;
-				break;
-			}
+		auto e = g_data_bucket_cache.Find(top_level_k);
+		if (e) {
+			e->value = r.value;
 		}
 	}
 
@@ -595,7 +562,7 @@ void DataBucket::LoadZoneCache(uint16 zone_id, uint16 instance_id)
 		return;
 	}
 
-	LogDataBucketsDetail("cache size before [{}] l size [{}]", g_data_bucket_cache.size(), l.size());
+	LogDataBucketsDetail("cache size before [{}] l size [{}]", g_data_bucket_cache.Size(), l.size());
 
 	uint32 added_count = 0;
 
@@ -609,16 +576,16 @@ void DataBucket::LoadZoneCache(uint16 zone_id, uint16 instance_id)
 		if (!ExistsInCache(e)) {
 			LogDataBucketsDetail("bucket id [{}] bucket key [{}] bucket value [{}]", e.id, e.key_, e.value);
 
-			g_data_bucket_cache.emplace_back(e);
+			g_data_bucket_cache.Set(e);
 		}
 	}
 
-	LogDataBucketsDetail("cache size after [{}]", g_data_bucket_cache.size());
+	LogDataBucketsDetail("cache size after [{}]", g_data_bucket_cache.Size());
 
 	LogDataBuckets(
 		"Loaded [{}] zone keys new cache size is [{}]",
 		l.size(),
-		g_data_bucket_cache.size()
+		g_data_bucket_cache.Size()
 	);
 }
 
@@ -629,21 +596,7 @@ void DataBucket::BulkLoadEntitiesToCache(DataBucketLoadType::Type t, std::vector
 	}
 
 	if (ids.size() == 1) {
-		bool has_cache = false;
-
-		for (const auto &e: g_data_bucket_cache) {
-			if (t == DataBucketLoadType::Bot) {
-				has_cache = e.bot_id == ids[0];
-			}
-			else if (t == DataBucketLoadType::Account) {
-				has_cache = e.account_id == ids[0];
-			}
-			else if (t == DataBucketLoadType::Client) {
-				has_cache = e.character_id == ids[0];
-			}
-		}
-
-		if (has_cache) {
+		if (g_data_bucket_cache.HasOwner(t, ids[0])) {
 			LogDataBucketsDetail("LoadType [{}] ID [{}] has cache", DataBucketLoadType::Name[t], ids[0]);
 			return;
 		}
@@ -680,7 +633,7 @@ void DataBucket::BulkLoadEntitiesToCache(DataBucketLoadType::Type t, std::vector
 		return;
 	}
 
-	LogDataBucketsDetail("cache size before [{}] l size [{}]", g_data_bucket_cache.size(), l.size());
+	LogDataBucketsDetail("cache size before [{}] l size [{}]", g_data_bucket_cache.Size(), l.size());
 
 	uint32 added_count = 0;
 
@@ -694,155 +647,99 @@ void DataBucket::BulkLoadEntitiesToCache(DataBucketLoadType::Type t, std::vector
 		if (!ExistsInCache(e)) {
 			LogDataBucketsDetail("bucket id [{}] bucket key [{}] bucket value [{}]", e.id, e.key_, e.value);
 
-			g_data_bucket_cache.emplace_back(e);
+			g_data_bucket_cache.Set(e);
 		}
 	}
 
-	LogDataBucketsDetail("cache size after [{}]", g_data_bucket_cache.size());
+	LogDataBucketsDetail("cache size after [{}]", g_data_bucket_cache.Size());
 
 	LogDataBuckets(
 		"Bulk Loaded ids [{}] column [{}] new cache size is [{}]",
 		ids.size(),
 		column,
-		g_data_bucket_cache.size()
+		g_data_bucket_cache.Size()
 	);
 }
 
 void DataBucket::DeleteCachedBuckets(DataBucketLoadType::Type type, uint32 id, uint32 secondary_id)
 {
-	size_t size_before = g_data_bucket_cache.size();
-
-	g_data_bucket_cache.erase(
-		std::remove_if(
-			g_data_bucket_cache.begin(),
-			g_data_bucket_cache.end(),
-			[&](DataBucketsRepository::DataBuckets &e) {
-				return (
-					(type == DataBucketLoadType::Bot && e.bot_id == id) ||
-					(type == DataBucketLoadType::Account && e.account_id == id) ||
-					(type == DataBucketLoadType::Client && e.character_id == id) ||
-					(type == DataBucketLoadType::Zone && e.zone_id == id && e.instance_id == secondary_id)
-				);
-			}
-		),
-		g_data_bucket_cache.end()
-	);
+	size_t size_before = g_data_bucket_cache.Size();
+
+	g_data_bucket_cache.EraseOwner(type, id, secondary_id);
 
 	LogDataBuckets(
 		"LoadType [{}] id [{}] cache size before [{}] after [{}]",
 		DataBucketLoadType::Name[type],
 		id,
 		size_before,
-		g_data_bucket_cache.size()
+		g_data_bucket_cache.Size()
 	);
 }
 
 bool DataBucket::ExistsInCache(const DataBucketsRepository::DataBuckets &entry)
 {
-	for (const auto &e: g_data_bucket_cache) {
-		if (e.id == entry.id) {
-			return true;
-		}
-	}
-
-	return false;
+	return g_data_bucket_cache.ExistsById(entry.id);
 }
 
 void DataBucket::DeleteFromMissesCache(DataBucketsRepository::DataBuckets e)
 {
 	// delete from cache where there might have been a written bucket miss to the cache
 	// this is to prevent the cache from growing too large
-	size_t size_before = g_data_bucket_cache.size();
-
-	g_data_bucket_cache.erase(
-		std::remove_if(
-			g_data_bucket_cache.begin(),
-			g_data_bucket_cache.end(),
-			[&](DataBucketsRepository::DataBuckets &ce) {
-				return ce.id == 0 && ce.key_ == e.key_ &&
-					   ce.account_id == e.account_id &&
-					   ce.character_id == e.character_id &&
-					   ce.npc_id == e.npc_id &&
-					   ce.bot_id == e.bot_id &&
-					   ce.zone_id == e.zone_id &&
-					   ce.instance_id == e.instance_id;
-			}
-		),
-		g_data_bucket_cache.end()
-	);
+	size_t size_before = g_data_bucket_cache.Size();
+
+	g_data_bucket_cache.EraseMiss(e);
+
 	LogDataBucketsDetail(
 		"Deleted bucket misses from cache where key [{}] size before [{}] after [{}]",
 		e.key_,
 		size_before,
-		g_data_bucket_cache.size()
+		g_data_bucket_cache.Size()
 	);
 }
 
 void DataBucket::ClearCache()
 {
-	g_data_bucket_cache.clear();
+	g_data_bucket_cache.Clear();
 	LogInfo("Cleared data buckets cache");
 }
 
 void DataBucket::DeleteFromCache(uint64 id, DataBucketLoadType::Type type)
 {
-	size_t size_before = g_data_bucket_cache.size();
-
-	g_data_bucket_cache.erase(
-		std::remove_if(
-			g_data_bucket_cache.begin(),
-			g_data_bucket_cache.end(),
-			[&](DataBucketsRepository::DataBuckets &e) {
-				switch (type) {
-					case DataBucketLoadType::Bot:
-						return e.bot_id == id;
-					case DataBucketLoadType::Client:
-						return e.character_id == id;
-					case DataBucketLoadType::Account:
-						return e.account_id == id;
-					default:
-						return false;
-				}
-			}
-		),
-		g_data_bucket_cache.end()
-	);
+	size_t size_before = g_data_bucket_cache.Size();
+
+	switch (type) {
+		case DataBucketLoadType::Bot:
+		case DataBucketLoadType::Client:
+		case DataBucketLoadType::Account:
+			g_data_bucket_cache.EraseOwner(type, id);
+			break;
+		default:
+			break;
+	}
 
 	LogDataBuckets(
 		"Deleted [{}] id [{}] from cache size before [{}] after [{}]",
 		DataBucketLoadType::Name[type],
 		id,
 		size_before,
-		g_data_bucket_cache.size()
+		g_data_bucket_cache.Size()
 	);
 }
 
 void DataBucket::DeleteZoneFromCache(uint16 zone_id, uint16 instance_id, DataBucketLoadType::Type type)
 {
-	size_t size_before = g_data_bucket_cache.size();
-
-	g_data_bucket_cache.erase(
-		std::remove_if(
-			g_data_bucket_cache.begin(),
-			g_data_bucket_cache.end(),
-			[&](DataBucketsRepository::DataBuckets &e) {
-				switch (type) {
-					case DataBucketLoadType::Zone:
-						return e.zone_id == zone_id && e.instance_id == instance_id;
-					default:
-						return false;
-				}
-			}
-		),
-		g_data_bucket_cache.end()
-	);
+	size_t size_before = g_data_bucket_cache.Size();
+
+	if (type == DataBucketLoadType::Zone) {
+		g_data_bucket_cache.EraseOwner(type, zone_id, instance_id);
+	}
 
 	LogDataBuckets(
 		"Deleted zone [{}] instance [{}] from cache size before [{}] after [{}]",
 		zone_id,
 		instance_id,
 		size_before,
-		g_data_bucket_cache.size()
+		g_data_bucket_cache.Size()
 	);
 }
 
@@ -0,0 +1,312 @@
+#include "data_bucket_cache.h"
+
+DataBucketCache::ScopedKeyView::ScopedKeyView(const ScopedKey &k)
+	: key(k.key), account_id(k.account_id), character_id(k.character_id), npc_id(k.npc_id), bot_id(k.bot_id),
+	  zone_id(k.zone_id), instance_id(k.instance_id)
+{
+}
+
+DataBucketCache::ScopedKeyView::ScopedKeyView(const DataBucketKey &k)
+	: key(k.key), account_id(k.account_id), character_id(k.character_id), npc_id(k.npc_id), bot_id(k.bot_id),
+	  zone_id(k.zone_id), instance_id(k.instance_id)
+{
+}
+
+DataBucketCache::ScopedKeyView::ScopedKeyView(const Bucket &b)
+	: key(b.key_), account_id(b.account_id), character_id(b.character_id), npc_id(b.npc_id), bot_id(b.bot_id),
+	  zone_id(b.zone_id), instance_id(b.instance_id)
+{
+}
+
+size_t DataBucketCache::ScopedKeyHash::operator()(const ScopedKeyView &k) const
+{
+	size_t h = std::hash<std::string_view>{}(k.key);
+
+	auto combine = [&h](uint64 v) {
+		h ^= std::hash<uint64>{}(v) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+	};
+
+	combine(k.account_id);
+	combine(k.character_id);
+	combine((static_cast<uint64>(k.npc_id) << 32) | k.bot_id);
+	combine((static_cast<uint64>(k.zone_id) << 16) | k.instance_id);
+
+	return h;
+}
+
+bool DataBucketCache::ScopedKeyEqual::operator()(const ScopedKeyView &a, const ScopedKeyView &b) const
+{
+	return (
+		a.key == b.key &&
+		a.bot_id == b.bot_id &&
+		a.account_id == b.account_id &&
+		a.character_id == b.character_id &&
+		a.npc_id == b.npc_id &&
+		a.zone_id == b.zone_id &&
+		a.instance_id == b.instance_id
+	);
+}
+
+DataBucketCache::Bucket *DataBucketCache::Find(const DataBucketKey &k)
+{
+	auto it = m_buckets.find(ScopedKeyView(k));
+	return it != m_buckets.end() ? &it->second : nullptr;
+}
+
+bool DataBucketCache::ExistsById(uint64 id) const
+{
+	return m_by_id.find(id) != m_by_id.end();
+}
+
+bool DataBucketCache::HasOwner(DataBucketLoadType::Type type, uint64 id, uint32 secondary_id) const
+{
+	auto index = GetOwnerIndex(type);
+	if (!index) {
+		return false;
+	}
+
+	const uint64 owner = type == DataBucketLoadType::Zone ? GetZoneOwnerKey(id, secondary_id) : id;
+
+	return index->find(owner) != index->end();
+}
+
+void DataBucketCache::Set(Bucket b)
+{
+	auto it = m_buckets.find(ScopedKeyView(b));
+	if (it != m_buckets.end()) {
+		EraseIterator(it);
+	}
+
+	ScopedKey k{
+		.key = b.key_,
+		.account_id = b.account_id,
+		.character_id = b.character_id,
+		.npc_id = b.npc_id,
+		.bot_id = b.bot_id,
+		.zone_id = b.zone_id,
+		.instance_id = b.instance_id
+	};
+
+	auto r = m_buckets.emplace(std::move(k), std::move(b));
+
+	// node based container, key addresses stay valid until the row itself is erased
+	const ScopedKey *key = &r.first->first;
+	const Bucket    &e   = r.first->second;
+
+	if (e.id > 0) {
+		m_by_id[e.id] = key;
+	}
+
+	IndexOwners(key, e);
+
+	if (IsExpiring(e)) {
+		m_expiring_count++;
+		m_expiry_heap.push(Expiry{.expires = e.expires, .id = e.id});
+		CompactExpiryHeap();
+	}
+}
+
+bool DataBucketCache::Erase(const DataBucketKey &k)
+{
+	auto it = m_buckets.find(ScopedKeyView(k));
+	if (it == m_buckets.end()) {
+		return false;
+	}
+
+	EraseIterator(it);
+
+	return true;
+}
+
+bool DataBucketCache::EraseMiss(const Bucket &b)
+{
+	auto it = m_buckets.find(ScopedKeyView(b));
+	if (it == m_buckets.end() || it->second.id != 0) {
+		return false;
+	}
+
+	EraseIterator(it);
+
+	return true;
+}
+
+size_t DataBucketCache::EraseOwner(DataBucketLoadType::Type type, uint64 id, uint32 secondary_id)
+{
+	auto index = GetOwnerIndex(type);
+	if (!index) {
+		return 0;
+	}
+
+	const uint64 owner = type == DataBucketLoadType::Zone ? GetZoneOwnerKey(id, secondary_id) : id;
+
+	auto o = index->find(owner);
+	if (o == index->end()) {
+		return 0;
+	}
+
+	// copy out, erasing rows unindexes them from the set we would be walking
+	std::vector<const ScopedKey *> keys(o->second.begin(), o->second.end());
+
+	for (auto k: keys) {
+		auto it = m_buckets.find(ScopedKeyView(*k));
+		if (it != m_buckets.end()) {
+			EraseIterator(it);
+		}
+	}
+
+	return keys.size();
+}
+
+size_t DataBucketCache::ReapExpired(int64 now)
+{
+	size_t reaped = 0;
+
+	while (!m_expiry_heap.empty() && static_cast<int64>(m_expiry_heap.top().expires) < now) {
+		const Expiry e = m_expiry_heap.top();
+		m_expiry_heap.pop();
+
+		auto i = m_by_id.find(e.id);
+		if (i == m_by_id.end()) {
+			continue;
+		}
+
+		auto it = m_buckets.find(ScopedKeyView(*i->second));
+
+		// the row was re-set with a different expiration since this entry was pushed
+		if (it == m_buckets.end() || it->second.expires != e.expires) {
+			continue;
+		}
+
+		EraseIterator(it);
+		reaped++;
+	}
+
+	return reaped;
+}
+
+void DataBucketCache::Clear()
+{
+	m_buckets.clear();
+	m_by_id.clear();
+	m_by_account.clear();
+	m_by_character.clear();
+	m_by_bot.clear();
+	m_by_zone.clear();
+	m_expiry_heap = {};
+	m_expiring_count = 0;
+}
+
+uint64 DataBucketCache::GetZoneOwnerKey(uint16 zone_id, uint16 instance_id)
+{
+	return (static_cast<uint64>(zone_id) << 16) | instance_id;
+}
+
+DataBucketCache::OwnerMap *DataBucketCache::GetOwnerIndex(DataBucketLoadType::Type type)
+{
+	return const_cast<OwnerMap *>(static_cast<const DataBucketCache *>(this)->GetOwnerIndex(type));
+}
+
+const DataBucketCache::OwnerMap *DataBucketCache::GetOwnerIndex(DataBucketLoadType::Type type) const
+{
+	switch (type) {
+		case DataBucketLoadType::Bot:
+			return &m_by_bot;
+		case DataBucketLoadType::Account:
+			return &m_by_account;
+		case DataBucketLoadType::Client:
+			return &m_by_character;
+		case DataBucketLoadType::Zone:
+			return &m_by_zone;
+		default:
+			return nullptr;
+	}
+}
+
+void DataBucketCache::IndexOwners(const ScopedKey *key, const Bucket &b)
+{
+	if (b.account_id > 0) {
+		m_by_account[b.account_id].insert(key);
+	}
+
+	if (b.character_id > 0) {
+		m_by_character[b.character_id].insert(key);
+	}
+
+	if (b.bot_id > 0) {
+		m_by_bot[b.bot_id].insert(key);
+	}
+
+	if (b.zone_id > 0) {
+		m_by_zone[GetZoneOwnerKey(b.zone_id, b.instance_id)].insert(key);
+	}
+}
+
+void DataBucketCache::UnindexOwners(const ScopedKey *key, const Bucket &b)
+{
+	auto unindex = [key](OwnerMap &index, uint64 owner) {
+		auto it = index.find(owner);
+		if (it == index.end()) {
+			return;
+		}
+
+		it->second.erase(key);
+		if (it->second.empty()) {
+			index.erase(it);
+		}
+	};
+
+	if (b.account_id > 0) {
+		unindex(m_by_account, b.account_id);
+	}
+
+	if (b.character_id > 0) {
+		unindex(m_by_character, b.character_id);
+	}
+
+	if (b.bot_id > 0) {
+		unindex(m_by_bot, b.bot_id);
+	}
+
+	if (b.zone_id > 0) {
+		unindex(m_by_zone, GetZoneOwnerKey(b.zone_id, b.instance_id));
+	}
+}
+
+void DataBucketCache::EraseIterator(BucketMap::iterator it)
+{
+	const ScopedKey *key = &it->first;
+	const Bucket    &b   = it->second;
+
+	if (b.id > 0) {
+		auto i = m_by_id.find(b.id);
+		if (i != m_by_id.end() && i->second == key) {
+			m_by_id.erase(i);
+		}
+	}
+
+	UnindexOwners(key, b);
+
+	if (IsExpiring(b) && m_expiring_count > 0) {
+		m_expiring_count--;
+	}
+
+	m_buckets.erase(it);
+}
+
+void DataBucketCache::CompactExpiryHeap()
+{
+	// rows re-set over and over leave stale heap entries behind, rebuild once they clearly outnumber live ones
+	if (m_expiry_heap.size() <= (m_expiring_count * 2) + 1024) {
+		return;
+	}
+
+	std::vector<Expiry> live;
+	live.reserve(m_expiring_count);
+	for (const auto &e: m_buckets) {
+		if (IsExpiring(e.second)) {
+			live.emplace_back(Expiry{.expires = e.second.expires, .id = e.second.id});
+		}
+	}
+
+	m_expiry_heap = std::priority_queue<Expiry, std::vector<Expiry>, std::greater<>>(std::greater<>(), std::move(live));
+}
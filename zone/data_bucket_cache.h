@@ -0,0 +1,106 @@
+#ifndef EQEMU_DATABUCKET_CACHE_H
+#define EQEMU_DATABUCKET_CACHE_H
+
+#include <functional>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "data_bucket.h"
+
+// Zone local cache of data bucket rows (and misses, rows with an id of 0)
+//
+// Rows are indexed by their full scoped key (key + account/character/npc/bot/zone/instance) for O(1) reads, by id so
+// bulk loads can skip rows already present, and by owner so a character, account, bot or zone can be dropped without
+// walking the whole cache. Rows with an expiration are also pushed onto a min-heap; ReapExpired() only ever looks at
+// the top of the heap so expired rows are removed without scanning. Heap entries are invalidated lazily, a row that
+// was deleted or re-set with a new expiration simply no longer matches its stale heap entry.
+class DataBucketCache {
+public:
+	using Bucket = DataBucketsRepository::DataBuckets;
+
+	Bucket *Find(const DataBucketKey &k);
+	bool ExistsById(uint64 id) const;
+	bool HasOwner(DataBucketLoadType::Type type, uint64 id, uint32 secondary_id = 0) const;
+
+	// inserts the row, replacing any row with the same scoped key
+	void Set(Bucket b);
+	bool Erase(const DataBucketKey &k);
+	bool EraseMiss(const Bucket &b);
+	size_t EraseOwner(DataBucketLoadType::Type type, uint64 id, uint32 secondary_id = 0);
+	size_t ReapExpired(int64 now);
+	void Clear();
+
+	inline size_t Size() const { return m_buckets.size(); }
+	inline size_t GetExpiryHeapSize() const { return m_expiry_heap.size(); }
+
+private:
+	struct ScopedKey {
+		std::string key;
+		uint64      account_id;
+		uint64      character_id;
+		uint32      npc_id;
+		uint32      bot_id;
+		uint16      zone_id;
+		uint16      instance_id;
+	};
+
+	// same fields as ScopedKey without owning the key string, lets lookups skip the copy
+	struct ScopedKeyView {
+		std::string_view key;
+		uint64           account_id;
+		uint64           character_id;
+		uint32           npc_id;
+		uint32           bot_id;
+		uint16           zone_id;
+		uint16           instance_id;
+
+		ScopedKeyView(const ScopedKey &k);
+		ScopedKeyView(const DataBucketKey &k);
+		ScopedKeyView(const Bucket &b);
+	};
+
+	struct ScopedKeyHash {
+		using is_transparent = void;
+		size_t operator()(const ScopedKeyView &k) const;
+	};
+
+	struct ScopedKeyEqual {
+		using is_transparent = void;
+		bool operator()(const ScopedKeyView &a, const ScopedKeyView &b) const;
+	};
+
+	struct Expiry {
+		uint32 expires;
+		uint64 id;
+
+		bool operator>(const Expiry &o) const { return expires > o.expires; }
+	};
+
+	using BucketMap = std::unordered_map<ScopedKey, Bucket, ScopedKeyHash, ScopedKeyEqual>;
+	using OwnerMap  = std::unordered_map<uint64, std::unordered_set<const ScopedKey *>>;
+
+	static uint64 GetZoneOwnerKey(uint16 zone_id, uint16 instance_id);
+	// misses (id 0) never expire, they are dropped when the row gets written
+	static inline bool IsExpiring(const Bucket &b) { return b.id > 0 && b.expires > 0; }
+
+	OwnerMap *GetOwnerIndex(DataBucketLoadType::Type type);
+	const OwnerMap *GetOwnerIndex(DataBucketLoadType::Type type) const;
+	void IndexOwners(const ScopedKey *key, const Bucket &b);
+	void UnindexOwners(const ScopedKey *key, const Bucket &b);
+	void EraseIterator(BucketMap::iterator it);
+	void CompactExpiryHeap();
+
+	BucketMap                                                           m_buckets;
+	std::unordered_map<uint64, const ScopedKey *>                       m_by_id;
+	OwnerMap                                                            m_by_account;
+	OwnerMap                                                            m_by_character;
+	OwnerMap                                                            m_by_bot;
+	OwnerMap                                                            m_by_zone;
+	std::priority_queue<Expiry, std::vector<Expiry>, std::greater<>>    m_expiry_heap;
+	size_t                                                              m_expiring_count = 0;
+};
+
+#endif //EQEMU_DATABUCKET_CACHE_H
@@ -30,6 +30,7 @@
 
 #include "../common/features.h"
 #include "../common/guilds.h"
+#include "../common/tick_profiler.h"
 
 #include "entity.h"
 #include "dynamic_zone.h"
@@ -331,11 +332,14 @@ void EntityList::AddClient(Client *client)
 	client->SetID(GetFreeID());
 	client_list.emplace(std::pair<uint16, Client *>(client->GetID(), client));
 	mob_list.emplace(std::pair<uint16, Mob *>(client->GetID(), client));
+	m_spatial_grid.Add(client);
 }
 
 
 void EntityList::TrapProcess()
 {
+	TICK_PROFILE("EntityList::TrapProcess");
+
 	if (numclients < 1)
 		return;
 
@@ -375,6 +379,8 @@ void EntityList::CheckGroupList (const char *fname, const int fline)
 
 void EntityList::GroupProcess()
 {
+	TICK_PROFILE("EntityList::GroupProcess");
+
 	if (numclients < 1)
 		return;
 
@@ -397,6 +403,8 @@ void EntityList::QueueToGroupsForNPCHealthAA(Mob *sender, const EQApplicationPac
 
 void EntityList::RaidProcess()
 {
+	TICK_PROFILE("EntityList::RaidProcess");
+
 	if (numclients < 1)
 		return;
 
@@ -411,6 +419,8 @@ void EntityList::RaidProcess()
 
 void EntityList::DoorProcess()
 {
+	TICK_PROFILE("EntityList::DoorProcess");
+
 	if (zone && zone->IsIdleWhenEmpty()) {
 		if (numclients < 1) {
 			return;
@@ -435,6 +445,8 @@ void EntityList::DoorProcess()
 
 void EntityList::ObjectProcess()
 {
+	TICK_PROFILE("EntityList::ObjectProcess");
+
 	if (object_list.empty()) {
 		object_timer.Disable();
 		return;
@@ -454,6 +466,8 @@ void EntityList::ObjectProcess()
 
 void EntityList::CorpseProcess()
 {
+	TICK_PROFILE("EntityList::CorpseProcess");
+
 	if (corpse_list.empty()) {
 		corpse_timer.Disable(); // No corpses in list
 		return;
@@ -473,8 +487,12 @@ void EntityList::CorpseProcess()
 
 void EntityList::MobProcess()
 {
+	TICK_PROFILE("EntityList::MobProcess");
+
 	bool mob_dead;
 
+	m_parallel_ai.Prepare(npc_list);
+
 	auto it = mob_list.begin();
 	while (it != mob_list.end()) {
 		uint16 id = it->first;
@@ -539,6 +557,11 @@ void EntityList::MobProcess()
 			mob_dead = !mob->Process();
 		}
 
+		// keep the spatial grid in step with whatever movement happened this tick
+		if (!mob_dead) {
+			m_spatial_grid.Update(mob);
+		}
+
 		size_t a_sz = mob_list.size();
 
 		if (a_sz > sz) {
@@ -585,6 +608,8 @@ void EntityList::MobProcess()
 
 void EntityList::BeaconProcess()
 {
+	TICK_PROFILE("EntityList::BeaconProcess");
+
 	auto it = beacon_list.begin();
 	while (it != beacon_list.end()) {
 		if (!it->second->Process()) {
@@ -599,6 +624,8 @@ void EntityList::BeaconProcess()
 
 void EntityList::EncounterProcess()
 {
+	TICK_PROFILE("EntityList::EncounterProcess");
+
 	auto it = encounter_list.begin();
 	while (it != encounter_list.end()) {
 		if (!it->second->Process()) {
@@ -695,6 +722,7 @@ void EntityList::AddNPC(NPC *npc, bool send_spawn_packet, bool dont_queue)
 
 	npc_list.emplace(std::pair<uint16, NPC *>(npc->GetID(), npc));
 	mob_list.emplace(std::pair<uint16, Mob *>(npc->GetID(), npc));
+	m_spatial_grid.Add(npc);
 
 	entity_list.ScanCloseMobs(npc);
 
@@ -776,6 +804,7 @@ void EntityList::AddMerc(Merc *merc, bool SendSpawnPacket, bool dontqueue)
 
 		merc_list.emplace(std::pair<uint16, Merc *>(merc->GetID(), merc));
 		mob_list.emplace(std::pair<uint16, Mob *>(merc->GetID(), merc));
+		m_spatial_grid.Add(merc);
 
 		if (parse->MercHasQuestSub(EVENT_SPAWN)) {
 			parse->EventMerc(EVENT_SPAWN, merc, nullptr, "", 0);
@@ -1750,26 +1779,31 @@ void EntityList::QueueCloseClients(
 	}
 
 	float distance_squared = distance * distance;
-	for (auto &e : sender->GetCloseMobList(distance)) {
-		Mob *mob = e.second;
-		if (!mob) {
-			continue;
-		}
 
-		if (!mob->IsClient()) {
-			continue;
-		}
+	// every client of the same version receives the same translated packet, encode it once per version
+	EncodedPacketCache cache(app, is_ack_required);
 
-		Client *client = mob->CastToClient();
+	m_spatial_grid.ForEachCandidate(
+		sender->GetX(),
+		sender->GetY(),
+		distance,
+		[&](Mob *mob) {
+			if (!mob || !mob->IsClient()) {
+				return;
+			}
 
-		if ((!ignore_sender || client != sender) && (client != skipped_mob)) {
+			Client *client = mob->CastToClient();
+
+			if ((ignore_sender && client == sender) || client == skipped_mob) {
+				return;
+			}
 
 			if (DistanceSquared(client->GetPosition(), sender->GetPosition()) >= distance_squared) {
-				continue;
+				return;
 			}
 
 			if (!client->Connected()) {
-				continue;
+				return;
 			}
 
 			eqFilterMode client_filter = client->GetFilter(filter);
@@ -1779,10 +1813,10 @@ void EntityList::QueueCloseClients(
 				 (sender == client || (client->GetGroup() && client->GetGroup()->IsGroupMember(sender)))) ||
 				(client_filter == FilterShowSelfOnly && client == sender)
 				) {
-				client->QueuePacket(app, is_ack_required, Client::CLIENT_CONNECTED);
+				client->QueueCachedPacket(cache, Client::CLIENT_CONNECTED);
 			}
 		}
-	}
+	);
 }
 
 //sender can be null
@@ -1791,12 +1825,14 @@ void EntityList::QueueClients(
 	bool ignore_sender, bool ackreq
 )
 {
+	EncodedPacketCache cache(app, ackreq);
+
 	auto it = client_list.begin();
 	while (it != client_list.end()) {
 		Client *ent = it->second;
 
 		if ((!ignore_sender || ent != sender))
-			ent->QueuePacket(app, ackreq, Client::CLIENT_CONNECTED);
+			ent->QueueCachedPacket(cache, Client::CLIENT_CONNECTED);
 
 		++it;
 	}
@@ -1907,16 +1943,28 @@ Client *EntityList::GetRandomClient(const glm::vec3& location, float distance, C
 
 	std::vector<Client*> clients_in_range;
 
-	for (const auto& client : client_list) {
-		if (
-			client.second != exclude_client &&
-			(
-				is_whole_zone ||
-				DistanceSquared(static_cast<glm::vec3>(client.second->GetPosition()), location) <= distance_squared
-			)
-		) {
-			clients_in_range.push_back(client.second);
+	if (is_whole_zone) {
+		for (const auto& client : client_list) {
+			if (client.second != exclude_client) {
+				clients_in_range.push_back(client.second);
+			}
 		}
+	} else {
+		m_spatial_grid.ForEachCandidate(
+			location.x,
+			location.y,
+			distance,
+			[&](Mob *mob) {
+				auto e = mob->IsClient() ? mob->CastToClient() : nullptr;
+				if (
+					e &&
+					e != exclude_client &&
+					DistanceSquared(static_cast<glm::vec3>(e->GetPosition()), location) <= distance_squared
+				) {
+					clients_in_range.push_back(e);
+				}
+			}
+		);
 	}
 
 	if (clients_in_range.empty()) {
@@ -1937,16 +1985,28 @@ NPC* EntityList::GetRandomNPC(const glm::vec3& location, float distance, NPC* ex
 
 	std::vector<NPC*> npcs_in_range;
 
-	for (const auto& npc : npc_list) {
-		if (
-			npc.second != exclude_npc &&
-			(
-				is_whole_zone ||
-				DistanceSquared(static_cast<glm::vec3>(npc.second->GetPosition()), location) <= distance_squared
-			)
-		) {
-			npcs_in_range.push_back(npc.second);
+	if (is_whole_zone) {
+		for (const auto& npc : npc_list) {
+			if (npc.second != exclude_npc) {
+				npcs_in_range.push_back(npc.second);
+			}
 		}
+	} else {
+		m_spatial_grid.ForEachCandidate(
+			location.x,
+			location.y,
+			distance,
+			[&](Mob *mob) {
+				auto e = mob->IsNPC() && !mob->IsMerc() ? mob->CastToNPC() : nullptr;
+				if (
+					e &&
+					e != exclude_npc &&
+					DistanceSquared(static_cast<glm::vec3>(e->GetPosition()), location) <= distance_squared
+				) {
+					npcs_in_range.push_back(e);
+				}
+			}
+		);
 	}
 
 	if (npcs_in_range.empty()) {
@@ -1967,16 +2027,26 @@ Mob* EntityList::GetRandomMob(const glm::vec3& location, float distance, Mob* ex
 
 	std::vector<Mob*> mobs_in_range;
 
-	for (const auto& mob : mob_list) {
-		if (
-			mob.second != exclude_mob &&
-			(
-				is_whole_zone ||
-				DistanceSquared(static_cast<glm::vec3>(mob.second->GetPosition()), location) <= distance_squared
-			)
-		) {
-			mobs_in_range.push_back(mob.second);
+	if (is_whole_zone) {
+		for (const auto& mob : mob_list) {
+			if (mob.second != exclude_mob) {
+				mobs_in_range.push_back(mob.second);
+			}
 		}
+	} else {
+		m_spatial_grid.ForEachCandidate(
+			location.x,
+			location.y,
+			distance,
+			[&](Mob *mob) {
+				if (
+					mob != exclude_mob &&
+					DistanceSquared(static_cast<glm::vec3>(mob->GetPosition()), location) <= distance_squared
+				) {
+					mobs_in_range.push_back(mob);
+				}
+			}
+		);
 	}
 
 	if (mobs_in_range.empty()) {
@@ -2623,6 +2693,8 @@ void EntityList::RemoveAllMobs()
 		free_ids.push(it->first);
 		it = mob_list.erase(it);
 	}
+
+	m_spatial_grid.Clear();
 }
 
 void EntityList::RemoveAllClients()
@@ -2765,6 +2837,7 @@ bool EntityList::RemoveMob(uint16 delete_id)
 		else if (client_list.count(delete_id)) {
 			entity_list.RemoveClient(delete_id);
 		}
+		m_spatial_grid.Remove(delete_id);
 		safe_delete(it->second);
 		if (!corpse_list.count(delete_id)) {
 			free_ids.push(it->first);
@@ -2892,30 +2965,38 @@ void EntityList::ScanCloseMobs(Mob *scanning_mob)
 
 	float scan_range = RuleI(Range, MobCloseScanDistance);
 
-	// Reserve memory in m_close_mobs to avoid frequent re-allocations if not already reserved.
-	// Assuming mob_list.size() as an upper bound for reservation.
-	if (scanning_mob->m_close_mobs.bucket_count() < mob_list.size()) {
-		scanning_mob->m_close_mobs.reserve(mob_list.size());
-	}
+	// cells are sized to the scan range so a scan never touches more than the 3x3 cells around the scanning mob
+	m_spatial_grid.SetCellSize(scan_range);
 
 	scanning_mob->m_close_mobs.clear();
 
-	for (auto &e : mob_list) {
-		auto mob = e.second;
+	auto add_close_mob = [&](Mob *mob) {
+		if (!mob || mob->GetID() <= 0 || mob->IsZoneController()) {
+			return;
+		}
 
-		if (mob && (mob->GetID() <= 0 || mob->IsZoneController())) {
-			continue;
+		// add mob to scanning_mob's close list and vice versa
+		// check if the mob is already in the close mobs list before inserting
+		if (mob->m_close_mobs.find(scanning_mob->GetID()) == mob->m_close_mobs.end()) {
+			mob->m_close_mobs[scanning_mob->GetID()] = scanning_mob;
 		}
+		scanning_mob->m_close_mobs[mob->GetID()] = mob;
+	};
 
-		float distance = Distance(scanning_mob->GetPosition(), mob->GetPosition());
-		if (distance <= scan_range || mob->GetAggroRange() >= scan_range) {
-			// add mob to scanning_mob's close list and vice versa
-			// check if the mob is already in the close mobs list before inserting
-			if (mob->m_close_mobs.find(scanning_mob->GetID()) == mob->m_close_mobs.end()) {
-				mob->m_close_mobs[scanning_mob->GetID()] = scanning_mob;
+	m_spatial_grid.ForEachCandidate(
+		scanning_mob->GetX(),
+		scanning_mob->GetY(),
+		scan_range,
+		[&](Mob *mob) {
+			if (Distance(scanning_mob->GetPosition(), mob->GetPosition()) <= scan_range) {
+				add_close_mob(mob);
 			}
-			scanning_mob->m_close_mobs[mob->GetID()] = mob;
 		}
+	);
+
+	// mobs with an aggro range beyond the scan range are always considered close
+	for (auto &e : m_spatial_grid.GetWideAggroMobs()) {
+		add_close_mob(e.second);
 	}
 
 	LogAIScanClose(
@@ -3106,6 +3187,8 @@ void EntityList::RemoveEntity(uint16 id)
 
 void EntityList::Process()
 {
+	TICK_PROFILE("EntityList::Process");
+
 	CheckSpawnQueue();
 }
 
@@ -5546,44 +5629,40 @@ Mob *EntityList::GetClosestMobByBodyType(Mob *sender, uint8 BodyType, bool skip_
 
 void EntityList::GetTargetsForConeArea(Mob *start, float min_radius, float radius, float height, int pcnpc, std::list<Mob*> &m_list)
 {
-	auto it = mob_list.begin();
-	while (it !=  mob_list.end()) {
-		Mob *ptr = it->second;
-		if (ptr == start) {
-			++it;
-			continue;
-		}
-		// check PC/NPC only flag 1 = PCs, 2 = NPCs
-		if (pcnpc == 1 && !ptr->IsClient() && !ptr->IsMerc() && !ptr->IsBot()) {
-			++it;
-			continue;
-		} else if (pcnpc == 2 && (ptr->IsClient() || ptr->IsMerc() || ptr->IsBot())) {
-			++it;
-			continue;
-		}
-		if (ptr->IsClient() && !ptr->CastToClient()->ClientFinishedLoading()) {
-			++it;
-			continue;
-		}
-		if (ptr->IsAura() || ptr->IsTrap()) {
-			++it;
-			continue;
-		}
-
-		float x_diff = ptr->GetX() - start->GetX();
-		float y_diff = ptr->GetY() - start->GetY();
-		float z_diff = ptr->GetZ() - start->GetZ();
+	m_spatial_grid.ForEachCandidate(
+		start->GetX(),
+		start->GetY(),
+		radius,
+		[&](Mob *ptr) {
+			if (ptr == start) {
+				return;
+			}
+			// check PC/NPC only flag 1 = PCs, 2 = NPCs
+			if (pcnpc == 1 && !ptr->IsClient() && !ptr->IsMerc() && !ptr->IsBot()) {
+				return;
+			} else if (pcnpc == 2 && (ptr->IsClient() || ptr->IsMerc() || ptr->IsBot())) {
+				return;
+			}
+			if (ptr->IsClient() && !ptr->CastToClient()->ClientFinishedLoading()) {
+				return;
+			}
+			if (ptr->IsAura() || ptr->IsTrap()) {
+				return;
+			}
 
-		x_diff *= x_diff;
-		y_diff *= y_diff;
-		z_diff *= z_diff;
+			float x_diff = ptr->GetX() - start->GetX();
+			float y_diff = ptr->GetY() - start->GetY();
+			float z_diff = ptr->GetZ() - start->GetZ();
 
-		if ((x_diff + y_diff) <= (radius * radius) && (x_diff + y_diff) >= (min_radius * min_radius))
-			if(z_diff <= (height * height))
-				m_list.push_back(ptr);
+			x_diff *= x_diff;
+			y_diff *= y_diff;
+			z_diff *= z_diff;
 
-		++it;
-	}
+			if ((x_diff + y_diff) <= (radius * radius) && (x_diff + y_diff) >= (min_radius * min_radius))
+				if(z_diff <= (height * height))
+					m_list.push_back(ptr);
+		}
+	);
 }
 
 Client *EntityList::FindCorpseDragger(uint16 CorpseID)
@@ -31,6 +31,8 @@
 #include "position.h"
 #include "zonedump.h"
 #include "common.h"
+#include "spatial_grid.h"
+#include "parallel_ai.h"
 
 class Encounter;
 class Beacon;
@@ -573,6 +575,8 @@ public:
 	void SendAlternateAdvancementStats();
 	void ScanCloseMobs(Mob *scanning_mob);
 	void UpdateKnownPositions(Mob *scanning_mob);
+	inline SpatialGrid &GetSpatialGrid() { return m_spatial_grid; }
+	inline const ParallelAI &GetParallelAI() const { return m_parallel_ai; }
 
 	void GetTrapInfo(Client* c);
 	bool IsTrapGroupSpawned(uint32 trap_id, uint8 group);
@@ -617,6 +621,9 @@ private:
 	std::list<Area> area_list;
 	std::queue<uint16> free_ids;
 
+	SpatialGrid m_spatial_grid;
+	ParallelAI  m_parallel_ai;
+
 	Timer object_timer;
 	Timer door_timer;
 	Timer corpse_timer;
@@ -5,7 +5,7 @@ void command_movement(Client *c, const Seperator *sep)
 {
 	const int arguments = sep->argnum;
 	if (!arguments) {
-		c->Message(Chat::White, "Usage: #movement [clear|packet|rotate|run|stats|stop|walk]");
+		c->Message(Chat::White, "Usage: #movement [clear|packet|rotate|run|stats|stop|stress|walk]");
 		return;
 	}
 
@@ -15,6 +15,7 @@ void command_movement(Client *c, const Seperator *sep)
 	const bool is_run    = !strcasecmp(sep->arg[1], "run");
 	const bool is_stats  = !strcasecmp(sep->arg[1], "stats");
 	const bool is_stop   = !strcasecmp(sep->arg[1], "stop");
+	const bool is_stress = !strcasecmp(sep->arg[1], "stress");
 	const bool is_walk   = !strcasecmp(sep->arg[1], "walk");
 
 	if (
@@ -24,9 +25,10 @@ void command_movement(Client *c, const Seperator *sep)
 		!is_run &&
 		!is_stats &&
 		!is_stop &&
+		!is_stress &&
 		!is_walk
 	) {
-		c->Message(Chat::White, "Usage: #movement [clear|packet|rotate|run|stats|stop|walk]");
+		c->Message(Chat::White, "Usage: #movement [clear|packet|rotate|run|stats|stop|stress|walk]");
 		return;
 	}
 
@@ -74,6 +76,11 @@ void command_movement(Client *c, const Seperator *sep)
 		}
 
 		t->StopNavigation();
+	} else if (is_stress) {
+		const uint32 npc_count = sep->IsNumber(2) ? Strings::ToUnsignedInt(sep->arg[2]) : 50;
+		const uint32 seconds   = sep->IsNumber(3) ? Strings::ToUnsignedInt(sep->arg[3]) : 10;
+
+		m.StartPathStress(c, npc_count, seconds);
 	} else if (is_walk) {
 		Mob *t = c->GetTarget();
 		if (!t) {
@@ -0,0 +1,118 @@
+#include "../client.h"
+#include "../dialogue_window.h"
+#include "../../common/path_manager.h"
+#include "../../common/tick_profiler.h"
+
+void command_profiler(Client *c, const Seperator *sep)
+{
+	const auto arguments = sep->argnum;
+	if (!arguments) {
+		c->Message(Chat::White, "Usage: #profiler on - Starts recording zone loop phase timings");
+		c->Message(Chat::White, "Usage: #profiler off - Stops recording, recorded timings are kept");
+		c->Message(Chat::White, "Usage: #profiler summary - Shows p50/p99 per phase over the recent samples");
+		c->Message(Chat::White, "Usage: #profiler dump - Writes the recorded scopes as a Chrome trace to the logs folder");
+		c->Message(Chat::White, "Usage: #profiler reset - Discards everything recorded so far");
+		return;
+	}
+
+	const bool is_on      = !strcasecmp(sep->arg[1], "on");
+	const bool is_off     = !strcasecmp(sep->arg[1], "off");
+	const bool is_summary = !strcasecmp(sep->arg[1], "summary");
+	const bool is_dump    = !strcasecmp(sep->arg[1], "dump");
+	const bool is_reset   = !strcasecmp(sep->arg[1], "reset");
+
+	if (is_on || is_off) {
+		TickProfiler::SetEnabled(is_on);
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"Tick profiler is now {}.",
+				is_on ? "recording" : "stopped"
+			).c_str()
+		);
+		return;
+	}
+
+	if (is_reset) {
+		TickProfiler::Reset();
+		c->Message(Chat::White, "Tick profiler samples have been reset.");
+		return;
+	}
+
+	if (is_summary) {
+		const auto &l = TickProfiler::GetSummary();
+		if (l.empty()) {
+			c->Message(
+				Chat::White,
+				fmt::format(
+					"Nothing has been recorded yet, the profiler is {}.",
+					TickProfiler::IsEnabled() ? "recording" : "stopped"
+				).c_str()
+			);
+			return;
+		}
+
+		std::string popup_table;
+
+		popup_table += DialogueWindow::TableRow(
+			DialogueWindow::TableCell("Phase") +
+			DialogueWindow::TableCell("Calls") +
+			DialogueWindow::TableCell("p50 (us)") +
+			DialogueWindow::TableCell("p99 (us)") +
+			DialogueWindow::TableCell("Max (us)")
+		);
+
+		for (const auto &e: l) {
+			popup_table += DialogueWindow::TableRow(
+				DialogueWindow::TableCell(e.name) +
+				DialogueWindow::TableCell(Strings::Commify(e.calls)) +
+				DialogueWindow::TableCell(fmt::format("{:.1f}", e.p50_us)) +
+				DialogueWindow::TableCell(fmt::format("{:.1f}", e.p99_us)) +
+				DialogueWindow::TableCell(fmt::format("{:.1f}", e.max_us))
+			);
+		}
+
+		popup_table = DialogueWindow::Table(popup_table);
+
+		c->SendPopupToClient(
+			"Tick Profiler",
+			popup_table.c_str()
+		);
+		return;
+	}
+
+	if (is_dump) {
+		const std::string &file_name = fmt::format(
+			"{}/tick_profile_{}_{}_{}.json",
+			path.GetLogPath(),
+			zone->GetShortName(),
+			zone->GetInstanceID(),
+			std::time(nullptr)
+		);
+
+		size_t event_count = 0;
+		if (!TickProfiler::WriteChromeTrace(file_name, event_count)) {
+			c->Message(
+				Chat::White,
+				fmt::format(
+					"Failed to write tick profile to '{}'.",
+					file_name
+				).c_str()
+			);
+			return;
+		}
+
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"Wrote {} scope{} to '{}', open it in chrome://tracing or ui.perfetto.dev.",
+				Strings::Commify(event_count),
+				event_count != 1 ? "s" : "",
+				file_name
+			).c_str()
+		);
+		return;
+	}
+
+	c->Message(Chat::White, "Usage: #profiler [on|off|summary|dump|reset]");
+}
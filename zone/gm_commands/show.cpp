@@ -10,8 +10,10 @@
 #include "show/currencies.cpp"
 #include "show/distance.cpp"
 #include "show/emotes.cpp"
+#include "show/encode_stats.cpp"
 #include "show/field_of_view.cpp"
 #include "show/flags.cpp"
+#include "show/focus_cache.cpp"
 #include "show/group_info.cpp"
 #include "show/hatelist.cpp"
 #include "show/inventory.cpp"
@@ -26,8 +28,10 @@
 #include "show/petition.cpp"
 #include "show/petition_info.cpp"
 #include "show/proximity.cpp"
+#include "show/quest_dispatch_stats.cpp"
 #include "show/quest_errors.cpp"
 #include "show/quest_globals.cpp"
+#include "show/quest_timers.cpp"
 #include "show/recipe.cpp"
 #include "show/server_info.cpp"
 #include "show/skills.cpp"
@@ -72,8 +76,10 @@ void command_show(Client *c, const Seperator *sep)
 		Cmd{.cmd = "currencies", .u = "currencies", .fn = ShowCurrencies, .a = {"#viewcurrencies"}},
 		Cmd{.cmd = "distance", .u = "distance", .fn = ShowDistance, .a = {"#distance"}},
 		Cmd{.cmd = "emotes", .u = "emotes", .fn = ShowEmotes, .a = {"#emoteview"}},
+		Cmd{.cmd = "encode_stats", .u = "encode_stats [reset] (reset is optional)", .fn = ShowEncodeStats},
 		Cmd{.cmd = "field_of_view", .u = "field_of_view", .fn = ShowFieldOfView, .a = {"#fov"}},
 		Cmd{.cmd = "flags", .u = "flags", .fn = ShowFlags, .a = {"#flags"}},
+		Cmd{.cmd = "focus_cache", .u = "focus_cache [reset] (reset is optional)", .fn = ShowFocusCache},
 		Cmd{.cmd = "group_info", .u = "group_info", .fn = ShowGroupInfo, .a = {"#ginfo"}},
 		Cmd{.cmd = "hatelist", .u = "hatelist", .fn = ShowHateList, .a = {"#hatelist"}},
 		Cmd{.cmd = "inventory", .u = "inventory", .fn = ShowInventory, .a = {"#peekinv"}},
@@ -88,8 +94,10 @@ void command_show(Client *c, const Seperator *sep)
 		Cmd{.cmd = "petition", .u = "petition", .fn = ShowPetition, .a = {"#listpetition", "#viewpetition"}},
 		Cmd{.cmd = "petition_info", .u = "petition_info", .fn = ShowPetitionInfo, .a = {"#petitioninfo"}},
 		Cmd{.cmd = "proximity", .u = "proximity", .fn = ShowProximity, .a = {"#proximity"}},
+		Cmd{.cmd = "quest_dispatch_stats", .u = "quest_dispatch_stats [reset] (reset is optional)", .fn = ShowQuestDispatchStats},
 		Cmd{.cmd = "quest_errors", .u = "quest_errors", .fn = ShowQuestErrors, .a = {"#questerrors"}},
 		Cmd{.cmd = "quest_globals", .u = "quest_globals", .fn = ShowQuestGlobals, .a = {"#globalview"}},
+		Cmd{.cmd = "quest_timers", .u = "quest_timers", .fn = ShowQuestTimers},
 		Cmd{.cmd = "recipe", .u = "recipe [Recipe ID]", .fn = ShowRecipe, .a = {"#viewrecipe"}},
 		Cmd{.cmd = "server_info", .u = "server_info", .fn = ShowServerInfo, .a = {"#serverinfo"}},
 		Cmd{.cmd = "skills", .u = "skills", .fn = ShowSkills, .a = {"#showskills"}},
@@ -0,0 +1,87 @@
+#include "../../client.h"
+#include "../../dialogue_window.h"
+
+void ShowEncodeStats(Client *c, const Seperator *sep)
+{
+	if (!strcasecmp(sep->arg[2], "reset")) {
+		EncodedPacketCache::ResetStats();
+		c->Message(Chat::White, "Broadcast encode statistics have been reset.");
+		return;
+	}
+
+	struct OpcodeStats {
+		int                       opcode;
+		EncodedPacketCache::Stats stats;
+	};
+
+	std::vector<OpcodeStats> l;
+
+	uint64 total_encodes = 0;
+	uint64 total_reuses  = 0;
+
+	for (int i = 0; i < _maxEmuOpcode; ++i) {
+		const auto &s = EncodedPacketCache::GetStats(static_cast<EmuOpcode>(i));
+		if (s.encodes || s.reuses) {
+			l.emplace_back(OpcodeStats{.opcode = i, .stats = s});
+			total_encodes += s.encodes;
+			total_reuses += s.reuses;
+		}
+	}
+
+	if (l.empty()) {
+		c->Message(Chat::White, "No broadcast packets have been encoded yet.");
+		return;
+	}
+
+	std::sort(
+		l.begin(),
+		l.end(),
+		[](const OpcodeStats &a, const OpcodeStats &b) {
+			return a.stats.reuses > b.stats.reuses;
+		}
+	);
+
+	std::string popup_table;
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Opcode") +
+		DialogueWindow::TableCell("Encodes") +
+		DialogueWindow::TableCell("Encodes Saved") +
+		DialogueWindow::TableCell("Saved")
+	);
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("All") +
+		DialogueWindow::TableCell(Strings::Commify(total_encodes)) +
+		DialogueWindow::TableCell(Strings::Commify(total_reuses)) +
+		DialogueWindow::TableCell(
+			fmt::format(
+				"{:.2f}%%",
+				static_cast<double>(total_reuses) / static_cast<double>(total_encodes + total_reuses) * 100.0
+			)
+		)
+	);
+
+	popup_table += DialogueWindow::Break(2);
+
+	for (const auto &e: l) {
+		popup_table += DialogueWindow::TableRow(
+			DialogueWindow::TableCell(OpcodeNames[e.opcode]) +
+			DialogueWindow::TableCell(Strings::Commify(e.stats.encodes)) +
+			DialogueWindow::TableCell(Strings::Commify(e.stats.reuses)) +
+			DialogueWindow::TableCell(
+				fmt::format(
+					"{:.2f}%%",
+					static_cast<double>(e.stats.reuses) / static_cast<double>(e.stats.encodes + e.stats.reuses) * 100.0
+				)
+			)
+		);
+	}
+
+	popup_table = DialogueWindow::Table(popup_table);
+
+	c->SendPopupToClient(
+		"Broadcast Encode Statistics",
+		popup_table.c_str()
+	);
+}
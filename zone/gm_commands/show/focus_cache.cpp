@@ -0,0 +1,106 @@
+#include "../../client.h"
+#include "../../dialogue_window.h"
+
+void ShowFocusCache(Client *c, const Seperator *sep)
+{
+	Mob* t = c;
+	if (c->GetTarget()) {
+		t = c->GetTarget();
+	}
+
+	if (!t->IsOfClientBot()) {
+		c->Message(Chat::White, "Focus caching is only done for clients and bots.");
+		return;
+	}
+
+	if (!strcasecmp(sep->arg[2], "reset")) {
+		t->InvalidateFocusCache();
+		t->ResetFocusCacheStats();
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"Focus cache for {} has been cleared.",
+				c->GetTargetDescription(t)
+			).c_str()
+		);
+		return;
+	}
+
+	const auto &s = t->GetFocusCacheStats();
+
+	const uint64 lookups = s.hits + s.misses + s.uncacheable;
+
+	std::string popup_table;
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Hits") +
+		DialogueWindow::TableCell("Misses") +
+		DialogueWindow::TableCell("Uncacheable") +
+		DialogueWindow::TableCell("Invalidations") +
+		DialogueWindow::TableCell("Hit Rate")
+	);
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell(Strings::Commify(s.hits)) +
+		DialogueWindow::TableCell(Strings::Commify(s.misses)) +
+		DialogueWindow::TableCell(Strings::Commify(s.uncacheable)) +
+		DialogueWindow::TableCell(Strings::Commify(s.invalidations)) +
+		DialogueWindow::TableCell(
+			fmt::format(
+				"{:.2f}%%",
+				lookups ? static_cast<double>(s.hits) / static_cast<double>(lookups) * 100.0 : 0.0
+			)
+		)
+	);
+
+	popup_table += DialogueWindow::Break(2);
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Focus Type") +
+		DialogueWindow::TableCell("Spell") +
+		DialogueWindow::TableCell("Item") +
+		DialogueWindow::TableCell("AA") +
+		DialogueWindow::TableCell("Worn")
+	);
+
+	// sorted so the table reads the same between dumps
+	std::vector<std::pair<uint32, Mob::FocusCacheEntry>> l(t->GetFocusCache().begin(), t->GetFocusCache().end());
+
+	std::sort(
+		l.begin(),
+		l.end(),
+		[](const auto &a, const auto &b) {
+			return a.first < b.first;
+		}
+	);
+
+	for (const auto &[key, e]: l) {
+		const uint16 spell_id = key & 0xFFFF;
+
+		std::string item;
+		if (e.item) {
+			item = e.rand_effectiveness ?
+				fmt::format("{} (best {}, rolled)", e.item->Name, e.item_best) :
+				fmt::format("{} ({})", e.item->Name, e.item_total);
+		}
+
+		popup_table += DialogueWindow::TableRow(
+			DialogueWindow::TableCell(std::to_string(key >> 16)) +
+			DialogueWindow::TableCell(fmt::format("{} ({})", GetSpellName(spell_id), spell_id)) +
+			DialogueWindow::TableCell(item.empty() ? "-" : item) +
+			DialogueWindow::TableCell(std::to_string(e.aa_total)) +
+			DialogueWindow::TableCell(std::to_string(e.worn_total))
+		);
+	}
+
+	popup_table = DialogueWindow::Table(popup_table);
+
+	c->SendPopupToClient(
+		fmt::format(
+			"Focus Cache for {} ({} Entries)",
+			t->GetCleanName(),
+			Strings::Commify(l.size())
+		).c_str(),
+		popup_table.c_str()
+	);
+}
@@ -129,6 +129,16 @@ void ShowNetwork(Client *c, const Seperator *sep)
 		DialogueWindow::TableCell(Strings::Commify(opts.daybreak_options.port))
 	);
 
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Batched Send") +
+		DialogueWindow::TableCell(opts.daybreak_options.batch_send ? "Yes" : "No")
+	);
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Batched Receive") +
+		DialogueWindow::TableCell(opts.daybreak_options.batch_recv ? "Yes" : "No")
+	);
+
 	popup_table = DialogueWindow::Table(popup_table);
 
 	c->SendPopupToClient(
@@ -0,0 +1,92 @@
+#include "../../client.h"
+#include "../../dialogue_window.h"
+#include "../../quest_parser_collection.h"
+
+void ShowQuestDispatchStats(Client *c, const Seperator *sep)
+{
+	if (!strcasecmp(sep->arg[2], "reset")) {
+		parse->ResetEventStats();
+		c->Message(Chat::White, "Quest dispatch statistics have been reset.");
+		return;
+	}
+
+	struct QuestEventStats {
+		int                               event_id;
+		QuestParserCollection::EventStats stats;
+	};
+
+	std::vector<QuestEventStats> l;
+
+	uint64 total_fired           = 0;
+	uint64 total_short_circuited = 0;
+
+	for (int i = 0; i < _LargestEventID; ++i) {
+		const auto &s = parse->GetEventStats(static_cast<QuestEventID>(i));
+		if (s.fired || s.short_circuited) {
+			l.emplace_back(QuestEventStats{.event_id = i, .stats = s});
+			total_fired += s.fired;
+			total_short_circuited += s.short_circuited;
+		}
+	}
+
+	if (l.empty()) {
+		c->Message(Chat::White, "No quest events have been checked yet.");
+		return;
+	}
+
+	std::sort(
+		l.begin(),
+		l.end(),
+		[](const QuestEventStats &a, const QuestEventStats &b) {
+			return a.stats.fired + a.stats.short_circuited > b.stats.fired + b.stats.short_circuited;
+		}
+	);
+
+	std::string popup_table;
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Event") +
+		DialogueWindow::TableCell("Fired") +
+		DialogueWindow::TableCell("Short Circuited") +
+		DialogueWindow::TableCell("Skipped")
+	);
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("All") +
+		DialogueWindow::TableCell(Strings::Commify(total_fired)) +
+		DialogueWindow::TableCell(Strings::Commify(total_short_circuited)) +
+		DialogueWindow::TableCell(
+			fmt::format(
+				"{:.2f}%%",
+				static_cast<double>(total_short_circuited) / static_cast<double>(total_fired + total_short_circuited) * 100.0
+			)
+		)
+	);
+
+	popup_table += DialogueWindow::Break(2);
+
+	for (const auto &e: l) {
+		popup_table += DialogueWindow::TableRow(
+#ifdef EMBPERL
+			DialogueWindow::TableCell(QuestEventSubroutines[e.event_id]) +
+#else
+			DialogueWindow::TableCell(std::to_string(e.event_id)) +
+#endif
+			DialogueWindow::TableCell(Strings::Commify(e.stats.fired)) +
+			DialogueWindow::TableCell(Strings::Commify(e.stats.short_circuited)) +
+			DialogueWindow::TableCell(
+				fmt::format(
+					"{:.2f}%%",
+					static_cast<double>(e.stats.short_circuited) / static_cast<double>(e.stats.fired + e.stats.short_circuited) * 100.0
+				)
+			)
+		);
+	}
+
+	popup_table = DialogueWindow::Table(popup_table);
+
+	c->SendPopupToClient(
+		"Quest Dispatch Statistics",
+		popup_table.c_str()
+	);
+}
@@ -0,0 +1,71 @@
+#include "../../client.h"
+#include "../../dialogue_window.h"
+#include "../../questmgr.h"
+
+void ShowQuestTimers(Client *c, const Seperator *sep)
+{
+	std::string popup_table;
+
+	// the target's own timers, when there is one with any
+	Mob *t = c->GetTarget();
+	if (t) {
+		const auto &l = quest_manager.GetQuestTimers(t);
+		if (!l.empty()) {
+			popup_table += DialogueWindow::TableRow(
+				DialogueWindow::TableCell("Timer") +
+				DialogueWindow::TableCell("Remaining") +
+				DialogueWindow::TableCell("Duration")
+			);
+
+			for (const auto &e: l) {
+				popup_table += DialogueWindow::TableRow(
+					DialogueWindow::TableCell(e.name) +
+					DialogueWindow::TableCell(fmt::format("{} ms", Strings::Commify(e.remaining))) +
+					DialogueWindow::TableCell(fmt::format("{} ms", Strings::Commify(e.duration)))
+				);
+			}
+
+			popup_table += DialogueWindow::Break(2);
+		}
+	}
+
+	const auto &counts = quest_manager.GetQuestTimerCountsByScript();
+	if (counts.empty() && popup_table.empty()) {
+		c->Message(Chat::White, "There are no quest timers running.");
+		return;
+	}
+
+	std::vector<std::pair<std::string, uint32>> l(counts.begin(), counts.end());
+
+	std::sort(
+		l.begin(),
+		l.end(),
+		[](const auto &a, const auto &b) {
+			return a.second > b.second;
+		}
+	);
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Script") +
+		DialogueWindow::TableCell("Timers")
+	);
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("All") +
+		DialogueWindow::TableCell(Strings::Commify(quest_manager.GetQuestTimerCount()))
+	);
+
+	for (const auto &e: l) {
+		popup_table += DialogueWindow::TableRow(
+			DialogueWindow::TableCell(e.first) +
+			DialogueWindow::TableCell(Strings::Commify(e.second))
+		);
+	}
+
+	popup_table = DialogueWindow::Table(popup_table);
+
+	c->SendPopupToClient(
+		t ? fmt::format("Quest Timers ({})", t->GetCleanName()).c_str() : "Quest Timers",
+		popup_table.c_str()
+	);
+}
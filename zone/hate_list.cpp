@@ -29,10 +29,60 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "zone.h"
 #include "water_map.h"
 
-#include <list>
-
 extern Zone *zone;
 
+void struct_HateList::SetEnt(Mob *m)
+{
+	const int32 row = owner->Find(entity);
+	if (row != HateList::NOT_FOUND) {
+		owner->SetRowEntity(row, m);
+	}
+
+	entity = m;
+}
+
+int64 struct_HateList::GetHate() const
+{
+	const int32 row = owner->Find(entity);
+	return row != HateList::NOT_FOUND ? owner->m_hate[row] : 0;
+}
+
+void struct_HateList::SetHate(int64 value)
+{
+	const int32 row = owner->Find(entity);
+	if (row != HateList::NOT_FOUND) {
+		owner->SetRowHate(row, value);
+	}
+}
+
+int64 struct_HateList::GetDamage() const
+{
+	const int32 row = owner->Find(entity);
+	return row != HateList::NOT_FOUND ? owner->m_damage[row] : 0;
+}
+
+void struct_HateList::SetDamage(int64 value)
+{
+	const int32 row = owner->Find(entity);
+	if (row != HateList::NOT_FOUND) {
+		owner->m_damage[row] = value;
+	}
+}
+
+bool struct_HateList::GetFrenzy() const
+{
+	const int32 row = owner->Find(entity);
+	return row != HateList::NOT_FOUND && owner->m_frenzy[row];
+}
+
+void struct_HateList::SetFrenzy(bool value)
+{
+	const int32 row = owner->Find(entity);
+	if (row != HateList::NOT_FOUND) {
+		owner->SetRowFrenzy(row, value);
+	}
+}
+
 HateList::HateList()
 {
 	hate_owner = nullptr;
@@ -43,66 +93,92 @@ HateList::~HateList()
 }
 
 void HateList::WipeHateList(bool npc_only) {
-	auto iterator = list.begin();
-	while (iterator != list.end()) {
-		Mob *m = (*iterator)->entity_on_hatelist;
+	// collected first, quest events below are free to change the list
+	std::vector<Mob *> removals;
+	removals.reserve(m_entities.size());
+
+	for (auto m : m_entities) {
+		if (!m) {
+			continue;
+		}
+
 		if (
-			m &&
 			(
 				m->IsOfClientBotMerc() ||
 				(m->IsPet() && m->GetOwner() && m->GetOwner()->IsOfClientBotMerc())
 			) &&
 			npc_only
 		) {
-			iterator++;
-		} else {
-			if (m) {
-				if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
-					parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), m, "0", 0);
-				}
+			continue;
+		}
 
-				if (m->IsClient()) {
-					m->CastToClient()->DecrementAggroCount();
-					m->CastToClient()->RemoveXTarget(hate_owner, true);
-				}
+		removals.emplace_back(m);
+	}
 
-				delete (*iterator);
-				iterator = list.erase(iterator);
-			}
+	for (auto m : removals) {
+		if (Find(m) == NOT_FOUND) {
+			continue;
+		}
+
+		if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
+			parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), m, "0", 0);
+		}
+
+		if (m->IsClient()) {
+			m->CastToClient()->DecrementAggroCount();
+			m->CastToClient()->RemoveXTarget(hate_owner, true);
+		}
+
+		const int32 row = Find(m);
+		if (row != NOT_FOUND) {
+			EraseRow(row);
 		}
 	}
 }
 
 bool HateList::IsEntOnHateList(Mob* m)
 {
-	return m ? Find(m) != nullptr : false;
+	return m ? Find(m) != NOT_FOUND : false;
 }
 
-struct_HateList* HateList::Find(Mob* m)
+int32 HateList::Find(Mob* m) const
 {
-	if (!m || list.empty()) {
-		return nullptr;
+	if (!m || m_entities.empty()) {
+		return NOT_FOUND;
 	}
 
-	for (auto e : list) {
-		if (e->entity_on_hatelist && e->entity_on_hatelist == m) {
-			return e;
+	const uint16 id = m->GetID();
+	if (id) {
+		auto it = m_row_by_entity_id.find(id);
+		if (it != m_row_by_entity_id.end() && m_entities[it->second] == m) {
+			return it->second;
+		}
+
+		if (m_unindexed_rows == 0) {
+			return NOT_FOUND;
 		}
 	}
 
-	return nullptr;
+	// only reached for entities added before they had an id
+	for (size_t i = 0; i < m_entities.size(); ++i) {
+		if (m_entities[i] == m) {
+			return static_cast<int32>(i);
+		}
+	}
+
+	return NOT_FOUND;
 }
 
 void HateList::SetHateAmountOnEnt(Mob* other, int64 in_hate, uint64 in_damage)
 {
-	struct_HateList *entity = Find(other);
-	if (entity)
+	const int32 row = Find(other);
+	if (row != NOT_FOUND)
 	{
 		if (in_damage > 0)
-			entity->hatelist_damage = in_damage;
+			m_damage[row] = in_damage;
 		if (in_hate > 0)
-			entity->stored_hate_amount = in_hate;
-		entity->last_modified = Timer::GetCurrentTime();
+			SetRowHate(row, in_hate);
+		m_last_modified[row] = Timer::GetCurrentTime();
 	}
 }
 
@@ -115,8 +191,8 @@ Mob* HateList::GetDamageTopOnHateList(Mob* hater)
 
 	uint64 damage = 0;
 
-	for (const auto& e : list) {
-		c = e->entity_on_hatelist;
+	for (size_t i = 0; i < m_entities.size(); ++i) {
+		c = m_entities[i];
 
 		if (!c) {
 			continue;
@@ -143,9 +219,9 @@ Mob* HateList::GetDamageTopOnHateList(Mob* hater)
 				m = c;
 				damage = g->GetTotalGroupDamage(hater);
 			}
-		} else if (static_cast<uint64>(e->hatelist_damage) >= damage) {
+		} else if (static_cast<uint64>(m_damage[i]) >= damage) {
 			m = c;
-			damage = static_cast<uint64>(e->hatelist_damage);
+			damage = static_cast<uint64>(m_damage[i]);
 		}
 	}
 
@@ -157,28 +233,28 @@ Mob* HateList::GetClosestEntOnHateList(Mob *hater, bool skip_mezzed, EntityFilte
 	float close_distance = 99999.9f;
 	float this_distance;
 
-	for (const auto& e : list) {
-		if (!e->entity_on_hatelist) {
+	for (auto m : m_entities) {
+		if (!m) {
 			continue;
 		}
 
-		if (skip_mezzed && e->entity_on_hatelist->IsMezzed()) {
+		if (skip_mezzed && m->IsMezzed()) {
 			continue;
 		}
 
 		switch (filter_type) {
 			case EntityFilterType::Bots:
-				if (!e->entity_on_hatelist->IsBot()) {
+				if (!m->IsBot()) {
 					continue;
 				}
 				break;
 			case EntityFilterType::Clients:
-				if (!e->entity_on_hatelist->IsClient()) {
+				if (!m->IsClient()) {
 					continue;
 				}
 				break;
 			case EntityFilterType::NPCs:
-				if (!e->entity_on_hatelist->IsNPC()) {
+				if (!m->IsNPC()) {
 					continue;
 				}
 				break;
@@ -187,10 +263,10 @@ Mob* HateList::GetClosestEntOnHateList(Mob *hater, bool skip_mezzed, EntityFilte
 				break;
 		}
 
-		this_distance = DistanceSquaredNoZ(e->entity_on_hatelist->GetPosition(), hater->GetPosition());
+		this_distance = DistanceSquaredNoZ(m->GetPosition(), hater->GetPosition());
 		if (this_distance <= close_distance) {
 			close_distance = this_distance;
-			close_entity   = e->entity_on_hatelist;
+			close_entity   = m;
 		}
 	}
 
@@ -218,12 +294,12 @@ void HateList::AddEntToHateList(Mob *in_entity, int64 in_hate, int64 in_damage,
 		return;
 	}
 
-	struct_HateList *entity = Find(in_entity);
-	if (entity) {
-		entity->hatelist_damage += (in_damage >= 0) ? in_damage : 0;
-		entity->stored_hate_amount += in_hate;
-		entity->is_entity_frenzy = in_is_entity_frenzied;
-		entity->last_modified = Timer::GetCurrentTime();
+	const int32 row = Find(in_entity);
+	if (row != NOT_FOUND) {
+		m_damage[row] += (in_damage >= 0) ? in_damage : 0;
+		SetRowHate(row, m_hate[row] + in_hate);
+		SetRowFrenzy(row, in_is_entity_frenzied);
+		m_last_modified[row] = Timer::GetCurrentTime();
 
 		LogHate(
 			"AddEntToHateList in_entity [{}] ({}) in_hate [{}] in_damage [{}] stored_hate_amount [{}] hatelist_damage [{}]",
@@ -231,18 +307,11 @@ void HateList::AddEntToHateList(Mob *in_entity, int64 in_hate, int64 in_damage,
 			in_entity->GetID(),
 			in_hate,
 			in_damage,
-			entity->stored_hate_amount,
-			entity->hatelist_damage
+			m_hate[row],
+			m_damage[row]
 		);
 	} else if (iAddIfNotExist) {
-		entity = new struct_HateList;
-		entity->entity_on_hatelist = in_entity;
-		entity->hatelist_damage = (in_damage >= 0) ? in_damage : 0;
-		entity->stored_hate_amount = in_hate;
-		entity->is_entity_frenzy = in_is_entity_frenzied;
-		entity->oor_count = 0;
-		entity->last_modified = Timer::GetCurrentTime();
-		list.push_back(entity);
+		AddRow(in_entity, in_hate, (in_damage >= 0) ? in_damage : 0, in_is_entity_frenzied);
 
 		if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
 			parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "1", 0);
@@ -260,43 +329,35 @@ bool HateList::RemoveEntFromHateList(Mob *in_entity)
 		return false;
 	}
 
-	bool is_found = false;
-	auto iterator = list.begin();
-
-	while (iterator != list.end()) {
-		if ((*iterator)->entity_on_hatelist == in_entity) {
-			is_found = true;
+	const int32 row = Find(in_entity);
+	if (row == NOT_FOUND) {
+		return false;
+	}
 
-			if (in_entity && in_entity->IsClient()) {
-				in_entity->CastToClient()->DecrementAggroCount();
-			}
+	if (in_entity->IsClient()) {
+		in_entity->CastToClient()->DecrementAggroCount();
+	}
 
-			delete (*iterator);
-			iterator = list.erase(iterator);
+	EraseRow(row);
 
-			if (in_entity) {
-				if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
-					parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "0", 0);
-				}
-			}
-		} else {
-			++iterator;
-		}
+	if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
+		parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "0", 0);
 	}
-	return is_found;
+
+	return true;
 }
 
 // so if faction_id and faction_value are set, we do RewardFaction, otherwise old stuff
 void HateList::DoFactionHits(int64 npc_faction_level_id, int32 faction_id, int32 faction_value) {
 	if (npc_faction_level_id <= 0 && faction_id <= 0 && faction_value == 0)
 		return;
-	auto iterator = list.begin();
-	while (iterator != list.end())
+
+	for (size_t i = 0; i < m_entities.size(); ++i)
 	{
 		Client *client;
 
-		if ((*iterator)->entity_on_hatelist && (*iterator)->entity_on_hatelist->IsClient())
-			client = (*iterator)->entity_on_hatelist->CastToClient();
+		if (m_entities[i] && m_entities[i]->IsClient())
+			client = m_entities[i]->CastToClient();
 		else
 			client = nullptr;
 
@@ -307,7 +368,6 @@ void HateList::DoFactionHits(int64 npc_faction_level_id, int32 faction_id, int32
 				client->SetFactionLevel(client->CharacterID(), npc_faction_level_id, client->GetBaseClass(), client->GetBaseRace(), client->GetDeity());
 			}
 		}
-		++iterator;
 	}
 }
 
@@ -316,15 +376,11 @@ int HateList::GetSummonedPetCountOnHateList() {
 	//Function to get number of 'Summoned' pets on a targets hate list to allow calculations for certian spell effects.
 	//Unclear from description that pets are required to be 'summoned body type'. Will not require at this time.
 	int pet_count = 0;
-	auto iterator = list.begin();
-	while (iterator != list.end()) {
-
-		if ((*iterator)->entity_on_hatelist != nullptr && (*iterator)->entity_on_hatelist->IsNPC() && ((*iterator)->entity_on_hatelist->CastToNPC()->IsPet() || ((*iterator)->entity_on_hatelist->CastToNPC()->GetSwarmOwner() > 0)))
+	for (auto m : m_entities) {
+		if (m != nullptr && m->IsNPC() && (m->CastToNPC()->IsPet() || (m->CastToNPC()->GetSwarmOwner() > 0)))
 		{
 			++pet_count;
 		}
-
-		++iterator;
 	}
 
 	return pet_count;
@@ -332,17 +388,17 @@ int HateList::GetSummonedPetCountOnHateList() {
 
 int HateList::GetHateRatio(Mob *top, Mob *other)
 {
-	auto other_entry = Find(other);
+	const int32 other_row = Find(other);
 
-	if (!other_entry || other_entry->stored_hate_amount < 1)
+	if (other_row == NOT_FOUND || m_hate[other_row] < 1)
 		return 0;
 
-	auto top_entry = Find(top);
+	const int32 top_row = Find(top);
 
-	if (!top_entry || top_entry->stored_hate_amount < 1)
+	if (top_row == NOT_FOUND || m_hate[top_row] < 1)
 		return 999; // shouldn't happen if you call it right :P
 
-	return EQ::Clamp(static_cast<int>((other_entry->stored_hate_amount * 100) / top_entry->stored_hate_amount), 1, 999);
+	return EQ::Clamp(static_cast<int>((m_hate[other_row] * 100) / m_hate[top_row]), 1, 999);
 }
 
 // skip is used to ignore a certain mob on the list
@@ -370,30 +426,20 @@ Mob *HateList::GetMobWithMostHateOnList(
 		int64 hate_client_type_in_range = -1;
 		int   skipped_count             = 0;
 
-		auto iterator = list.begin();
-		while (iterator != list.end()) {
-			struct_HateList *cur      = (*iterator);
-			int16           aggro_mod = 0;
+		for (size_t i = 0; i < m_entities.size(); ++i) {
+			int16 aggro_mod = 0;
 
-			if (!cur) {
-				++iterator;
-				continue;
-			}
-
-			Mob *m = cur->entity_on_hatelist;
+			Mob *m = m_entities[i];
 
 			if (!m) {
-				++iterator;
 				continue;
 			}
 
 			if (m == skip) {
-				++iterator;
 				continue;
 			}
 
 			if (skip_mezzed && m->IsMezzed()) {
-				++iterator;
 				continue;
 			}
 
@@ -402,7 +448,6 @@ Mob *HateList::GetMobWithMostHateOnList(
 				(filter_type == EntityFilterType::Clients && !m->IsClient()) ||
 				(filter_type == EntityFilterType::NPCs && !m->IsNPC())
 			) {
-				++iterator;
 				continue;
 			}
 
@@ -412,7 +457,6 @@ Mob *HateList::GetMobWithMostHateOnList(
 					hate     = 1;
 				}
 
-				++iterator;
 				continue;
 			}
 
@@ -422,11 +466,10 @@ Mob *HateList::GetMobWithMostHateOnList(
 					hate     = 0;
 				}
 
-				++iterator;
 				continue;
 			}
 
-			int64 current_hate = cur->stored_hate_amount;
+			int64 current_hate = m_hate[i];
 
 			if (m->IsOfClientBot()) {
 				if (m->IsClient() && m->CastToClient()->IsSitting()) {
@@ -442,7 +485,7 @@ Mob *HateList::GetMobWithMostHateOnList(
 						if (center->CombatRange(m)) {
 							aggro_mod += RuleI(Aggro, MeleeRangeAggroMod);
 
-							if (current_hate > hate_client_type_in_range || cur->is_entity_frenzy) {
+							if (current_hate > hate_client_type_in_range || m_frenzy[i]) {
 								hate_client_type_in_range = current_hate;
 								top_client_type_in_range  = m;
 							}
@@ -471,12 +514,10 @@ Mob *HateList::GetMobWithMostHateOnList(
 				current_hate += (current_hate * aggro_mod / 100);
 			}
 
-			if (current_hate > hate || cur->is_entity_frenzy) {
+			if (current_hate > hate || m_frenzy[i]) {
 				hate     = current_hate;
 				top_hate = m;
 			}
-
-			++iterator;
 		}
 
 		if (top_client_type_in_range && top_hate) {
@@ -515,34 +556,39 @@ Mob *HateList::GetMobWithMostHateOnList(
 			return top_hate ? top_hate : nullptr;
 		}
 	} else {
-		auto iterator      = list.begin();
-		int  skipped_count = 0;
-		while (iterator != list.end()) {
-			struct_HateList *cur = (*iterator);
-			if (cur) {
-				Mob *m = cur->entity_on_hatelist;
-
-				if (!m) {
-					++iterator;
-					continue;
-				}
+		// without frenzied entries the answer is the top row unless that one is being skipped
+		if (m_frenzy_count == 0) {
+			const int32 top = GetTopRow();
+			if (top == NOT_FOUND) {
+				return nullptr;
+			}
 
-				if (m == skip) {
-					++iterator;
-					continue;
-				}
+			Mob *m = m_entities[top];
+			if (m && m != skip && (!skip_mezzed || !m->IsMezzed())) {
+				return m_hate[top] > hate ? m : nullptr;
+			}
+		}
 
-				if (skip_mezzed && m->IsMezzed()) {
-					++iterator;
-					continue;
-				}
+		int skipped_count = 0;
+		for (size_t i = 0; i < m_entities.size(); ++i) {
+			Mob *m = m_entities[i];
 
-				if ((cur->stored_hate_amount > hate) || cur->is_entity_frenzy) {
-					top_hate = m;
-					hate     = cur->stored_hate_amount;
-				}
+			if (!m) {
+				continue;
+			}
+
+			if (m == skip) {
+				continue;
+			}
+
+			if (skip_mezzed && m->IsMezzed()) {
+				continue;
+			}
+
+			if ((m_hate[i] > hate) || m_frenzy[i]) {
+				top_hate = m;
+				hate     = m_hate[i];
 			}
-			++iterator;
 		}
 
 		if (!top_hate && skipped_count > 0) {
@@ -559,34 +605,33 @@ Mob *HateList::GetMobWithMostHateOnList(bool skip_mezzed){
 	Mob* top = nullptr;
 	int64 hate = -1;
 
-	auto iterator = list.begin();
-	while (iterator != list.end())
+	const int32 top_row = GetTopRow();
+	if (top_row == NOT_FOUND) {
+		return nullptr;
+	}
+
+	if (m_entities[top_row] && (!skip_mezzed || !m_entities[top_row]->IsMezzed())) {
+		return m_hate[top_row] > hate ? m_entities[top_row] : nullptr;
+	}
+
+	for (size_t i = 0; i < m_entities.size(); ++i)
 	{
-		struct_HateList *cur = (*iterator);
+		Mob *m = m_entities[i];
 
-		if (cur) {
+		if (m != nullptr && (m_hate[i] > hate))
+		{
 			LogHateDetail(
-				"Looping GetMobWithMostHateOnList1 [{}] cur [{}] hate [{}] calc [{}]",
-				cur->entity_on_hatelist->GetMobDescription(),
-				cur->stored_hate_amount,
-				hate,
-				(cur->stored_hate_amount > hate)
+				"Looping GetMobWithMostHateOnList [{}] hate [{}] top hate [{}]",
+				m->GetMobDescription(),
+				m_hate[i],
+				hate
 			);
 
-			if (cur->entity_on_hatelist != nullptr && (cur->stored_hate_amount > hate))
-			{
-				LogHateDetail(
-					"Looping GetMobWithMostHateOnList2 [{}]",
-					cur->entity_on_hatelist->GetMobDescription()
-				);
-
-				if (!skip_mezzed || !cur->entity_on_hatelist->IsMezzed()) {
-					top = cur->entity_on_hatelist;
-					hate = cur->stored_hate_amount;
-				}
+			if (!skip_mezzed || !m->IsMezzed()) {
+				top = m;
+				hate = m_hate[i];
 			}
 		}
-		++iterator;
 	}
 	return top;
 }
@@ -594,7 +639,7 @@ Mob *HateList::GetMobWithMostHateOnList(bool skip_mezzed){
 
 Mob *HateList::GetRandomMobOnHateList(EntityFilterType filter_type)
 {
-	const auto &l = GetFilteredHateList(filter_type);
+	const auto &l = GetFilteredRows(filter_type);
 
 	int count = l.size();
 	if (count <= 0) { // If we don't have any entries it'll crash getting a random 0, -1 position.
@@ -602,32 +647,12 @@ Mob *HateList::GetRandomMobOnHateList(EntityFilterType filter_type)
 	}
 
 	if (count == 1) { // No need to do all that extra work if we only have one hate entry
-		auto c = *l.begin();
-		if (c) {
-			Mob *m = c->entity_on_hatelist;
-			if (!m) {
-				return nullptr;
-			}
-
-			return m;
-		}
-
-		return nullptr;
+		return m_entities[l.front()];
 	}
 
-	auto r            = l.begin();
-	int  random_index = rand() % count;
-
-	std::advance(r, random_index);
-
-	auto e = *r;
-
-	Mob *m = e->entity_on_hatelist;
-	if (m) {
-		return m;
-	}
+	int random_index = rand() % count;
 
-	return nullptr;
+	return m_entities[l[random_index]];
 }
 
 Mob *HateList::GetEscapingMobOnHateList(Mob *center, float range, bool first) {
@@ -639,30 +664,30 @@ Mob *HateList::GetEscapingMobOnHateList(Mob *center, float range, bool first) {
 	Mob *escaping_mob = nullptr;
 	float mob_distance = 0.0f;
 
-	for (auto iter : list) {
-		if (!iter->entity_on_hatelist)
+	for (auto m : m_entities) {
+		if (!m)
 			continue;
 
-		if (!iter->entity_on_hatelist->IsFeared())
+		if (!m->IsFeared())
 			continue;
 
-		if (iter->entity_on_hatelist->IsRooted())
+		if (m->IsRooted())
 			continue;
-		if (iter->entity_on_hatelist->IsMezzed())
+		if (m->IsMezzed())
 			continue;
-		if (iter->entity_on_hatelist->IsStunned())
+		if (m->IsStunned())
 			continue;
 
-		float distance_test = DistanceSquared(center->GetPosition(), iter->entity_on_hatelist->GetPosition());
+		float distance_test = DistanceSquared(center->GetPosition(), m->GetPosition());
 
 		if (range > 0.0f && distance_test > range)
 			continue;
 
 		if (first)
-			return iter->entity_on_hatelist;
+			return m;
 
 		if (distance_test > mob_distance) {
-			escaping_mob = iter->entity_on_hatelist;
+			escaping_mob = m;
 			mob_distance = distance_test;
 		}
 	}
@@ -672,33 +697,29 @@ Mob *HateList::GetEscapingMobOnHateList(Mob *center, float range, bool first) {
 
 int64 HateList::GetEntHateAmount(Mob *in_entity, bool damage)
 {
-	struct_HateList *entity;
+	const int32 row = Find(in_entity);
 
-	entity = Find(in_entity);
-
-	if (entity && damage)
-		return entity->hatelist_damage;
-	else if (entity)
-		return entity->stored_hate_amount;
+	if (row != NOT_FOUND && damage)
+		return m_damage[row];
+	else if (row != NOT_FOUND)
+		return m_hate[row];
 	else
 		return 0;
 }
 
 bool HateList::IsHateListEmpty() {
-	return list.empty();
+	return m_entities.empty();
 }
 
 uint32 HateList::GetHateListCount(HateListCountType count_type)
 {
 	if (count_type == HateListCountType::All) {
-		return list.size();
+		return m_entities.size();
 	}
 
 	uint32 count = 0;
 
-	for (const auto& e : list) {
-		Mob* m = e->entity_on_hatelist;
-
+	for (auto m : m_entities) {
 		if (
 			m &&
 			(
@@ -716,7 +737,7 @@ uint32 HateList::GetHateListCount(HateListCountType count_type)
 
 void HateList::PrintHateListToClient(Client *c)
 {
-	if (list.size()) {
+	if (!m_entities.empty()) {
 		c->Message(
 			Chat::White,
 			fmt::format(
@@ -725,18 +746,17 @@ void HateList::PrintHateListToClient(Client *c)
 			).c_str()
 		);
 
-		auto entity_number = 1;
-		for (const auto& hate_entity : list) {
-			if (hate_entity->entity_on_hatelist) {
+		for (size_t i = 0; i < m_entities.size(); ++i) {
+			if (m_entities[i]) {
 				c->Message(
 					Chat::White,
 					fmt::format(
 						"Hate Entity {} | Name: {} ({}) Damage: {} Hate: {}",
-						entity_number,
-						hate_entity->entity_on_hatelist->GetName(),
-						hate_entity->entity_on_hatelist->GetID(),
-						hate_entity->hatelist_damage,
-						hate_entity->stored_hate_amount
+						i + 1,
+						m_entities[i]->GetName(),
+						m_entities[i]->GetID(),
+						m_damage[i],
+						m_hate[i]
 					).c_str()
 				);
 			} else {
@@ -744,14 +764,12 @@ void HateList::PrintHateListToClient(Client *c)
 					Chat::White,
 					fmt::format(
 						"Hate Entity {} | Damage: {} Hate: {}",
-						entity_number,
-						hate_entity->hatelist_damage,
-						hate_entity->stored_hate_amount
+						i + 1,
+						m_damage[i],
+						m_hate[i]
 					).c_str()
 				);
 			}
-
-			entity_number++;
 		}
 	} else {
 		c->Message(
@@ -772,24 +790,23 @@ int HateList::AreaRampage(Mob *caster, Mob *target, int count, ExtraAttackOption
 
 	// tank will be hit ONLY if they are the only target on the hate list
 	// if there is anyone else on the hate list, the tank will not be hit, even if those others aren't hit either
-	if (list.size() == 1) {
+	if (m_entities.size() == 1) {
 		caster->ProcessAttackRounds(target, opts);
 		return 1;
 	}
 
 	int hit_count = 0;
-	// This should prevent crashes if something dies (or mainly more than 1 thing goes away)
-	// This is a temp solution until the hate lists can be rewritten to not have that issue
+	// attacks can kill and remove haters, resolve by entity id once the targets are picked
 	std::vector<uint16> id_list;
-	for (auto &h : list) {
-		if (h->entity_on_hatelist && h->entity_on_hatelist != caster && h->entity_on_hatelist != target &&
-			caster->CombatRange(h->entity_on_hatelist, 1.0, true, opts)) {
+	for (auto m : m_entities) {
+		if (m && m != caster && m != target &&
+			caster->CombatRange(m, 1.0, true, opts)) {
 
-			if (RuleB(Custom, ConditionalPetRampageImmunity) && h->entity_on_hatelist->GetOwner() && h->entity_on_hatelist->GetOwner()->IsClient() && h->entity_on_hatelist->GetSpecialAbility(SpecialAbility::BeingAggroImmunity)) {
+			if (RuleB(Custom, ConditionalPetRampageImmunity) && m->GetOwner() && m->GetOwner()->IsClient() && m->GetSpecialAbility(SpecialAbility::BeingAggroImmunity)) {
 				continue;
 			}
 
-			id_list.push_back(h->entity_on_hatelist->GetID());
+			id_list.push_back(m->GetID());
 		}
 
 		if (count != -1 && id_list.size() > count) {
@@ -817,89 +834,95 @@ void HateList::SpellCast(Mob *caster, uint32 spell_id, float range, Mob* ae_cent
 	if (ae_center)
 		center = ae_center;
 
-	//this is slower than just iterating through the list but avoids
-	//crashes when people kick the bucket in the middle of this call
-	//that invalidates our iterator but there's no way to know sadly
-	//So keep a list of entity ids and look up after
-	std::list<uint32> id_list;
+	// spells can kill and remove haters, so keep a list of entity ids and look them up after
+	std::vector<uint32> id_list;
 	range = range * range;
 	float min_range2 = spells[spell_id].min_range * spells[spell_id].min_range;
 	float dist_targ = 0;
-	auto iterator = list.begin();
-	while (iterator != list.end())
+	for (auto m : m_entities)
 	{
-		struct_HateList *h = (*iterator);
+		if (!m) {
+			continue;
+		}
+
 		if (range > 0)
 		{
-			dist_targ = DistanceSquared(center->GetPosition(), h->entity_on_hatelist->GetPosition());
+			dist_targ = DistanceSquared(center->GetPosition(), m->GetPosition());
 			if (dist_targ <= range && dist_targ >= min_range2)
 			{
-				id_list.push_back(h->entity_on_hatelist->GetID());
-				h->entity_on_hatelist->CalcSpellPowerDistanceMod(spell_id, dist_targ);
+				id_list.push_back(m->GetID());
+				m->CalcSpellPowerDistanceMod(spell_id, dist_targ);
 			}
 		}
 		else
 		{
-			id_list.push_back(h->entity_on_hatelist->GetID());
-			h->entity_on_hatelist->CalcSpellPowerDistanceMod(spell_id, 0, caster);
+			id_list.push_back(m->GetID());
+			m->CalcSpellPowerDistanceMod(spell_id, 0, caster);
 		}
-		++iterator;
 	}
 
-	auto iter = id_list.begin();
-	while (iter != id_list.end())
+	for (auto id : id_list)
 	{
-		Mob *cur = entity_list.GetMobID((*iter));
+		Mob *cur = entity_list.GetMobID(id);
 		if (cur)
 		{
 			caster->SpellOnTarget(spell_id, cur);
 		}
-		iter++;
 	}
 }
 
 void HateList::RemoveStaleEntries(int time_ms, float dist)
 {
-	auto it = list.begin();
-
 	auto cur_time = Timer::GetCurrentTime();
 
 	auto dist2 = dist * dist;
 
-	while (it != list.end()) {
-		auto m = (*it)->entity_on_hatelist;
-		if (m) {
-			bool remove = false;
+	std::vector<Mob *> removals;
+
+	for (size_t i = 0; i < m_entities.size(); ++i) {
+		auto m = m_entities[i];
+		if (!m) {
+			continue;
+		}
+
+		bool remove = false;
+
+		if (cur_time - m_last_modified[i] > time_ms) {
+			remove = true;
+		}
 
-			if (cur_time - (*it)->last_modified > time_ms) {
+		if (!remove && DistanceSquaredNoZ(hate_owner->GetPosition(), m->GetPosition()) > dist2) {
+			m_oor_count[i]++;
+			if (m_oor_count[i] == 2) {
 				remove = true;
 			}
+		} else if (m_oor_count[i] != 0) {
+			m_oor_count[i] = 0;
+		}
 
-			if (!remove && DistanceSquaredNoZ(hate_owner->GetPosition(), m->GetPosition()) > dist2) {
-				(*it)->oor_count++;
-				if ((*it)->oor_count == 2) {
-					remove = true;
-				}
-			} else if ((*it)->oor_count != 0) {
-				(*it)->oor_count = 0;
-			}
+		if (remove) {
+			removals.emplace_back(m);
+		}
+	}
 
-			if (remove) {
-				if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
-					parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), m, "0", 0);
-				}
+	for (auto m : removals) {
+		if (Find(m) == NOT_FOUND) {
+			continue;
+		}
 
-				if (m->IsClient()) {
-					m->CastToClient()->DecrementAggroCount();
-					m->CastToClient()->RemoveXTarget(hate_owner, true);
-				}
+		if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
+			parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), m, "0", 0);
+		}
 
-				delete (*it);
-				it = list.erase(it);
-				continue;
-			}
+		if (m->IsClient()) {
+			m->CastToClient()->DecrementAggroCount();
+			m->CastToClient()->RemoveXTarget(hate_owner, true);
+		}
+
+		const int32 row = Find(m);
+		if (row != NOT_FOUND) {
+			EraseRow(row);
 		}
-		++it;
 	}
 }
 
@@ -909,9 +932,13 @@ void HateList::DamageHateList(int64 damage, uint32 distance, EntityFilterType fi
 		return;
 	}
 
-	const auto& l = GetFilteredHateList(filter_type, distance);
-	for (const auto& h : l) {
-		auto e = h->entity_on_hatelist;
+	// targets are picked up front, damage can kill and remove them from the list
+	std::vector<Mob *> targets;
+	for (auto row : GetFilteredRows(filter_type, distance)) {
+		targets.emplace_back(m_entities[row]);
+	}
+
+	for (auto e : targets) {
 		if (is_percentage) {
 			const auto damage_percentage = EQ::Clamp(damage, static_cast<int64>(1), static_cast<int64>(100));
 			const auto total_damage = (e->GetMaxHP() / 100) * damage_percentage;
@@ -922,12 +949,34 @@ void HateList::DamageHateList(int64 damage, uint32 distance, EntityFilterType fi
 	}
 }
 
-std::list<struct_HateList*> HateList::GetFilteredHateList(EntityFilterType filter_type, uint32 distance)
+std::vector<struct_HateList *> HateList::GetHateList()
+{
+	std::vector<struct_HateList *> l;
+	l.reserve(m_entities.size());
+
+	for (size_t i = 0; i < m_entities.size(); ++i) {
+		l.emplace_back(GetHandle(static_cast<int32>(i)));
+	}
+
+	return l;
+}
+
+std::vector<struct_HateList *> HateList::GetFilteredHateList(EntityFilterType filter_type, uint32 distance)
+{
+	std::vector<struct_HateList *> l;
+	for (auto row : GetFilteredRows(filter_type, distance)) {
+		l.emplace_back(GetHandle(row));
+	}
+
+	return l;
+}
+
+std::vector<int32> HateList::GetFilteredRows(EntityFilterType filter_type, uint32 distance) const
 {
-	std::list<struct_HateList*> l;
+	std::vector<int32> l;
 	const auto squared_distance = (distance * distance);
-	for (auto h : list) {
-		auto e = h->entity_on_hatelist;
+	for (size_t i = 0; i < m_entities.size(); ++i) {
+		auto e = m_entities[i];
 		if (!e) {
 			continue;
 		}
@@ -950,8 +999,177 @@ std::list<struct_HateList*> HateList::GetFilteredHateList(EntityFilterType filte
 			continue;
 		}
 
-		l.push_back(h);
+		l.emplace_back(static_cast<int32>(i));
 	}
 
 	return l;
 }
+
+void HateList::AddRow(Mob *m, int64 hate, int64 damage, bool is_frenzy)
+{
+	const auto   row = static_cast<int32>(m_entities.size());
+	const uint16 id  = m->GetID();
+
+	m_entities.emplace_back(m);
+	m_entity_ids.emplace_back(id);
+	m_hate.emplace_back(hate);
+	m_damage.emplace_back(damage);
+	m_last_modified.emplace_back(Timer::GetCurrentTime());
+	m_frenzy.emplace_back(is_frenzy ? 1 : 0);
+	m_oor_count.emplace_back(0);
+	m_handles.emplace_back(nullptr);
+
+	if (id) {
+		m_row_by_entity_id[id] = row;
+	}
+	else {
+		m_unindexed_rows++;
+	}
+
+	if (is_frenzy) {
+		m_frenzy_count++;
+	}
+
+	// appended last, so it only takes the top on strictly more hate
+	if (!m_top_dirty && (m_top_row == NOT_FOUND || hate > m_hate[m_top_row])) {
+		m_top_row = row;
+	}
+}
+
+void HateList::EraseRow(int32 row)
+{
+	const uint16 id = m_entity_ids[row];
+	if (id) {
+		auto it = m_row_by_entity_id.find(id);
+		if (it != m_row_by_entity_id.end() && it->second == row) {
+			m_row_by_entity_id.erase(it);
+		}
+	}
+	else if (m_unindexed_rows > 0) {
+		m_unindexed_rows--;
+	}
+
+	if (m_frenzy[row] && m_frenzy_count > 0) {
+		m_frenzy_count--;
+	}
+
+	m_entities.erase(m_entities.begin() + row);
+	m_entity_ids.erase(m_entity_ids.begin() + row);
+	m_hate.erase(m_hate.begin() + row);
+	m_damage.erase(m_damage.begin() + row);
+	m_last_modified.erase(m_last_modified.begin() + row);
+	m_frenzy.erase(m_frenzy.begin() + row);
+	m_oor_count.erase(m_oor_count.begin() + row);
+	m_handles.erase(m_handles.begin() + row);
+
+	// rows after the erased one moved up by one
+	for (size_t i = row; i < m_entity_ids.size(); ++i) {
+		if (m_entity_ids[i]) {
+			m_row_by_entity_id[m_entity_ids[i]] = static_cast<int32>(i);
+		}
+	}
+
+	if (m_entities.empty()) {
+		m_top_row   = NOT_FOUND;
+		m_top_dirty = false;
+	}
+	else if (row == m_top_row) {
+		m_top_dirty = true;
+	}
+	else if (row < m_top_row) {
+		m_top_row--;
+	}
+}
+
+void HateList::SetRowHate(int32 row, int64 hate)
+{
+	const int64 previous = m_hate[row];
+	m_hate[row] = hate;
+
+	if (m_top_dirty) {
+		return;
+	}
+
+	if (row == m_top_row) {
+		if (hate < previous) {
+			m_top_dirty = true;
+		}
+
+		return;
+	}
+
+	if (hate > m_hate[m_top_row] || (hate == m_hate[m_top_row] && row < m_top_row)) {
+		m_top_row = row;
+	}
+}
+
+void HateList::SetRowFrenzy(int32 row, bool is_frenzy)
+{
+	if (static_cast<bool>(m_frenzy[row]) == is_frenzy) {
+		return;
+	}
+
+	m_frenzy[row] = is_frenzy ? 1 : 0;
+
+	if (is_frenzy) {
+		m_frenzy_count++;
+	}
+	else if (m_frenzy_count > 0) {
+		m_frenzy_count--;
+	}
+}
+
+void HateList::SetRowEntity(int32 row, Mob *m)
+{
+	const uint16 previous_id = m_entity_ids[row];
+	if (previous_id) {
+		auto it = m_row_by_entity_id.find(previous_id);
+		if (it != m_row_by_entity_id.end() && it->second == row) {
+			m_row_by_entity_id.erase(it);
+		}
+	}
+	else if (m_unindexed_rows > 0) {
+		m_unindexed_rows--;
+	}
+
+	const uint16 id = m ? m->GetID() : 0;
+	if (id) {
+		m_row_by_entity_id[id] = row;
+	}
+	else {
+		m_unindexed_rows++;
+	}
+
+	m_entities[row]   = m;
+	m_entity_ids[row] = id;
+
+	if (m_handles[row]) {
+		m_handles[row]->entity = m;
+	}
+}
+
+int32 HateList::GetTopRow()
+{
+	if (m_top_dirty) {
+		m_top_row = NOT_FOUND;
+
+		for (size_t i = 0; i < m_hate.size(); ++i) {
+			if (m_top_row == NOT_FOUND || m_hate[i] > m_hate[m_top_row]) {
+				m_top_row = static_cast<int32>(i);
+			}
+		}
+
+		m_top_dirty = false;
+	}
+
+	return m_top_row;
+}
+
+struct_HateList *HateList::GetHandle(int32 row)
+{
+	if (!m_handles[row]) {
+		m_handles[row] = std::make_unique<struct_HateList>(this, m_entities[row]);
+	}
+
+	return m_handles[row].get();
+}
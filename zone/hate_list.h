@@ -21,19 +21,36 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 
 #include "../common/emu_constants.h"
 
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 class Client;
 class Group;
+class HateList;
 class Mob;
 class Raid;
 struct ExtraAttackOptions;
 
+// Handle to a row of a HateList, handed out by GetHateList() / GetFilteredHateList() and to Lua / Perl as HateEntry
+// Valid for as long as the entity stays on the list, reads and writes go straight to the owning table
 struct struct_HateList {
-	Mob    *entity_on_hatelist;
-	int64  hatelist_damage;
-	int64  stored_hate_amount;
-	bool   is_entity_frenzy;
-	int8   oor_count; // count on how long we've been out of range
-	uint32 last_modified; // we need to remove this if it gets higher than 10 mins
+	struct_HateList(HateList *owner, Mob *entity) : owner(owner), entity(entity) { }
+
+	Mob *GetEnt() const { return entity; }
+	void SetEnt(Mob *m);
+	int64 GetHate() const;
+	void SetHate(int64 value);
+	int64 GetDamage() const;
+	void SetDamage(int64 value);
+	bool GetFrenzy() const;
+	void SetFrenzy(bool value);
+
+private:
+	friend class HateList;
+
+	HateList *owner;
+	Mob      *entity;
 };
 
 enum class HateListCountType {
@@ -66,9 +83,9 @@ public:
 
 	int64 GetEntHateAmount(Mob *ent, bool in_damage = false);
 
-	std::list<struct_HateList *> &GetHateList() { return list; }
+	std::vector<struct_HateList *> GetHateList();
 
-	std::list<struct_HateList *> GetFilteredHateList(
+	std::vector<struct_HateList *> GetFilteredHateList(
 		EntityFilterType filter_type = EntityFilterType::All,
 		uint32 distance = 0
 	);
@@ -95,13 +112,43 @@ public:
 	void WipeHateList(bool npc_only = false);
 	void RemoveStaleEntries(int time_ms, float dist);
 
-
 protected:
-	struct_HateList* Find(Mob* m);
+	static const int32 NOT_FOUND = -1;
+
+	int32 Find(Mob* m) const;
+
 private:
-	std::list<struct_HateList *> list;
-	Mob                          *hate_owner;
+	friend struct struct_HateList;
+
+	// rows are kept in insertion order, target selection ties go to whoever got on the list first
+	void AddRow(Mob *m, int64 hate, int64 damage, bool is_frenzy);
+	void EraseRow(int32 row);
+	void SetRowHate(int32 row, int64 hate);
+	void SetRowFrenzy(int32 row, bool is_frenzy);
+	void SetRowEntity(int32 row, Mob *m);
+	int32 GetTopRow();
+	std::vector<int32> GetFilteredRows(EntityFilterType filter_type, uint32 distance = 0) const;
+	struct_HateList *GetHandle(int32 row);
+
+	// hate table, one column per field
+	std::vector<Mob *>                            m_entities;
+	std::vector<uint16>                           m_entity_ids;
+	std::vector<int64>                            m_hate;
+	std::vector<int64>                            m_damage;
+	std::vector<uint32>                           m_last_modified;
+	std::vector<uint8>                            m_frenzy;
+	std::vector<int8>                             m_oor_count;
+	std::vector<std::unique_ptr<struct_HateList>> m_handles; // created on demand
+
+	std::unordered_map<uint16, int32>             m_row_by_entity_id;
+	uint32                                        m_unindexed_rows = 0; // rows whose entity had no id yet
+	uint32                                        m_frenzy_count   = 0;
+
+	// first row holding the highest stored hate, recomputed only when the top row loses hate or leaves
+	int32                                         m_top_row   = NOT_FOUND;
+	bool                                          m_top_dirty = false;
+
+	Mob                                           *hate_owner;
 };
 
 #endif
-
@@ -1146,6 +1146,9 @@ void Client::DeleteItemInInventory(int16 slot_id, int16 quantity, bool client_up
 		LogDebug("DeleteItemInInventory([{}], [{}], [{}])", slot_id, quantity, (client_update) ? "true":"false");
 	#endif
 
+	// edible bonuses come from food and drink in the general slots, picked up by the next CalcBonuses
+	SetBonusLayersDirty(BonusLayer::Items);
+
 	// Added 'IsSlotValid(slot_id)' check to both segments of client packet processing.
 	// - cursor queue slots were slipping through and crashing client
 	if(!m_inv[slot_id]) {
@@ -1251,7 +1254,7 @@ bool Client::PutItemInInventory(int16 slot_id, const EQ::ItemInstance& inst, boo
 		SendWearChange(EQ::InventoryProfile::CalcMaterialFromSlot(slot_id));
 	}
 
-	CalcBonuses();
+	CalcBonusLayers(BonusLayer::Items);
 
 	if (slot_id == EQ::invslot::slotCursor) {
 		auto s = m_inv.cursor_cbegin(), e = m_inv.cursor_cend();
@@ -1333,7 +1336,7 @@ void Client::PutLootInInventory(int16 slot_id, const EQ::ItemInstance &inst, Loo
 		}
 	}
 
-	CalcBonuses();
+	CalcBonusLayers(BonusLayer::Items);
 }
 bool Client::TryStacking(EQ::ItemInstance* item, uint8 type, bool try_worn, bool try_cursor) {
 	if(!item || !item->IsStackable() || item->GetCharges()>=item->GetItem()->StackSize)
@@ -1347,7 +1350,7 @@ bool Client::TryStacking(EQ::ItemInstance* item, uint8 type, bool try_worn, bool
 		EQ::ItemInstance* tmp_inst = m_inv.GetItem(i);
 		if(tmp_inst && tmp_inst->GetItem()->ID == item_id && tmp_inst->GetCharges() < tmp_inst->GetItem()->StackSize){
 			MoveItemCharges(*item, i, type);
-			CalcBonuses();
+			CalcBonusLayers(BonusLayer::Items);
 			if (item->GetCharges()) { // we didn't get them all
 				return AutoPutLootInInventory(*item, try_worn, try_cursor, 0);
 			}
@@ -1364,7 +1367,7 @@ bool Client::TryStacking(EQ::ItemInstance* item, uint8 type, bool try_worn, bool
 
 			if(tmp_inst && tmp_inst->GetItem()->ID == item_id && tmp_inst->GetCharges() < tmp_inst->GetItem()->StackSize) {
 				MoveItemCharges(*item, slotid, type);
-				CalcBonuses();
+				CalcBonusLayers(BonusLayer::Items);
 				if (item->GetCharges()) { // we didn't get them all
 					return AutoPutLootInInventory(*item, try_worn, try_cursor, 0);
 				}
@@ -2561,7 +2564,7 @@ bool Client::SwapItem(MoveItem_Struct* move_in) {
 	}
 
 	// Step 8: Re-calc stats
-	CalcBonuses();
+	CalcBonusLayers(BonusLayer::Items);
 
 	ApplyWeaponsStance();
 
@@ -4014,7 +4017,7 @@ void Client::SetBandolier(const EQApplicationPacket *app)
 	}
 
 	// finally, recalculate any stat bonuses from the item change
-	CalcBonuses();
+	CalcBonusLayers(BonusLayer::Items);
 }
 
 bool Client::MoveItemToInventory(EQ::ItemInstance *ItemToReturn, bool UpdateClient) {
@@ -9,42 +9,42 @@
 
 Lua_Mob Lua_HateEntry::GetEnt() {
 	Lua_Safe_Call_Class(Lua_Mob);
-	return Lua_Mob(self->entity_on_hatelist);
+	return Lua_Mob(self->GetEnt());
 }
 
 void Lua_HateEntry::SetEnt(Lua_Mob e) {
 	Lua_Safe_Call_Void();
-	self->entity_on_hatelist = e;
+	self->SetEnt(e);
 }
 
 int64 Lua_HateEntry::GetDamage() {
 	Lua_Safe_Call_Int();
-	return self->hatelist_damage;
+	return self->GetDamage();
 }
 
 void Lua_HateEntry::SetDamage(int64 value) {
 	Lua_Safe_Call_Void();
-	self->hatelist_damage = value;
+	self->SetDamage(value);
 }
 
 int64 Lua_HateEntry::GetHate() {
 	Lua_Safe_Call_Int();
-	return self->stored_hate_amount;
+	return self->GetHate();
 }
 
 void Lua_HateEntry::SetHate(int64 value) {
 	Lua_Safe_Call_Void();
-	self->stored_hate_amount = value;
+	self->SetHate(value);
 }
 
 bool Lua_HateEntry::GetFrenzy() {
 	Lua_Safe_Call_Bool();
-	return self->is_entity_frenzy;
+	return self->GetFrenzy();
 }
 
 void Lua_HateEntry::SetFrenzy(bool value) {
 	Lua_Safe_Call_Void();
-	self->is_entity_frenzy = value;
+	self->SetFrenzy(value);
 }
 
 luabind::scope lua_register_hate_entry() {
@@ -11,6 +11,7 @@
 #include <algorithm>
 
 #include "../common/spdat.h"
+#include "../common/tick_profiler.h"
 #include "masterentity.h"
 #include "questmgr.h"
 #include "zone.h"
@@ -462,6 +463,8 @@ int LuaParser::EventGlobalNPC(QuestEventID evt, NPC* npc, Mob *init, std::string
 
 int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
 						 std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
+	TICK_PROFILE("LuaParser::EventNPC");
+
 	const char *sub_name = LuaEvents[evt];
 
 	int start = lua_gettop(L);
@@ -471,7 +474,7 @@ int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, M
 		PushErrorHandler(L);
 		if(l_func != nullptr) {
 			l_func->push(L);
-		} else {
+		} else if(!PushEventFunction(evt, package_name)) {
 			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
 			lua_getfield(L, -1, sub_name);
 			npop = 3;
@@ -557,6 +560,8 @@ int LuaParser::EventGlobalPlayer(QuestEventID evt, Client *client, std::string d
 
 int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *client, std::string data, uint32 extra_data,
 							std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
+	TICK_PROFILE("LuaParser::EventPlayer");
+
 	const char *sub_name = LuaEvents[evt];
 	int start = lua_gettop(L);
 
@@ -565,7 +570,7 @@ int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *
 		PushErrorHandler(L);
 		if(l_func != nullptr) {
 			l_func->push(L);
-		} else {
+		} else if(!PushEventFunction(evt, package_name)) {
 			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
 			lua_getfield(L, -1, sub_name);
 			npop = 3;
@@ -634,6 +639,8 @@ int LuaParser::EventItem(QuestEventID evt, Client *client, EQ::ItemInstance *ite
 
 int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob,
 						  std::string data, uint32 extra_data, std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
+	TICK_PROFILE("LuaParser::EventItem");
+
 	const char *sub_name = LuaEvents[evt];
 
 	int start = lua_gettop(L);
@@ -643,7 +650,7 @@ int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *cl
 		PushErrorHandler(L);
 		if(l_func != nullptr) {
 			l_func->push(L);
-		} else {
+		} else if(!PushEventFunction(evt, package_name)) {
 			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
 			lua_getfield(L, -1, sub_name);
 			npop = 3;
@@ -715,6 +722,8 @@ int LuaParser::EventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spe
 
 int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, std::string data, uint32 extra_data,
 						   std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
+	TICK_PROFILE("LuaParser::EventSpell");
+
 	const char *sub_name = LuaEvents[evt];
 
 	int start = lua_gettop(L);
@@ -724,7 +733,7 @@ int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob,
 		PushErrorHandler(L);
 		if(l_func != nullptr) {
 			l_func->push(L);
-		} else {
+		} else if(!PushEventFunction(evt, package_name)) {
 			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
 			lua_getfield(L, -1, sub_name);
 			npop = 3;
@@ -795,6 +804,8 @@ int LuaParser::EventEncounter(QuestEventID evt, std::string encounter_name, std:
 
 int LuaParser::_EventEncounter(std::string package_name, QuestEventID evt, std::string encounter_name, std::string data, uint32 extra_data,
 							   std::vector<std::any> *extra_pointers) {
+	TICK_PROFILE("LuaParser::EventEncounter");
+
 	const char *sub_name = LuaEvents[evt];
 
 	int start = lua_gettop(L);
@@ -852,8 +863,7 @@ bool LuaParser::HasQuestSub(uint32 npc_id, QuestEventID evt) {
 
 	std::string package_name = "npc_" + std::to_string(npc_id);
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return HasEventFunction(evt, package_name);
 }
 
 bool LuaParser::HasGlobalQuestSub(QuestEventID evt) {
@@ -862,8 +872,7 @@ bool LuaParser::HasGlobalQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "global_npc");
+	return HasEventFunction(evt, "global_npc");
 }
 
 bool LuaParser::PlayerHasQuestSub(QuestEventID evt) {
@@ -872,8 +881,7 @@ bool LuaParser::PlayerHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "player");
+	return HasEventFunction(evt, "player");
 }
 
 bool LuaParser::GlobalPlayerHasQuestSub(QuestEventID evt) {
@@ -882,8 +890,7 @@ bool LuaParser::GlobalPlayerHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "global_player");
+	return HasEventFunction(evt, "global_player");
 }
 
 bool LuaParser::SpellHasQuestSub(uint32 spell_id, QuestEventID evt) {
@@ -894,8 +901,7 @@ bool LuaParser::SpellHasQuestSub(uint32 spell_id, QuestEventID evt) {
 
 	std::string package_name = "spell_" + std::to_string(spell_id);
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return HasEventFunction(evt, package_name);
 }
 
 bool LuaParser::ItemHasQuestSub(EQ::ItemInstance *itm, QuestEventID evt) {
@@ -910,8 +916,7 @@ bool LuaParser::ItemHasQuestSub(EQ::ItemInstance *itm, QuestEventID evt) {
 	std::string package_name = "item_";
 	package_name += std::to_string(itm->GetID());
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return HasEventFunction(evt, package_name);
 }
 
 bool LuaParser::EncounterHasQuestSub(std::string encounter_name, QuestEventID evt) {
@@ -922,8 +927,7 @@ bool LuaParser::EncounterHasQuestSub(std::string encounter_name, QuestEventID ev
 
 	std::string package_name = "encounter_" + encounter_name;
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return HasEventFunction(evt, package_name);
 }
 
 void LuaParser::LoadNPCScript(std::string filename, int npc_id) {
@@ -984,6 +988,7 @@ void LuaParser::Init() {
 
 void LuaParser::ReloadQuests() {
 	loaded_.clear();
+	event_refs_.clear();
 	errors_.clear();
 	mods_.clear();
 	lua_encounter_events_registered.clear();
@@ -1211,6 +1216,7 @@ void LuaParser::LoadScript(std::string filename, std::string package_name) {
 	}
 	else {
 		loaded_[package_name] = true;
+		CacheEventFunctions(package_name);
 	}
 
 	auto end = lua_gettop(L);
@@ -1240,6 +1246,43 @@ bool LuaParser::HasFunction(std::string subname, std::string package_name) {
 	return false;
 }
 
+void LuaParser::CacheEventFunctions(const std::string &package_name) {
+	auto &refs = event_refs_[package_name];
+	refs.assign(_LargestEventID, LUA_NOREF);
+
+	lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
+
+	for(int i = 0; i < _LargestEventID; ++i) {
+		if(!LuaEvents[i]) {
+			continue;
+		}
+
+		lua_getfield(L, -1, LuaEvents[i]);
+		if(lua_isfunction(L, -1)) {
+			refs[i] = luaL_ref(L, LUA_REGISTRYINDEX);
+		} else {
+			lua_pop(L, 1);
+		}
+	}
+
+	lua_pop(L, 1);
+}
+
+bool LuaParser::HasEventFunction(QuestEventID evt, const std::string &package_name) {
+	auto iter = event_refs_.find(package_name);
+	return iter != event_refs_.end() && iter->second[evt] != LUA_NOREF;
+}
+
+bool LuaParser::PushEventFunction(QuestEventID evt, const std::string &package_name) {
+	auto iter = event_refs_.find(package_name);
+	if(iter == event_refs_.end() || iter->second[evt] == LUA_NOREF) {
+		return false;
+	}
+
+	lua_rawgeti(L, LUA_REGISTRYINDEX, iter->second[evt]);
+	return true;
+}
+
 bool LuaParser::HasEncounterSub(const std::string& package_name, QuestEventID evt)
 {
 	auto it = lua_encounter_events_registered.find(package_name);
@@ -1723,6 +1766,8 @@ int LuaParser::_EventBot(
 	std::vector<std::any> *extra_pointers,
 	luabind::adl::object *l_func
 ) {
+	TICK_PROFILE("LuaParser::EventBot");
+
 	const char *sub_name = LuaEvents[evt];
 	int start = lua_gettop(L);
 
@@ -1731,7 +1776,7 @@ int LuaParser::_EventBot(
 		PushErrorHandler(L);
 		if(l_func != nullptr) {
 			l_func->push(L);
-		} else {
+		} else if(!PushEventFunction(evt, package_name)) {
 			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
 			lua_getfield(L, -1, sub_name);
 			npop = 3;
@@ -1822,8 +1867,7 @@ bool LuaParser::BotHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "bot");
+	return HasEventFunction(evt, "bot");
 }
 
 bool LuaParser::GlobalBotHasQuestSub(QuestEventID evt) {
@@ -1832,8 +1876,7 @@ bool LuaParser::GlobalBotHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "global_bot");
+	return HasEventFunction(evt, "global_bot");
 }
 
 void LuaParser::LoadBotScript(std::string filename) {
@@ -1902,6 +1945,8 @@ int LuaParser::_EventMerc(
 	std::vector<std::any> *extra_pointers,
 	luabind::adl::object *l_func
 ) {
+	TICK_PROFILE("LuaParser::EventMerc");
+
 	const char *sub_name = LuaEvents[evt];
 	int start = lua_gettop(L);
 
@@ -1910,7 +1955,7 @@ int LuaParser::_EventMerc(
 		PushErrorHandler(L);
 		if(l_func != nullptr) {
 			l_func->push(L);
-		} else {
+		} else if(!PushEventFunction(evt, package_name)) {
 			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
 			lua_getfield(L, -1, sub_name);
 			npop = 3;
@@ -2009,8 +2054,7 @@ bool LuaParser::MercHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "merc");
+	return HasEventFunction(evt, "merc");
 }
 
 bool LuaParser::GlobalMercHasQuestSub(QuestEventID evt) {
@@ -2019,8 +2063,7 @@ bool LuaParser::GlobalMercHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "global_merc");
+	return HasEventFunction(evt, "global_merc");
 }
 
 void LuaParser::LoadMercScript(std::string filename) {
@@ -7,6 +7,7 @@
 #include <string>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <exception>
 
 #include "zone_config.h"
@@ -309,11 +310,16 @@ private:
 	);
 
 	void LoadScript(std::string filename, std::string package_name);
+	void CacheEventFunctions(const std::string &package_name);
+	bool HasEventFunction(QuestEventID evt, const std::string &package_name);
+	bool PushEventFunction(QuestEventID evt, const std::string &package_name);
 	void MapFunctions(lua_State *L);
 	QuestEventID ConvertLuaEvent(QuestEventID evt);
 
 	std::map<std::string, std::string> vars_;
 	std::map<std::string, bool> loaded_;
+	// registry refs to each loaded package's event handlers, LUA_NOREF where it has none
+	std::unordered_map<std::string, std::vector<int>> event_refs_;
 	std::vector<LuaMod> mods_;
 	lua_State *L;
 
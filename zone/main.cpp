@@ -23,6 +23,8 @@
 
 #include "../common/global_define.h"
 #include "../common/timer.h"
+#include "../common/event/timer_wheel.h"
+#include "../common/tick_profiler.h"
 #include "../common/eq_packet_structs.h"
 #include "../common/mutex.h"
 #include "../common/opcodemgr.h"
@@ -48,6 +50,7 @@
 #include "bot_command.h"
 #include "zonedb.h"
 #include "titles.h"
+#include "tradeskill_recipes.h"
 #include "guild_mgr.h"
 #include "task_manager.h"
 #include "quest_parser_collection.h"
@@ -85,9 +88,11 @@ extern volatile bool is_zone_loaded;
 #include "zone_event_scheduler.h"
 #include "../common/file.h"
 #include "../common/events/player_event_logs.h"
+#include "../common/database/database_write_queue.h"
 #include "../common/path_manager.h"
 #include "../common/database/database_update.h"
 #include "../common/skill_caps.h"
+#include "../common/bazaar_search_index.h"
 #include "zone_event_scheduler.h"
 #include "zone_cli.h"
 
@@ -109,9 +114,12 @@ ZoneEventScheduler    event_scheduler;
 WorldContentService   content_service;
 PathManager           path;
 PlayerEventLogs       player_event_logs;
+DatabaseWriteQueue    database_write_queue;
 DatabaseUpdate        database_update;
 SkillCaps             skill_caps;
 EvolvingItemsManager  evolving_items_manager;
+TradeskillRecipes     tradeskill_recipes;
+BazaarSearchIndex     bazaar_search_index;
 
 const SPDat_Spell_Struct* spells;
 int32 SPDAT_RECORDS = -1;
@@ -298,8 +306,13 @@ int main(int argc, char **argv)
 		EQ::InitializeDynamicLookups();
 	}
 
-	// command handler (no sidecar or test commands)
-	if (ZoneCLI::RanConsoleCommand(argc, argv) && !(ZoneCLI::RanSidecarCommand(argc, argv) || ZoneCLI::RanTestCommand(argc, argv))) {
+	TickProfiler::SetEnabled(RuleB(Zone, TickProfiler));
+
+	// command handler (no sidecar, test or benchmark commands)
+	if (
+		ZoneCLI::RanConsoleCommand(argc, argv) &&
+		!(ZoneCLI::RanSidecarCommand(argc, argv) || ZoneCLI::RanTestCommand(argc, argv) || ZoneCLI::RanBenchmarkCommand(argc, argv))
+	) {
 		LogSys.EnableConsoleLogging();
 		ZoneCLI::CommandHandler(argc, argv);
 	}
@@ -310,13 +323,19 @@ int main(int argc, char **argv)
 		->SetGMSayHandler(&Zone::GMSayHookCallBackProcess)
 		->StartFileLogs();
 
-	if (ZoneCLI::RanTestCommand(argc, argv)) {
+	if (ZoneCLI::RanTestCommand(argc, argv) || ZoneCLI::RanBenchmarkCommand(argc, argv)) {
 		LogSys.SilenceConsoleLogging();
 	}
 
 	player_event_logs.SetDatabase(&database)->Init();
 
+	database_write_queue.SetDatabase(&database);
+	if (RuleB(Zone, AsyncDatabaseWrites) && database_write_queue.Start(RuleI(Zone, AsyncDatabaseWriteQueueMax))) {
+		database_write_queue.SetStatsInterval(RuleI(Zone, AsyncDatabaseWriteStatsInterval));
+	}
+
 	skill_caps.SetContentDatabase(&content_db)->LoadSkillCaps();
+	bazaar_search_index.SetDatabase(&database);
 
 	const auto c = EQEmuConfig::get();
 	if (c->auto_database_updates) {
@@ -388,7 +407,7 @@ int main(int argc, char **argv)
 		LogError("Failed. But ignoring error and going on..");
 	}
 
-	if (!database.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells)) {
+	if (!database.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells, &spell_traits)) {
 		LogError("Loading spells failed!");
 		return 1;
 	}
@@ -492,9 +511,9 @@ int main(int argc, char **argv)
 	worldserver.Connect();
 	worldserver.SetScheduler(&event_scheduler);
 
-	// sidecar command handler
+	// sidecar, test and benchmark command handler (runs once the zone process is fully initialized)
 	if (ZoneCLI::RanConsoleCommand(argc, argv)
-		&& (ZoneCLI::RanSidecarCommand(argc, argv) || ZoneCLI::RanTestCommand(argc, argv))) {
+		&& (ZoneCLI::RanSidecarCommand(argc, argv) || ZoneCLI::RanTestCommand(argc, argv) || ZoneCLI::RanBenchmarkCommand(argc, argv))) {
 		LogSys.EnableConsoleLogging();
 		ZoneCLI::CommandHandler(argc, argv);
 	}
@@ -540,8 +559,11 @@ int main(int argc, char **argv)
 	std::unique_ptr<EQ::Net::WebsocketServer>          ws_server;
 
 	auto loop_fn = [&](EQ::Timer *t) {
+		TICK_PROFILE("Zone::Frame");
+
 		//Advance the timer to our current point in time
 		Timer::SetCurrentTime();
+		EQ::TimerWheel::Get().Advance(Timer::GetCurrentTime());
 
 		/**
 		 * Calculate frame time
@@ -572,6 +594,8 @@ int main(int argc, char **argv)
 			opts.daybreak_options.resend_delay_min    = RuleI(Network, ResendDelayMinMS);
 			opts.daybreak_options.resend_delay_max    = RuleI(Network, ResendDelayMaxMS);
 			opts.daybreak_options.outgoing_data_rate  = RuleR(Network, ClientDataRate);
+			opts.daybreak_options.batch_send          = RuleB(Network, BatchedDatagramIO);
+			opts.daybreak_options.batch_recv          = RuleB(Network, BatchedDatagramIO);
 			eqsm      = std::make_unique<EQ::Net::EQStreamManager>(opts);
 			eqsf_open = true;
 
@@ -588,7 +612,10 @@ int main(int argc, char **argv)
 		}
 
 		//give the stream identifier a chance to do its work....
-		stream_identifier.Process();
+		{
+			TICK_PROFILE("EQStreamIdentifier::Process");
+			stream_identifier.Process();
+		}
 
 		//check the stream identifier for any now-identified streams
 		while ((eqsi = stream_identifier.PopIdentified())) {
@@ -634,7 +661,10 @@ int main(int argc, char **argv)
 				entity_list.MobProcess();
 				entity_list.BeaconProcess();
 				entity_list.EncounterProcess();
-				event_scheduler.Process(zone, &content_service);
+				{
+					TICK_PROFILE("ZoneEventScheduler::Process");
+					event_scheduler.Process(zone, &content_service);
+				}
 
 				if (zone) {
 					if (!zone->Process()) {
@@ -649,6 +679,10 @@ int main(int argc, char **argv)
 		}
 
 		QServ->CheckForConnectState();
+		{
+			TICK_PROFILE("DatabaseWriteQueue::Process");
+			database_write_queue.Process();
+		}
 
 		if (InterserverTimer.Check()) {
 			InterserverTimer.Start();
@@ -680,6 +714,9 @@ int main(int argc, char **argv)
 	if (zone != 0) {
 		zone->Shutdown(true);
 	}
+
+	// commits anything still queued before the connection goes away
+	database_write_queue.Stop();
 	//Fix for Linux world server problem.
 	safe_delete(task_manager);
 	safe_delete(npc_scale_manager);
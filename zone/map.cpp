@@ -261,6 +261,14 @@ bool Map::CheckLoS(glm::vec3 myloc, glm::vec3 oloc) const {
 	return !imp->rm->raycast((const RmReal*)&myloc, (const RmReal*)&oloc, nullptr, nullptr, nullptr);
 }
 
+// thread safe variant of CheckLoS, used by the parallel AI prepare phase
+bool Map::CheckLoSReadOnly(glm::vec3 myloc, glm::vec3 oloc) const {
+	if(!imp)
+		return false;
+
+	return !imp->rm->raycastReadOnly((const RmReal*)&myloc, (const RmReal*)&oloc, nullptr, nullptr);
+}
+
 // returns true if a collision happens
 bool Map::DoCollisionCheck(glm::vec3 myloc, glm::vec3 oloc, glm::vec3 &outnorm, float &distance) const {
 	if(!imp)
@@ -269,6 +277,92 @@ bool Map::DoCollisionCheck(glm::vec3 myloc, glm::vec3 oloc, glm::vec3 &outnorm,
 	return imp->rm->raycast((const RmReal*)&myloc, (const RmReal*)&oloc, nullptr, (RmReal *)&outnorm, (RmReal *)&distance);
 }
 
+void Map::CheckLoSBatch(const glm::vec3 *from, const glm::vec3 *to, uint8 *los, size_t count) const {
+	if (!imp) {
+		std::fill(los, los + count, 0);
+		return;
+	}
+
+	imp->rm->raycastBatch(count, (const RmReal*)from, (const RmReal*)to, los, nullptr, nullptr);
+
+	for (size_t i = 0; i < count; ++i) {
+		los[i] = !los[i];
+	}
+}
+
+void Map::LineIntersectsZoneBatch(const glm::vec3 *start, const glm::vec3 *end, uint8 *hit, glm::vec3 *result, size_t count) const {
+	if (!imp) {
+		std::fill(hit, hit + count, 0);
+		return;
+	}
+
+	imp->rm->raycastBatch(count, (const RmReal*)start, (const RmReal*)end, hit, (RmReal*)result, nullptr);
+}
+
+void Map::FindBestZBatch(glm::vec3 *start, float *best_z, size_t count) const {
+	if (!imp) {
+		std::fill(best_z, best_z + count, BEST_Z_INVALID);
+		return;
+	}
+
+	const float adjust = RuleI(Map, FindBestZHeightAdjust);
+
+	std::vector<glm::vec3> to(count);
+	std::vector<glm::vec3> result(count);
+	std::vector<uint8>     hit(count);
+
+	for (size_t i = 0; i < count; ++i) {
+		start[i].z += adjust;
+		to[i] = glm::vec3(start[i].x, start[i].y, BEST_Z_INVALID);
+	}
+
+	imp->rm->raycastBatch(count, (const RmReal*)start, (const RmReal*)to.data(), hit.data(), (RmReal*)result.data(), nullptr);
+
+	// whatever found no floor below looks for the nearest Z above, as FindBestZ does
+	std::vector<size_t> above;
+	for (size_t i = 0; i < count; ++i) {
+		if (hit[i] && (zone->newzone_data.underworld == 0.0f || result[i].z >= zone->newzone_data.underworld)) {
+			best_z[i] = result[i].z;
+			continue;
+		}
+
+		best_z[i] = BEST_Z_INVALID;
+		above.emplace_back(i);
+	}
+
+	if (above.empty()) {
+		return;
+	}
+
+	std::vector<glm::vec3> from(above.size());
+	to.resize(above.size());
+	for (size_t i = 0; i < above.size(); ++i) {
+		from[i] = start[above[i]];
+		to[i]   = glm::vec3(from[i].x, from[i].y, -BEST_Z_INVALID);
+	}
+
+	imp->rm->raycastBatch(above.size(), (const RmReal*)from.data(), (const RmReal*)to.data(), hit.data(), (RmReal*)result.data(), nullptr);
+
+	for (size_t i = 0; i < above.size(); ++i) {
+		if (hit[i] && (zone->newzone_data.max_z == 0.0f || result[i].z <= zone->newzone_data.max_z)) {
+			best_z[above[i]] = result[i].z;
+		}
+	}
+}
+
+void Map::GetBounds(glm::vec3 &min, glm::vec3 &max) const {
+	if (!imp) {
+		min = max = glm::vec3(0.0f);
+		return;
+	}
+
+	const RmReal *bmin = imp->rm->getBoundMin();
+	const RmReal *bmax = imp->rm->getBoundMax();
+
+	min = glm::vec3(bmin[0], bmin[1], bmin[2]);
+	max = glm::vec3(bmax[0], bmax[1], bmax[2]);
+}
+
 Map *Map::LoadMapFile(std::string file) {
 	std::transform(file.begin(), file.end(), file.begin(), ::tolower);
 	std::string filename = fmt::format("{}/base/{}.map", path.GetMapsPath(), file);
@@ -287,10 +381,21 @@ Map *Map::LoadMapFile(std::string file) {
 #ifdef USE_MAP_MMFS
 bool Map::Load(std::string filename, bool force_mmf_overwrite)
 {
+	if (LoadMapped(filename)) {
+		return true;
+	}
+
 	if (LoadMMF(filename, force_mmf_overwrite)) {
 		LogInfo("Loaded .MMF Map File in place of [{}]", filename.c_str());
 		return true;
 	}
+
+	if (!LoadSource(filename)) {
+		return false;
+	}
+
+	return SaveMMF(filename, force_mmf_overwrite);
+}
 #else
 
 /**
@@ -299,7 +404,16 @@ bool Map::Load(std::string filename, bool force_mmf_overwrite)
  */
 bool Map::Load(const std::string &filename)
 {
+	if (LoadMapped(filename)) {
+		return true;
+	}
+
+	return LoadSource(filename);
+}
 #endif /*USE_MAP_MMFS*/
+
+bool Map::LoadSource(const std::string &filename)
+{
 	LogInfo("Loading Map with Filename: [{}]", filename);
 	FILE *map_file = fopen(filename.c_str(), "rb");
 	if (map_file) {
@@ -320,11 +434,6 @@ bool Map::Load(const std::string &filename)
 				LogError("Failed to load V1 Map File [{}]", filename.c_str());
 			}
 
-#ifdef USE_MAP_MMFS
-			if (loaded_map_file)
-				return SaveMMF(filename, force_mmf_overwrite);
-#endif /*USE_MAP_MMFS*/
-
 			return loaded_map_file;
 		}
 		else if (version == 0x02000000) {
@@ -338,11 +447,6 @@ bool Map::Load(const std::string &filename)
 				LogError("Failed to load V2 Map File [{}]", filename.c_str());
 			}
 
-#ifdef USE_MAP_MMFS
-			if (loaded_map_file)
-				return SaveMMF(filename, force_mmf_overwrite);
-#endif /*USE_MAP_MMFS*/
-
 			return loaded_map_file;
 		}
 		else {
@@ -355,6 +459,94 @@ bool Map::Load(const std::string &filename)
 	return false;
 }
 
+std::string Map::GetMappedFileName(const std::string &filename)
+{
+	std::string mapped_file_name = filename;
+
+	auto ext_off = mapped_file_name.rfind(".map");
+	if (ext_off != std::string::npos) {
+		mapped_file_name.erase(ext_off);
+	}
+
+	return mapped_file_name + ".rmesh";
+}
+
+// size and write time of the .map, a mapped mesh records the ones it was built from
+static bool GetMapSourceStamp(const std::string &filename, uint64 &source_size, int64 &source_mtime)
+{
+	std::error_code ec;
+
+	source_size = fs::file_size(filename, ec);
+	if (ec) {
+		return false;
+	}
+
+	auto write_time = fs::last_write_time(filename, ec);
+	if (ec) {
+		return false;
+	}
+
+	source_mtime = static_cast<int64>(write_time.time_since_epoch().count());
+
+	return true;
+}
+
+bool Map::LoadMapped(const std::string &filename)
+{
+	const std::string mapped_file_name = GetMappedFileName(filename);
+	if (!File::Exists(mapped_file_name)) {
+		return false;
+	}
+
+	// without the .map there is nothing to compare against, the mapped mesh is all there is
+	uint64 source_size  = 0;
+	int64  source_mtime = 0;
+	if (!GetMapSourceStamp(filename, source_size, source_mtime)) {
+		source_size  = 0;
+		source_mtime = 0;
+	}
+
+	auto rm = mapRaycastMesh(mapped_file_name, source_size, source_mtime);
+	if (!rm) {
+		return false;
+	}
+
+	if (imp) {
+		imp->rm->release();
+	}
+	else {
+		imp = new impl;
+	}
+
+	imp->rm = rm;
+
+	LogInfo("Mapped [{}] in place of [{}]", mapped_file_name, filename);
+
+	return true;
+}
+
+bool Map::SaveMapped(const std::string &filename) const
+{
+	if (!imp || !imp->rm) {
+		return false;
+	}
+
+	uint64 source_size  = 0;
+	int64  source_mtime = 0;
+	if (!GetMapSourceStamp(filename, source_size, source_mtime)) {
+		LogError("Failed to stat Map File [{}]", filename);
+		return false;
+	}
+
+	const std::string mapped_file_name = GetMappedFileName(filename);
+	if (!writeMappedRaycastMesh(imp->rm, mapped_file_name, source_size, source_mtime)) {
+		LogError("Failed to write mapped mesh [{}]", mapped_file_name);
+		return false;
+	}
+
+	return true;
+}
+
 bool Map::LoadV1(FILE *f) {
 	uint32 face_count;
 	uint16 node_count;
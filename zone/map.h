@@ -44,21 +44,37 @@ public:
 	bool LineIntersectsZone(glm::vec3 start, glm::vec3 end, float step, glm::vec3 *result) const;
 	bool LineIntersectsZoneNoZLeaps(glm::vec3 start, glm::vec3 end, float step_mag, glm::vec3 *result) const;
 	bool CheckLoS(glm::vec3 myloc, glm::vec3 oloc) const;
+	bool CheckLoSReadOnly(glm::vec3 myloc, glm::vec3 oloc) const;
 	bool DoCollisionCheck(glm::vec3 myloc, glm::vec3 oloc, glm::vec3 &outnorm, float &distance) const;
 
+	// batched forms, every ray gets the answer the single call would give it but the rays are cast in packets. They
+	// only read the map so they may be called from worker threads. Like FindBestZ, FindBestZBatch raises each start
+	// by Map:FindBestZHeightAdjust.
+	void CheckLoSBatch(const glm::vec3 *from, const glm::vec3 *to, uint8 *los, size_t count) const;
+	void LineIntersectsZoneBatch(const glm::vec3 *start, const glm::vec3 *end, uint8 *hit, glm::vec3 *result, size_t count) const;
+	void FindBestZBatch(glm::vec3 *start, float *best_z, size_t count) const;
+	void GetBounds(glm::vec3 &min, glm::vec3 &max) const;
+
 #ifdef USE_MAP_MMFS
 	bool Load(std::string filename, bool force_mmf_overwrite = false);
 #else
 	bool Load(const std::string& filename);
 #endif
 
+	// loads the .map itself, never the mapped or .mmf copies
+	bool LoadSource(const std::string &filename);
+	// writes the loaded mesh next to the .map so later loads map it in place
+	bool SaveMapped(const std::string &filename) const;
+
 	static Map *LoadMapFile(std::string file);
+	static std::string GetMappedFileName(const std::string &filename);
 private:
 	void RotateVertex(glm::vec3 &v, float rx, float ry, float rz);
 	void ScaleVertex(glm::vec3 &v, float sx, float sy, float sz);
 	void TranslateVertex(glm::vec3 &v, float tx, float ty, float tz);
 	bool LoadV1(FILE *f);
 	bool LoadV2(FILE *f);
+	bool LoadMapped(const std::string &filename);
 
 #ifdef USE_MAP_MMFS
 	bool LoadMMF(const std::string& map_file_name, bool force_mmf_overwrite);
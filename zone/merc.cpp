@@ -10,6 +10,7 @@
 #include "zone.h"
 #include "string_ids.h"
 #include "../common/skill_caps.h"
+#include "../common/tick_profiler.h"
 
 extern volatile bool is_zone_loaded;
 
@@ -90,6 +91,10 @@ Merc::~Merc() {
 
 void Merc::CalcBonuses()
 {
+	TICK_PROFILE("Merc::CalcBonuses");
+
+	InvalidateFocusCache();
+
 	memset(&itembonuses, 0, sizeof(StatBonuses));
 	memset(&aabonuses, 0, sizeof(StatBonuses));
 	CalcItemBonuses(&itembonuses);
@@ -932,6 +937,8 @@ void Merc::AI_Process() {
 	if(!IsAIControlled())
 		return;
 
+	TICK_PROFILE("Merc::AI_Process");
+
 	if(IsCasting())
 		return;
 
@@ -3754,6 +3754,7 @@ void Mob::GMMove(float x, float y, float z, float heading, bool save_guard_spot)
 	m_Position.y = y;
 	m_Position.z = z;
 	SetHeading(heading);
+	entity_list.GetSpatialGrid().Update(this);
 	mMovementManager->SendCommandToClients(this, 0.0, 0.0, 0.0, 0.0, 0, ClientRangeAny);
 
 	if (IsNPC() && save_guard_spot) {
@@ -3766,6 +3767,7 @@ void Mob::GMMove(const glm::vec4 &position, bool save_guard_spot) {
 	m_Position.y = position.y;
 	m_Position.z = position.z;
 	SetHeading(position.w);
+	entity_list.GetSpatialGrid().Update(this);
 	mMovementManager->SendCommandToClients(this, 0.0, 0.0, 0.0, 0.0, 0, ClientRangeAny);
 
 	if (IsNPC() && save_guard_spot) {
@@ -8545,8 +8547,8 @@ void Mob::CopyHateList(Mob* to) {
 	}
 
 	for (const auto& h : hate_list.GetHateList()) {
-		if (h->entity_on_hatelist) {
-			to->AddToHateList(h->entity_on_hatelist, h->stored_hate_amount, h->hatelist_damage);
+		if (h->GetEnt()) {
+			to->AddToHateList(h->GetEnt(), h->GetHate(), h->GetDamage());
 		}
 	}
 }
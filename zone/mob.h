@@ -38,6 +38,7 @@
 #include <memory>
 
 #include "heal_rotation.h"
+#include "parallel_ai.h"
 
 char* strn0cpy(char* dest, const char* source, uint32 size);
 
@@ -65,6 +66,14 @@ namespace DeathSave {
     constexpr uint32 HP8000 = 2;
 }
 
+// inputs CalcBonuses recomputes, a caller that knows only some of them changed can skip the others
+namespace BonusLayer {
+	constexpr uint8 Items  = 1 << 0; // worn, augments, tribute, heroic and edible
+	constexpr uint8 Spells = 1 << 1; // buffs
+	constexpr uint8 AAs    = 1 << 2;
+	constexpr uint8 All    = Items | Spells | AAs;
+}
+
 enum class eSpecialAttacks : int {
 	None,
 	Rampage,
@@ -353,6 +362,7 @@ public:
 		uint8 WornType = 0, int32 ticsremaining = 0, int buffslot = -1, int instrument_mod = 10,
 		bool IsAISpellEffect = false, uint16 effect_id = 0, int32 se_base = 0, int32 se_limit = 0, int32 se_max = 0);
 	void NegateSpellEffectBonuses(uint16 spell_id);
+	void NegateBuffBonuses();
 	bool NegateSpellEffect(uint16 spell_id, int effect_id);
 	float GetActSpellRange(uint16 spell_id, float range);
 	int64 GetActSpellDamage(uint16 spell_id, int64 value, Mob* target = nullptr);
@@ -824,9 +834,10 @@ public:
 	void ClearFeignMemory();
 	bool IsOnFeignMemory(Mob *attacker) const;
 	void PrintHateListToClient(Client *who) { hate_list.PrintHateListToClient(who); }
-	std::list<struct_HateList*>& GetHateList() { return hate_list.GetHateList(); }
+	std::vector<struct_HateList*> GetHateList() { return hate_list.GetHateList(); }
 	bool CheckLosFN(Mob* other);
 	bool CheckLosFN(float posX, float posY, float posZ, float mobSize);
+	void GetLosEndpoints(float posX, float posY, float posZ, float mobSize, glm::vec3 &myloc, glm::vec3 &oloc);
 	static bool CheckLosFN(glm::vec3 posWatcher, float sizeWatcher, glm::vec3 posTarget, float sizeTarget);
 	virtual bool CheckWaterLoS(Mob* m);
 	bool CheckPositioningLosFN(Mob* other, float posX, float posY, float posZ);
@@ -837,7 +848,7 @@ public:
 	inline bool CheckLastLosState() const { return last_los_check; }
 	std::string GetMobDescription();
 
-	std::list<struct_HateList*> GetFilteredHateList(
+	std::vector<struct_HateList*> GetFilteredHateList(
 		EntityFilterType filter_type = EntityFilterType::All,
 		uint32 distance = 0
 	) {
@@ -1039,6 +1050,31 @@ public:
 	bool PassCharmTargetRestriction(Mob *target);
 	bool CanFocusUseRandomEffectivenessByType(focusType type);
 	int GetFocusRandomEffectivenessValue(int focus_base, int focus_base2, bool best_focus = 0);
+
+	// item, AA and worn parts of GetFocusEffect for one focus type and spell, buff foci are always checked live
+	static constexpr size_t MAX_FOCUS_CACHE_ENTRIES = 2048;
+
+	struct FocusCacheEntry {
+		int64               item_total;
+		int64               item_best;          // random effectiveness: best_focus value the item was picked on
+		uint16              item_focus_id;      // random effectiveness: rolled again on every cast
+		const EQ::ItemData* item;               // named in the focus message
+		int64               aa_total;
+		int64               worn_total;
+		bool                rand_effectiveness;
+	};
+
+	struct FocusCacheStats {
+		uint64 hits;
+		uint64 misses;
+		uint64 uncacheable;
+		uint64 invalidations;
+	};
+
+	inline const std::unordered_map<uint32, FocusCacheEntry>& GetFocusCache() const { return m_focus_cache; }
+	inline const FocusCacheStats& GetFocusCacheStats() const { return m_focus_cache_stats; }
+	inline void ResetFocusCacheStats() { m_focus_cache_stats = FocusCacheStats{}; }
+	void InvalidateFocusCache();
 	int GetHealRate() const { return itembonuses.HealRate + spellbonuses.HealRate + aabonuses.HealRate; }
 	int GetMemoryBlurChance(int base_chance);
 	inline bool HasBaseEffectFocus() const { return (spellbonuses.FocusEffects[focusFcBaseEffects] || aabonuses.FocusEffects[focusFcBaseEffects] || itembonuses.FocusEffects[focusFcBaseEffects]); }
@@ -1308,6 +1344,7 @@ public:
 	float				GetZOffset() const;
 	float               GetDefaultRaceSize(int race_id = -1, int gender_id = -1) const;
 	void 				FixZ(int32 z_find_offset = 5, bool fix_client_z = false);
+	static void			FixZBatch(const std::vector<Mob *> &mobs, int32 z_find_offset = 5);
 	float				GetFixedZ(const glm::vec3 &destination, int32 z_find_offset = 5);
 	virtual int			GetStuckBehavior() const { return 0; }
 
@@ -1339,6 +1376,7 @@ public:
 	void SetLooting(uint16 val) { entity_id_being_looted = val; }
 
 	bool CheckWillAggro(Mob *mob);
+	bool CheckWillAggroExceptLoS(Mob *mob);
 	bool IsPetAggroExempt(Mob *pet_owner);
 
 	void InstillDoubt(Mob *who);
@@ -1413,6 +1451,12 @@ public:
 	virtual const bool IsUnderwaterOnly() const { return false; }
 	inline bool IsTrackable() const { return(trackable); }
 	Timer* GetAIThinkTimer() { return AI_think_timer.get(); }
+
+	// parallel AI prepare phase, see parallel_ai.h
+	bool IsAIPrepareCandidate();
+	static void PrepareAIIntents(Mob *const *mobs, size_t count, uint64 frame);
+	inline const MobAIIntent &GetAIIntent() const { return m_ai_intent; }
+	Mob *GetPreparedTopHate();
 	Timer* GetAIMovementTimer() { return AI_movement_timer.get(); }
 	Timer GetAttackTimer() { return attack_timer; }
 	Timer GetAttackDWTimer() { return attack_dw_timer; }
@@ -1489,6 +1533,8 @@ public:
 	void ExpendAlternateAdvancementCharge(uint32 aa_id);
 	void CalcAABonuses(StatBonuses* newbon);
 	int64 CalcAAFocus(focusType type, const AA::Rank &rank, uint16 spell_id);
+	bool CanCacheFocus(focusType type, bool rand_effectiveness);
+	FocusCacheEntry CalcCacheableFocus(focusType type, uint16 spell_id, bool rand_effectiveness);
 	void ApplyAABonuses(const AA::Rank &rank, StatBonuses* newbon);
 	bool CheckAATimer(int timer);
 
@@ -1699,6 +1745,8 @@ protected:
 	bool spawned;
 	void CalcSpellBonuses(StatBonuses* newbon);
 	virtual void CalcBonuses();
+	void CalcBonusLayers(uint8 layers);
+	inline void SetBonusLayersDirty(uint8 layers) { m_dirty_bonus_layers |= layers; }
 	void TrySkillProc(Mob *on, EQ::skills::SkillType skill, uint16 ReuseTime, bool Success = false, uint16 hand = 0, bool IsDefensive = false); // hand if 0 means its a skill ability for proc rate checks, otherwise hand is passed.
 	bool PassLimitToSkill(EQ::skills::SkillType skill, int32 spell_id, int proc_type, int aa_id=0);
 	bool PassLimitClass(uint32 Classes_, uint16 Class_);
@@ -1718,6 +1766,8 @@ protected:
 	void CalculateNewFearpoint();
 	float FindGroundZ(float new_x, float new_y, float z_offset=0.0);
 	float FindDestGroundZ(glm::vec3 dest, float z_offset=0.0);
+	bool CanFixZ(bool fix_client_z);
+	void ApplyFixedZ(float new_z);
 
 	virtual float GetSympatheticProcChances(uint16 spell_id, int16 ProcRateMod, int32 ItemProcRate = 0);
 	int16 GetSympatheticSpellProcRate(uint16 spell_id);
@@ -1761,6 +1811,15 @@ protected:
 	Timer focusproclimit_timer[MAX_FOCUS_PROC_LIMIT_TIMERS];	//SPA 511
 	int32 focusproclimit_spellid[MAX_FOCUS_PROC_LIMIT_TIMERS];	//SPA 511
 
+	// keyed on focus type << 16 | spell id, cleared by CalcBonuses
+	std::unordered_map<uint32, FocusCacheEntry> m_focus_cache;
+	FocusCacheStats                             m_focus_cache_stats{};
+	bool                                        m_focus_cache_volatile = false; // set when a focus hit a timer or side effect
+
+	// layers the next CalcBonuses recomputes, everything unless called through CalcBonusLayers
+	uint8 m_calc_bonus_layers  = BonusLayer::All;
+	uint8 m_dirty_bonus_layers = 0;
+
 	Timer spell_proclimit_timer[MAX_PROC_LIMIT_TIMERS];			//SPA 512
 	int32 spell_proclimit_spellid[MAX_PROC_LIMIT_TIMERS];		//SPA 512
 	Timer ranged_proclimit_timer[MAX_PROC_LIMIT_TIMERS];		//SPA 512
@@ -1894,6 +1953,7 @@ protected:
 	std::unique_ptr<Timer> AI_scan_door_open_timer;
 	uint32 time_until_can_move;
 	HateList hate_list;
+	MobAIIntent m_ai_intent;
 	std::set<uint32> feign_memory_list;
 	// This is to keep track of the current (one only) faction mod (alliance)
 	uint32 current_alliance_faction;
@@ -20,6 +20,7 @@
 #include "../common/features.h"
 #include "../common/rulesys.h"
 #include "../common/strings.h"
+#include "../common/tick_profiler.h"
 
 #include "client.h"
 #include "entity.h"
@@ -969,6 +970,85 @@ void Mob::ProcessForcedMovement()
 	}
 }
 
+// true when this mob's AI will select a hate target this tick and nothing in that selection has side effects
+bool Mob::IsAIPrepareCandidate()
+{
+	if (!IsNPC() || IsMerc() || !IsAIControlled() || !AI_think_timer || !AI_target_check_timer) {
+		return false;
+	}
+
+	if (!(AI_think_timer->Check(false) || attack_timer.Check(false))) {
+		return false;
+	}
+
+	if (IsCasting() || !IsEngaged() || !zone->CanDoCombat() || IsPetStop() || IsPetRegroup()) {
+		return false;
+	}
+
+	if (currently_fleeing || IsRooted() || IsBlind() || !AI_target_check_timer->Check(false)) {
+		return false;
+	}
+
+	// CombatRange() flips pseudo root for chase distance NPCs, leave those to the serial phase
+	return !GetSpecialAbility(SpecialAbility::NPCChaseDistance);
+}
+
+// runs on a parallel AI worker, must only read shared state and write the intents of the mobs it was handed
+void Mob::PrepareAIIntents(Mob *const *mobs, size_t count, uint64 frame)
+{
+	std::vector<Mob *>     casting;
+	std::vector<glm::vec3> los_from;
+	std::vector<glm::vec3> los_to;
+
+	for (size_t i = 0; i < count; ++i) {
+		Mob *m = mobs[i];
+
+		MobAIIntent intent{};
+
+		intent.frame    = frame;
+		intent.top_hate = m->hate_list.GetMobWithMostHateOnList(m);
+
+		Mob *t = (m->IsFocused() && m->target) ? m->target : intent.top_hate;
+		if (t && zone->zonemap) {
+			m->GetLosEndpoints(t->GetX(), t->GetY(), t->GetZ(), t->GetSize(), intent.los_from, intent.los_to);
+
+			casting.emplace_back(m);
+			los_from.emplace_back(intent.los_from);
+			los_to.emplace_back(intent.los_to);
+		}
+
+		m->m_ai_intent = intent;
+	}
+
+	if (casting.empty()) {
+		return;
+	}
+
+	// every sight line of the chunk in one batch
+	std::vector<uint8> los(casting.size());
+	zone->zonemap->CheckLoSBatch(los_from.data(), los_to.data(), los.data(), casting.size());
+
+	for (size_t i = 0; i < casting.size(); ++i) {
+		casting[i]->m_ai_intent.los     = los[i];
+		casting[i]->m_ai_intent.has_los = true;
+	}
+}
+
+Mob *Mob::GetPreparedTopHate()
+{
+	// the prepared pick is only trusted while it is still on our hate list, earlier mobs in the serial phase may have
+	// killed or wiped it
+	if (
+		m_ai_intent.frame == entity_list.GetParallelAI().GetFrame() &&
+		m_ai_intent.top_hate &&
+		hate_list.IsEntOnHateList(m_ai_intent.top_hate)
+	) {
+		return m_ai_intent.top_hate;
+	}
+
+	return hate_list.GetMobWithMostHateOnList(this);
+}
+
 void Mob::AI_Process() {
 	if (!IsAIControlled())
 		return;
@@ -976,6 +1056,7 @@ void Mob::AI_Process() {
 	if (!(AI_think_timer->Check() || attack_timer.Check(false)))
 		return;
 
+	TICK_PROFILE("Mob::AI_Process");
 
 	if (IsCasting())
 		return;
@@ -1081,12 +1162,12 @@ void Mob::AI_Process() {
 
 				if (IsFocused()) {
 					if (!target) {
-						SetTarget(hate_list.GetMobWithMostHateOnList(this));
+						SetTarget(GetPreparedTopHate());
 					}
 				}
 				else {
 					if (!ImprovedTaunt())
-						SetTarget(hate_list.GetMobWithMostHateOnList(this));
+						SetTarget(GetPreparedTopHate());
 				}
 
 			}
@@ -1,15 +1,20 @@
 #include "mob_movement_manager.h"
 #include "client.h"
 #include "mob.h"
+#include "npc.h"
 #include "zone.h"
 #include "position.h"
 #include "water_map.h"
 #include "../common/eq_packet_structs.h"
 #include "../common/misc_functions.h"
 #include "../common/data_verification.h"
+#include "../common/event/task_scheduler.h"
 
+#include <algorithm>
+#include <atomic>
 #include <vector>
 #include <deque>
+#include <future>
 #include <map>
 #include <stdlib.h>
 
@@ -614,6 +619,10 @@ struct MovementStats {
 		TotalSentMovement = 0ULL;
 		TotalSentPosition = 0ULL;
 		TotalSentHeading  = 0ULL;
+		PathsQueued       = 0ULL;
+		PathsApplied      = 0ULL;
+		PathsDropped      = 0ULL;
+		PathWaitTime      = 0.0;
 	}
 
 	double   LastResetTime;
@@ -621,6 +630,10 @@ struct MovementStats {
 	uint64_t TotalSentMovement;
 	uint64_t TotalSentPosition;
 	uint64_t TotalSentHeading;
+	uint64_t PathsQueued;
+	uint64_t PathsApplied;
+	uint64_t PathsDropped;  // superseded by a newer request, a stop or a teleport before the route came back
+	double   PathWaitTime;  // seconds between queueing and applying, summed over PathsApplied
 };
 
 struct NavigateTo {
@@ -640,9 +653,28 @@ struct NavigateTo {
 	double last_set_time;
 };
 
+// a path search handed to a worker thread. Everything the search needs is copied in when it is queued so the worker
+// never touches the mob, the route is turned into movement commands on the main thread once done is set
+struct MobPathRequest {
+	IPathfinder       *pathing     = nullptr;
+	glm::vec3         start;
+	glm::vec3         dest;
+	MobMovementMode   mode         = MovementRunning;
+	bool              underwater   = false;
+	PathfinderOptions opts;
+	double            queued_time  = 0.0;
+
+	IPathfinder::IPath route;
+	bool               partial = false;
+	bool               stuck   = false;
+	std::atomic<bool>  done{false};
+	std::future<void>  task;
+};
+
 struct MobMovementEntry {
 	std::deque<std::unique_ptr<IMovementCommand>> Commands;
 	NavigateTo                                    NavTo;
+	std::shared_ptr<MobPathRequest>               PendingPath;
 };
 
 void AdjustRoute(std::list<IPathfinder::IPathNode> &nodes, Mob *who)
@@ -653,20 +685,63 @@ void AdjustRoute(std::list<IPathfinder::IPathNode> &nodes, Mob *who)
 
 	auto offset = who->GetZOffset();
 
+	std::vector<glm::vec3> positions;
+	positions.reserve(nodes.size());
 	for (auto &node : nodes) {
-		if (!zone->watermap->InLiquid(node.pos)) {
-			auto best_z = zone->zonemap->FindBestZ(node.pos, nullptr);
-			if (best_z != BEST_Z_INVALID) {
-				node.pos.z = best_z + offset;
-			}
+		positions.emplace_back(node.pos);
+	}
+
+	std::vector<uint8> in_liquid(positions.size());
+	zone->watermap->InLiquidBatch(positions.data(), in_liquid.data(), positions.size());
+
+	// the ground under every dry node is found in one batch
+	std::vector<IPathfinder::IPathNode *> dry;
+	std::vector<glm::vec3>               starts;
+	size_t                               n = 0;
+	for (auto &node : nodes) {
+		if (!in_liquid[n++]) {
+			dry.emplace_back(&node);
+			starts.emplace_back(node.pos);
 		} // todo: floating logic?
 	}
+
+	std::vector<float> best_z(dry.size());
+	zone->zonemap->FindBestZBatch(starts.data(), best_z.data(), dry.size());
+
+	for (size_t i = 0; i < dry.size(); ++i) {
+		// a node with no ground under it keeps the raised z, as it did when FindBestZ adjusted it in place
+		dry[i]->pos = starts[i];
+		if (best_z[i] != BEST_Z_INVALID) {
+			dry[i]->pos.z = best_z[i] + offset;
+		}
+	}
 }
 
+// #movement stress, re-orders a set of NPCs across the zone every second and samples frame times meanwhile
+struct PathStress {
+	bool                   Active        = false;
+	uint16                 ClientID      = 0;
+	double                 EndTime       = 0.0;
+	double                 LastOrderTime = 0.0;
+	uint32                 Round         = 0;
+	uint64                 Orders        = 0;
+	std::vector<uint16>    NPCIDs;
+	std::vector<glm::vec3> Destinations;
+	std::vector<double>    FrameTimes;
+};
+
 struct MobMovementManager::Implementation {
 	std::map<Mob *, MobMovementEntry> Entries;
 	std::vector<Client *>             Clients;
 	MovementStats                     Stats;
+	PathStress                        Stress;
+
+	// every queued request until its worker is done, including those of mobs that were removed in the meantime
+	std::vector<std::shared_ptr<MobPathRequest>> PathsInFlight;
+	uint32                                       PathThreadCount = 0;
+
+	// declared last so its workers are joined before the requests they may still be writing go away
+	std::unique_ptr<EQ::Event::TaskScheduler> PathScheduler;
 };
 
 MobMovementManager::MobMovementManager()
@@ -680,10 +755,29 @@ MobMovementManager::~MobMovementManager()
 
 void MobMovementManager::Process()
 {
+	const double current_time = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
+
 	for (auto &iter : _impl->Entries) {
 		auto &ent      = iter.second;
 		auto &commands = ent.Commands;
 
+		// routes only ever land here, at the tick boundary, never in the middle of an AI pass
+		if (ent.PendingPath && ent.PendingPath->done.load(std::memory_order_acquire)) {
+			auto request = std::move(ent.PendingPath);
+
+			_impl->Stats.PathsApplied++;
+			_impl->Stats.PathWaitTime += current_time - request->queued_time;
+
+			commands.clear();
+
+			if (request->underwater) {
+				ApplyPathUnderwater(iter.first, *request);
+			}
+			else {
+				ApplyPathGround(iter.first, *request);
+			}
+		}
+
 		while (true != commands.empty()) {
 			auto &cmd = commands.front();
 			auto r    = cmd->Process(this, iter.first);
@@ -695,6 +789,27 @@ void MobMovementManager::Process()
 			commands.pop_front();
 		}
 	}
+
+	if (!_impl->PathsInFlight.empty()) {
+		_impl->PathsInFlight.erase(
+			std::remove_if(
+				_impl->PathsInFlight.begin(),
+				_impl->PathsInFlight.end(),
+				[](const std::shared_ptr<MobPathRequest> &r) {
+					return r->done.load(std::memory_order_acquire);
+				}
+			),
+			_impl->PathsInFlight.end()
+		);
+	}
+	else if (_impl->PathScheduler && !RuleB(Pathing, AsyncPathRequests)) {
+		_impl->PathScheduler.reset();
+		_impl->PathThreadCount = 0;
+	}
+
+	if (_impl->Stress.Active) {
+		ProcessPathStress();
+	}
 }
 
 void MobMovementManager::AddMob(Mob *mob)
@@ -744,6 +859,11 @@ void MobMovementManager::Teleport(Mob *who, float x, float y, float z, float hea
 
 	ent.second.Commands.clear();
 
+	if (ent.second.PendingPath) {
+		ent.second.PendingPath.reset();
+		_impl->Stats.PathsDropped++;
+	}
+
 	PushTeleportTo(ent.second, x, y, z, heading);
 }
 
@@ -770,10 +890,27 @@ void MobMovementManager::NavigateTo(Mob *who, float x, float y, float z, MobMove
 		auto heading_match = IsHeadingEqual(0.0, nav.navigate_to_heading);
 
 		if (false == within || false == heading_match || ent.second.Commands.size() == 0) {
+			auto previous = std::move(ent.second.Commands);
 			ent.second.Commands.clear();
 
+			if (ent.second.PendingPath) {
+				ent.second.PendingPath.reset();
+				_impl->Stats.PathsDropped++;
+			}
+
 			//Path is no longer valid, calculate a new path
 			UpdatePath(who, x, y, z, mode);
+
+			// the search went to a worker, keep doing what we were doing (or head straight there) until it is back
+			if (ent.second.PendingPath) {
+				if (!previous.empty()) {
+					ent.second.Commands = std::move(previous);
+				}
+				else {
+					PushMoveTo(ent.second, x, y, z, mode);
+				}
+			}
+
 			nav.navigate_to_x       = x;
 			nav.navigate_to_y       = y;
 			nav.navigate_to_z       = z;
@@ -802,10 +939,27 @@ void MobMovementManager::NavigateToPrecise(Mob *who, float x, float y, float z,
 		auto heading_match = IsHeadingEqual(0.0, nav.navigate_to_heading);
 
 		if (false == within || false == heading_match || ent.second.Commands.size() == 0) {
+			auto previous = std::move(ent.second.Commands);
 			ent.second.Commands.clear();
 
+			if (ent.second.PendingPath) {
+				ent.second.PendingPath.reset();
+				_impl->Stats.PathsDropped++;
+			}
+
 			//Path is no longer valid, calculate a new path
 			UpdatePath(who, x, y, z, mode);
+
+			// the search went to a worker, keep doing what we were doing (or head straight there) until it is back
+			if (ent.second.PendingPath) {
+				if (!previous.empty()) {
+					ent.second.Commands = std::move(previous);
+				}
+				else {
+					PushMoveTo(ent.second, x, y, z, mode);
+				}
+			}
+
 			nav.navigate_to_x       = x;
 			nav.navigate_to_y       = y;
 			nav.navigate_to_z       = z;
@@ -826,6 +980,11 @@ void MobMovementManager::StopNavigation(Mob *who)
 	nav.navigate_to_z       = 0.0;
 	nav.navigate_to_heading = 0.0;
 
+	if (ent.second.PendingPath) {
+		ent.second.PendingPath.reset();
+		_impl->Stats.PathsDropped++;
+	}
+
 	if (true == ent.second.Commands.empty()) {
 		PushStopMoving(ent.second);
 		return;
@@ -1015,6 +1174,44 @@ void MobMovementManager::DumpStats(Client *client)
 		_impl->Stats.TotalSentPosition,
 		static_cast<double>(_impl->Stats.TotalSentPosition) / total_time
 	);
+
+	client->Message(
+		Chat::System,
+		fmt::format(
+			"Async Paths: {} queued {} applied {} dropped {} in flight (mean wait {:.1f} ms)",
+			_impl->Stats.PathsQueued,
+			_impl->Stats.PathsApplied,
+			_impl->Stats.PathsDropped,
+			_impl->PathsInFlight.size(),
+			_impl->Stats.PathsApplied ? _impl->Stats.PathWaitTime / _impl->Stats.PathsApplied * 1000.0 : 0.0
+		).c_str()
+	);
+
+	if (zone && zone->pathing) {
+		const auto &s = zone->pathing->GetStats();
+
+		client->Message(
+			Chat::System,
+			fmt::format(
+				"Path Requests: {} ({:.2f} / sec) Cache Hits: {} ({:.2f}%%) Mean Query: {:.2f} us",
+				s.requests,
+				static_cast<double>(s.requests) / total_time,
+				s.cache_hits,
+				s.requests ? static_cast<double>(s.cache_hits) / static_cast<double>(s.requests) * 100.0 : 0.0,
+				s.requests ? static_cast<double>(s.query_ns) / static_cast<double>(s.requests) / 1000.0 : 0.0
+			).c_str()
+		);
+		client->Message(
+			Chat::System,
+			fmt::format(
+				"Route Cache: {} routes ({:.1f} KB) Evictions: {} Pooled Queries: {}",
+				s.cache_entries,
+				static_cast<double>(s.cache_bytes) / 1024.0,
+				s.cache_evictions,
+				s.queries
+			).c_str()
+		);
+	}
 }
 
 void MobMovementManager::ClearStats()
@@ -1024,6 +1221,14 @@ void MobMovementManager::ClearStats()
 	_impl->Stats.TotalSentHeading  = 0;
 	_impl->Stats.TotalSentMovement = 0;
 	_impl->Stats.TotalSentPosition = 0;
+	_impl->Stats.PathsQueued       = 0;
+	_impl->Stats.PathsApplied      = 0;
+	_impl->Stats.PathsDropped      = 0;
+	_impl->Stats.PathWaitTime      = 0.0;
+
+	if (zone && zone->pathing) {
+		zone->pathing->ClearStats();
+	}
 }
 
 /**
@@ -1112,22 +1317,33 @@ void MobMovementManager::UpdatePath(Mob *who, float x, float y, float z, MobMove
 
 void MobMovementManager::UpdatePathGround(Mob *who, float x, float y, float z, MobMovementMode mode)
 {
-	PathfinderOptions opts;
-	opts.smooth_path = true;
-	opts.step_size   = RuleR(Pathing, NavmeshStepSize);
-	opts.offset      = who->GetZOffset();
-	opts.flags       = PathingNotDisabled ^ PathingZoneLine;
-
+	auto request = std::make_shared<MobPathRequest>();
+	request->start            = glm::vec3(who->GetX(), who->GetY(), who->GetZ());
+	request->dest             = glm::vec3(x, y, z);
+	request->mode             = mode;
+	request->opts.smooth_path = true;
+	request->opts.step_size   = RuleR(Pathing, NavmeshStepSize);
+	request->opts.offset      = who->GetZOffset();
 	//This is probably pointless since the nav mesh tool currently sets zonelines to disabled anyway
-	auto partial = false;
-	auto stuck   = false;
-	auto route   = zone->pathing->FindPath(
-		glm::vec3(who->GetX(), who->GetY(), who->GetZ()),
-		glm::vec3(x, y, z),
-		partial,
-		stuck,
-		opts
-	);
+	request->opts.flags       = PathingNotDisabled ^ PathingZoneLine;
+
+	if (QueuePathRequest(who, request)) {
+		return;
+	}
+
+	request->route = zone->pathing->FindPath(request->start, request->dest, request->partial, request->stuck, request->opts);
+
+	ApplyPathGround(who, *request);
+}
+
+void MobMovementManager::ApplyPathGround(Mob *who, MobPathRequest &request)
+{
+	const float x      = request.dest.x;
+	const float y      = request.dest.y;
+	const float z      = request.dest.z;
+	const auto  mode   = request.mode;
+	auto        &route = request.route;
+	auto        stuck  = request.stuck;
 
 	auto eiter = _impl->Entries.find(who);
 	auto &ent  = (*eiter);
@@ -1253,21 +1469,36 @@ void MobMovementManager::UpdatePathUnderwater(Mob *who, float x, float y, float
 		return;
 	}
 
-	PathfinderOptions opts;
-	opts.smooth_path = true;
-	opts.step_size   = RuleR(Pathing, NavmeshStepSize);
-	opts.offset      = who->GetZOffset();
-	opts.flags       = PathingNotDisabled ^ PathingZoneLine;
-
-	auto partial = false;
-	auto stuck   = false;
-	auto route   = zone->pathing->FindPath(
-		glm::vec3(who->GetX(), who->GetY(), who->GetZ()),
-		glm::vec3(x, y, z),
-		partial,
-		stuck,
-		opts
-	);
+	auto request = std::make_shared<MobPathRequest>();
+	request->start            = glm::vec3(who->GetX(), who->GetY(), who->GetZ());
+	request->dest             = glm::vec3(x, y, z);
+	request->mode             = movement_mode;
+	request->underwater       = true;
+	request->opts.smooth_path = true;
+	request->opts.step_size   = RuleR(Pathing, NavmeshStepSize);
+	request->opts.offset      = who->GetZOffset();
+	request->opts.flags       = PathingNotDisabled ^ PathingZoneLine;
+
+	if (QueuePathRequest(who, request)) {
+		return;
+	}
+
+	request->route = zone->pathing->FindPath(request->start, request->dest, request->partial, request->stuck, request->opts);
+
+	ApplyPathUnderwater(who, *request);
+}
+
+void MobMovementManager::ApplyPathUnderwater(Mob *who, MobPathRequest &request)
+{
+	const float x             = request.dest.x;
+	const float y             = request.dest.y;
+	const float z             = request.dest.z;
+	const auto  movement_mode = request.mode;
+	auto        &route        = request.route;
+	auto        stuck         = request.stuck;
+
+	auto eiter = _impl->Entries.find(who);
+	auto &ent  = (*eiter);
 
 	if (route.size() == 0) {
 		HandleStuckBehavior(who, x, y, z, movement_mode);
@@ -1444,3 +1675,181 @@ void MobMovementManager::HandleStuckBehavior(Mob *who, float x, float y, float z
 			break;
 	}
 }
+
+bool MobMovementManager::QueuePathRequest(Mob *who, std::shared_ptr<MobPathRequest> request)
+{
+	if (!RuleB(Pathing, AsyncPathRequests) || !zone->pathing) {
+		return false;
+	}
+
+	const uint32 thread_count = std::max(1, RuleI(Pathing, AsyncPathThreads));
+	if (!_impl->PathScheduler || _impl->PathThreadCount != thread_count) {
+		// the old workers may still be searching, let them finish before they are torn down
+		WaitForPathRequests();
+
+		_impl->PathScheduler.reset();
+		_impl->PathScheduler   = std::make_unique<EQ::Event::TaskScheduler>(thread_count);
+		_impl->PathThreadCount = thread_count;
+
+		LogPathing("Asynchronous path requests started with [{}] worker thread(s)", thread_count);
+	}
+
+	request->pathing     = zone->pathing;
+	request->queued_time = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
+
+	// the worker only sees the request and the navmesh, both outlive it (see WaitForPathRequests)
+	auto r = request;
+	request->task = _impl->PathScheduler->Enqueue(
+		[r]() {
+			r->route = r->pathing->FindPath(r->start, r->dest, r->partial, r->stuck, r->opts);
+			r->done.store(true, std::memory_order_release);
+		}
+	);
+
+	auto eiter = _impl->Entries.find(who);
+	eiter->second.PendingPath = request;
+
+	_impl->PathsInFlight.emplace_back(std::move(request));
+	_impl->Stats.PathsQueued++;
+
+	return true;
+}
+
+void MobMovementManager::WaitForPathRequests()
+{
+	for (auto &r : _impl->PathsInFlight) {
+		if (r->task.valid()) {
+			r->task.wait();
+		}
+	}
+
+	_impl->PathsInFlight.clear();
+
+	for (auto &iter : _impl->Entries) {
+		if (iter.second.PendingPath) {
+			iter.second.PendingPath.reset();
+			_impl->Stats.PathsDropped++;
+		}
+	}
+}
+
+void MobMovementManager::StartPathStress(Client *client, uint32 npc_count, uint32 seconds)
+{
+	auto &stress = _impl->Stress;
+	if (stress.Active) {
+		client->Message(Chat::White, "A path stress run is already in progress.");
+		return;
+	}
+
+	stress = PathStress();
+
+	for (auto &e : entity_list.GetNPCList()) {
+		NPC *npc = e.second;
+		if (
+			!npc ||
+			npc->IsPet() ||
+			npc->GetIsBoat() ||
+			npc->IsUnderwaterOnly() ||
+			!npc->IsAIControlled() ||
+			npc->GetFlyMode() == GravityBehavior::Flying
+		) {
+			continue;
+		}
+
+		stress.NPCIDs.emplace_back(npc->GetID());
+		stress.Destinations.emplace_back(npc->GetX(), npc->GetY(), npc->GetZ());
+
+		if (stress.NPCIDs.size() >= npc_count) {
+			break;
+		}
+	}
+
+	if (stress.NPCIDs.size() < 2) {
+		client->Message(Chat::White, "At least two ground NPCs are needed to stress pathing.");
+		stress = PathStress();
+		return;
+	}
+
+	const double current_time = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
+
+	stress.Active        = true;
+	stress.ClientID      = client->GetID();
+	stress.EndTime       = current_time + seconds;
+	stress.LastOrderTime = 0.0;
+
+	client->Message(
+		Chat::White,
+		fmt::format(
+			"Pathing {} NPC(s) across the zone for {} second(s) with {} path requests.",
+			stress.NPCIDs.size(),
+			seconds,
+			RuleB(Pathing, AsyncPathRequests) ? "asynchronous" : "synchronous"
+		).c_str()
+	);
+}
+
+void MobMovementManager::ProcessPathStress()
+{
+	auto &stress = _impl->Stress;
+
+	const double current_time = static_cast<double>(Timer::GetCurrentTime()) / 1000.0;
+
+	stress.FrameTimes.emplace_back(frame_time * 1000.0);
+
+	if (current_time < stress.EndTime) {
+		// NavigateTo will not re-path a mob more than twice a second, a full second between orders keeps every one a real search
+		if (current_time - stress.LastOrderTime >= 1.0) {
+			stress.LastOrderTime = current_time;
+			stress.Round++;
+
+			// everyone heads for another NPC's starting point, rotating each round so every order is a new route
+			const size_t n = stress.NPCIDs.size();
+
+			size_t offset = (n / 2 + stress.Round) % n;
+			if (offset == 0) {
+				offset = 1;
+			}
+
+			for (size_t i = 0; i < n; ++i) {
+				NPC *npc = entity_list.GetNPCByID(stress.NPCIDs[i]);
+				if (!npc) {
+					continue;
+				}
+
+				const auto &d = stress.Destinations[(i + offset) % n];
+				NavigateTo(npc, d.x, d.y, d.z, MovementRunning);
+				stress.Orders++;
+			}
+		}
+
+		return;
+	}
+
+	auto &t = stress.FrameTimes;
+	std::sort(t.begin(), t.end());
+
+	auto percentile = [&t](double p) {
+		return t.empty() ? 0.0 : t[static_cast<size_t>(static_cast<double>(t.size() - 1) * p)];
+	};
+
+	const std::string &report = fmt::format(
+		"Path stress ({}) finished, {} NPC(s) given {} order(s) over {} frame(s), frame time p50 [{:.1f}] p90 [{:.1f}] p99 [{:.1f}] max [{:.1f}] ms",
+		RuleB(Pathing, AsyncPathRequests) ? "asynchronous" : "synchronous",
+		stress.NPCIDs.size(),
+		stress.Orders,
+		t.size(),
+		percentile(0.50),
+		percentile(0.90),
+		percentile(0.99),
+		t.empty() ? 0.0 : t.back()
+	);
+
+	LogPathing("{}", report);
+
+	auto c = entity_list.GetClientByID(stress.ClientID);
+	if (c) {
+		c->Message(Chat::White, report.c_str());
+	}
+
+	stress = PathStress();
+}
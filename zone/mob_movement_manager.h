@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include "../common/types.h"
 
 class Mob;
 class Client;
@@ -7,6 +8,7 @@ class Client;
 struct RotateCommand;
 struct MovementCommand;
 struct MobMovementEntry;
+struct MobPathRequest;
 struct PlayerPositionUpdateServer_Struct;
 
 enum ClientRange : int
@@ -68,6 +70,10 @@ public:
 	void DumpStats(Client *client);
 	void ClearStats();
 
+	// blocks until no worker is reading the pathfinder, pending routes are dropped
+	void WaitForPathRequests();
+	void StartPathStress(Client *client, uint32 npc_count, uint32 seconds);
+
 	static MobMovementManager &Get() {
 		static MobMovementManager inst;
 		return inst;
@@ -82,6 +88,10 @@ private:
 	void UpdatePath(Mob *who, float x, float y, float z, MobMovementMode mob_movement_mode);
 	void UpdatePathGround(Mob *who, float x, float y, float z, MobMovementMode mode);
 	void UpdatePathUnderwater(Mob *who, float x, float y, float z, MobMovementMode movement_mode);
+	bool QueuePathRequest(Mob *who, std::shared_ptr<MobPathRequest> request);
+	void ApplyPathGround(Mob *who, MobPathRequest &request);
+	void ApplyPathUnderwater(Mob *who, MobPathRequest &request);
+	void ProcessPathStress();
 	void UpdatePathBoat(Mob *who, float x, float y, float z, MobMovementMode mode);
 	void PushTeleportTo(MobMovementEntry &ent, float x, float y, float z, float heading);
 	void PushMoveTo(MobMovementEntry &ent, float x, float y, float z, MobMovementMode mob_movement_mode);
@@ -1,6 +1,8 @@
 #include "oriented_bounding_box.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/transform.hpp>
+#include <glm/common.hpp>
+#include <limits>
 
 glm::mat4 CreateRotateMatrix(float rx, float ry, float rz) {
 	glm::mat4 rot_x(1.0f);
@@ -93,3 +95,22 @@ bool OrientedBoundingBox::ContainsPoint(const glm::vec3 &p) const {
 	
 	return false;
 }
+
+void OrientedBoundingBox::GetAABB(glm::vec3 &min, glm::vec3 &max) const {
+	min = glm::vec3(std::numeric_limits<float>::max());
+	max = glm::vec3(std::numeric_limits<float>::lowest());
+
+	for (int i = 0; i < 8; ++i) {
+		glm::vec4 corner(
+			(i & 1) ? max_x : min_x,
+			(i & 2) ? max_y : min_y,
+			(i & 4) ? max_z : min_z,
+			1.0f
+		);
+
+		glm::vec3 p(transformation * corner);
+
+		min = glm::min(min, p);
+		max = glm::max(max, p);
+	}
+}
@@ -12,6 +12,8 @@ public:
 	~OrientedBoundingBox() = default;
 
 	bool ContainsPoint(const glm::vec3 &p) const;
+	// axis aligned bounds of the transformed box
+	void GetAABB(glm::vec3 &min, glm::vec3 &max) const;
 private:
 	float min_x, max_x;
 	float min_y, max_y;
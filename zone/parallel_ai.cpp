@@ -0,0 +1,84 @@
+#include "parallel_ai.h"
+#include "npc.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/rulesys.h"
+#include <algorithm>
+#include <chrono>
+#include <future>
+
+void ParallelAI::Prepare(const std::unordered_map<uint16, NPC *> &npc_list)
+{
+	// bumped every tick even when disabled so intents from an earlier tick can never be mistaken for current ones
+	m_frame++;
+
+	if (!RuleB(Zone, ParallelAIPrepare)) {
+		if (m_scheduler) {
+			m_scheduler.reset();
+			m_thread_count = 0;
+		}
+
+		return;
+	}
+
+	m_candidates.clear();
+	for (auto &e: npc_list) {
+		NPC *npc = e.second;
+		if (npc && npc->IsAIPrepareCandidate()) {
+			m_candidates.emplace_back(npc);
+		}
+	}
+
+	// below this many thinkers handing work to other threads costs more than it saves
+	if (m_candidates.empty() || m_candidates.size() < static_cast<size_t>(RuleI(Zone, ParallelAIMinMobs))) {
+		return;
+	}
+
+	const uint32 thread_count = std::max(1, RuleI(Zone, ParallelAIThreads));
+
+	EnsureWorkers(thread_count);
+
+	auto start = std::chrono::steady_clock::now();
+
+	const uint64 frame      = m_frame;
+	const size_t chunk_size = (m_candidates.size() + thread_count - 1) / thread_count;
+
+	std::vector<std::future<void>> futures;
+	futures.reserve(thread_count);
+
+	for (size_t begin = 0; begin < m_candidates.size(); begin += chunk_size) {
+		const size_t end = std::min(begin + chunk_size, m_candidates.size());
+
+		futures.emplace_back(
+			m_scheduler->Enqueue(
+				[this, begin, end, frame]() {
+					Mob::PrepareAIIntents(m_candidates.data() + begin, end - begin, frame);
+				}
+			)
+		);
+	}
+
+	// barrier, nothing may move on to the serial phase while a worker is still reading the entity list
+	for (auto &f: futures) {
+		f.get();
+	}
+
+	LogAIDetail(
+		"Prepared [{}] NPC intents across [{}] thread(s) in [{}] us",
+		m_candidates.size(),
+		futures.size(),
+		std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()
+	);
+}
+
+void ParallelAI::EnsureWorkers(uint32 thread_count)
+{
+	if (m_scheduler && m_thread_count == thread_count) {
+		return;
+	}
+
+	m_scheduler.reset();
+	m_scheduler    = std::make_unique<EQ::Event::TaskScheduler>(thread_count);
+	m_thread_count = thread_count;
+
+	LogAI("Parallel AI prepare phase started with [{}] worker thread(s)", thread_count);
+}
@@ -0,0 +1,48 @@
+#ifndef EQEMU_PARALLEL_AI_H
+#define EQEMU_PARALLEL_AI_H
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <glm/vec3.hpp>
+#include "../common/types.h"
+#include "../common/event/task_scheduler.h"
+
+class Mob;
+class NPC;
+
+// Read-only AI decisions computed for a mob ahead of its serial AI_Process
+//
+// Only valid for the frame it was prepared in; anything that changed since (target left the hate list, either
+// side moved) is detected at the point of use and the live calculation is done instead.
+struct MobAIIntent {
+	uint64    frame      = 0;
+	Mob       *top_hate  = nullptr;
+	bool      has_los    = false;
+	bool      los        = false;
+	glm::vec3 los_from   = {};
+	glm::vec3 los_to     = {};
+};
+
+// Opt-in parallel prepare phase for NPC AI (Zone:ParallelAIPrepare)
+//
+// Before the mob list is processed, NPCs whose AI will think this tick have their hate target and line of sight to
+// it computed across a worker pool. Workers only read shared state and write the intent of the mob they were handed,
+// the main thread waits for every worker before MobProcess continues, then applies the intents serially in the usual
+// mob list order so results do not depend on thread scheduling.
+class ParallelAI {
+public:
+	void Prepare(const std::unordered_map<uint16, NPC *> &npc_list);
+
+	inline uint64 GetFrame() const { return m_frame; }
+
+private:
+	void EnsureWorkers(uint32 thread_count);
+
+	uint64                                    m_frame        = 0;
+	uint32                                    m_thread_count = 0;
+	std::unique_ptr<EQ::Event::TaskScheduler> m_scheduler;
+	std::vector<Mob *>                        m_candidates;
+};
+
+#endif //EQEMU_PARALLEL_AI_H
@@ -70,6 +70,17 @@ public:
 
 	typedef std::list<IPathNode> IPath;
 
+	struct Stats
+	{
+		uint64 requests        = 0;
+		uint64 cache_hits      = 0;
+		uint64 cache_evictions = 0;
+		uint64 query_ns        = 0; // time spent in FindRoute / FindPath, hits included
+		uint64 cache_entries   = 0;
+		uint64 cache_bytes     = 0;
+		uint64 queries         = 0; // pooled dtNavMeshQuery objects
+	};
+
 	IPathfinder() { }
 	virtual ~IPathfinder() { }
 
@@ -77,6 +88,8 @@ public:
 	virtual IPath FindPath(const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, const PathfinderOptions& opts) = 0;
 	virtual glm::vec3 GetRandomLocation(const glm::vec3 &start, int flags = PathingNotDisabled) = 0;
 	virtual void DebugCommand(Client *c, const Seperator *sep) = 0;
+	virtual Stats GetStats() { return Stats(); }
+	virtual void ClearStats() { }
 
 	static IPathfinder *Load(const std::string &zone);
 };
@@ -1,5 +1,12 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <stdio.h>
+#include <unordered_map>
 #include <vector>
 #include "pathfinder_nav_mesh.h"
 #include <DetourCommon.h>
@@ -12,17 +19,288 @@
 
 extern Zone *zone;
 
+namespace {
+	enum class RouteKind : uint8 {
+		Route,
+		Path
+	};
+
+	// start and end are quantized to cells on top of the polys they resolved to, so every mob chasing the same target
+	// from roughly the same spot shares one search. The options are part of the key since they shape the result
+	struct RouteCacheKey {
+		RouteKind kind;
+		dtPolyRef start_ref;
+		dtPolyRef end_ref;
+		int32     start_cell[3];
+		int32     end_cell[3];
+		int       flags;
+		bool      smooth_path;
+		float     step_size;
+		float     offset;
+		float     flag_cost[10];
+
+		bool operator==(const RouteCacheKey &o) const
+		{
+			return kind == o.kind &&
+				start_ref == o.start_ref &&
+				end_ref == o.end_ref &&
+				std::equal(std::begin(start_cell), std::end(start_cell), std::begin(o.start_cell)) &&
+				std::equal(std::begin(end_cell), std::end(end_cell), std::begin(o.end_cell)) &&
+				flags == o.flags &&
+				smooth_path == o.smooth_path &&
+				step_size == o.step_size &&
+				offset == o.offset &&
+				std::equal(std::begin(flag_cost), std::end(flag_cost), std::begin(o.flag_cost));
+		}
+	};
+
+	struct RouteCacheKeyHash {
+		size_t operator()(const RouteCacheKey &k) const
+		{
+			size_t h = std::hash<uint64>()(static_cast<uint64>(k.start_ref));
+
+			auto combine = [&h](size_t v) {
+				h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+			};
+
+			combine(std::hash<uint64>()(static_cast<uint64>(k.end_ref)));
+			for (int i = 0; i < 3; ++i) {
+				combine(std::hash<int32>()(k.start_cell[i]));
+				combine(std::hash<int32>()(k.end_cell[i]));
+			}
+
+			combine(std::hash<int>()(k.flags));
+			combine(static_cast<size_t>(k.kind));
+
+			// costs and step size rarely differ between callers, equality sorts out the odd collision
+			return h;
+		}
+	};
+
+	struct RouteCacheEntry {
+		RouteCacheKey      key;
+		IPathfinder::IPath route;
+		bool               partial;
+		bool               stuck;
+		size_t             bytes;
+	};
+
+	inline int32 RouteCacheCell(float v, float cell_size)
+	{
+		return static_cast<int32>(std::floor(v / cell_size));
+	}
+
+	RouteCacheKey MakeRouteCacheKey(
+		RouteKind kind,
+		dtPolyRef start_ref,
+		dtPolyRef end_ref,
+		const glm::vec3 &start,
+		const glm::vec3 &end,
+		const PathfinderOptions &opts
+	)
+	{
+		const float cell_size = std::max(RuleR(Pathing, RouteCacheCellSize), 0.1f);
+
+		RouteCacheKey k{};
+		k.kind          = kind;
+		k.start_ref     = start_ref;
+		k.end_ref       = end_ref;
+		k.start_cell[0] = RouteCacheCell(start.x, cell_size);
+		k.start_cell[1] = RouteCacheCell(start.y, cell_size);
+		k.start_cell[2] = RouteCacheCell(start.z, cell_size);
+		k.end_cell[0]   = RouteCacheCell(end.x, cell_size);
+		k.end_cell[1]   = RouteCacheCell(end.y, cell_size);
+		k.end_cell[2]   = RouteCacheCell(end.z, cell_size);
+		k.flags         = opts.flags;
+		k.smooth_path   = opts.smooth_path;
+		k.step_size     = opts.step_size;
+		k.offset        = opts.offset;
+		std::copy(std::begin(opts.flag_cost), std::end(opts.flag_cost), std::begin(k.flag_cost));
+
+		return k;
+	}
+
+	// rough heap footprint of a cached route, list nodes plus the map and lru bookkeeping
+	inline size_t RouteCacheEntryBytes(const IPathfinder::IPath &route)
+	{
+		return sizeof(RouteCacheEntry) + sizeof(RouteCacheKey) + 4 * sizeof(void *) +
+			route.size() * (sizeof(IPathfinder::IPathNode) + 2 * sizeof(void *));
+	}
+
+	// a cached route was built from another point in the same cells, pin its ends to this caller's positions
+	void PinRouteEnds(IPathfinder::IPath &route, const glm::vec3 &start, const glm::vec3 &end, bool partial)
+	{
+		for (auto &n: route) {
+			if (!n.teleport) {
+				n.pos.x = start.x;
+				n.pos.y = start.y;
+				break;
+			}
+		}
+
+		if (partial) {
+			return;
+		}
+
+		for (auto n = route.rbegin(); n != route.rend(); ++n) {
+			if (!n->teleport) {
+				n->pos.x = end.x;
+				n->pos.y = end.y;
+				break;
+			}
+		}
+	}
+
+	class RequestTimer {
+	public:
+		explicit RequestTimer(std::atomic<uint64> &total_ns) : m_total_ns(total_ns), m_start(std::chrono::steady_clock::now()) { }
+
+		~RequestTimer()
+		{
+			m_total_ns.fetch_add(
+				static_cast<uint64>(
+					std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count()
+				),
+				std::memory_order_relaxed
+			);
+		}
+
+	private:
+		std::atomic<uint64>                   &m_total_ns;
+		std::chrono::steady_clock::time_point m_start;
+	};
+}
+
 struct PathfinderNavmesh::Implementation
 {
-	dtNavMesh *nav_mesh;
-	dtNavMeshQuery *query;
+	dtNavMesh *nav_mesh = nullptr;
+
+	// initialized queries waiting to be reused, a thread holds one for the length of a request so there are only ever
+	// as many as there are threads pathing at the same time
+	struct PooledQuery {
+		dtNavMeshQuery *query;
+		int            max_nodes;
+	};
+
+	std::mutex               query_lock;
+	std::vector<PooledQuery> idle_queries;
+	size_t                   query_count = 0;
+
+	std::mutex                                                                                 cache_lock;
+	std::list<RouteCacheEntry>                                                                 cache_lru; // most recent first
+	std::unordered_map<RouteCacheKey, std::list<RouteCacheEntry>::iterator, RouteCacheKeyHash> cache;
+	size_t                                                                                     cache_bytes = 0;
+
+	std::atomic<uint64> stats_requests{0};
+	std::atomic<uint64> stats_cache_hits{0};
+	std::atomic<uint64> stats_cache_evictions{0};
+	std::atomic<uint64> stats_query_ns{0};
+
+	class QueryLease {
+	public:
+		explicit QueryLease(Implementation &impl) : m_impl(impl)
+		{
+			const int max_nodes = RuleI(Pathing, MaxNavmeshNodes);
+
+			{
+				std::lock_guard<std::mutex> guard(m_impl.query_lock);
+				if (!m_impl.idle_queries.empty()) {
+					m_query = m_impl.idle_queries.back();
+					m_impl.idle_queries.pop_back();
+				}
+				else {
+					m_impl.query_count++;
+				}
+			}
+
+			if (!m_query.query) {
+				m_query.query     = dtAllocNavMeshQuery();
+				m_query.max_nodes = 0;
+			}
+
+			// only a fresh query or a MaxNavmeshNodes change pays for the node pool and hash
+			if (m_query.max_nodes != max_nodes) {
+				m_query.query->init(impl.nav_mesh, max_nodes);
+				m_query.max_nodes = max_nodes;
+			}
+		}
+
+		~QueryLease()
+		{
+			std::lock_guard<std::mutex> guard(m_impl.query_lock);
+			m_impl.idle_queries.emplace_back(m_query);
+		}
+
+		QueryLease(const QueryLease &) = delete;
+		QueryLease &operator=(const QueryLease &) = delete;
+
+		dtNavMeshQuery *operator->() const { return m_query.query; }
+		dtNavMeshQuery *get() const { return m_query.query; }
+
+	private:
+		Implementation &m_impl;
+		PooledQuery    m_query{nullptr, 0};
+	};
+
+	bool FindCachedRoute(const RouteCacheKey &key, IPath &route, bool &partial, bool &stuck)
+	{
+		std::lock_guard<std::mutex> guard(cache_lock);
+
+		auto iter = cache.find(key);
+		if (iter == cache.end()) {
+			return false;
+		}
+
+		cache_lru.splice(cache_lru.begin(), cache_lru, iter->second);
+
+		route   = iter->second->route;
+		partial = iter->second->partial;
+		stuck   = iter->second->stuck;
+
+		return true;
+	}
+
+	void CacheRoute(const RouteCacheKey &key, const IPath &route, bool partial, bool stuck)
+	{
+		const int capacity = RuleI(Pathing, RouteCacheSize);
+		if (capacity <= 0) {
+			return;
+		}
+
+		std::lock_guard<std::mutex> guard(cache_lock);
+
+		// another thread may have raced us to the same search
+		if (cache.find(key) != cache.end()) {
+			return;
+		}
+
+		const size_t bytes = RouteCacheEntryBytes(route);
+
+		cache_lru.emplace_front(RouteCacheEntry{key, route, partial, stuck, bytes});
+		cache.emplace(key, cache_lru.begin());
+		cache_bytes += bytes;
+
+		while (cache.size() > static_cast<size_t>(capacity)) {
+			auto &oldest = cache_lru.back();
+			cache_bytes -= oldest.bytes;
+			cache.erase(oldest.key);
+			cache_lru.pop_back();
+			stats_cache_evictions.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void ClearCache()
+	{
+		std::lock_guard<std::mutex> guard(cache_lock);
+		cache.clear();
+		cache_lru.clear();
+		cache_bytes = 0;
+	}
 };
 
 PathfinderNavmesh::PathfinderNavmesh(const std::string &path)
 {
 	m_impl = std::make_unique<Implementation>();
-	m_impl->nav_mesh = nullptr;
-	m_impl->query = nullptr;
 	Load(path);
 }
 
@@ -39,11 +317,11 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 		return IPath();
 	}
 
-	if (!m_impl->query) {
-		m_impl->query = dtAllocNavMeshQuery();
-	}
+	m_impl->stats_requests.fetch_add(1, std::memory_order_relaxed);
+	RequestTimer timer(m_impl->stats_query_ns);
+
+	Implementation::QueryLease query(*m_impl);
 
-	m_impl->query->init(m_impl->nav_mesh, RuleI(Pathing, MaxNavmeshNodes));
 	glm::vec3 current_location(start.x, start.z, start.y);
 	glm::vec3 dest_location(end.x, end.z, end.y);
 
@@ -64,21 +342,56 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 	dtPolyRef end_ref;
 	glm::vec3 ext(5.0f, 100.0f, 5.0f);
 
-	m_impl->query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
-	m_impl->query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
+	query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
+	query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
 
 	if (!start_ref || !end_ref) {
 		return IPath();
 	}
 
+	// FindRoute has fixed costs, only the flags vary
+	PathfinderOptions key_opts;
+	key_opts.flags = flags;
+
+	const auto key = MakeRouteCacheKey(RouteKind::Route, start_ref, end_ref, start, end, key_opts);
+
+	IPath route;
+	bool  route_stuck = false;
+	if (m_impl->FindCachedRoute(key, route, partial, route_stuck)) {
+		m_impl->stats_cache_hits.fetch_add(1, std::memory_order_relaxed);
+		PinRouteEnds(route, start, end, partial);
+	}
+	else {
+		route = BuildRoute(query.get(), filter, start_ref, end_ref, current_location, dest_location, partial, route_stuck);
+		m_impl->CacheRoute(key, route, partial, route_stuck);
+	}
+
+	if (route_stuck) {
+		stuck = true;
+	}
+
+	return route;
+}
+
+IPathfinder::IPath PathfinderNavmesh::BuildRoute(
+	dtNavMeshQuery *query,
+	const dtQueryFilter &filter,
+	dtPolyRef start_ref,
+	dtPolyRef end_ref,
+	const glm::vec3 &current_location,
+	const glm::vec3 &dest_location,
+	bool &partial,
+	bool &stuck
+)
+{
 	int npoly = 0;
 	dtPolyRef path[1024] = { 0 };
-	auto status = m_impl->query->findPath(start_ref, end_ref, &current_location[0], &dest_location[0], &filter, path, &npoly, 1024);
+	auto status = query->findPath(start_ref, end_ref, &current_location[0], &dest_location[0], &filter, path, &npoly, 1024);
 
 	if (npoly) {
 		glm::vec3 epos = dest_location;
 		if (path[npoly - 1] != end_ref) {
-			m_impl->query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
+			query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
 			partial = true;
 
 			auto dist = DistanceSquared(epos, current_location);
@@ -93,7 +406,7 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 		int n_straight_polys;
 		dtPolyRef straight_path_polys[2048];
 
-		status = m_impl->query->findStraightPath(&current_location[0], &epos[0], path, npoly,
+		status = query->findStraightPath(&current_location[0], &epos[0], path, npoly,
 			straight_path, straight_path_flags,
 			straight_path_polys, &n_straight_polys, 2048, DT_STRAIGHTPATH_AREA_CROSSINGS);
 
@@ -125,7 +438,7 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 	}
 
 	IPath Route;
-	Route.push_back(end);
+	Route.push_back(glm::vec3(dest_location.x, dest_location.z, dest_location.y));
 	return Route;
 }
 
@@ -137,11 +450,11 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 		return IPath();
 	}
 
-	if (!m_impl->query) {
-		m_impl->query = dtAllocNavMeshQuery();
-	}
+	m_impl->stats_requests.fetch_add(1, std::memory_order_relaxed);
+	RequestTimer timer(m_impl->stats_query_ns);
+
+	Implementation::QueryLease query(*m_impl);
 
-	m_impl->query->init(m_impl->nav_mesh, RuleI(Pathing, MaxNavmeshNodes));
 	glm::vec3 current_location(start.x, start.z, start.y);
 	glm::vec3 dest_location(end.x, end.z, end.y);
 
@@ -158,26 +471,59 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 	filter.setAreaCost(9, opts.flag_cost[8]); //Portal
 	filter.setAreaCost(10, opts.flag_cost[9]); //Prefer
 
-	static const int max_polys = 256;
 	dtPolyRef start_ref;
 	dtPolyRef end_ref;
 	glm::vec3 ext(10.0f, 200.0f, 10.0f);
 
-	m_impl->query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
-	m_impl->query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
+	query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
+	query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
 
 	if (!start_ref || !end_ref) {
 		return IPath();
 	}
 
+	const auto key = MakeRouteCacheKey(RouteKind::Path, start_ref, end_ref, start, end, opts);
+
+	IPath route;
+	bool  route_stuck = false;
+	if (m_impl->FindCachedRoute(key, route, partial, route_stuck)) {
+		m_impl->stats_cache_hits.fetch_add(1, std::memory_order_relaxed);
+		PinRouteEnds(route, start, end, partial);
+	}
+	else {
+		route = BuildPath(query.get(), filter, start_ref, end_ref, current_location, dest_location, partial, route_stuck, opts);
+		m_impl->CacheRoute(key, route, partial, route_stuck);
+	}
+
+	if (route_stuck) {
+		stuck = true;
+	}
+
+	return route;
+}
+
+IPathfinder::IPath PathfinderNavmesh::BuildPath(
+	dtNavMeshQuery *query,
+	const dtQueryFilter &filter,
+	dtPolyRef start_ref,
+	dtPolyRef end_ref,
+	const glm::vec3 &current_location,
+	const glm::vec3 &dest_location,
+	bool &partial,
+	bool &stuck,
+	const PathfinderOptions &opts
+)
+{
+	static const int max_polys = 256;
+
 	int npoly = 0;
 	dtPolyRef path[max_polys] = { 0 };
-	auto status = m_impl->query->findPath(start_ref, end_ref, &current_location[0], &dest_location[0], &filter, path, &npoly, max_polys);
+	auto status = query->findPath(start_ref, end_ref, &current_location[0], &dest_location[0], &filter, path, &npoly, max_polys);
 
 	if (npoly) {
 		glm::vec3 epos = dest_location;
 		if (path[npoly - 1] != end_ref) {
-			m_impl->query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
+			query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
 			partial = true;
 
 			auto dist = DistanceSquared(epos, current_location);
@@ -191,9 +537,9 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 		unsigned char straight_path_flags[max_polys];
 		dtPolyRef straight_path_polys[max_polys];
 
-		auto status = m_impl->query->findStraightPath(&current_location[0], &epos[0], path, npoly,
+		status = query->findStraightPath(&current_location[0], &epos[0], path, npoly,
 			(float*)&straight_path[0], straight_path_flags,
-			straight_path_polys, &n_straight_polys, 2048, DT_STRAIGHTPATH_AREA_CROSSINGS | DT_STRAIGHTPATH_ALL_CROSSINGS);
+			straight_path_polys, &n_straight_polys, max_polys, DT_STRAIGHTPATH_AREA_CROSSINGS | DT_STRAIGHTPATH_ALL_CROSSINGS);
 
 		if (dtStatusFailed(status)) {
 			return IPath();
@@ -309,10 +655,7 @@ glm::vec3 PathfinderNavmesh::GetRandomLocation(const glm::vec3 &start, int flags
 		return glm::vec3(0.f);
 	}
 
-	if (!m_impl->query) {
-		m_impl->query = dtAllocNavMeshQuery();
-		m_impl->query->init(m_impl->nav_mesh, RuleI(Pathing, MaxNavmeshNodes));
-	}
+	Implementation::QueryLease query(*m_impl);
 
 	dtQueryFilter filter;
 	filter.setIncludeFlags(flags);
@@ -334,14 +677,14 @@ glm::vec3 PathfinderNavmesh::GetRandomLocation(const glm::vec3 &start, int flags
 	glm::vec3 current_location(start.x, start.z, start.y);
 	glm::vec3 ext(5.0f, 100.0f, 5.0f);
 
-	m_impl->query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
+	query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
 
 	if (!start_ref)
 	{
 		return glm::vec3(0.f);
 	}
 
-	if (dtStatusSucceed(m_impl->query->findRandomPointAroundCircle(start_ref, &current_location[0], 100.f, &filter, []() { return (float)zone->random.Real(0.0, 1.0); }, &randomRef, point)))
+	if (dtStatusSucceed(query->findRandomPointAroundCircle(start_ref, &current_location[0], 100.f, &filter, []() { return (float)zone->random.Real(0.0, 1.0); }, &randomRef, point)))
 	{
 		return glm::vec3(point[0], point[2], point[1]);
 	}
@@ -371,14 +714,54 @@ void PathfinderNavmesh::DebugCommand(Client *c, const Seperator *sep)
 	}
 }
 
+IPathfinder::Stats PathfinderNavmesh::GetStats()
+{
+	Stats s;
+	s.requests        = m_impl->stats_requests.load(std::memory_order_relaxed);
+	s.cache_hits      = m_impl->stats_cache_hits.load(std::memory_order_relaxed);
+	s.cache_evictions = m_impl->stats_cache_evictions.load(std::memory_order_relaxed);
+	s.query_ns        = m_impl->stats_query_ns.load(std::memory_order_relaxed);
+
+	{
+		std::lock_guard<std::mutex> guard(m_impl->cache_lock);
+		s.cache_entries = m_impl->cache.size();
+		s.cache_bytes   = m_impl->cache_bytes;
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(m_impl->query_lock);
+		s.queries = m_impl->query_count;
+	}
+
+	return s;
+}
+
+void PathfinderNavmesh::ClearStats()
+{
+	m_impl->stats_requests        = 0;
+	m_impl->stats_cache_hits      = 0;
+	m_impl->stats_cache_evictions = 0;
+	m_impl->stats_query_ns        = 0;
+}
+
 void PathfinderNavmesh::Clear()
 {
-	if (m_impl->nav_mesh) {
-		dtFreeNavMesh(m_impl->nav_mesh);
+	// cached routes hold poly refs into the mesh being freed
+	m_impl->ClearCache();
+
+	{
+		std::lock_guard<std::mutex> guard(m_impl->query_lock);
+		for (auto &q: m_impl->idle_queries) {
+			dtFreeNavMeshQuery(q.query);
+		}
+
+		m_impl->idle_queries.clear();
+		m_impl->query_count = 0;
 	}
 
-	if (m_impl->query) {
-		dtFreeNavMeshQuery(m_impl->query);
+	if (m_impl->nav_mesh) {
+		dtFreeNavMesh(m_impl->nav_mesh);
+		m_impl->nav_mesh = nullptr;
 	}
 }
 
@@ -4,6 +4,9 @@
 #include <string>
 #include <DetourNavMesh.h>
 
+class dtNavMeshQuery;
+class dtQueryFilter;
+
 class PathfinderNavmesh : public IPathfinder
 {
 public:
@@ -14,10 +17,14 @@ public:
 	virtual IPath FindPath(const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, const PathfinderOptions& opts);
 	virtual glm::vec3 GetRandomLocation(const glm::vec3 &start, int flags = PathingNotDisabled);
 	virtual void DebugCommand(Client *c, const Seperator *sep);
+	virtual Stats GetStats();
+	virtual void ClearStats();
 
 private:
 	void Clear();
 	void Load(const std::string &path);
+	IPath BuildRoute(dtNavMeshQuery *query, const dtQueryFilter &filter, dtPolyRef start_ref, dtPolyRef end_ref, const glm::vec3 &current_location, const glm::vec3 &dest_location, bool &partial, bool &stuck);
+	IPath BuildPath(dtNavMeshQuery *query, const dtQueryFilter &filter, dtPolyRef start_ref, dtPolyRef end_ref, const glm::vec3 &current_location, const glm::vec3 &dest_location, bool &partial, bool &stuck, const PathfinderOptions &opts);
 	void ShowPath(Client *c, const glm::vec3 &start, const glm::vec3 &end);
 	dtStatus GetPolyHeightNoConnections(dtPolyRef ref, const float *pos, float *height) const;
 	dtStatus GetPolyHeightOnPath(const dtPolyRef *path, const int path_len, const glm::vec3 &pos, float *h) const;
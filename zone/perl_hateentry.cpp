@@ -9,42 +9,42 @@
 
 int64_t Perl_HateEntry_GetDamage(struct_HateList* self) // @categories Script Utility, Hate and Aggro
 {
-	return self->hatelist_damage;
+	return self->GetDamage();
 }
 
 Mob* Perl_HateEntry_GetEnt(struct_HateList* self) // @categories Script Utility, Hate and Aggro
 {
-	return self->entity_on_hatelist;
+	return self->GetEnt();
 }
 
 bool Perl_HateEntry_GetFrenzy(struct_HateList* self) // @categories Script Utility, Hate and Aggro
 {
-	return self->is_entity_frenzy;
+	return self->GetFrenzy();
 }
 
 int64_t Perl_HateEntry_GetHate(struct_HateList* self) // @categories Script Utility, Hate and Aggro
 {
-	return self->stored_hate_amount;
+	return self->GetHate();
 }
 
 void Perl_HateEntry_SetDamage(struct_HateList* self, int64 value) // @categories Script Utility, Hate and Aggro
 {
-	self->hatelist_damage = value;
+	self->SetDamage(value);
 }
 
 void Perl_HateEntry_SetEnt(struct_HateList* self, Mob* mob) // @categories Script Utility, Hate and Aggro
 {
-	self->entity_on_hatelist = mob;
+	self->SetEnt(mob);
 }
 
 void Perl_HateEntry_SetFrenzy(struct_HateList* self, bool is_frenzy) // @categories Script Utility, Hate and Aggro
 {
-	self->is_entity_frenzy = is_frenzy;
+	self->SetFrenzy(is_frenzy);
 }
 
 void Perl_HateEntry_SetHate(struct_HateList* self, int64 value) // @categories Script Utility, Hate and Aggro
 {
-	self->stored_hate_amount = value;
+	self->SetHate(value);
 }
 
 void perl_register_hateentry()
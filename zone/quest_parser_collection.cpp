@@ -40,6 +40,26 @@ const std::string ENCOUNTER_NO_ENTITY_ID = "-1";
 extern Zone* zone;
 extern void MapOpcodes();
 
+// asks the interface about every event once so the per event checks afterwards are a single bit test
+template<typename Probe>
+static std::bitset<_LargestEventID> BuildQuestEventMask(Probe probe)
+{
+	std::bitset<_LargestEventID> mask;
+
+	for (int i = 0; i < _LargestEventID; i++) {
+		if (probe(static_cast<QuestEventID>(i))) {
+			mask.set(i);
+		}
+	}
+
+	return mask;
+}
+
+static inline bool HasQuestEvent(const std::bitset<_LargestEventID>& mask, QuestEventID event_id)
+{
+	return event_id < _LargestEventID && mask.test(event_id);
+}
+
 QuestParserCollection::QuestParserCollection()
 {
 	_player_quest_status        = QuestUnloaded;
@@ -90,6 +110,7 @@ void QuestParserCollection::ReloadQuests(bool reset_timers)
 	MapOpcodes();
 
 	_npc_quest_status.clear();
+	_npc_quest_subs.clear();
 
 	_player_quest_status        = QuestUnloaded;
 	_global_player_quest_status = QuestUnloaded;
@@ -99,6 +120,14 @@ void QuestParserCollection::ReloadQuests(bool reset_timers)
 	_merc_quest_status          = QuestUnloaded;
 	_global_merc_quest_status   = QuestUnloaded;
 
+	_global_npc_quest_subs.reset();
+	_player_quest_subs.reset();
+	_global_player_quest_subs.reset();
+	_bot_quest_subs.reset();
+	_global_bot_quest_subs.reset();
+	_merc_quest_subs.reset();
+	_global_merc_quest_subs.reset();
+
 	_spell_quest_status.clear();
 	_item_quest_status.clear();
 	_encounter_quest_status.clear();
@@ -115,48 +144,77 @@ void QuestParserCollection::RemoveEncounter(const std::string& name)
 	}
 }
 
+void QuestParserCollection::ResetEventStats()
+{
+	_event_stats.fill(EventStats{});
+}
+
+void QuestParserCollection::CountEvent(QuestEventID event_id, bool fired)
+{
+	if (event_id >= _LargestEventID) {
+		return;
+	}
+
+	if (fired) {
+		_event_stats[event_id].fired++;
+	} else {
+		_event_stats[event_id].short_circuited++;
+	}
+}
+
 bool QuestParserCollection::HasQuestSub(uint32 npc_id, QuestEventID event_id)
 {
-	return (
+	const bool has_sub = (
 		HasQuestSubLocal(npc_id, event_id) ||
 		HasQuestSubGlobal(event_id) ||
 		NPCHasEncounterSub(npc_id, event_id)
 	);
+
+	if (!has_sub) {
+		CountEvent(event_id, false);
+	}
+
+	return has_sub;
 }
 
 bool QuestParserCollection::NPCHasEncounterSub(uint32 npc_id, QuestEventID event_id)
 {
+	if (_encounter_quest_status.empty()) {
+		return false;
+	}
+
 	return HasEncounterSub(event_id, fmt::format("npc_{}", npc_id)) || HasEncounterSub(event_id, "npc_" + ENCOUNTER_NO_ENTITY_ID);
 }
 
 bool QuestParserCollection::HasQuestSubLocal(uint32 npc_id, QuestEventID event_id)
 {
-	auto iter = _npc_quest_status.find(npc_id);
+	auto subs = _npc_quest_subs.find(npc_id);
+	if (subs != _npc_quest_subs.end()) {
+		return HasQuestEvent(subs->second, event_id);
+	}
 
-	if (iter != _npc_quest_status.end()) {
-		if (iter->second != QuestFailedToLoad) { //loaded or failed to load
-			auto qiter = _interfaces.find(iter->second);
-			if (qiter->second->HasQuestSub(npc_id, event_id)) {
-				return true;
-			}
-		}
-	} else {
-		std::string filename;
-		auto        qi = GetQIByNPCQuest(npc_id, filename);
+	// no mask means we either never looked or the npc has no script
+	if (_npc_quest_status.find(npc_id) != _npc_quest_status.end()) {
+		return false;
+	}
 
-		if (qi) {
-			_npc_quest_status[npc_id] = qi->GetIdentifier();
+	std::string filename;
+	auto        qi = GetQIByNPCQuest(npc_id, filename);
 
-			qi->LoadNPCScript(filename, npc_id);
-			if (qi->HasQuestSub(npc_id, event_id)) {
-				return true;
-			}
-		} else {
-			_npc_quest_status[npc_id] = QuestFailedToLoad;
-		}
+	if (!qi) {
+		_npc_quest_status[npc_id] = QuestFailedToLoad;
+		return false;
 	}
 
-	return false;
+	_npc_quest_status[npc_id] = qi->GetIdentifier();
+
+	qi->LoadNPCScript(filename, npc_id);
+
+	auto& mask = _npc_quest_subs[npc_id];
+
+	mask = BuildQuestEventMask([&](QuestEventID e) { return qi->HasQuestSub(npc_id, e); });
+
+	return HasQuestEvent(mask, event_id);
 }
 
 bool QuestParserCollection::HasQuestSubGlobal(QuestEventID event_id)
@@ -168,33 +226,36 @@ bool QuestParserCollection::HasQuestSubGlobal(QuestEventID event_id)
 		if (qi) {
 			qi->LoadGlobalNPCScript(filename);
 			_global_npc_quest_status = qi->GetIdentifier();
-			if (qi->HasGlobalQuestSub(event_id)) {
-				return true;
-			}
-		}
-	} else {
-		if (_global_npc_quest_status != QuestFailedToLoad) {
-			auto qiter = _interfaces.find(_global_npc_quest_status);
-			if (qiter->second->HasGlobalQuestSub(event_id)) {
-				return true;
-			}
+			_global_npc_quest_subs   = BuildQuestEventMask([&](QuestEventID e) { return qi->HasGlobalQuestSub(e); });
+		} else {
+			_global_npc_quest_status = QuestFailedToLoad;
 		}
 	}
 
-	return false;
+	return HasQuestEvent(_global_npc_quest_subs, event_id);
 }
 
 bool QuestParserCollection::PlayerHasQuestSub(QuestEventID event_id)
 {
-	return (
+	const bool has_sub = (
 		PlayerHasQuestSubLocal(event_id) ||
 		PlayerHasQuestSubGlobal(event_id) ||
 		PlayerHasEncounterSub(event_id)
 	);
+
+	if (!has_sub) {
+		CountEvent(event_id, false);
+	}
+
+	return has_sub;
 }
 
 bool QuestParserCollection::PlayerHasEncounterSub(QuestEventID event_id)
 {
+	if (_encounter_quest_status.empty()) {
+		return false;
+	}
+
 	return HasEncounterSub(event_id, "player");
 }
 
@@ -207,14 +268,11 @@ bool QuestParserCollection::PlayerHasQuestSubLocal(QuestEventID event_id)
 		if (qi) {
 			_player_quest_status = qi->GetIdentifier();
 			qi->LoadPlayerScript(filename);
-			return qi->PlayerHasQuestSub(event_id);
+			_player_quest_subs = BuildQuestEventMask([&](QuestEventID e) { return qi->PlayerHasQuestSub(e); });
 		}
-	} else if (_player_quest_status != QuestFailedToLoad) {
-		auto iter = _interfaces.find(_player_quest_status);
-		return iter->second->PlayerHasQuestSub(event_id);
 	}
 
-	return false;
+	return HasQuestEvent(_player_quest_subs, event_id);
 }
 
 bool QuestParserCollection::PlayerHasQuestSubGlobal(QuestEventID event_id)
@@ -226,23 +284,35 @@ bool QuestParserCollection::PlayerHasQuestSubGlobal(QuestEventID event_id)
 		if (qi) {
 			_global_player_quest_status = qi->GetIdentifier();
 			qi->LoadGlobalPlayerScript(filename);
-			return qi->GlobalPlayerHasQuestSub(event_id);
+			_global_player_quest_subs = BuildQuestEventMask([&](QuestEventID e) { return qi->GlobalPlayerHasQuestSub(e); });
 		}
-	} else if (_global_player_quest_status != QuestFailedToLoad) {
-		auto iter = _interfaces.find(_global_player_quest_status);
-		return iter->second->GlobalPlayerHasQuestSub(event_id);
 	}
 
-	return false;
+	return HasQuestEvent(_global_player_quest_subs, event_id);
 }
 
 bool QuestParserCollection::SpellHasEncounterSub(uint32 spell_id, QuestEventID event_id)
 {
+	if (_encounter_quest_status.empty()) {
+		return false;
+	}
+
 	return HasEncounterSub(event_id, fmt::format("spell_{}", spell_id)) ||
 		   HasEncounterSub(event_id, "spell_" + ENCOUNTER_NO_ENTITY_ID);
 }
 
 bool QuestParserCollection::SpellHasQuestSub(uint32 spell_id, QuestEventID event_id)
+{
+	const bool has_sub = SpellHasQuestSubLocal(spell_id, event_id);
+
+	if (!has_sub) {
+		CountEvent(event_id, false);
+	}
+
+	return has_sub;
+}
+
+bool QuestParserCollection::SpellHasQuestSubLocal(uint32 spell_id, QuestEventID event_id)
 {
 	if (SpellHasEncounterSub(spell_id, event_id)) {
 		return true;
@@ -273,7 +343,7 @@ bool QuestParserCollection::SpellHasQuestSub(uint32 spell_id, QuestEventID event
 
 bool QuestParserCollection::ItemHasEncounterSub(EQ::ItemInstance *inst, QuestEventID event_id)
 {
-	if (inst) {
+	if (inst && !_encounter_quest_status.empty()) {
 		return HasEncounterSub(event_id, fmt::format("item_{}", inst->GetID())) ||
 			   HasEncounterSub(event_id, "item_" + ENCOUNTER_NO_ENTITY_ID);
 	}
@@ -282,6 +352,17 @@ bool QuestParserCollection::ItemHasEncounterSub(EQ::ItemInstance *inst, QuestEve
 }
 
 bool QuestParserCollection::ItemHasQuestSub(EQ::ItemInstance* inst, QuestEventID event_id)
+{
+	const bool has_sub = ItemHasQuestSubLocal(inst, event_id);
+
+	if (!has_sub) {
+		CountEvent(event_id, false);
+	}
+
+	return has_sub;
+}
+
+bool QuestParserCollection::ItemHasQuestSubLocal(EQ::ItemInstance* inst, QuestEventID event_id)
 {
 	if (!inst) {
 		return false;
@@ -349,14 +430,11 @@ bool QuestParserCollection::BotHasQuestSubLocal(QuestEventID event_id)
 		if (qi) {
 			_bot_quest_status = qi->GetIdentifier();
 			qi->LoadBotScript(filename);
-			return qi->BotHasQuestSub(event_id);
+			_bot_quest_subs = BuildQuestEventMask([&](QuestEventID e) { return qi->BotHasQuestSub(e); });
 		}
-	} else if (_bot_quest_status != QuestFailedToLoad) {
-		auto iter = _interfaces.find(_bot_quest_status);
-		return iter->second->BotHasQuestSub(event_id);
 	}
 
-	return false;
+	return HasQuestEvent(_bot_quest_subs, event_id);
 }
 
 bool QuestParserCollection::BotHasQuestSubGlobal(QuestEventID event_id)
@@ -368,19 +446,22 @@ bool QuestParserCollection::BotHasQuestSubGlobal(QuestEventID event_id)
 		if (qi) {
 			_global_bot_quest_status = qi->GetIdentifier();
 			qi->LoadGlobalBotScript(filename);
-			return qi->GlobalBotHasQuestSub(event_id);
+			_global_bot_quest_subs = BuildQuestEventMask([&](QuestEventID e) { return qi->GlobalBotHasQuestSub(e); });
 		}
-	} else if (_global_bot_quest_status != QuestFailedToLoad) {
-		auto iter = _interfaces.find(_global_bot_quest_status);
-		return iter->second->GlobalBotHasQuestSub(event_id);
 	}
 
-	return false;
+	return HasQuestEvent(_global_bot_quest_subs, event_id);
 }
 
 bool QuestParserCollection::BotHasQuestSub(QuestEventID event_id)
 {
-	return BotHasQuestSubLocal(event_id) || BotHasQuestSubGlobal(event_id);
+	const bool has_sub = BotHasQuestSubLocal(event_id) || BotHasQuestSubGlobal(event_id);
+
+	if (!has_sub) {
+		CountEvent(event_id, false);
+	}
+
+	return has_sub;
 }
 
 bool QuestParserCollection::MercHasQuestSubLocal(QuestEventID event_id)
@@ -392,14 +473,11 @@ bool QuestParserCollection::MercHasQuestSubLocal(QuestEventID event_id)
 		if (qi) {
 			_merc_quest_status = qi->GetIdentifier();
 			qi->LoadMercScript(filename);
-			return qi->MercHasQuestSub(event_id);
+			_merc_quest_subs = BuildQuestEventMask([&](QuestEventID e) { return qi->MercHasQuestSub(e); });
 		}
-	} else if (_merc_quest_status != QuestFailedToLoad) {
-		auto iter = _interfaces.find(_merc_quest_status);
-		return iter->second->MercHasQuestSub(event_id);
 	}
 
-	return false;
+	return HasQuestEvent(_merc_quest_subs, event_id);
 }
 
 bool QuestParserCollection::MercHasQuestSubGlobal(QuestEventID event_id)
@@ -411,19 +489,22 @@ bool QuestParserCollection::MercHasQuestSubGlobal(QuestEventID event_id)
 		if (qi) {
 			_global_merc_quest_status = qi->GetIdentifier();
 			qi->LoadGlobalMercScript(filename);
-			return qi->GlobalMercHasQuestSub(event_id);
+			_global_merc_quest_subs = BuildQuestEventMask([&](QuestEventID e) { return qi->GlobalMercHasQuestSub(e); });
 		}
-	} else if (_global_merc_quest_status != QuestFailedToLoad) {
-		auto iter = _interfaces.find(_global_merc_quest_status);
-		return iter->second->GlobalMercHasQuestSub(event_id);
 	}
 
-	return false;
+	return HasQuestEvent(_global_merc_quest_subs, event_id);
 }
 
 bool QuestParserCollection::MercHasQuestSub(QuestEventID event_id)
 {
-	return MercHasQuestSubLocal(event_id) || MercHasQuestSubGlobal(event_id);
+	const bool has_sub = MercHasQuestSubLocal(event_id) || MercHasQuestSubGlobal(event_id);
+
+	if (!has_sub) {
+		CountEvent(event_id, false);
+	}
+
+	return has_sub;
 }
 
 int QuestParserCollection::EventNPC(
@@ -439,6 +520,17 @@ int QuestParserCollection::EventNPC(
 		return 0;
 	}
 
+	if (
+		!HasQuestSubLocal(npc->GetNPCTypeID(), event_id) &&
+		!HasQuestSubGlobal(event_id) &&
+		_encounter_quest_status.empty()
+	) {
+		CountEvent(event_id, false);
+		return 0;
+	}
+
+	CountEvent(event_id, true);
+
 	const int local_return   = EventNPCLocal(event_id, npc, init, data, extra_data, extra_pointers);
 	const int global_return  = EventNPCGlobal(event_id, npc, init, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventNPC(event_id, npc, init, data, extra_data, extra_pointers);
@@ -463,27 +555,13 @@ int QuestParserCollection::EventNPCLocal(
 	std::vector<std::any>* extra_pointers
 )
 {
-	auto iter = _npc_quest_status.find(npc->GetNPCTypeID());
-	if (iter != _npc_quest_status.end()) {
-		//loaded or failed to load
-		if (iter->second != QuestFailedToLoad) {
-			auto qiter = _interfaces.find(iter->second);
-			return qiter->second->EventNPC(event_id, npc, init, data, extra_data, extra_pointers);
-		}
-	} else if (_npc_quest_status[npc->GetNPCTypeID()] != QuestFailedToLoad) {
-		std::string filename;
-		auto        qi = GetQIByNPCQuest(npc->GetNPCTypeID(), filename);
-
-		if (qi) {
-			_npc_quest_status[npc->GetNPCTypeID()] = qi->GetIdentifier();
-			qi->LoadNPCScript(filename, npc->GetNPCTypeID());
-			return qi->EventNPC(event_id, npc, init, data, extra_data, extra_pointers);
-		} else {
-			_npc_quest_status[npc->GetNPCTypeID()] = QuestFailedToLoad;
-		}
+	if (!HasQuestSubLocal(npc->GetNPCTypeID(), event_id)) {
+		return 0;
 	}
 
-	return 0;
+	auto iter  = _npc_quest_status.find(npc->GetNPCTypeID());
+	auto qiter = _interfaces.find(iter->second);
+	return qiter->second->EventNPC(event_id, npc, init, data, extra_data, extra_pointers);
 }
 
 int QuestParserCollection::EventNPCGlobal(
@@ -495,23 +573,12 @@ int QuestParserCollection::EventNPCGlobal(
 	std::vector<std::any>* extra_pointers
 )
 {
-	if (_global_npc_quest_status != QuestUnloaded && _global_npc_quest_status != QuestFailedToLoad) {
-		auto qiter = _interfaces.find(_global_npc_quest_status);
-		return qiter->second->EventGlobalNPC(event_id, npc, init, data, extra_data, extra_pointers);
-	} else if (_global_npc_quest_status != QuestFailedToLoad) {
-		std::string filename;
-		auto        qi = GetQIByGlobalNPCQuest(filename);
-
-		if (qi) {
-			_global_npc_quest_status = qi->GetIdentifier();
-			qi->LoadGlobalNPCScript(filename);
-			return qi->EventGlobalNPC(event_id, npc, init, data, extra_data, extra_pointers);
-		} else {
-			_global_npc_quest_status = QuestFailedToLoad;
-		}
+	if (!HasQuestSubGlobal(event_id)) {
+		return 0;
 	}
 
-	return 0;
+	auto qiter = _interfaces.find(_global_npc_quest_status);
+	return qiter->second->EventGlobalNPC(event_id, npc, init, data, extra_data, extra_pointers);
 }
 
 int QuestParserCollection::EventPlayer(
@@ -522,6 +589,17 @@ int QuestParserCollection::EventPlayer(
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (
+		!PlayerHasQuestSubLocal(event_id) &&
+		!PlayerHasQuestSubGlobal(event_id) &&
+		_encounter_quest_status.empty()
+	) {
+		CountEvent(event_id, false);
+		return 0;
+	}
+
+	CountEvent(event_id, true);
+
 	const int local_return   = EventPlayerLocal(event_id, client, data, extra_data, extra_pointers);
 	const int global_return  = EventPlayerGlobal(event_id, client, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventPlayer(event_id, client, data, extra_data, extra_pointers);
@@ -545,23 +623,12 @@ int QuestParserCollection::EventPlayerLocal(
 	std::vector<std::any>* extra_pointers
 )
 {
-	if (_player_quest_status == QuestUnloaded) {
-		std::string filename;
-		auto        qi = GetQIByPlayerQuest(filename);
-
-		if (qi) {
-			_player_quest_status = qi->GetIdentifier();
-			qi->LoadPlayerScript(filename);
-			return qi->EventPlayer(event_id, client, data, extra_data, extra_pointers);
-		}
-	} else {
-		if (_player_quest_status != QuestFailedToLoad) {
-			auto iter = _interfaces.find(_player_quest_status);
-			return iter->second->EventPlayer(event_id, client, data, extra_data, extra_pointers);
-		}
+	if (!PlayerHasQuestSubLocal(event_id)) {
+		return 0;
 	}
 
-	return 0;
+	auto iter = _interfaces.find(_player_quest_status);
+	return iter->second->EventPlayer(event_id, client, data, extra_data, extra_pointers);
 }
 
 int QuestParserCollection::EventPlayerGlobal(
@@ -572,23 +639,12 @@ int QuestParserCollection::EventPlayerGlobal(
 	std::vector<std::any>* extra_pointers
 )
 {
-	if (_global_player_quest_status == QuestUnloaded) {
-		std::string filename;
-		auto        qi = GetQIByGlobalPlayerQuest(filename);
-
-		if (qi) {
-			_global_player_quest_status = qi->GetIdentifier();
-			qi->LoadGlobalPlayerScript(filename);
-			return qi->EventGlobalPlayer(event_id, client, data, extra_data, extra_pointers);
-		}
-	} else {
-		if (_global_player_quest_status != QuestFailedToLoad) {
-			auto iter = _interfaces.find(_global_player_quest_status);
-			return iter->second->EventGlobalPlayer(event_id, client, data, extra_data, extra_pointers);
-		}
+	if (!PlayerHasQuestSubGlobal(event_id)) {
+		return 0;
 	}
 
-	return 0;
+	auto iter = _interfaces.find(_global_player_quest_status);
+	return iter->second->EventGlobalPlayer(event_id, client, data, extra_data, extra_pointers);
 }
 
 int QuestParserCollection::EventItem(
@@ -605,6 +661,8 @@ int QuestParserCollection::EventItem(
 		return 0;
 	}
 
+	CountEvent(event_id, true);
+
 	std::string item_script;
 	if (inst->GetItem()->ScriptFileID != 0) {
 		item_script = fmt::format(
@@ -677,6 +735,8 @@ int QuestParserCollection::EventSpell(
 	std::vector<std::any>* extra_pointers
 )
 {
+	CountEvent(event_id, true);
+
 	auto iter = _spell_quest_status.find(spell_id);
 	if (iter != _spell_quest_status.end()) {
 		//loaded or failed to load
@@ -773,6 +833,17 @@ int QuestParserCollection::EventBot(
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (
+		!BotHasQuestSubLocal(event_id) &&
+		!BotHasQuestSubGlobal(event_id) &&
+		_encounter_quest_status.empty()
+	) {
+		CountEvent(event_id, false);
+		return 0;
+	}
+
+	CountEvent(event_id, true);
+
 	const int local_return   = EventBotLocal(event_id, bot, init, data, extra_data, extra_pointers);
 	const int global_return  = EventBotGlobal(event_id, bot, init, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventBot(event_id, bot, init, data, extra_data, extra_pointers);
@@ -797,23 +868,12 @@ int QuestParserCollection::EventBotLocal(
 	std::vector<std::any>* extra_pointers
 )
 {
-	if (_bot_quest_status == QuestUnloaded) {
-		std::string filename;
-		auto        qi = GetQIByBotQuest(filename);
-
-		if (qi) {
-			_bot_quest_status = qi->GetIdentifier();
-			qi->LoadBotScript(filename);
-			return qi->EventBot(event_id, bot, init, data, extra_data, extra_pointers);
-		}
-	} else {
-		if (_bot_quest_status != QuestFailedToLoad) {
-			auto iter = _interfaces.find(_bot_quest_status);
-			return iter->second->EventBot(event_id, bot, init, data, extra_data, extra_pointers);
-		}
+	if (!BotHasQuestSubLocal(event_id)) {
+		return 0;
 	}
 
-	return 0;
+	auto iter = _interfaces.find(_bot_quest_status);
+	return iter->second->EventBot(event_id, bot, init, data, extra_data, extra_pointers);
 }
 
 int QuestParserCollection::EventBotGlobal(
@@ -825,23 +885,12 @@ int QuestParserCollection::EventBotGlobal(
 	std::vector<std::any>* extra_pointers
 )
 {
-	if (_global_bot_quest_status == QuestUnloaded) {
-		std::string filename;
-		auto        qi = GetQIByGlobalBotQuest(filename);
-
-		if (qi) {
-			_global_bot_quest_status = qi->GetIdentifier();
-			qi->LoadGlobalBotScript(filename);
-			return qi->EventGlobalBot(event_id, bot, init, data, extra_data, extra_pointers);
-		}
-	} else {
-		if (_global_bot_quest_status != QuestFailedToLoad) {
-			auto iter = _interfaces.find(_global_bot_quest_status);
-			return iter->second->EventGlobalBot(event_id, bot, init, data, extra_data, extra_pointers);
-		}
+	if (!BotHasQuestSubGlobal(event_id)) {
+		return 0;
 	}
 
-	return 0;
+	auto iter = _interfaces.find(_global_bot_quest_status);
+	return iter->second->EventGlobalBot(event_id, bot, init, data, extra_data, extra_pointers);
 }
 
 int QuestParserCollection::EventMerc(
@@ -853,6 +902,17 @@ int QuestParserCollection::EventMerc(
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (
+		!MercHasQuestSubLocal(event_id) &&
+		!MercHasQuestSubGlobal(event_id) &&
+		_encounter_quest_status.empty()
+	) {
+		CountEvent(event_id, false);
+		return 0;
+	}
+
+	CountEvent(event_id, true);
+
 	const int local_return   = EventMercLocal(event_id, merc, init, data, extra_data, extra_pointers);
 	const int global_return  = EventMercGlobal(event_id, merc, init, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventMerc(event_id, merc, init, data, extra_data, extra_pointers);
@@ -877,23 +937,12 @@ int QuestParserCollection::EventMercLocal(
 	std::vector<std::any>* extra_pointers
 )
 {
-	if (_merc_quest_status == QuestUnloaded) {
-		std::string filename;
-		auto        qi = GetQIByMercQuest(filename);
-
-		if (qi) {
-			_merc_quest_status = qi->GetIdentifier();
-			qi->LoadMercScript(filename);
-			return qi->EventMerc(event_id, merc, init, data, extra_data, extra_pointers);
-		}
-	} else {
-		if (_merc_quest_status != QuestFailedToLoad) {
-			auto iter = _interfaces.find(_merc_quest_status);
-			return iter->second->EventMerc(event_id, merc, init, data, extra_data, extra_pointers);
-		}
+	if (!MercHasQuestSubLocal(event_id)) {
+		return 0;
 	}
 
-	return 0;
+	auto iter = _interfaces.find(_merc_quest_status);
+	return iter->second->EventMerc(event_id, merc, init, data, extra_data, extra_pointers);
 }
 
 int QuestParserCollection::EventMercGlobal(
@@ -905,23 +954,12 @@ int QuestParserCollection::EventMercGlobal(
 	std::vector<std::any>* extra_pointers
 )
 {
-	if (_global_merc_quest_status == QuestUnloaded) {
-		std::string filename;
-		auto        qi = GetQIByGlobalMercQuest(filename);
-
-		if (qi) {
-			_global_merc_quest_status = qi->GetIdentifier();
-			qi->LoadGlobalMercScript(filename);
-			return qi->EventGlobalMerc(event_id, merc, init, data, extra_data, extra_pointers);
-		}
-	} else {
-		if (_global_merc_quest_status != QuestFailedToLoad) {
-			auto iter = _interfaces.find(_global_merc_quest_status);
-			return iter->second->EventGlobalMerc(event_id, merc, init, data, extra_data, extra_pointers);
-		}
+	if (!MercHasQuestSubGlobal(event_id)) {
+		return 0;
 	}
 
-	return 0;
+	auto iter = _interfaces.find(_global_merc_quest_status);
+	return iter->second->EventGlobalMerc(event_id, merc, init, data, extra_data, extra_pointers);
 }
 
 QuestInterface* QuestParserCollection::GetQIByNPCQuest(uint32 npc_id, std::string& filename)
@@ -1421,6 +1459,11 @@ int QuestParserCollection::DispatchEventNPC(
 	std::vector<std::any>* extra_pointers
 )
 {
+	// encounters are the only thing dispatched to here
+	if (_encounter_quest_status.empty()) {
+		return 0;
+	}
+
 	int ret = 0;
 
 	for (const auto& e: _load_precedence) {
@@ -1441,6 +1484,10 @@ int QuestParserCollection::DispatchEventPlayer(
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (_encounter_quest_status.empty()) {
+		return 0;
+	}
+
 	int ret = 0;
 
 	for (const auto& e: _load_precedence) {
@@ -1463,6 +1510,10 @@ int QuestParserCollection::DispatchEventItem(
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (_encounter_quest_status.empty()) {
+		return 0;
+	}
+
 	int ret = 0;
 
 	for (const auto& e: _load_precedence) {
@@ -1485,6 +1536,10 @@ int QuestParserCollection::DispatchEventSpell(
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (_encounter_quest_status.empty()) {
+		return 0;
+	}
+
 	int ret = 0;
 
 	for (const auto& e: _load_precedence) {
@@ -1506,6 +1561,10 @@ int QuestParserCollection::DispatchEventBot(
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (_encounter_quest_status.empty()) {
+		return 0;
+	}
+
 	int ret = 0;
 
 	for (const auto& e: _load_precedence) {
@@ -1527,6 +1586,10 @@ int QuestParserCollection::DispatchEventMerc(
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (_encounter_quest_status.empty()) {
+		return 0;
+	}
+
 	int ret = 0;
 
 	for (const auto& e: _load_precedence) {
@@ -36,8 +36,11 @@
 
 #include "zone_config.h"
 
+#include <array>
+#include <bitset>
 #include <list>
 #include <map>
+#include <unordered_map>
 
 #define QuestFailedToLoad 0xFFFFFFFF
 #define QuestUnloaded 0x00
@@ -174,6 +177,15 @@ public:
 
 	void GetErrors(std::list<std::string> &quest_errors);
 
+	// events that reached a quest interface vs. events dropped because nothing handles them
+	struct EventStats {
+		uint64 fired           = 0;
+		uint64 short_circuited = 0;
+	};
+
+	const EventStats& GetEventStats(QuestEventID event_id) const { return _event_stats[event_id]; }
+	void ResetEventStats();
+
 	/*
 		Internally used memory reference for all Perl Event Export Settings
 		Some exports are very taxing on CPU given how much an event is called.
@@ -196,12 +208,17 @@ public:
 	void LoadPerlEventExportSettings(PerlEventExportSettings* s);
 
 private:
+	// one bit per event with a handler, built when a script is loaded so checks never reach the interface
+	using QuestEventMask = std::bitset<_LargestEventID>;
+
 	bool HasQuestSubLocal(uint32 npc_id, QuestEventID event_id);
 	bool HasQuestSubGlobal(QuestEventID event_id);
 	bool NPCHasEncounterSub(uint32 npc_id, QuestEventID event_id);
 	bool PlayerHasQuestSubLocal(QuestEventID event_id);
 	bool PlayerHasQuestSubGlobal(QuestEventID event_id);
 	bool PlayerHasEncounterSub(QuestEventID event_id);
+	bool SpellHasQuestSubLocal(uint32 spell_id, QuestEventID event_id);
+	bool ItemHasQuestSubLocal(EQ::ItemInstance* inst, QuestEventID event_id);
 	bool SpellHasEncounterSub(uint32 spell_id, QuestEventID event_id);
 	bool ItemHasEncounterSub(EQ::ItemInstance* inst, QuestEventID event_id);
 	bool HasEncounterSub(QuestEventID event_id, const std::string& package_name);
@@ -210,6 +227,8 @@ private:
 	bool MercHasQuestSubLocal(QuestEventID event_id);
 	bool MercHasQuestSubGlobal(QuestEventID event_id);
 
+	void CountEvent(QuestEventID event_id, bool fired);
+
 	int EventNPCLocal(
 		QuestEventID event_id,
 		NPC* npc,
@@ -362,6 +381,17 @@ private:
 	std::map<uint32, uint32>      _spell_quest_status;
 	std::map<uint32, uint32>      _item_quest_status;
 	std::map<std::string, uint32> _encounter_quest_status;
+
+	std::unordered_map<uint32, QuestEventMask> _npc_quest_subs;
+	QuestEventMask                             _global_npc_quest_subs;
+	QuestEventMask                             _player_quest_subs;
+	QuestEventMask                             _global_player_quest_subs;
+	QuestEventMask                             _bot_quest_subs;
+	QuestEventMask                             _global_bot_quest_subs;
+	QuestEventMask                             _merc_quest_subs;
+	QuestEventMask                             _global_merc_quest_subs;
+
+	std::array<EventStats, _LargestEventID> _event_stats{};
 };
 
 extern QuestParserCollection *parse;
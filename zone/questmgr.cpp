@@ -24,6 +24,7 @@
 #include "../common/spdat.h"
 #include "../common/strings.h"
 #include "../common/say_link.h"
+#include "../common/tick_profiler.h"
 #include "../common/events/player_event_logs.h"
 
 #include "entity.h"
@@ -85,32 +86,73 @@ QuestManager::~QuestManager() {
 }
 
 void QuestManager::Process() {
-	std::list<QuestTimer>::iterator cur = QTimerList.begin(), end;
-
-	end = QTimerList.end();
-	while (cur != end) {
-		if (cur->Timer_.Enabled() && cur->Timer_.Check()) {
-			if (cur->mob) {
-				if (cur->mob->IsEncounter()) {
-					parse->EventEncounter(EVENT_TIMER, cur->mob->CastToEncounter()->GetEncounterName(), cur->name, 0, nullptr);
-				} else {
-					parse->EventMob(EVENT_TIMER, cur->mob, nullptr, [&]() { return cur->name; }, 0);
-				}
+	TICK_PROFILE("QuestManager::Process");
 
-				//we MUST reset our iterator since the quest could have removed/added any
-				//number of timers... worst case we have to check a bunch of timers twice
-				cur = QTimerList.begin();
-				end = QTimerList.end();    //dunno if this is needed, cant hurt...
-			}
-			else {
-				cur = QTimerList.erase(cur);
-			}
+	// only timers that have come due are looked at, and they fire in the order they were first set like the list they
+	// used to be scanned from. The event can add, restart or stop any timer (this one included) so nothing is held
+	// across it but the handle.
+	const uint64 now = QuestTimerClock();
+
+	std::vector<QuestTimerDue> due;
+	while (!quest_timer_heap.empty() && quest_timer_heap.top().due <= now) {
+		due.emplace_back(quest_timer_heap.top());
+		quest_timer_heap.pop();
+	}
+
+	std::sort(
+		due.begin(),
+		due.end(),
+		[](const QuestTimerDue &a, const QuestTimerDue &b) {
+			return a.id < b.id;
+		}
+	);
+
+	for (const auto &d : due) {
+		auto it = quest_timers.find(d.id);
+		if (it == quest_timers.end() || it->second.sequence != d.sequence) {
+			continue;
 		}
-		else {
-			++cur;
+
+		auto &t = it->second;
+		if (!t.mob) {
+			RemoveQuestTimer(d.id);
+			continue;
+		}
+
+		// the timer has the final say on when it fires, the due time is only when to ask it
+		if (!t.Timer_.Check()) {
+			ScheduleQuestTimer(d.id, t);
+			continue;
+		}
+
+		ScheduleQuestTimer(d.id, t);
+
+		Mob               *mob = t.mob;
+		const std::string name = t.name;
+		if (mob->IsEncounter()) {
+			parse->EventEncounter(EVENT_TIMER, mob->CastToEncounter()->GetEncounterName(), name, 0, nullptr);
+		} else {
+			parse->EventMob(EVENT_TIMER, mob, nullptr, [&]() { return name; }, 0);
 		}
 	}
 
+	// restarted timers leave stale entries behind, a script restarting a timer every tick would grow the heap forever
+	if (quest_timer_heap.size() > quest_timers.size() * 2 + 64) {
+		std::vector<QuestTimerDue> l;
+		l.reserve(quest_timers.size());
+		while (!quest_timer_heap.empty()) {
+			const auto &d = quest_timer_heap.top();
+			auto       it = quest_timers.find(d.id);
+			if (it != quest_timers.end() && it->second.sequence == d.sequence) {
+				l.emplace_back(d);
+			}
+
+			quest_timer_heap.pop();
+		}
+
+		quest_timer_heap = decltype(quest_timer_heap)(std::greater<>(), std::move(l));
+	}
+
 	auto cur_iter = STimerList.begin();
 	while(cur_iter != STimerList.end()) {
 		if(!cur_iter->Timer_.Enabled()) {
@@ -139,14 +181,8 @@ void QuestManager::EndQuest() {
 	running_quest run = quests_running_.top();
 	if(run.depop_npc && run.owner->IsNPC()) {
 		//clear out any timers for them...
-		std::list<QuestTimer>::iterator cur = QTimerList.begin(), end;
-
-		end = QTimerList.end();
-		while (cur != end) {
-			if (cur->mob == run.owner)
-				cur = QTimerList.erase(cur);
-			else
-				++cur;
+		for (auto id : GetQuestTimerIDs(run.owner)) {
+			RemoveQuestTimer(id);
 		}
 		run.owner->Depop();
 	}
@@ -154,7 +190,130 @@ void QuestManager::EndQuest() {
 }
 
 void QuestManager::ClearAllTimers() {
-	QTimerList.clear();
+	quest_timers.clear();
+	quest_timers_by_mob.clear();
+	quest_timer_heap = {};
+}
+
+uint64 QuestManager::QuestTimerClock() {
+	const uint32 now = Timer::GetCurrentTime();
+	quest_timer_clock += now - quest_timer_clock_last;
+	quest_timer_clock_last = now;
+	return quest_timer_clock;
+}
+
+QuestManager::QuestTimer *QuestManager::FindQuestTimer(const Mob *m, const std::string &name, uint64 *id) {
+	auto o = quest_timers_by_mob.find(m);
+	if (o == quest_timers_by_mob.end()) {
+		return nullptr;
+	}
+
+	auto n = o->second.find(name);
+	if (n == o->second.end()) {
+		return nullptr;
+	}
+
+	if (id) {
+		*id = n->second;
+	}
+
+	return &quest_timers.at(n->second);
+}
+
+void QuestManager::AddQuestTimer(uint32 milliseconds, Mob *m, const std::string &name) {
+	const uint64 id = next_quest_timer_id++;
+
+	auto &t = quest_timers.emplace(id, QuestTimer(milliseconds, m, name)).first->second;
+	quest_timers_by_mob[m][name] = id;
+
+	ScheduleQuestTimer(id, t);
+}
+
+void QuestManager::ScheduleQuestTimer(uint64 id, QuestTimer &t) {
+	t.sequence = next_quest_timer_sequence++;
+
+	// a timer fires once more than its duration has gone by since it started
+	if (t.Timer_.Enabled()) {
+		quest_timer_heap.push(QuestTimerDue{
+			.due = QuestTimerClock() + t.Timer_.GetRemainingTime() + 1,
+			.id = id,
+			.sequence = t.sequence
+		});
+	}
+}
+
+void QuestManager::RemoveQuestTimer(uint64 id) {
+	auto it = quest_timers.find(id);
+	if (it == quest_timers.end()) {
+		return;
+	}
+
+	auto o = quest_timers_by_mob.find(it->second.mob);
+	if (o != quest_timers_by_mob.end()) {
+		o->second.erase(it->second.name);
+		if (o->second.empty()) {
+			quest_timers_by_mob.erase(o);
+		}
+	}
+
+	// the heap entry goes stale and is dropped when it comes up
+	quest_timers.erase(it);
+}
+
+std::vector<uint64> QuestManager::GetQuestTimerIDs(const Mob *m) const {
+	std::vector<uint64> l;
+
+	auto o = quest_timers_by_mob.find(m);
+	if (o != quest_timers_by_mob.end()) {
+		l.reserve(o->second.size());
+		for (const auto &e : o->second) {
+			l.emplace_back(e.second);
+		}
+
+		std::sort(l.begin(), l.end());
+	}
+
+	return l;
+}
+
+std::vector<QuestManager::QuestTimerInfo> QuestManager::GetQuestTimers(Mob *m) {
+	std::vector<QuestTimerInfo> l;
+	for (auto id : GetQuestTimerIDs(m)) {
+		auto &t = quest_timers.at(id);
+		l.emplace_back(
+			QuestTimerInfo{
+				.name = t.name,
+				.remaining = t.Timer_.GetRemainingTime(),
+				.duration = t.Timer_.GetDuration()
+			}
+		);
+	}
+
+	return l;
+}
+
+std::map<std::string, uint32> QuestManager::GetQuestTimerCountsByScript() const {
+	std::map<std::string, uint32> l;
+	for (const auto &[m, timers] : quest_timers_by_mob) {
+		std::string script;
+		if (!m) {
+			script = "Unowned";
+		} else if (m->IsEncounter()) {
+			script = fmt::format("Encounter {}", m->CastToEncounter()->GetEncounterName());
+		} else if (m->IsNPC()) {
+			script = fmt::format("NPC {} ({})", m->GetCleanName(), m->GetNPCTypeID());
+		} else if (m->IsBot()) {
+			script = "Bot";
+		} else if (m->IsClient()) {
+			script = "Player";
+		} else {
+			script = "Other";
+		}
+
+		l[script] += timers.size();
+	}
+
+	return l;
 }
 
 //quest perl functions
@@ -553,19 +712,17 @@ void QuestManager::settimer(const std::string& timer_name, uint32 seconds, Mob*
 		);
 	};
 
-	if (!QTimerList.empty()) {
-		for (auto& e : QTimerList) {
-			if (e.mob && e.mob == mob && e.name == timer_name) {
-				e.Timer_.Start(seconds * 1000, false);
+	uint64 id = 0;
+	if (auto e = FindQuestTimer(mob, timer_name, &id)) {
+		e->Timer_.Start(seconds * 1000, false);
+		ScheduleQuestTimer(id, *e);
 
-				parse->EventMob(EVENT_TIMER_START, mob, nullptr, f);
+		parse->EventMob(EVENT_TIMER_START, mob, nullptr, f);
 
-				return;
-			}
-		}
+		return;
 	}
 
-	QTimerList.emplace_back(QuestTimer(seconds * 1000, mob, timer_name));
+	AddQuestTimer(seconds * 1000, mob, timer_name);
 
 	parse->EventMob(EVENT_TIMER_START, mob, nullptr, f);
 }
@@ -602,19 +759,17 @@ void QuestManager::settimerMS(const std::string& timer_name, uint32 milliseconds
 		return;
 	}
 
-	if (!QTimerList.empty()) {
-		for (auto& e : QTimerList) {
-			if (e.mob && e.mob == owner && e.name == timer_name) {
-				e.Timer_.Start(milliseconds, false);
+	uint64 id = 0;
+	if (auto e = FindQuestTimer(owner, timer_name, &id)) {
+		e->Timer_.Start(milliseconds, false);
+		ScheduleQuestTimer(id, *e);
 
-				parse->EventMob(EVENT_TIMER_START, owner, nullptr, f);
+		parse->EventMob(EVENT_TIMER_START, owner, nullptr, f);
 
-				return;
-			}
-		}
+		return;
 	}
 
-	QTimerList.emplace_back(QuestTimer(milliseconds, owner, timer_name));
+	AddQuestTimer(milliseconds, owner, timer_name);
 
 	parse->EventMob(EVENT_TIMER_START, owner, nullptr, f);
 }
@@ -640,19 +795,17 @@ void QuestManager::settimerMS(const std::string& timer_name, uint32 milliseconds
 		);
 	};
 
-	if (!QTimerList.empty()) {
-		for (auto& e : QTimerList) {
-			if (e.mob && e.mob == m && e.name == timer_name) {
-				e.Timer_.Start(milliseconds, false);
+	uint64 id = 0;
+	if (auto e = FindQuestTimer(m, timer_name, &id)) {
+		e->Timer_.Start(milliseconds, false);
+		ScheduleQuestTimer(id, *e);
 
-				parse->EventMob(EVENT_TIMER_START, m, nullptr, f);
+		parse->EventMob(EVENT_TIMER_START, m, nullptr, f);
 
-				return;
-			}
-		}
+		return;
 	}
 
-	QTimerList.emplace_back(QuestTimer(milliseconds, m, timer_name));
+	AddQuestTimer(milliseconds, m, timer_name);
 
 	parse->EventMob(EVENT_TIMER_START, m, nullptr, f);
 }
@@ -675,17 +828,11 @@ void QuestManager::stoptimer(const std::string& timer_name)
 		return;
 	}
 
-	if (QTimerList.empty()) {
-		return;
-	}
-
-	for (auto e = QTimerList.begin(); e != QTimerList.end(); ++e) {
-		if (e->mob && e->mob == owner && e->name == timer_name) {
-			parse->EventMob(EVENT_TIMER_STOP, owner, nullptr, [&]() { return timer_name; });
+	uint64 id = 0;
+	if (FindQuestTimer(owner, timer_name, &id)) {
+		parse->EventMob(EVENT_TIMER_STOP, owner, nullptr, [&]() { return timer_name; });
 
-			QTimerList.erase(e);
-			break;
-		}
+		RemoveQuestTimer(id);
 	}
 }
 
@@ -702,17 +849,11 @@ void QuestManager::stoptimer(const std::string& timer_name, Mob* m)
 		return;
 	}
 
-	if (QTimerList.empty()) {
-		return;
-	}
-
-	for (auto e = QTimerList.begin(); e != QTimerList.end(); ++e) {
-		if (e->mob && e->mob == m && e->name == timer_name) {
-			parse->EventMob(EVENT_TIMER_STOP, m, nullptr, [&]() { return timer_name; });
+	uint64 id = 0;
+	if (FindQuestTimer(m, timer_name, &id)) {
+		parse->EventMob(EVENT_TIMER_STOP, m, nullptr, [&]() { return timer_name; });
 
-			QTimerList.erase(e);
-			break;
-		}
+		RemoveQuestTimer(id);
 	}
 }
 
@@ -743,18 +884,16 @@ void QuestManager::stopalltimers()
 		return;
 	}
 
-	if (QTimerList.empty()) {
-		return;
-	}
+	for (auto id : GetQuestTimerIDs(owner)) {
+		auto e = quest_timers.find(id);
+		if (e == quest_timers.end()) {
+			continue;
+		}
 
-	for (auto e = QTimerList.begin(); e != QTimerList.end();) {
-		if (e->mob && e->mob == owner) {
-			parse->EventMob(EVENT_TIMER_STOP, owner, nullptr, [&]() { return e->name; });
+		const std::string name = e->second.name;
+		parse->EventMob(EVENT_TIMER_STOP, owner, nullptr, [&]() { return name; });
 
-			e = QTimerList.erase(e);
-		} else {
-			++e;
-		}
+		RemoveQuestTimer(id);
 	}
 }
 
@@ -785,18 +924,16 @@ void QuestManager::stopalltimers(Mob* m)
 		return;
 	}
 
-	if (QTimerList.empty()) {
-		return;
-	}
+	for (auto id : GetQuestTimerIDs(m)) {
+		auto e = quest_timers.find(id);
+		if (e == quest_timers.end()) {
+			continue;
+		}
 
-	for (auto e = QTimerList.begin(); e != QTimerList.end();) {
-		if (e->mob && e->mob == m) {
-			parse->EventMob(EVENT_TIMER_STOP, m, nullptr, [&]() { return e->name; });
+		const std::string name = e->second.name;
+		parse->EventMob(EVENT_TIMER_STOP, m, nullptr, [&]() { return name; });
 
-			e = QTimerList.erase(e);
-		} else {
-			++e;
-		}
+		RemoveQuestTimer(id);
 	}
 }
 
@@ -814,7 +951,7 @@ void QuestManager::pausetimer(const std::string& timer_name, Mob* m)
 		return;
 	}
 
-	if (QTimerList.empty()) {
+	if (quest_timers.empty()) {
 		return;
 	}
 
@@ -827,14 +964,10 @@ void QuestManager::pausetimer(const std::string& timer_name, Mob* m)
 
 	uint32 milliseconds = 0;
 
-	if (!QTimerList.empty()) {
-		for (auto e = QTimerList.begin(); e != QTimerList.end(); ++e) {
-			if (e->mob && e->mob == mob && e->name == timer_name) {
-				milliseconds = e->Timer_.GetRemainingTime();
-				QTimerList.erase(e);
-				break;
-			}
-		}
+	uint64 id = 0;
+	if (auto e = FindQuestTimer(mob, timer_name, &id)) {
+		milliseconds = e->Timer_.GetRemainingTime();
+		RemoveQuestTimer(id);
 	}
 
 	PTimerList.emplace_back(
@@ -897,26 +1030,21 @@ void QuestManager::resumetimer(const std::string& timer_name, Mob* m)
 		);
 	};
 
-	if (!QTimerList.empty()) {
-		for (auto e : QTimerList) {
-			if (e.mob && e.mob == mob && e.name == timer_name) {
-				e.Timer_.Enable();
-				e.Timer_.Start(milliseconds, false);
-				LogQuests(
-					"Resuming timer [{}] for [{}] with [{}] ms remaining",
-					timer_name,
-					owner->GetName(),
-					milliseconds
-				);
+	// a timer set again while this one was paused keeps running as it was set
+	if (FindQuestTimer(mob, timer_name)) {
+		LogQuests(
+			"Resuming timer [{}] for [{}] with [{}] ms remaining",
+			timer_name,
+			owner->GetName(),
+			milliseconds
+		);
 
-				parse->EventMob(EVENT_TIMER_RESUME, mob, nullptr, f);
+		parse->EventMob(EVENT_TIMER_RESUME, mob, nullptr, f);
 
-				return;
-			}
-		}
+		return;
 	}
 
-	QTimerList.emplace_back(QuestTimer(milliseconds, mob, timer_name));
+	AddQuestTimer(milliseconds, mob, timer_name);
 
 	parse->EventMob(EVENT_TIMER_RESUME, mob, nullptr, f);
 
@@ -968,15 +1096,7 @@ bool QuestManager::hastimer(const std::string& timer_name, Mob* m)
 		return false;
 	}
 
-	const auto& e = std::find_if(
-		QTimerList.begin(),
-		QTimerList.end(),
-		[&timer_name, &mob](QuestTimer e) {
-			return e.mob && e.mob == mob && e.name == timer_name;
-		}
-	);
-
-	return e != QTimerList.end();
+	return mob && FindQuestTimer(mob, timer_name);
 }
 
 uint32 QuestManager::getremainingtimeMS(const std::string& timer_name, Mob* m)
@@ -993,15 +1113,9 @@ uint32 QuestManager::getremainingtimeMS(const std::string& timer_name, Mob* m)
 		return 0;
 	}
 
-	const auto& e = std::find_if(
-		QTimerList.begin(),
-		QTimerList.end(),
-		[&timer_name, &mob](QuestTimer e) {
-			return e.mob && e.mob == mob && e.name == timer_name;
-		}
-	);
+	const auto e = FindQuestTimer(mob, timer_name);
 
-	return e != QTimerList.end() ? e->Timer_.GetRemainingTime() : 0;
+	return e ? e->Timer_.GetRemainingTime() : 0;
 }
 
 uint32 QuestManager::gettimerdurationMS(const std::string& timer_name, Mob* m)
@@ -1018,15 +1132,9 @@ uint32 QuestManager::gettimerdurationMS(const std::string& timer_name, Mob* m)
 		return 0;
 	}
 
-	const auto& e = std::find_if(
-		QTimerList.begin(),
-		QTimerList.end(),
-		[&timer_name, &mob](QuestTimer e) {
-			return e.mob && e.mob == mob && e.name == timer_name;
-		}
-	);
+	const auto e = FindQuestTimer(mob, timer_name);
 
-	return e != QTimerList.end() ? e->Timer_.GetDuration() : 0;
+	return e ? e->Timer_.GetDuration() : 0;
 }
 
 void QuestManager::emote(const char *str) {
@@ -4592,15 +4700,22 @@ void QuestManager::SpawnCircle(uint32 npc_id, glm::vec4 position, float radius,
 
 	glm::vec4 npc_position = position;
 
+	std::vector<Mob*> npcs;
+	npcs.reserve(points);
+
 	for (uint32 i = 0; i < points; i++) {
 		float angle = 2 * M_PI * i / points;
 
 		npc_position.x = position.x + radius * std::cos(angle);
 		npc_position.y = position.y + radius * std::sin(angle);
 
-		NPC* n = new NPC(t, nullptr, npc_position, GravityBehavior::Water);
+		npcs.emplace_back(new NPC(t, nullptr, npc_position, GravityBehavior::Water));
+	}
 
-		n->FixZ();
+	Mob::FixZBatch(npcs);
+
+	for (auto m : npcs) {
+		NPC* n = m->CastToNPC();
 
 		n->AddLootTable();
 
@@ -4632,6 +4747,9 @@ void QuestManager::SpawnGrid(uint32 npc_id, glm::vec4 position, float spacing, u
 
 	uint32 spawned = 0;
 
+	std::vector<Mob*> npcs;
+	npcs.reserve(spawn_count);
+
 	for (uint32 row = 0; row < rows; row++) {
 		for (uint32 column = 0; column < columns; column++) {
 			if (spawned >= spawn_count) {
@@ -4641,20 +4759,24 @@ void QuestManager::SpawnGrid(uint32 npc_id, glm::vec4 position, float spacing, u
 			npc_position.x = start_x + column * spacing;
 			npc_position.y = start_y + row * spacing;
 
-			NPC* n = new NPC(t, nullptr, npc_position, GravityBehavior::Water);
+			npcs.emplace_back(new NPC(t, nullptr, npc_position, GravityBehavior::Water));
 
-			n->FixZ();
+			spawned++;
+		}
+	}
 
-			n->AddLootTable();
+	Mob::FixZBatch(npcs);
 
-			if (n->DropsGlobalLoot()) {
-				n->CheckGlobalLootTables();
-			}
+	for (auto m : npcs) {
+		NPC* n = m->CastToNPC();
 
-			entity_list.AddNPC(n, true, true);
+		n->AddLootTable();
 
-			spawned++;
+		if (n->DropsGlobalLoot()) {
+			n->CheckGlobalLootTables();
 		}
+
+		entity_list.AddNPC(n, true, true);
 	}
 }
 
@@ -22,7 +22,10 @@
 #include "tasks.h"
 
 #include <list>
+#include <map>
+#include <queue>
 #include <stack>
+#include <unordered_map>
 
 class Client;
 class Mob;
@@ -61,6 +64,17 @@ public:
 	void ClearTimers(Mob *who);
 	void ClearAllTimers();
 
+	struct QuestTimerInfo {
+		std::string name;
+		uint32      remaining;
+		uint32      duration;
+	};
+
+	// running timers of one owner in the order they were first set, and the count of running timers per quest script
+	std::vector<QuestTimerInfo> GetQuestTimers(Mob *m);
+	std::map<std::string, uint32> GetQuestTimerCountsByScript() const;
+	size_t GetQuestTimerCount() const { return quest_timers.size(); }
+
 	//quest functions
 	void echo(int colour, const char *str);
 	void say(const char *str, Journal::Options &opts);
@@ -403,7 +417,26 @@ private:
 		Mob*   mob;
 		std::string name;
 		Timer Timer_;
+		uint64 sequence = 0; // which due entry is current, bumped every time the timer is rescheduled
 	};
+
+	// A quest timer's due time in the heap Process pops from. Stopping or restarting a timer leaves its old entry behind,
+	// the entry is dropped when popped because the timer is gone or its sequence moved on.
+	struct QuestTimerDue {
+		uint64 due;
+		uint64 id;
+		uint64 sequence;
+
+		bool operator>(const QuestTimerDue &o) const { return due != o.due ? due > o.due : id > o.id; }
+	};
+
+	QuestTimer *FindQuestTimer(const Mob *m, const std::string &name, uint64 *id = nullptr);
+	void AddQuestTimer(uint32 milliseconds, Mob *m, const std::string &name);
+	void ScheduleQuestTimer(uint64 id, QuestTimer &t);
+	void RemoveQuestTimer(uint64 id);
+	std::vector<uint64> GetQuestTimerIDs(const Mob *m) const;
+	uint64 QuestTimerClock();
+
 	class SignalTimer {
 	public:
 		inline SignalTimer(int duration, int _npc_id, int _signal_id) : npc_id(_npc_id), signal_id(_signal_id), Timer_(duration) { Timer_.Start(duration, false); }
@@ -411,7 +444,17 @@ private:
 		int signal_id;
 		Timer Timer_;
 	};
-	std::list<QuestTimer>	QTimerList;
+	// quest timers by handle, handles are handed out in creation order and never reused so they also order timers
+	// that come due on the same millisecond the way they were set
+	std::unordered_map<uint64, QuestTimer>                                         quest_timers;
+	std::unordered_map<const Mob *, std::unordered_map<std::string, uint64>>       quest_timers_by_mob;
+	std::priority_queue<QuestTimerDue, std::vector<QuestTimerDue>, std::greater<>> quest_timer_heap;
+
+	uint64 next_quest_timer_id       = 1;
+	uint64 next_quest_timer_sequence = 1;
+	uint64 quest_timer_clock         = 0; // Timer::GetCurrentTime() widened so due times do not wrap
+	uint32 quest_timer_clock_last    = 0;
+
 	std::list<SignalTimer>	STimerList;
 	std::list<PausedTimer>	PTimerList;
 };
@@ -6,7 +6,21 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <stdio.h>
+#include <algorithm>
+#include <filesystem>
 #include <vector>
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#endif
+#ifdef _WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 // This code snippet allows you to create an axis aligned bounding volume tree for a triangle mesh so that you can do
 // high-speed raycasting.
@@ -673,9 +687,13 @@ public:
 				for (RmUint32 i=0; i<count; i++)
 				{
 					RmUint32 tri = *scan++;
-					if ( raycastTriangles[tri] != raycastFrame )
+					// without a dedupe buffer a triangle shared by several leaves is simply tested again
+					if ( !raycastTriangles || raycastTriangles[tri] != raycastFrame )
 					{
-						raycastTriangles[tri] = raycastFrame;
+						if ( raycastTriangles )
+						{
+							raycastTriangles[tri] = raycastFrame;
+						}
 						RmUint32 i1 = indices[tri*3+0];
 						RmUint32 i2 = indices[tri*3+1];
 						RmUint32 i3 = indices[tri*3+2];
@@ -735,6 +753,349 @@ public:
 		RmUint32		mLeafTriangleIndex;	// if it is a leaf node; then these are the triangle indices.
 	};
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Packet raycasting
+//
+// raycastBatch walks the tree with RM_LANES rays at a time: a node is visited when any ray of the packet may enter it,
+// and a leaf triangle is tested against every ray that reached the leaf. Each ray keeps its own nearest hit with the
+// same tie break as the single ray walk. A ray only ever finds the triangles it really crosses, and the leaf holding
+// its nearest hit is always one it enters, so visiting more nodes for the rest of the packet cannot change its answer.
+//
+// The lane width is picked at compile time: 8 with AVX, 4 with SSE2 (every x86-64 build), otherwise the batch calls
+// fall back to one raycastReadOnly per ray.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__AVX__)
+#define RM_LANES 8
+#define RM_LANES_NAME "AVX"
+typedef __m256 RmLanes;
+static inline RmLanes lanesSet(RmReal x) { return _mm256_set1_ps(x); }
+static inline RmLanes lanesLoad(const RmReal *p) { return _mm256_load_ps(p); }
+static inline void lanesStore(RmReal *p, RmLanes a) { _mm256_store_ps(p, a); }
+static inline RmLanes lanesAdd(RmLanes a, RmLanes b) { return _mm256_add_ps(a, b); }
+static inline RmLanes lanesSub(RmLanes a, RmLanes b) { return _mm256_sub_ps(a, b); }
+static inline RmLanes lanesMul(RmLanes a, RmLanes b) { return _mm256_mul_ps(a, b); }
+static inline RmLanes lanesDiv(RmLanes a, RmLanes b) { return _mm256_div_ps(a, b); }
+static inline RmLanes lanesMin(RmLanes a, RmLanes b) { return _mm256_min_ps(a, b); }
+static inline RmLanes lanesMax(RmLanes a, RmLanes b) { return _mm256_max_ps(a, b); }
+static inline RmLanes lanesLess(RmLanes a, RmLanes b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+static inline RmLanes lanesLessEqual(RmLanes a, RmLanes b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+static inline RmLanes lanesAnd(RmLanes a, RmLanes b) { return _mm256_and_ps(a, b); }
+static inline RmLanes lanesAndNot(RmLanes a, RmLanes b) { return _mm256_andnot_ps(a, b); }
+static inline RmLanes lanesOr(RmLanes a, RmLanes b) { return _mm256_or_ps(a, b); }
+static inline RmUint32 lanesMask(RmLanes a) { return (RmUint32) _mm256_movemask_ps(a); }
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RM_LANES 4
+#define RM_LANES_NAME "SSE2"
+typedef __m128 RmLanes;
+static inline RmLanes lanesSet(RmReal x) { return _mm_set1_ps(x); }
+static inline RmLanes lanesLoad(const RmReal *p) { return _mm_load_ps(p); }
+static inline void lanesStore(RmReal *p, RmLanes a) { _mm_store_ps(p, a); }
+static inline RmLanes lanesAdd(RmLanes a, RmLanes b) { return _mm_add_ps(a, b); }
+static inline RmLanes lanesSub(RmLanes a, RmLanes b) { return _mm_sub_ps(a, b); }
+static inline RmLanes lanesMul(RmLanes a, RmLanes b) { return _mm_mul_ps(a, b); }
+static inline RmLanes lanesDiv(RmLanes a, RmLanes b) { return _mm_div_ps(a, b); }
+static inline RmLanes lanesMin(RmLanes a, RmLanes b) { return _mm_min_ps(a, b); }
+static inline RmLanes lanesMax(RmLanes a, RmLanes b) { return _mm_max_ps(a, b); }
+static inline RmLanes lanesLess(RmLanes a, RmLanes b) { return _mm_cmplt_ps(a, b); }
+static inline RmLanes lanesLessEqual(RmLanes a, RmLanes b) { return _mm_cmple_ps(a, b); }
+static inline RmLanes lanesAnd(RmLanes a, RmLanes b) { return _mm_and_ps(a, b); }
+static inline RmLanes lanesAndNot(RmLanes a, RmLanes b) { return _mm_andnot_ps(a, b); }
+static inline RmLanes lanesOr(RmLanes a, RmLanes b) { return _mm_or_ps(a, b); }
+static inline RmUint32 lanesMask(RmLanes a) { return (RmUint32) _mm_movemask_ps(a); }
+#endif
+
+#ifdef RM_LANES
+
+// how far the packet boxes are grown so the slab test never turns down a node the single ray test would enter
+#define RAYPACKET_EPSILON 0.01f
+
+// node access for the packet walk, the built tree links nodes by pointer
+static inline const RmReal *packetNodeMin(const NodeAABB *n) { return n->mBounds.mMin; }
+static inline const RmReal *packetNodeMax(const NodeAABB *n) { return n->mBounds.mMax; }
+static inline RmUint32 packetNodeLeaf(const NodeAABB *n) { return n->mLeafTriangleIndex; }
+static inline const NodeAABB *packetNodeLeft(const NodeAABB *n, const NodeAABB *) { return n->mLeft; }
+static inline const NodeAABB *packetNodeRight(const NodeAABB *n, const NodeAABB *) { return n->mRight; }
+
+// rayIntersectsTriangle rejects a determinant inside +-0.00001 compared as double, this is the largest float inside
+static RmReal packetDeterminantEpsilon(void)
+{
+	RmReal e = 0.00001f;
+	while ( (double) e >= 0.00001 )
+	{
+		e = nextafterf(e, 0.0f);
+	}
+	return e;
+}
+
+struct alignas(32) RayPacket
+{
+	RmReal   ox[RM_LANES], oy[RM_LANES], oz[RM_LANES];
+	RmReal   dx[RM_LANES], dy[RM_LANES], dz[RM_LANES];
+	RmReal   ix[RM_LANES], iy[RM_LANES], iz[RM_LANES];	// reciprocal direction for the slab test
+	RmReal   nearest[RM_LANES];							// nearest hit so far, starts at the segment length
+	RmUint32 nearestTri[RM_LANES];
+	RmUint32 ray[RM_LANES];								// index into the batch, TRI_EOF for an unused lane
+};
+
+template <class Node>
+static void castPacket(RayPacket &p, const Node *root, const RmReal *vertices, const RmUint32 *indices, const RmUint32 *leafTriangles)
+{
+	static const RmReal detEpsilon = packetDeterminantEpsilon();
+
+	const RmLanes ox = lanesLoad(p.ox), oy = lanesLoad(p.oy), oz = lanesLoad(p.oz);
+	const RmLanes dx = lanesLoad(p.dx), dy = lanesLoad(p.dy), dz = lanesLoad(p.dz);
+	const RmLanes ix = lanesLoad(p.ix), iy = lanesLoad(p.iy), iz = lanesLoad(p.iz);
+	const RmLanes zero = lanesSet(0.0f);
+	const RmLanes one  = lanesSet(1.0f);
+
+	alignas(32) RmReal ts[RM_LANES];
+
+	// the tree is at most 15 levels deep when built and mapped trees are checked for depth on load
+	const Node *stack[64];
+	RmUint32 sp = 0;
+	stack[sp++] = root;
+
+	while ( sp )
+	{
+		const Node *n = stack[--sp];
+
+		const RmReal *bmin = packetNodeMin(n);
+		const RmReal *bmax = packetNodeMax(n);
+
+		RmLanes t1 = lanesMul(lanesSub(lanesSet(bmin[0] - RAYPACKET_EPSILON), ox), ix);
+		RmLanes t2 = lanesMul(lanesSub(lanesSet(bmax[0] + RAYPACKET_EPSILON), ox), ix);
+		RmLanes tmin = lanesMin(t1, t2);
+		RmLanes tmax = lanesMax(t1, t2);
+
+		t1 = lanesMul(lanesSub(lanesSet(bmin[1] - RAYPACKET_EPSILON), oy), iy);
+		t2 = lanesMul(lanesSub(lanesSet(bmax[1] + RAYPACKET_EPSILON), oy), iy);
+		tmin = lanesMax(tmin, lanesMin(t1, t2));
+		tmax = lanesMin(tmax, lanesMax(t1, t2));
+
+		t1 = lanesMul(lanesSub(lanesSet(bmin[2] - RAYPACKET_EPSILON), oz), iz);
+		t2 = lanesMul(lanesSub(lanesSet(bmax[2] + RAYPACKET_EPSILON), oz), iz);
+		tmin = lanesMax(tmin, lanesMin(t1, t2));
+		tmax = lanesMin(tmax, lanesMax(t1, t2));
+
+		const RmLanes reach = lanesAdd(lanesLoad(p.nearest), lanesSet(RAYPACKET_EPSILON));
+		const RmLanes enter = lanesAnd(
+			lanesAnd(lanesLessEqual(tmin, tmax), lanesLessEqual(zero, tmax)),
+			lanesLessEqual(tmin, reach)
+		);
+
+		const RmUint32 enterMask = lanesMask(enter);
+		if ( !enterMask )
+		{
+			continue;
+		}
+
+		const RmUint32 leaf = packetNodeLeaf(n);
+		if ( leaf == TRI_EOF )
+		{
+			// right goes on first so the left side is walked first, like the single ray walk
+			const Node *right = packetNodeRight(n, root);
+			const Node *left = packetNodeLeft(n, root);
+			if ( right )
+			{
+				stack[sp++] = right;
+			}
+			if ( left )
+			{
+				stack[sp++] = left;
+			}
+			continue;
+		}
+
+		const RmUint32 *scan = &leafTriangles[leaf];
+		RmUint32 count = *scan++;
+		for (RmUint32 i=0; i<count; i++)
+		{
+			RmUint32 tri = *scan++;
+			const RmReal *v0 = &vertices[indices[tri*3+0]*3];
+			const RmReal *v1 = &vertices[indices[tri*3+1]*3];
+			const RmReal *v2 = &vertices[indices[tri*3+2]*3];
+
+			// the same operations in the same order as rayIntersectsTriangle, so every lane gets the same t
+			RmReal e1[3],e2[3];
+			vector(e1,v1,v0);
+			vector(e2,v2,v0);
+
+			const RmLanes e10 = lanesSet(e1[0]), e11 = lanesSet(e1[1]), e12 = lanesSet(e1[2]);
+			const RmLanes e20 = lanesSet(e2[0]), e21 = lanesSet(e2[1]), e22 = lanesSet(e2[2]);
+
+			const RmLanes h0 = lanesSub(lanesMul(dy, e22), lanesMul(e21, dz));
+			const RmLanes h1 = lanesSub(lanesMul(dz, e20), lanesMul(e22, dx));
+			const RmLanes h2 = lanesSub(lanesMul(dx, e21), lanesMul(e20, dy));
+
+			const RmLanes a = lanesAdd(lanesAdd(lanesMul(e10, h0), lanesMul(e11, h1)), lanesMul(e12, h2));
+			RmLanes hit = lanesAndNot(
+				lanesAnd(lanesLessEqual(lanesSet(-detEpsilon), a), lanesLessEqual(a, lanesSet(detEpsilon))),
+				enter
+			);
+			if ( !lanesMask(hit) )
+			{
+				continue;
+			}
+
+			const RmLanes f = lanesDiv(one, a);
+			const RmLanes s0 = lanesSub(ox, lanesSet(v0[0]));
+			const RmLanes s1 = lanesSub(oy, lanesSet(v0[1]));
+			const RmLanes s2 = lanesSub(oz, lanesSet(v0[2]));
+
+			const RmLanes u = lanesMul(f, lanesAdd(lanesAdd(lanesMul(s0, h0), lanesMul(s1, h1)), lanesMul(s2, h2)));
+			hit = lanesAnd(hit, lanesAnd(lanesLessEqual(zero, u), lanesLessEqual(u, one)));
+			if ( !lanesMask(hit) )
+			{
+				continue;
+			}
+
+			const RmLanes q0 = lanesSub(lanesMul(s1, e12), lanesMul(e11, s2));
+			const RmLanes q1 = lanesSub(lanesMul(s2, e10), lanesMul(e12, s0));
+			const RmLanes q2 = lanesSub(lanesMul(s0, e11), lanesMul(e10, s1));
+
+			const RmLanes v = lanesMul(f, lanesAdd(lanesAdd(lanesMul(dx, q0), lanesMul(dy, q1)), lanesMul(dz, q2)));
+			hit = lanesAnd(hit, lanesAnd(lanesLessEqual(zero, v), lanesLessEqual(lanesAdd(u, v), one)));
+
+			const RmLanes t = lanesMul(f, lanesAdd(lanesAdd(lanesMul(e20, q0), lanesMul(e21, q1)), lanesMul(e22, q2)));
+			hit = lanesAnd(hit, lanesLess(zero, t));
+
+			RmUint32 hitMask = lanesMask(hit);
+			if ( !hitMask )
+			{
+				continue;
+			}
+
+			lanesStore(ts, t);
+			for (RmUint32 l=0; l<RM_LANES; l++)
+			{
+				if ( (hitMask & (1u << l)) && (ts[l] < p.nearest[l] || (ts[l] == p.nearest[l] && tri < p.nearestTri[l])) )
+				{
+					p.nearest[l] = ts[l];
+					p.nearestTri[l] = tri;
+				}
+			}
+		}
+	}
+}
+
+// rays that start close together mostly walk the same nodes, so they are ordered along a z-order curve over the mesh
+// bounds before they are packed
+static inline RmUint32 packetSortKey(const RmReal *from, const RmReal *bmin, const RmReal *bmax)
+{
+	RmUint32 key = 0;
+	RmUint32 cell[2];
+	for (RmUint32 a=0; a<2; a++)
+	{
+		RmReal extent = bmax[a] - bmin[a];
+		RmReal f = extent > 0 ? (from[a] - bmin[a]) / extent : 0;
+		f = f < 0 ? 0 : (f > 1 ? 1 : f);
+		cell[a] = (RmUint32) (f * 65535.0f);
+	}
+	for (RmUint32 b=0; b<16; b++)
+	{
+		key |= ((cell[0] >> b) & 1) << (b * 2);
+		key |= ((cell[1] >> b) & 1) << (b * 2 + 1);
+	}
+	return key;
+}
+
+template <class Node>
+static void castBatch(const Node *root, const RmReal *vertices, const RmUint32 *indices, const RmUint32 *leafTriangles,
+					  RmUint32 count, const RmReal *from, const RmReal *to, unsigned char *hit, RmReal *hitLocation, RmReal *hitDistance)
+{
+	std::vector<std::pair<RmUint32, RmUint32>> order;
+	order.reserve(count);
+	for (RmUint32 i=0; i<count; i++)
+	{
+		hit[i] = 0;
+		order.emplace_back(packetSortKey(&from[i*3], packetNodeMin(root), packetNodeMax(root)), i);
+	}
+	std::sort(order.begin(), order.end());
+
+	RayPacket p;
+	RmUint32 next = 0;
+	while ( next < count )
+	{
+		RmUint32 lanes = 0;
+		while ( lanes < RM_LANES && next < count )
+		{
+			const RmUint32 r = order[next++].second;
+			const RmReal *f = &from[r*3];
+			const RmReal *t = &to[r*3];
+
+			// same normalisation as the single ray casts, down to the degenerate length cut off
+			RmReal dir[3];
+			dir[0] = t[0] - f[0];
+			dir[1] = t[1] - f[1];
+			dir[2] = t[2] - f[2];
+			RmReal distance = sqrtf( dir[0]*dir[0] + dir[1]*dir[1]+dir[2]*dir[2] );
+			if ( distance < 0.0000000001f ) continue;
+			RmReal recipDistance = 1.0f / distance;
+			dir[0]*=recipDistance;
+			dir[1]*=recipDistance;
+			dir[2]*=recipDistance;
+
+			p.ox[lanes] = f[0];
+			p.oy[lanes] = f[1];
+			p.oz[lanes] = f[2];
+			p.dx[lanes] = dir[0];
+			p.dy[lanes] = dir[1];
+			p.dz[lanes] = dir[2];
+			// a huge finite reciprocal keeps axis parallel rays out of 0 * inf in the slab test
+			p.ix[lanes] = fabsf(dir[0]) > 1e-20f ? 1.0f / dir[0] : (dir[0] < 0 ? -1e30f : 1e30f);
+			p.iy[lanes] = fabsf(dir[1]) > 1e-20f ? 1.0f / dir[1] : (dir[1] < 0 ? -1e30f : 1e30f);
+			p.iz[lanes] = fabsf(dir[2]) > 1e-20f ? 1.0f / dir[2] : (dir[2] < 0 ? -1e30f : 1e30f);
+			p.nearest[lanes] = distance;
+			p.nearestTri[lanes] = TRI_EOF;
+			p.ray[lanes] = r;
+			lanes++;
+		}
+
+		if ( !lanes )
+		{
+			break;
+		}
+
+		// unused lanes can never enter a node
+		for (RmUint32 l=lanes; l<RM_LANES; l++)
+		{
+			p.ox[l] = p.oy[l] = p.oz[l] = 0;
+			p.dx[l] = p.dy[l] = p.dz[l] = 1;
+			p.ix[l] = p.iy[l] = p.iz[l] = 1;
+			p.nearest[l] = -1e30f;
+			p.nearestTri[l] = TRI_EOF;
+			p.ray[l] = TRI_EOF;
+		}
+
+		castPacket(p, root, vertices, indices, leafTriangles);
+
+		for (RmUint32 l=0; l<lanes; l++)
+		{
+			if ( p.nearestTri[l] == TRI_EOF )
+			{
+				continue;
+			}
+
+			const RmUint32 r = p.ray[l];
+			const RmReal t = p.nearest[l];
+			hit[r] = 1;
+			if ( hitLocation )
+			{
+				hitLocation[r*3+0] = p.ox[l]+p.dx[l]*t;
+				hitLocation[r*3+1] = p.oy[l]+p.dy[l]*t;
+				hitLocation[r*3+2] = p.oz[l]+p.dz[l]*t;
+			}
+			if ( hitDistance )
+			{
+				hitDistance[r] = t;
+			}
+		}
+	}
+}
+
+#endif /*RM_LANES*/
+
 class MyRaycastMesh : public RaycastMesh, public NodeInterface
 {
 public:
@@ -832,6 +1193,38 @@ public:
 		return ret;
 	}
 
+	virtual bool raycastReadOnly(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitDistance) const
+	{
+		bool ret = false;
+
+		RmReal dir[3];
+		dir[0] = to[0] - from[0];
+		dir[1] = to[1] - from[1];
+		dir[2] = to[2] - from[2];
+		RmReal distance = sqrtf( dir[0]*dir[0] + dir[1]*dir[1]+dir[2]*dir[2] );
+		if ( distance < 0.0000000001f ) return false;
+		RmReal recipDistance = 1.0f / distance;
+		dir[0]*=recipDistance;
+		dir[1]*=recipDistance;
+		dir[2]*=recipDistance;
+		RmUint32 nearestTriIndex=TRI_EOF;
+		// no frame counter, dedupe buffer or lazily built face normals are touched, so any number of threads may cast at once
+		mRoot->raycast(ret,from,to,dir,hitLocation,nullptr,hitDistance,mVertices,mIndices,distance,const_cast<MyRaycastMesh *>(this),nullptr,0,mLeafTriangles,nearestTriIndex);
+		return ret;
+	}
+
+	virtual void raycastBatch(RmUint32 count,const RmReal *from,const RmReal *to,unsigned char *hit,RmReal *hitLocation,RmReal *hitDistance) const
+	{
+#ifdef RM_LANES
+		castBatch<NodeAABB>(mRoot, mVertices, mIndices, mLeafTriangles.data(), count, from, to, hit, hitLocation, hitDistance);
+#else
+		for (RmUint32 i=0; i<count; i++)
+		{
+			hit[i] = raycastReadOnly(&from[i*3], &to[i*3], hitLocation ? &hitLocation[i*3] : nullptr, hitDistance ? &hitDistance[i] : nullptr);
+		}
+#endif
+	}
+
 	virtual void release(void)
 	{
 		delete this;
@@ -955,6 +1348,423 @@ public:
 #endif /*USE_MAP_MMFS*/
 };
 
+
+// on disk layout of a mapped mesh, host byte order like the other map formats
+static constexpr char     MAPPED_MESH_MAGIC[8]     = {'E', 'Q', 'R', 'M', 'E', 'S', 'H', '\0'};
+static constexpr RmUint32 MAPPED_MESH_VERSION      = 1;
+static constexpr uint64_t MAPPED_MESH_SECTION_ALIGN = 64;
+
+struct MappedMeshHeader
+{
+	char     magic[8];
+	RmUint32 version;
+	RmUint32 header_size;
+	uint64_t source_size;
+	int64_t  source_mtime;
+	uint64_t file_size;
+	RmUint32 vertex_count;
+	RmUint32 triangle_count;
+	RmUint32 node_count;
+	RmUint32 leaf_triangle_count;
+	// byte offsets from the start of the file
+	uint64_t vertices_offset;
+	uint64_t indices_offset;
+	uint64_t nodes_offset;
+	uint64_t leaf_triangles_offset;
+};
+
+struct MappedNode
+{
+	RmReal   min[3];
+	RmReal   max[3];
+	RmUint32 leaf_triangle_index; // TRI_EOF for inner nodes
+	RmUint32 left;                // node indexes, TRI_EOF when there is no child
+	RmUint32 right;
+};
+
+static_assert(sizeof(MappedMeshHeader) == 88, "mapped mesh header layout changed");
+static_assert(sizeof(MappedNode) == 36, "mapped mesh node layout changed");
+
+// deeper than any tree createRaycastMesh builds, keeps the packet walk stack bounded for mapped files
+static constexpr RmUint32 MAPPED_MESH_MAX_DEPTH = 32;
+
+#ifdef RM_LANES
+// node access for the packet walk, mapped nodes link by index from the root
+static inline const RmReal *packetNodeMin(const MappedNode *n) { return n->min; }
+static inline const RmReal *packetNodeMax(const MappedNode *n) { return n->max; }
+static inline RmUint32 packetNodeLeaf(const MappedNode *n) { return n->leaf_triangle_index; }
+static inline const MappedNode *packetNodeLeft(const MappedNode *n, const MappedNode *root) { return n->left != TRI_EOF ? root + n->left : nullptr; }
+static inline const MappedNode *packetNodeRight(const MappedNode *n, const MappedNode *root) { return n->right != TRI_EOF ? root + n->right : nullptr; }
+#endif /*RM_LANES*/
+
+// Read-only view of a mapped mesh file. Nothing is written after mapping: there is no dedupe buffer (a triangle shared
+// by several leaves is tested again, which cannot change the nearest hit) and face normals are worked out per hit.
+class MappedRaycastMesh : public RaycastMesh
+{
+public:
+	~MappedRaycastMesh(void)
+	{
+		if (mBase) {
+#ifdef _WINDOWS
+			UnmapViewOfFile(mBase);
+#else
+			munmap(const_cast<char *>(mBase), mSize);
+#endif
+		}
+	}
+
+	static MappedRaycastMesh *map(const std::string &file_name)
+	{
+		const char *base = nullptr;
+		size_t     size  = 0;
+
+#ifdef _WINDOWS
+		HANDLE file = CreateFile(
+			file_name.c_str(),
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL,
+			nullptr
+		);
+
+		if (file == INVALID_HANDLE_VALUE) {
+			return nullptr;
+		}
+
+		LARGE_INTEGER file_size;
+		if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < (LONGLONG) sizeof(MappedMeshHeader)) {
+			CloseHandle(file);
+			return nullptr;
+		}
+
+		HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (!mapping) {
+			return nullptr;
+		}
+
+		base = static_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		CloseHandle(mapping);
+		if (!base) {
+			return nullptr;
+		}
+
+		size = static_cast<size_t>(file_size.QuadPart);
+#else
+		int fd = open(file_name.c_str(), O_RDONLY);
+		if (fd == -1) {
+			return nullptr;
+		}
+
+		struct stat st;
+		if (fstat(fd, &st) == -1 || st.st_size < (off_t) sizeof(MappedMeshHeader)) {
+			close(fd);
+			return nullptr;
+		}
+
+		void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (p == MAP_FAILED) {
+			return nullptr;
+		}
+
+		base = static_cast<const char *>(p);
+		size = static_cast<size_t>(st.st_size);
+#endif
+
+		auto m = new MappedRaycastMesh;
+		m->mBase = base;
+		m->mSize = size;
+
+		return m;
+	}
+
+	// every offset and index is checked once here so the raycasts can trust the file
+	bool validate(uint64_t source_size, int64_t source_mtime, std::string &error)
+	{
+		const auto *h = reinterpret_cast<const MappedMeshHeader *>(mBase);
+
+		if (memcmp(h->magic, MAPPED_MESH_MAGIC, sizeof(MAPPED_MESH_MAGIC)) != 0) {
+			error = "bad magic";
+			return false;
+		}
+
+		if (h->version != MAPPED_MESH_VERSION || h->header_size != sizeof(MappedMeshHeader)) {
+			error = "unsupported version";
+			return false;
+		}
+
+		if (h->file_size != mSize) {
+			error = "truncated file";
+			return false;
+		}
+
+		if ((source_size || source_mtime) && (h->source_size != source_size || h->source_mtime != source_mtime)) {
+			error = "built from a different .map, convert it again";
+			return false;
+		}
+
+		auto section_fits = [&](uint64_t offset, uint64_t count, uint64_t element_size) {
+			return offset % MAPPED_MESH_SECTION_ALIGN == 0 &&
+				   offset <= mSize &&
+				   count <= (mSize - offset) / element_size;
+		};
+
+		if (
+			!h->vertex_count ||
+			!h->triangle_count ||
+			!h->node_count ||
+			!section_fits(h->vertices_offset, h->vertex_count, sizeof(RmReal) * 3) ||
+			!section_fits(h->indices_offset, h->triangle_count, sizeof(RmUint32) * 3) ||
+			!section_fits(h->nodes_offset, h->node_count, sizeof(MappedNode)) ||
+			!section_fits(h->leaf_triangles_offset, h->leaf_triangle_count, sizeof(RmUint32))
+		) {
+			error = "bad section bounds";
+			return false;
+		}
+
+		mVcount        = h->vertex_count;
+		mTcount        = h->triangle_count;
+		mNodeCount     = h->node_count;
+		mLeafCount     = h->leaf_triangle_count;
+		mVertices      = reinterpret_cast<const RmReal *>(mBase + h->vertices_offset);
+		mIndices       = reinterpret_cast<const RmUint32 *>(mBase + h->indices_offset);
+		mNodes         = reinterpret_cast<const MappedNode *>(mBase + h->nodes_offset);
+		mLeafTriangles = reinterpret_cast<const RmUint32 *>(mBase + h->leaf_triangles_offset);
+
+		for (RmUint32 i = 0; i < mTcount * 3; i++) {
+			if (mIndices[i] >= mVcount) {
+				error = "triangle index out of range";
+				return false;
+			}
+		}
+
+		// children always come after their parent when the tree is built, which also rules out cycles
+		std::vector<RmUint32> depth(mNodeCount, 0);
+		for (RmUint32 i = 0; i < mNodeCount; i++) {
+			const MappedNode &n = mNodes[i];
+			if (
+				(n.left != TRI_EOF && (n.left <= i || n.left >= mNodeCount)) ||
+				(n.right != TRI_EOF && (n.right <= i || n.right >= mNodeCount))
+			) {
+				error = "node index out of range";
+				return false;
+			}
+
+			if (depth[i] > MAPPED_MESH_MAX_DEPTH) {
+				error = "tree too deep";
+				return false;
+			}
+
+			if (n.left != TRI_EOF) {
+				depth[n.left] = std::max(depth[n.left], depth[i] + 1);
+			}
+			if (n.right != TRI_EOF) {
+				depth[n.right] = std::max(depth[n.right], depth[i] + 1);
+			}
+
+			if (n.leaf_triangle_index != TRI_EOF) {
+				if (n.leaf_triangle_index >= mLeafCount) {
+					error = "leaf index out of range";
+					return false;
+				}
+
+				const RmUint32 count = mLeafTriangles[n.leaf_triangle_index];
+				if (count > mLeafCount - n.leaf_triangle_index - 1) {
+					error = "leaf triangle count out of range";
+					return false;
+				}
+
+				for (RmUint32 t = 1; t <= count; t++) {
+					if (mLeafTriangles[n.leaf_triangle_index + t] >= mTcount) {
+						error = "leaf triangle out of range";
+						return false;
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+
+	virtual bool raycast(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance)
+	{
+		return cast(from, to, hitLocation, hitNormal, hitDistance);
+	}
+
+	virtual bool raycastReadOnly(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitDistance) const
+	{
+		return cast(from, to, hitLocation, nullptr, hitDistance);
+	}
+
+	virtual void raycastBatch(RmUint32 count,const RmReal *from,const RmReal *to,unsigned char *hit,RmReal *hitLocation,RmReal *hitDistance) const
+	{
+#ifdef RM_LANES
+		castBatch(mNodes, mVertices, mIndices, mLeafTriangles, count, from, to, hit, hitLocation, hitDistance);
+#else
+		for (RmUint32 i = 0; i < count; i++) {
+			hit[i] = cast(&from[i*3], &to[i*3], hitLocation ? &hitLocation[i*3] : nullptr, nullptr, hitDistance ? &hitDistance[i] : nullptr);
+		}
+#endif
+	}
+
+	virtual bool bruteForceRaycast(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance)
+	{
+		RmReal dir[3];
+		RmReal distance;
+		if (!direction(from, to, dir, distance)) {
+			return false;
+		}
+
+		bool   ret             = false;
+		RmReal nearestDistance = distance;
+
+		for (RmUint32 tri = 0; tri < mTcount; tri++) {
+			RmReal t;
+			if (intersectTriangle(tri, from, dir, t) && t < nearestDistance) {
+				nearestDistance = t;
+				reportHit(tri, t, from, dir, hitLocation, hitNormal, hitDistance);
+				ret = true;
+			}
+		}
+
+		return ret;
+	}
+
+	virtual const RmReal * getBoundMin(void) const
+	{
+		return mNodes[0].min;
+	}
+
+	virtual const RmReal * getBoundMax(void) const
+	{
+		return mNodes[0].max;
+	}
+
+	virtual void release(void)
+	{
+		delete this;
+	}
+
+private:
+	MappedRaycastMesh(void) = default;
+
+	static bool direction(const RmReal *from, const RmReal *to, RmReal *dir, RmReal &distance)
+	{
+		dir[0] = to[0] - from[0];
+		dir[1] = to[1] - from[1];
+		dir[2] = to[2] - from[2];
+		distance = sqrtf( dir[0]*dir[0] + dir[1]*dir[1]+dir[2]*dir[2] );
+		if ( distance < 0.0000000001f ) return false;
+		RmReal recipDistance = 1.0f / distance;
+		dir[0]*=recipDistance;
+		dir[1]*=recipDistance;
+		dir[2]*=recipDistance;
+		return true;
+	}
+
+	inline bool intersectTriangle(RmUint32 tri, const RmReal *from, const RmReal *dir, RmReal &t) const
+	{
+		const RmReal *p1 = &mVertices[mIndices[tri*3+0]*3];
+		const RmReal *p2 = &mVertices[mIndices[tri*3+1]*3];
+		const RmReal *p3 = &mVertices[mIndices[tri*3+2]*3];
+
+		return rayIntersectsTriangle(from,dir,p1,p2,p3,t);
+	}
+
+	void reportHit(RmUint32 tri, RmReal t, const RmReal *from, const RmReal *dir, RmReal *hitLocation, RmReal *hitNormal, RmReal *hitDistance) const
+	{
+		if ( hitLocation )
+		{
+			hitLocation[0] = from[0]+dir[0]*t;
+			hitLocation[1] = from[1]+dir[1]*t;
+			hitLocation[2] = from[2]+dir[2]*t;
+		}
+		if ( hitNormal )
+		{
+			const RmReal *p1 = &mVertices[mIndices[tri*3+0]*3];
+			const RmReal *p2 = &mVertices[mIndices[tri*3+1]*3];
+			const RmReal *p3 = &mVertices[mIndices[tri*3+2]*3];
+			computePlane(p3,p2,p1,hitNormal);
+		}
+		if ( hitDistance )
+		{
+			*hitDistance = t;
+		}
+	}
+
+	bool cast(const RmReal *from, const RmReal *to, RmReal *hitLocation, RmReal *hitNormal, RmReal *hitDistance) const
+	{
+		RmReal dir[3];
+		RmReal distance;
+		if (!direction(from, to, dir, distance)) {
+			return false;
+		}
+
+		bool     hit             = false;
+		RmUint32 nearestTriIndex = TRI_EOF;
+		castNode(0, hit, from, dir, hitLocation, hitNormal, hitDistance, distance, nearestTriIndex);
+		return hit;
+	}
+
+	// same visiting order and tie break on equal distances as NodeAABB::raycast, so both give the same hit
+	void castNode(RmUint32 index, bool &hit, const RmReal *from, const RmReal *dir, RmReal *hitLocation, RmReal *hitNormal, RmReal *hitDistance, RmReal &nearestDistance, RmUint32 &nearestTriIndex) const
+	{
+		const MappedNode &n = mNodes[index];
+
+		RmReal sect[3];
+		RmReal nd = nearestDistance;
+		if ( !intersectLineSegmentAABB(n.min,n.max,from,dir,nd,sect) )
+		{
+			return;
+		}
+
+		if ( n.leaf_triangle_index != TRI_EOF )
+		{
+			const RmUint32 *scan = &mLeafTriangles[n.leaf_triangle_index];
+			RmUint32 count = *scan++;
+			for (RmUint32 i=0; i<count; i++)
+			{
+				RmUint32 tri = *scan++;
+				RmReal t;
+				if ( intersectTriangle(tri,from,dir,t) )
+				{
+					if ( t < nearestDistance || (t == nearestDistance && tri < nearestTriIndex) )
+					{
+						nearestDistance = t;
+						nearestTriIndex = tri;
+						reportHit(tri,t,from,dir,hitLocation,hitNormal,hitDistance);
+						hit = true;
+					}
+				}
+			}
+			return;
+		}
+
+		if ( n.left != TRI_EOF )
+		{
+			castNode(n.left,hit,from,dir,hitLocation,hitNormal,hitDistance,nearestDistance,nearestTriIndex);
+		}
+		if ( n.right != TRI_EOF )
+		{
+			castNode(n.right,hit,from,dir,hitLocation,hitNormal,hitDistance,nearestDistance,nearestTriIndex);
+		}
+	}
+
+	const char       *mBase         = nullptr;
+	size_t           mSize          = 0;
+	RmUint32         mVcount        = 0;
+	RmUint32         mTcount        = 0;
+	RmUint32         mNodeCount     = 0;
+	RmUint32         mLeafCount     = 0;
+	const RmReal     *mVertices     = nullptr;
+	const RmUint32   *mIndices      = nullptr;
+	const MappedNode *mNodes        = nullptr;
+	const RmUint32   *mLeafTriangles = nullptr;
+};
+
 };
 
 
@@ -998,6 +1808,105 @@ RaycastMesh * createRaycastMesh(RmUint32 vcount,		// The number of vertices in t
 	return static_cast< RaycastMesh * >(m);
 }
 
+const char *getRaycastBatchKernel(void)
+{
+#ifdef RM_LANES
+	return RM_LANES_NAME;
+#else
+	return "scalar";
+#endif
+}
+
+bool writeMappedRaycastMesh(RaycastMesh *rm, const std::string &file_name, uint64_t source_size, int64_t source_mtime)
+{
+	// only a mesh built in this process has the tree to write out
+	auto m = dynamic_cast<MyRaycastMesh *>(rm);
+	if (!m || !m->mRoot || !m->mNodeCount) {
+		return false;
+	}
+
+	auto align = [](uint64_t offset) {
+		return (offset + MAPPED_MESH_SECTION_ALIGN - 1) / MAPPED_MESH_SECTION_ALIGN * MAPPED_MESH_SECTION_ALIGN;
+	};
+
+	MappedMeshHeader h{};
+	memcpy(h.magic, MAPPED_MESH_MAGIC, sizeof(MAPPED_MESH_MAGIC));
+	h.version               = MAPPED_MESH_VERSION;
+	h.header_size           = sizeof(MappedMeshHeader);
+	h.source_size           = source_size;
+	h.source_mtime          = source_mtime;
+	h.vertex_count          = m->mVcount;
+	h.triangle_count        = m->mTcount;
+	h.node_count            = m->mNodeCount;
+	h.leaf_triangle_count   = (RmUint32) m->mLeafTriangles.size();
+	h.vertices_offset       = align(sizeof(MappedMeshHeader));
+	h.indices_offset        = align(h.vertices_offset + sizeof(RmReal) * 3 * h.vertex_count);
+	h.nodes_offset          = align(h.indices_offset + sizeof(RmUint32) * 3 * h.triangle_count);
+	h.leaf_triangles_offset = align(h.nodes_offset + sizeof(MappedNode) * h.node_count);
+	h.file_size             = h.leaf_triangles_offset + sizeof(RmUint32) * h.leaf_triangle_count;
+
+	std::vector<char> out(h.file_size, 0);
+	memcpy(out.data(), &h, sizeof(h));
+	memcpy(out.data() + h.vertices_offset, m->mVertices, sizeof(RmReal) * 3 * h.vertex_count);
+	memcpy(out.data() + h.indices_offset, m->mIndices, sizeof(RmUint32) * 3 * h.triangle_count);
+
+	auto nodes = reinterpret_cast<MappedNode *>(out.data() + h.nodes_offset);
+	for (RmUint32 i = 0; i < m->mNodeCount; i++) {
+		const NodeAABB &src = m->mNodes[i];
+		MappedNode     &dst = nodes[i];
+
+		memcpy(dst.min, src.mBounds.mMin, sizeof(dst.min));
+		memcpy(dst.max, src.mBounds.mMax, sizeof(dst.max));
+		dst.leaf_triangle_index = src.mLeafTriangleIndex;
+		dst.left                = src.mLeft ? (RmUint32) (src.mLeft - m->mNodes) : TRI_EOF;
+		dst.right               = src.mRight ? (RmUint32) (src.mRight - m->mNodes) : TRI_EOF;
+	}
+
+	if (h.leaf_triangle_count) {
+		memcpy(out.data() + h.leaf_triangles_offset, m->mLeafTriangles.data(), sizeof(RmUint32) * h.leaf_triangle_count);
+	}
+
+	// written next to the target and renamed over it, zones that still have the old file mapped keep their copy
+	const std::string tmp_file_name = file_name + ".tmp";
+
+	FILE *f = fopen(tmp_file_name.c_str(), "wb");
+	if (!f) {
+		return false;
+	}
+
+	const bool written = fwrite(out.data(), out.size(), 1, f) == 1;
+	if (fclose(f) != 0 || !written) {
+		std::remove(tmp_file_name.c_str());
+		return false;
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(tmp_file_name, file_name, ec);
+	if (ec) {
+		std::remove(tmp_file_name.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+RaycastMesh *mapRaycastMesh(const std::string &file_name, uint64_t source_size, int64_t source_mtime)
+{
+	auto m = MappedRaycastMesh::map(file_name);
+	if (!m) {
+		return nullptr;
+	}
+
+	std::string error;
+	if (!m->validate(source_size, source_mtime, error)) {
+		LogInfo("Ignoring mapped mesh [{}] - {}", file_name, error);
+		m->release();
+		return nullptr;
+	}
+
+	return static_cast<RaycastMesh *>(m);
+}
+
 #ifdef USE_MAP_MMFS
 RaycastMesh* loadRaycastMesh(std::vector<char>& rm_buffer, bool& load_success)
 {
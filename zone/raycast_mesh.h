@@ -37,6 +37,12 @@ class RaycastMesh
 {
 public:
 	virtual bool raycast(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance) = 0;
+	// same hit result as raycast() but never mutates the mesh (no hit normal), safe to call from multiple threads at once
+	virtual bool raycastReadOnly(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitDistance) const = 0;
+	// casts count rays at once, ray i runs from from[i*3] to to[i*3] and gets the same answer raycastReadOnly gives it.
+	// hit[i] is set to 1 or 0, hitLocation (3 per ray) and hitDistance are only written for rays that hit and may be
+	// null. Read-only like raycastReadOnly.
+	virtual void raycastBatch(RmUint32 count,const RmReal *from,const RmReal *to,unsigned char *hit,RmReal *hitLocation,RmReal *hitDistance) const = 0;
 	virtual bool bruteForceRaycast(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance) = 0;
 
 	virtual const RmReal * getBoundMin(void) const = 0; // return the minimum bounding box
@@ -56,6 +62,21 @@ RaycastMesh * createRaycastMesh(RmUint32 vcount,		// The number of vertices in t
 								RmReal	minAxisSize=0.01f	// once a particular axis is less than this size, stop sub-dividing.
 								);
 
+// name of the instruction set raycastBatch packs rays with ("AVX", "SSE2" or "scalar")
+const char *getRaycastBatchKernel(void);
+
+// A mapped mesh is written once from a mesh built by createRaycastMesh and afterwards mapped read-only straight from the
+// file; nodes refer to each other by index and the vertices, indices and leaf triangles are used where they lie, so every
+// zone process with the same map open shares the page cache pages instead of building its own copy.
+//
+// source_size and source_mtime identify the .map the mesh was built from, a mapped mesh that does not match them is
+// refused. Pass zero for both to skip the check.
+#include <stdint.h>
+#include <string>
+
+bool writeMappedRaycastMesh(RaycastMesh *rm, const std::string &file_name, uint64_t source_size, int64_t source_mtime);
+RaycastMesh *mapRaycastMesh(const std::string &file_name, uint64_t source_size, int64_t source_mtime);
+
 #ifdef USE_MAP_MMFS
 #include <vector>
 
@@ -0,0 +1,120 @@
+#include "spatial_grid.h"
+#include "mob.h"
+
+void SpatialGrid::SetCellSize(float cell_size)
+{
+	if (cell_size <= 0.0f || cell_size == m_cell_size) {
+		return;
+	}
+
+	m_cell_size = cell_size;
+
+	// re-bucket everything we are tracking against the new cell size
+	std::vector<Mob *> mobs;
+	mobs.reserve(m_mob_cells.size());
+	for (const auto &e: m_mob_cells) {
+		mobs.emplace_back(e.second.mob);
+	}
+
+	Clear();
+
+	for (auto m: mobs) {
+		Add(m);
+	}
+}
+
+void SpatialGrid::Add(Mob *mob)
+{
+	if (!mob || mob->GetID() == 0) {
+		return;
+	}
+
+	const uint16 id = mob->GetID();
+	if (m_mob_cells.find(id) != m_mob_cells.end()) {
+		Remove(id);
+	}
+
+	const uint64 key = GetCellKey(GetCell(mob->GetX(), mob->GetY()));
+
+	InsertIntoCell(key, mob);
+	m_mob_cells[id] = Entry{.cell_key = key, .mob = mob};
+
+	UpdateWideAggro(id, mob);
+}
+
+void SpatialGrid::Remove(uint16 entity_id)
+{
+	auto it = m_mob_cells.find(entity_id);
+	if (it == m_mob_cells.end()) {
+		return;
+	}
+
+	RemoveFromCell(it->second.cell_key, it->second.mob);
+	m_mob_cells.erase(it);
+	m_wide_aggro_mobs.erase(entity_id);
+}
+
+void SpatialGrid::Update(Mob *mob)
+{
+	if (!mob) {
+		return;
+	}
+
+	// only mobs explicitly added are tracked, corpses and not yet spawned mobs move around without us
+	auto it = m_mob_cells.find(mob->GetID());
+	if (it == m_mob_cells.end() || it->second.mob != mob) {
+		return;
+	}
+
+	const uint64 key = GetCellKey(GetCell(mob->GetX(), mob->GetY()));
+	if (key != it->second.cell_key) {
+		RemoveFromCell(it->second.cell_key, mob);
+		InsertIntoCell(key, mob);
+		it->second.cell_key = key;
+	}
+
+	UpdateWideAggro(it->first, mob);
+}
+
+void SpatialGrid::Clear()
+{
+	m_cells.clear();
+	m_mob_cells.clear();
+	m_wide_aggro_mobs.clear();
+}
+
+void SpatialGrid::InsertIntoCell(uint64 key, Mob *mob)
+{
+	m_cells[key].emplace_back(mob);
+}
+
+void SpatialGrid::RemoveFromCell(uint64 key, Mob *mob)
+{
+	auto it = m_cells.find(key);
+	if (it == m_cells.end()) {
+		return;
+	}
+
+	auto &l = it->second;
+	for (size_t i = 0; i < l.size(); ++i) {
+		if (l[i] == mob) {
+			l[i] = l.back();
+			l.pop_back();
+			break;
+		}
+	}
+
+	if (l.empty()) {
+		m_cells.erase(it);
+	}
+}
+
+void SpatialGrid::UpdateWideAggro(uint16 entity_id, Mob *mob)
+{
+	if (mob->GetAggroRange() >= m_cell_size) {
+		m_wide_aggro_mobs[entity_id] = mob;
+	}
+	else if (!m_wide_aggro_mobs.empty()) {
+		m_wide_aggro_mobs.erase(entity_id);
+	}
+}
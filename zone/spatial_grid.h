@@ -0,0 +1,104 @@
+#ifndef EQEMU_SPATIAL_GRID_H
+#define EQEMU_SPATIAL_GRID_H
+
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+#include "../common/types.h"
+
+class Mob;
+
+// Uniform 2D (x/y) bucket grid over every mob in the zone
+//
+// Mobs are bucketed by the cell their position falls in; membership is updated incrementally whenever a mob
+// crosses a cell boundary so radius queries only need to touch the handful of cells overlapping the search circle
+// instead of the entire mob list. Queries return candidates, callers still apply their own exact distance checks.
+class SpatialGrid {
+public:
+	struct Cell {
+		int32 x;
+		int32 y;
+	};
+
+	struct Entry {
+		uint64 cell_key;
+		Mob    *mob;
+	};
+
+	void SetCellSize(float cell_size);
+	inline float GetCellSize() const { return m_cell_size; }
+
+	void Add(Mob *mob);
+	void Remove(uint16 entity_id);
+	void Update(Mob *mob);
+	void Clear();
+
+	inline size_t GetMobCount() const { return m_mob_cells.size(); }
+	inline size_t GetCellCount() const { return m_cells.size(); }
+
+	// mobs whose aggro range exceeds the cell size, they are relevant to every close scan regardless of distance
+	inline const std::unordered_map<uint16, Mob *> &GetWideAggroMobs() const { return m_wide_aggro_mobs; }
+
+	template<typename Callback>
+	void ForEachCandidate(float x, float y, float radius, Callback callback) const
+	{
+		if (m_cells.empty()) {
+			return;
+		}
+
+		const Cell min_cell = GetCell(x - radius, y - radius);
+		const Cell max_cell = GetCell(x + radius, y + radius);
+
+		const uint64 span = static_cast<uint64>(max_cell.x - min_cell.x + 1) *
+							static_cast<uint64>(max_cell.y - min_cell.y + 1);
+
+		// the search area covers more cells than are populated, walk the populated cells instead
+		if (span >= m_cells.size()) {
+			for (const auto &c: m_cells) {
+				for (Mob *m: c.second) {
+					callback(m);
+				}
+			}
+
+			return;
+		}
+
+		for (int32 cx = min_cell.x; cx <= max_cell.x; ++cx) {
+			for (int32 cy = min_cell.y; cy <= max_cell.y; ++cy) {
+				auto it = m_cells.find(GetCellKey(Cell{cx, cy}));
+				if (it == m_cells.end()) {
+					continue;
+				}
+
+				for (Mob *m: it->second) {
+					callback(m);
+				}
+			}
+		}
+	}
+
+private:
+	inline Cell GetCell(float x, float y) const
+	{
+		return Cell{
+			static_cast<int32>(std::floor(x / m_cell_size)),
+			static_cast<int32>(std::floor(y / m_cell_size))
+		};
+	}
+
+	static inline uint64 GetCellKey(const Cell &c)
+	{
+		return (static_cast<uint64>(static_cast<uint32>(c.x)) << 32) | static_cast<uint32>(c.y);
+	}
+
+	void InsertIntoCell(uint64 key, Mob *mob);
+	void RemoveFromCell(uint64 key, Mob *mob);
+	void UpdateWideAggro(uint16 entity_id, Mob *mob);
+
+	float                                          m_cell_size = 600.0f;
+	std::unordered_map<uint64, std::vector<Mob *>> m_cells;
+	std::unordered_map<uint16, Entry>              m_mob_cells;
+	std::unordered_map<uint16, Mob *>              m_wide_aggro_mobs;
+};
+
+#endif //EQEMU_SPATIAL_GRID_H
@@ -25,6 +25,7 @@
 #include "../common/spdat.h"
 #include "../common/data_verification.h"
 #include "../common/misc_functions.h"
+#include "../common/tick_profiler.h"
 
 #include "bot.h"
 #include "pets.h"
@@ -1749,7 +1750,7 @@ bool Mob::SpellEffect(Mob* caster, uint16 spell_id, float partial, int level_ove
 					if (RuleB(Custom, AlternateMobFDBehavior) && caster->IsNPC()) {
 						std::vector<Mob*> valid_targets;
 						for (const auto hater : caster->GetHateList()) {
-							auto mob = hater->entity_on_hatelist;
+							auto mob = hater->GetEnt();
 							if (mob == this) {
 								int hate = caster->GetHateAmount(this);
 								caster->SetHateAmountOnEnt(this, hate - 1000);
@@ -3576,7 +3577,7 @@ bool Mob::SpellEffect(Mob* caster, uint16 spell_id, float partial, int level_ove
 #endif
 	}
 
-	CalcBonuses();
+	CalcBonusLayers(BonusLayer::Spells);
 
 	if (SummonedItem) {
 		Client *c=CastToClient();
@@ -4022,6 +4023,8 @@ bool Mob::IsGroupSuspendableBuff(uint16 spell_id, Buffs_Struct buff) {
 
 void Mob::BuffProcess()
 {
+	TICK_PROFILE("Mob::BuffProcess");
+
 	int buff_count = GetMaxTotalSlots();
 
 	bool update_pet_owner = false;
@@ -4525,12 +4528,11 @@ void Mob::DoBuffTic(const Buffs_Struct &buff, int slot, Mob *caster)
 	}
 
 	/* Is this the best place for this?
-	 * Ideally we would only recalc spell bonuses
-	 * but we would also have to call all the Calc functions like Max HP
-	 * so lets just call the main CalcBonuses
+	 * Only the buffs changed, item and AA bonuses are reused
+	 * and the Calc functions like Max HP still run
 	 */
 	if (degenerating_effects)
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 }
 
 // removes the buff in the buff slot 'slot'
@@ -4795,7 +4797,7 @@ void Mob::BuffFadeBySlot(int slot, bool iRecalcBonuses)
 					//Remove damage over time effects on charmed pet and those applied by charmed pet.
 					if (RuleB(Spells, PreventFactionWarOnCharmBreak)) {
 						for (auto mob : hate_list.GetHateList()) {
-							auto tar = mob->entity_on_hatelist;
+							auto tar = mob->GetEnt();
 							if (tar) {
 								if (tar->IsCasting()) {
 									tar->InterruptSpell(tar->CastingSpellID());
@@ -5051,7 +5053,7 @@ void Mob::BuffFadeBySlot(int slot, bool iRecalcBonuses)
 	// we will eventually call CalcBonuses() even if we skip it right here, so should correct itself if we still have them
 	degenerating_effects = false;
 	if (iRecalcBonuses)
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 }
 
 int64 Mob::CalcAAFocus(focusType type, const AA::Rank &rank, uint16 spell_id)
@@ -5428,6 +5430,7 @@ int64 Mob::CalcAAFocus(focusType type, const AA::Rank &rank, uint16 spell_id)
 				break;
 
 			case SE_Ff_FocusTimerMin:
+				m_focus_cache_volatile = true;
 				if (IsFocusProcLimitTimerActive(-rank.id)) {
 					LimitFailure = true;
 				}
@@ -6094,6 +6097,7 @@ int64 Mob::CalcFocusEffect(focusType type, uint16 focus_id, uint16 spell_id, boo
 
 			case SE_CastonFocusEffect:
 				if (focus_spell.base_value[i] > 0) {
+					m_focus_cache_volatile = true;
 					Caston_spell_id = focus_spell.base_value[i];
 				}
 				break;
@@ -6193,6 +6197,7 @@ int64 Mob::CalcFocusEffect(focusType type, uint16 focus_id, uint16 spell_id, boo
 				break;
 
 			case SE_Ff_FocusTimerMin:
+				m_focus_cache_volatile = true;
 				if (IsFocusProcLimitTimerActive(focus_spell.id)) {
 					return 0;
 				}
@@ -6979,20 +6984,50 @@ uint16 Mob::GetSympatheticFocusEffect(focusType type, uint16 spell_id) {
 	return 0;
 }
 
-int64 Mob::GetFocusEffect(focusType type, uint16 spell_id, Mob *caster, bool from_buff_tic)
+bool Mob::CanCacheFocus(focusType type, bool rand_effectiveness)
 {
-	int64 realTotal = 0;
-	int64 realTotal2 = 0;
-	int64 realTotal3 = 0;
+	if (!RuleB(Spells, UseFocusCache)) {
+		return false;
+	}
 
-	bool rand_effectiveness = false;
+	// SE_FFItemClass limits depend on the item being clicked
+	if (casting_spell_inventory_slot && casting_spell_inventory_slot != -1) {
+		return false;
+	}
 
-	//Improved Healing, Damage & Mana Reduction are handled differently in that some are random percentages
-	//In these cases we need to find the most powerful effect, so that each piece of gear wont get its own chance
-	if (RuleB(Spells, LiveLikeFocusEffects) && CanFocusUseRandomEffectivenessByType(type)) {
-		rand_effectiveness = true;
+	// rolled inside CalcFocusEffect every time they are checked
+	switch (type) {
+		case focusTriggerOnCast:
+		case focusBlockNextSpell:
+		case focusFcCastSpellOnLand:
+			return false;
+		default:
+			break;
+	}
+
+	// outside of the best focus pass classic foci and random effectiveness types roll their value per item
+	if (!rand_effectiveness && (RuleB(Spells, UseClassicSpellFocus) || CanFocusUseRandomEffectivenessByType(type))) {
+		return false;
 	}
 
+	return true;
+}
+
+void Mob::InvalidateFocusCache()
+{
+	if (!m_focus_cache.empty()) {
+		m_focus_cache.clear();
+		m_focus_cache_stats.invalidations++;
+	}
+}
+
+Mob::FocusCacheEntry Mob::CalcCacheableFocus(focusType type, uint16 spell_id, bool rand_effectiveness)
+{
+	FocusCacheEntry focus{.rand_effectiveness = rand_effectiveness};
+
+	int64 realTotal = 0;
+	int64 realTotal3 = 0;
+
 	//Check if item focus effect exists for the mob.
 	if (itembonuses.FocusEffects[type]) {
 		const EQ::ItemData* TempItem = nullptr;
@@ -7155,8 +7190,151 @@ int64 Mob::GetFocusEffect(focusType type, uint16 spell_id, Mob *caster, bool fro
 			}
 		}
 
-		if (UsedItem && rand_effectiveness && focus_max_real != 0) {
-			realTotal = CalcFocusEffect(type, UsedFocusID, spell_id);
+		focus.item_total    = realTotal;
+		focus.item_best     = focus_max_real;
+		focus.item_focus_id = UsedFocusID;
+		focus.item          = UsedItem;
+	}
+
+	// AA Focus
+	if (aabonuses.FocusEffects[type]) {
+
+		int32 Total3 = 0;
+
+		for (const auto &aa : aa_ranks) {
+			auto ability_rank = zone->GetAlternateAdvancementAbilityAndRank(aa.first, aa.second.first);
+			auto ability = ability_rank.first;
+			auto rank = ability_rank.second;
+
+			if (!ability) {
+				continue;
+			}
+
+			if (rank->effects.empty()) {
+				continue;
+			}
+
+			Total3 = CalcAAFocus(type, *rank, spell_id);
+			if (Total3 > 0 && realTotal3 >= 0 && Total3 > realTotal3) {
+				realTotal3 = Total3;
+			}
+			else if (Total3 < 0 && Total3 < realTotal3) {
+				realTotal3 = Total3;
+			}
+		}
+	}
+
+	focus.aa_total = realTotal3;
+
+	//Reagent focus does not apply to these, GetFocusEffect returns 0 and the worn foci are not worth checking
+	if (type == focusReagentCost && (IsEffectInSpell(spell_id, SE_SummonItem) || IsSacrificeSpell(spell_id))) {
+		return focus;
+	}
+
+	int32 worneffect_bonus = 0;
+	//Non-Live like feature to allow for an additive focus bonus to be applied from foci that are placed in worn slot. (Limit Checks)
+	if (RuleB(Spells, UseAdditiveFocusFromWornSlotWithLimits)) {
+		//Check if item focus effect exists for the mob.
+		if (itembonuses.FocusEffectsWornWithLimits[type]) {
+			const EQ::ItemData* temporary_item = nullptr;
+			const EQ::ItemData* used_item      = nullptr;
+
+			//item focus
+			for (int x = EQ::invslot::EQUIPMENT_BEGIN; x <= EQ::invslot::EQUIPMENT_END; x++) {
+				temporary_item = nullptr;
+				EQ::ItemInstance* ins = GetInv().GetItem(x);
+				if (!ins) {
+					continue;
+				}
+
+				temporary_item = ins->GetItem();
+				if (temporary_item && IsValidSpell(temporary_item->Worn.Effect)) {
+					if (rand_effectiveness) {
+						worneffect_bonus += CalcFocusEffect(type, temporary_item->Worn.Effect, spell_id, true);
+					}
+					else {
+						worneffect_bonus += CalcFocusEffect(type, temporary_item->Worn.Effect, spell_id);
+					}
+				}
+
+				for (int y = EQ::invaug::SOCKET_BEGIN; y <= EQ::invaug::SOCKET_END; ++y) {
+					EQ::ItemInstance* aug = nullptr;
+					aug = ins->GetAugment(y);
+					if (aug) {
+						const EQ::ItemData* temporary_item_augment = aug->GetItem();
+						if (temporary_item_augment && IsValidSpell(temporary_item_augment->Worn.Effect)) {
+							if (rand_effectiveness) {
+								worneffect_bonus += CalcFocusEffect(type, temporary_item_augment->Worn.Effect, spell_id, true);
+							}
+							else {
+								worneffect_bonus += CalcFocusEffect(type, temporary_item_augment->Worn.Effect, spell_id);
+						    }
+						}
+					}
+				}
+			}
+		}
+	}
+	//Non-Live like feature to allow for an additive focus bonus to be applied from foci that are placed in worn slot. (No limit checks)
+	else if (RuleB(Spells, UseAdditiveFocusFromWornSlot)) {
+		worneffect_bonus = itembonuses.FocusEffectsWorn[type];
+	}
+
+	focus.worn_total = worneffect_bonus;
+
+	return focus;
+}
+
+int64 Mob::GetFocusEffect(focusType type, uint16 spell_id, Mob *caster, bool from_buff_tic)
+{
+	int64 realTotal = 0;
+	int64 realTotal2 = 0;
+
+	bool rand_effectiveness = false;
+
+	//Improved Healing, Damage & Mana Reduction are handled differently in that some are random percentages
+	//In these cases we need to find the most powerful effect, so that each piece of gear wont get its own chance
+	if (RuleB(Spells, LiveLikeFocusEffects) && CanFocusUseRandomEffectivenessByType(type)) {
+		rand_effectiveness = true;
+	}
+
+	//Items, AAs and worn effects only change with bonuses, buffs below are always checked
+	FocusCacheEntry focus;
+	if (CanCacheFocus(type, rand_effectiveness)) {
+		const uint32 key = (static_cast<uint32>(type) << 16) | spell_id;
+		auto         e   = m_focus_cache.find(key);
+		if (e != m_focus_cache.end() && e->second.rand_effectiveness == rand_effectiveness) {
+			focus = e->second;
+			m_focus_cache_stats.hits++;
+		}
+		else {
+			m_focus_cache_volatile = false;
+			focus = CalcCacheableFocus(type, spell_id, rand_effectiveness);
+
+			if (m_focus_cache_volatile) {
+				m_focus_cache_stats.uncacheable++;
+			}
+			else {
+				if (m_focus_cache.size() >= MAX_FOCUS_CACHE_ENTRIES) {
+					m_focus_cache.clear();
+				}
+
+				m_focus_cache[key] = focus;
+				m_focus_cache_stats.misses++;
+			}
+		}
+	}
+	else {
+		focus = CalcCacheableFocus(type, spell_id, rand_effectiveness);
+		m_focus_cache_stats.uncacheable++;
+	}
+
+	if (focus.item) {
+		const EQ::ItemData* UsedItem = focus.item;
+		realTotal = focus.item_total;
+
+		if (UsedItem && rand_effectiveness && focus.item_best != 0) {
+			realTotal = CalcFocusEffect(type, focus.item_focus_id, spell_id);
 		}
 
 		if ((rand_effectiveness && UsedItem) || (realTotal != 0 && UsedItem)) {
@@ -7263,91 +7441,13 @@ int64 Mob::GetFocusEffect(focusType type, uint16 spell_id, Mob *caster, bool fro
 		}
 	}
 
-	// AA Focus
-	if (aabonuses.FocusEffects[type]) {
-
-		int32 Total3 = 0;
-
-		for (const auto &aa : aa_ranks) {
-			auto ability_rank = zone->GetAlternateAdvancementAbilityAndRank(aa.first, aa.second.first);
-			auto ability = ability_rank.first;
-			auto rank = ability_rank.second;
-
-			if (!ability) {
-				continue;
-			}
-
-			if (rank->effects.empty()) {
-				continue;
-			}
-
-			Total3 = CalcAAFocus(type, *rank, spell_id);
-			if (Total3 > 0 && realTotal3 >= 0 && Total3 > realTotal3) {
-				realTotal3 = Total3;
-			}
-			else if (Total3 < 0 && Total3 < realTotal3) {
-				realTotal3 = Total3;
-			}
-		}
-	}
-
 	if (type == focusReagentCost && (IsEffectInSpell(spell_id, SE_SummonItem) || IsSacrificeSpell(spell_id))) {
 		return 0;
 	}
 	//Summon Spells that require reagents are typically imbue type spells, enchant metal, sacrifice and shouldn't be affected
 	//by reagent conservation for obvious reasons.
 
-
-	int32 worneffect_bonus = 0;
-	//Non-Live like feature to allow for an additive focus bonus to be applied from foci that are placed in worn slot. (Limit Checks)
-	if (RuleB(Spells, UseAdditiveFocusFromWornSlotWithLimits)) {
-		//Check if item focus effect exists for the mob.
-		if (itembonuses.FocusEffectsWornWithLimits[type]) {
-			const EQ::ItemData* temporary_item = nullptr;
-			const EQ::ItemData* used_item      = nullptr;
-
-			//item focus
-			for (int x = EQ::invslot::EQUIPMENT_BEGIN; x <= EQ::invslot::EQUIPMENT_END; x++) {
-				temporary_item = nullptr;
-				EQ::ItemInstance* ins = GetInv().GetItem(x);
-				if (!ins) {
-					continue;
-				}
-
-				temporary_item = ins->GetItem();
-				if (temporary_item && IsValidSpell(temporary_item->Worn.Effect)) {
-					if (rand_effectiveness) {
-						worneffect_bonus += CalcFocusEffect(type, temporary_item->Worn.Effect, spell_id, true);
-					}
-					else {
-						worneffect_bonus += CalcFocusEffect(type, temporary_item->Worn.Effect, spell_id);
-					}
-				}
-
-				for (int y = EQ::invaug::SOCKET_BEGIN; y <= EQ::invaug::SOCKET_END; ++y) {
-					EQ::ItemInstance* aug = nullptr;
-					aug = ins->GetAugment(y);
-					if (aug) {
-						const EQ::ItemData* temporary_item_augment = aug->GetItem();
-						if (temporary_item_augment && IsValidSpell(temporary_item_augment->Worn.Effect)) {
-							if (rand_effectiveness) {
-								worneffect_bonus += CalcFocusEffect(type, temporary_item_augment->Worn.Effect, spell_id, true);
-							}
-							else {
-								worneffect_bonus += CalcFocusEffect(type, temporary_item_augment->Worn.Effect, spell_id);
-						    }
-						}
-					}
-				}
-			}
-		}
-	}
-	//Non-Live like feature to allow for an additive focus bonus to be applied from foci that are placed in worn slot. (No limit checks)
-	else if (RuleB(Spells, UseAdditiveFocusFromWornSlot)) {
-		worneffect_bonus = itembonuses.FocusEffectsWorn[type];
-	}
-
-	return realTotal + realTotal2 + realTotal3 + worneffect_bonus;
+	return realTotal + realTotal2 + focus.aa_total + focus.worn_total;
 }
 
 int64 NPC::GetFocusEffect(focusType type, uint16 spell_id, Mob* caster, bool from_buff_tic) {
@@ -4042,7 +4042,7 @@ int Mob::AddBuff(Mob *caster, uint16 spell_id, int duration, int32 level_overrid
 	}
 
 	// recalculate bonuses since we stripped/added buffs
-	CalcBonuses();
+	CalcBonusLayers(BonusLayer::Spells);
 
 	return emptyslot;
 }
@@ -5103,7 +5103,7 @@ void Mob::BuffFadeAll()
 	}
 
 	if (recalc_bonus) {
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 	}
 }
 
@@ -5125,7 +5125,7 @@ void Mob::BuffFadeNonPersistDeath()
 	}
 
 	if (recalc_bonus) {
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 	}
 }
 
@@ -5144,7 +5144,7 @@ void Mob::BuffFadeBeneficial() {
 	}
 
 	if (recalc_bonus) {
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 	}
 }
 
@@ -5163,7 +5163,7 @@ void Mob::BuffFadeDetrimental() {
 	}
 
 	if (recalc_bonus) {
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 	}
 }
 
@@ -5188,7 +5188,7 @@ void Mob::BuffFadeDetrimentalByCaster(Mob *caster)
 	}
 
 	if (recalc_bonus) {
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 	}
 }
 
@@ -5208,7 +5208,7 @@ void Mob::BuffFadeBySitModifier()
 	}
 
 	if (recalc_bonus) {
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 	}
 }
 
@@ -5224,7 +5224,7 @@ void Mob::BuffFadeBySpellID(uint16 spell_id)
 	}
 
 	if (recalc_bonus) {
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 	}
 }
 
@@ -5243,7 +5243,7 @@ void Mob::BuffFadeBySpellIDAndCaster(uint16 spell_id, uint16 caster_id)
 	}
 
 	if (recalc_bonus) {
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 	}
 }
 
@@ -5264,7 +5264,7 @@ void Mob::BuffFadeByEffect(int effect_id, int slot_to_skip)
 	}
 
 	if (recalc_bonus) {
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 	}
 }
 
@@ -5281,7 +5281,7 @@ void Mob::BuffFadeSongs() {
 	}
 
 	if (recalc_bonus) {
-		CalcBonuses();
+		CalcBonusLayers(BonusLayer::Spells);
 	}
 }
 
@@ -0,0 +1,348 @@
+#include <algorithm>
+#include <regex>
+#include "tradeskill_recipes.h"
+#include "zonedb.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/strings.h"
+#include "../common/timer.h"
+#include "../common/repositories/criteria/content_filter_criteria.h"
+#include "../common/repositories/tradeskill_recipe_repository.h"
+
+bool TradeskillRecipes::Recipe::HasEntryFor(uint32 item_id) const
+{
+	for (const auto &e: entries) {
+		if (static_cast<uint32>(e.item_id) == item_id) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool TradeskillRecipes::Recipe::HasContainer(uint32 item_id) const
+{
+	for (const auto &e: entries) {
+		if (e.iscontainer > 0 && static_cast<uint32>(e.item_id) == item_id) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+uint64 TradeskillRecipes::HashComponents(const std::vector<uint32> &sorted_item_ids)
+{
+	// FNV-1a over the sorted ids, collisions are settled by comparing the component lists
+	uint64 hash = 14695981039346656037ULL;
+	for (const auto &id: sorted_item_ids) {
+		hash ^= id;
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+void TradeskillRecipes::EnsureLoaded()
+{
+	if (!m_loaded) {
+		Load();
+	}
+}
+
+void TradeskillRecipes::Load()
+{
+	BenchTimer timer;
+
+	m_recipes.clear();
+	m_recipes_by_components.clear();
+	m_entry_count = 0;
+
+	const auto recipes = TradeskillRecipeRepository::All(content_db);
+
+	m_recipes.reserve(recipes.size());
+
+	for (const auto &e: recipes) {
+		Recipe r;
+
+		r.id                = static_cast<uint32>(e.id);
+		r.name              = e.name;
+		r.name_lower        = Strings::ToLower(e.name);
+		r.tradeskill        = static_cast<uint16>(e.tradeskill);
+		r.skill_needed      = e.skillneeded;
+		r.trivial           = static_cast<uint16>(e.trivial);
+		r.nofail            = e.nofail;
+		r.replace_container = e.replace_container;
+		r.must_learn        = static_cast<uint8>(e.must_learn);
+		r.quest             = e.quest;
+		r.enabled           = e.enabled;
+
+		m_recipes.emplace(r.id, std::move(r));
+	}
+
+	// the same content criteria the recipe searches have always put in their query
+	auto results = content_db.QueryDatabase(
+		fmt::format(
+			"SELECT id FROM {} WHERE TRUE {}",
+			TradeskillRecipeRepository::TableName(),
+			ContentFilterCriteria::apply()
+		)
+	);
+
+	for (auto row: results) {
+		auto it = m_recipes.find(Strings::ToUnsignedInt(row[0]));
+		if (it != m_recipes.end()) {
+			it->second.in_content = true;
+		}
+	}
+
+	const auto entries = TradeskillRecipeEntriesRepository::GetWhere(content_db, "TRUE ORDER BY id");
+
+	for (const auto &e: entries) {
+		auto it = m_recipes.find(static_cast<uint32>(e.recipe_id));
+		if (it == m_recipes.end()) {
+			continue;
+		}
+
+		auto &r = it->second;
+
+		const uint32 item_id = static_cast<uint32>(e.item_id);
+
+		if (e.componentcount > 0) {
+			r.component_entries.emplace_back(item_id, static_cast<uint8>(e.componentcount));
+			r.components.insert(r.components.end(), e.componentcount, item_id);
+			r.component_count += e.componentcount;
+		}
+
+		if (e.successcount > 0) {
+			r.onsuccess.emplace_back(item_id, static_cast<uint8>(e.successcount));
+		}
+
+		if (e.failcount > 0) {
+			r.onfail.emplace_back(item_id, static_cast<uint8>(e.failcount));
+		}
+
+		if (e.salvagecount > 0) {
+			r.salvage.emplace_back(item_id, static_cast<uint8>(e.salvagecount));
+		}
+
+		r.entries.emplace_back(e);
+		++m_entry_count;
+	}
+
+	for (auto &[id, r]: m_recipes) {
+		if (r.components.empty()) {
+			continue;
+		}
+
+		std::sort(r.components.begin(), r.components.end());
+		m_recipes_by_components.emplace(HashComponents(r.components), id);
+	}
+
+	m_loaded = true;
+
+	LogInfo(
+		"Loaded [{}] tradeskill recipes with [{}] entries ({}s)",
+		Strings::Commify(m_recipes.size()),
+		Strings::Commify(m_entry_count),
+		std::to_string(timer.elapsed())
+	);
+}
+
+void TradeskillRecipes::Reload()
+{
+	m_loaded = false;
+	m_recipes.clear();
+	m_recipes_by_components.clear();
+	m_entry_count = 0;
+}
+
+size_t TradeskillRecipes::GetRecipeCount()
+{
+	EnsureLoaded();
+
+	return m_recipes.size();
+}
+
+size_t TradeskillRecipes::GetEntryCount()
+{
+	EnsureLoaded();
+
+	return m_entry_count;
+}
+
+const TradeskillRecipes::Recipe *TradeskillRecipes::GetRecipe(uint32 recipe_id)
+{
+	EnsureLoaded();
+
+	auto it = m_recipes.find(recipe_id);
+
+	return it != m_recipes.end() ? &it->second : nullptr;
+}
+
+void TradeskillRecipes::SetEnabled(uint32 recipe_id, bool enabled)
+{
+	if (!m_loaded) {
+		return;
+	}
+
+	auto it = m_recipes.find(recipe_id);
+	if (it != m_recipes.end()) {
+		it->second.enabled = enabled;
+	}
+}
+
+const TradeskillRecipes::Recipe *TradeskillRecipes::FindByComponents(
+	std::vector<uint32> item_ids,
+	uint8 c_type,
+	uint32 some_id
+)
+{
+	EnsureLoaded();
+
+	if (item_ids.empty()) {
+		return nullptr;
+	}
+
+	std::sort(item_ids.begin(), item_ids.end());
+
+	std::vector<const Recipe *> matches;
+
+	const auto range = m_recipes_by_components.equal_range(HashComponents(item_ids));
+	for (auto it = range.first; it != range.second; ++it) {
+		const auto &r = m_recipes.at(it->second);
+		if (r.enabled && r.components == item_ids) {
+			matches.emplace_back(&r);
+		}
+	}
+
+	if (matches.empty()) {
+		return nullptr;
+	}
+
+	std::sort(
+		matches.begin(),
+		matches.end(),
+		[](const Recipe *a, const Recipe *b) {
+			return a->id < b->id;
+		}
+	);
+
+	// the same components make more than one recipe, the container decides
+	if (matches.size() > 1) {
+		const uint32 container_item_id = some_id ? some_id : c_type;
+		if (!container_item_id) {
+			return nullptr;
+		}
+
+		matches.erase(
+			std::remove_if(
+				matches.begin(),
+				matches.end(),
+				[&](const Recipe *r) {
+					return !r->HasEntryFor(container_item_id);
+				}
+			),
+			matches.end()
+		);
+
+		if (matches.empty()) {
+			LogError("Combine error: Incorrect container is being used!");
+			return nullptr;
+		}
+
+		if (matches.size() > 1) {
+			LogError(
+				"Combine error: Recipe is not unique! [{}] matches found for container [{}]. Continuing with first recipe match",
+				matches.size(),
+				container_item_id
+			);
+		}
+	}
+
+	const Recipe *r = matches.front();
+	if (!r->HasEntryFor(c_type) && !(some_id && r->HasEntryFor(some_id))) {
+		return nullptr;
+	}
+
+	return r;
+}
+
+std::vector<const TradeskillRecipes::Recipe *> TradeskillRecipes::Search(const SearchCriteria &c)
+{
+	EnsureLoaded();
+
+	std::vector<const Recipe *> l;
+
+	// plain text is a substring match, anything with pattern characters in it goes to a regex the way RLIKE took it
+	bool              use_regex = false;
+	std::regex        pattern;
+	const std::string needle    = Strings::ToLower(c.name);
+	if (!c.name.empty() && c.name.find_first_of(".^$|()[]{}*+?\\") != std::string::npos) {
+		try {
+			pattern   = std::regex(c.name, std::regex::ECMAScript | std::regex::icase);
+			use_regex = true;
+		}
+		catch (const std::regex_error &) {
+			return l;
+		}
+	}
+
+	auto matches = [&](const Recipe &r) {
+		if (!r.enabled || !r.in_content || (r.must_learn & 0x20)) {
+			return false;
+		}
+
+		// favorites are looked up by id below and skip the name and trivial filters
+		if (c.recipe_ids.empty()) {
+			if (r.trivial < c.min_trivial || r.trivial > c.max_trivial) {
+				return false;
+			}
+
+			if (use_regex && !std::regex_search(r.name, pattern)) {
+				return false;
+			}
+
+			if (!use_regex && !needle.empty() && r.name_lower.find(needle) == std::string::npos) {
+				return false;
+			}
+		}
+
+		if (!r.HasContainer(c.object_type) && !(c.some_id && r.HasContainer(c.some_id))) {
+			return false;
+		}
+
+		return r.component_count <= c.bag_slots;
+	};
+
+	if (!c.recipe_ids.empty()) {
+		for (const auto &id: c.recipe_ids) {
+			auto it = m_recipes.find(id);
+			if (it != m_recipes.end() && matches(it->second)) {
+				l.emplace_back(&it->second);
+			}
+		}
+	}
+	else {
+		for (const auto &[id, r]: m_recipes) {
+			if (matches(r)) {
+				l.emplace_back(&r);
+			}
+		}
+	}
+
+	std::sort(
+		l.begin(),
+		l.end(),
+		[](const Recipe *a, const Recipe *b) {
+			return a->id < b->id;
+		}
+	);
+
+	l.erase(std::unique(l.begin(), l.end()), l.end());
+
+	if (c.limit && l.size() > c.limit) {
+		l.resize(c.limit);
+	}
+
+	return l;
+}
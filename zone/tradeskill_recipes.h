@@ -0,0 +1,84 @@
+#ifndef EQEMU_TRADESKILL_RECIPES_H
+#define EQEMU_TRADESKILL_RECIPES_H
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../common/types.h"
+#include "../common/repositories/tradeskill_recipe_entries_repository.h"
+
+// Every recipe and its entries held in memory, so combines, auto combines and recipe searches are answered without
+// going back to tradeskill_recipe / tradeskill_recipe_entries. Loaded on first use and dropped on a Tradeskill Recipes
+// (or Content Flags) reload, to be loaded again by whatever asks next.
+class TradeskillRecipes {
+public:
+	using ItemCount = std::pair<uint32, uint8>;
+
+	struct Recipe {
+		uint32      id                = 0;
+		std::string name;
+		std::string name_lower;
+		uint16      tradeskill        = 0;
+		int16       skill_needed      = 0;
+		uint16      trivial           = 0;
+		bool        nofail            = false;
+		bool        replace_container = false;
+		uint8       must_learn        = 0;
+		bool        quest             = false;
+		bool        enabled           = false;
+		bool        in_content        = false; // passes the content filter the recipe searches apply
+		uint32      component_count   = 0;     // sum of componentcount
+
+		std::vector<uint32>    components; // one item id per component needed, sorted, the key of the index
+		std::vector<ItemCount> component_entries;
+		std::vector<ItemCount> onsuccess;
+		std::vector<ItemCount> onfail;
+		std::vector<ItemCount> salvage;
+
+		// every entry in id order, for lore checks and the quest API
+		std::vector<TradeskillRecipeEntriesRepository::TradeskillRecipeEntries> entries;
+
+		bool HasEntryFor(uint32 item_id) const;
+		bool HasContainer(uint32 item_id) const;
+	};
+
+	struct SearchCriteria {
+		uint32              object_type = 0;
+		uint32              some_id     = 0;
+		uint32              bag_slots   = 0;
+		std::vector<uint32> recipe_ids; // favorites, searched instead of name and trivial when set
+		std::string         name;       // matched the way name RLIKE did, case insensitive
+		uint32              min_trivial = 0;
+		uint32              max_trivial = 0;
+		size_t              limit       = 0;
+	};
+
+	const Recipe *GetRecipe(uint32 recipe_id);
+
+	// the enabled recipe made from exactly these items in a container of c_type / some_id
+	const Recipe *FindByComponents(std::vector<uint32> item_ids, uint8 c_type, uint32 some_id);
+
+	std::vector<const Recipe *> Search(const SearchCriteria &c);
+
+	void SetEnabled(uint32 recipe_id, bool enabled);
+	void Reload();
+
+	size_t GetRecipeCount();
+	size_t GetEntryCount();
+
+	static uint64 HashComponents(const std::vector<uint32> &sorted_item_ids);
+
+private:
+	void EnsureLoaded();
+	void Load();
+
+	bool                                    m_loaded      = false;
+	size_t                                  m_entry_count = 0;
+	std::unordered_map<uint32, Recipe>      m_recipes;
+	std::unordered_multimap<uint64, uint32> m_recipes_by_components;
+};
+
+extern TradeskillRecipes tradeskill_recipes;
+
+#endif //EQEMU_TRADESKILL_RECIPES_H
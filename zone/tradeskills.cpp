@@ -31,8 +31,10 @@
 #include "quest_parser_collection.h"
 #include "string_ids.h"
 #include "titles.h"
+#include "tradeskill_recipes.h"
 #include "zonedb.h"
 #include "worldserver.h"
+#include "../common/database/database_write_queue.h"
 #include "../common/repositories/char_recipe_list_repository.h"
 #include "../common/repositories/criteria/content_filter_criteria.h"
 #include "../common/repositories/tradeskill_recipe_repository.h"
@@ -644,7 +646,7 @@ void Object::HandleCombine(Client* user, const NewCombine_Struct* in_combine, Ob
 		if (!spec.has_learnt && ((spec.must_learn&0x10) != 0x10)) {
 			user->MessageString(Chat::LightBlue, TRADESKILL_LEARN_RECIPE, spec.name.c_str());
 		}
-		database.UpdateRecipeMadecount(spec.recipe_id, user->CharacterID(), spec.madecount+1);
+		user->SetRecipeMadeCount(spec.recipe_id, spec.madecount + 1);
 	}
 
 	// Replace the container on success if required.
@@ -768,27 +770,24 @@ void Object::HandleAutoCombine(Client* user, const RecipeAutoCombine_Struct* rac
 		}
 	}
 
-    //pull the list of components
-	const auto query = fmt::format("SELECT item_id, componentcount "
-                                    "FROM tradeskill_recipe_entries "
-                                    "WHERE componentcount > 0 AND recipe_id = {}",
-                                    rac->recipe_id);
-    auto results = content_db.QueryDatabase(query);
-	if (!results.Success()) {
+	//pull the list of components
+	const auto recipe = tradeskill_recipes.GetRecipe(rac->recipe_id);
+	if (!recipe) {
 		user->QueuePacket(outapp);
 		safe_delete(outapp);
 		return;
 	}
 
-	if(results.RowCount() < 1) {
+	const auto &components = recipe->component_entries;
+	if (components.empty()) {
 		LogError("Error in HandleAutoCombine: no components returned");
 		user->QueuePacket(outapp);
 		safe_delete(outapp);
 		return;
 	}
 
-	if(results.RowCount() > 10) {
-		LogError("Error in HandleAutoCombine: too many components returned ([{}])", results.RowCount());
+	if (components.size() > 10) {
+		LogError("Error in HandleAutoCombine: too many components returned ([{}])", components.size());
 		user->QueuePacket(outapp);
 		safe_delete(outapp);
 		return;
@@ -806,10 +805,10 @@ void Object::HandleAutoCombine(Client* user, const RecipeAutoCombine_Struct* rac
 
 	std::list<int> MissingItems;
 
-    uint8 needItemIndex = 0;
-	for (auto row = results.begin(); row != results.end(); ++row, ++needItemIndex) {
-		uint32 item = (uint32)Strings::ToInt(row[0]);
-		uint8 num = (uint8) Strings::ToInt(row[1]);
+	uint8 needItemIndex = 0;
+	for (auto c = components.begin(); c != components.end(); ++c, ++needItemIndex) {
+		uint32 item = c->first;
+		uint8 num = c->second;
 
 		needcount += num;
 
@@ -856,7 +855,7 @@ void Object::HandleAutoCombine(Client* user, const RecipeAutoCombine_Struct* rac
 
 	//remove all the items from the players inventory, with updates...
 	int16 slot;
-	for(uint8 r = 0; r < results.RowCount(); r++) {
+	for(uint8 r = 0; r < components.size(); r++) {
 		if(items[r] == 0 || counts[r] == 0)
 			continue;	//skip empties, could prolly break here
 
@@ -895,7 +894,7 @@ void Object::HandleAutoCombine(Client* user, const RecipeAutoCombine_Struct* rac
 		if (!spec.has_learnt && ((spec.must_learn & 0x10) != 0x10)) {
 			user->MessageString(Chat::LightBlue, TRADESKILL_LEARN_RECIPE, spec.name.c_str());
 		}
-		database.UpdateRecipeMadecount(spec.recipe_id, user->CharacterID(), spec.madecount+1);
+		user->SetRecipeMadeCount(spec.recipe_id, spec.madecount + 1);
 	}
 
 
@@ -917,74 +916,48 @@ void Object::HandleAutoCombine(Client* user, const RecipeAutoCombine_Struct* rac
 }
 
 void Client::SendTradeskillSearchResults(
-	const std::string &query,
+	const std::vector<const TradeskillRecipes::Recipe *> &recipes,
 	unsigned long objtype,
 	unsigned long someid
 )
 {
-	auto results = content_db.QueryDatabase(query);
-	if (!results.Success()) {
-		return;
-	}
-
-	if (results.RowCount() < 1) {
+	if (recipes.empty()) {
 		return;
 	}
 
+	LoadLearnedRecipes();
 
-	auto character_learned_recipe_list = CharRecipeListRepository::GetWhere(
-		database,
-		fmt::format("char_id = {}", CharacterID())
-	);
-
-	for (auto row = results.begin(); row != results.end(); ++row) {
-		if (row == nullptr || row[0] == nullptr || row[1] == nullptr || row[2] == nullptr || row[3] == nullptr ||
-			row[4] == nullptr || row[5] == nullptr) {
-			continue;
-		}
-
-		uint32     recipe_id  = (uint32) Strings::ToInt(row[0]);
-		const char *name      = row[1];
-		uint32     trivial    = (uint32) Strings::ToInt(row[2]);
-		uint32     comp_count = (uint32) Strings::ToInt(row[3]);
-		uint32     tradeskill = (uint16) Strings::ToInt(row[4]);
-		uint32     must_learn = (uint16) Strings::ToInt(row[5]);
-
+	for (const auto r : recipes) {
+		const auto learned = m_learned_recipes.find(r->id);
 
 		// Skip the recipes that exceed the threshold in skill difference
 		// Recipes that have either been made before or were
 		// explicitly learned are excempt from that limit
-		auto character_learned_recipe = CharRecipeListRepository::GetCharRecipeListEntry(
-			character_learned_recipe_list,
-			recipe_id
-		);
-
 		if (RuleB(Skills, UseLimitTradeskillSearchSkillDiff) &&
-			((int32) trivial - (int32) GetSkill((EQ::skills::SkillType) tradeskill)) >
+			((int32) r->trivial - (int32) GetSkill((EQ::skills::SkillType) r->tradeskill)) >
 			RuleI(Skills, MaxTradeskillSearchSkillDiff)) {
 
-			LogTradeskills("Checking limit recipe_id [{}] name [{}]", recipe_id, name);
+			LogTradeskills("Checking limit recipe_id [{}] name [{}]", r->id, r->name);
 
-			if (character_learned_recipe.madecount == 0) {
+			if (learned == m_learned_recipes.end() || learned->second == 0) {
 				continue;
 			}
 		}
 
 		//Skip recipes that must be learned
-		if ((must_learn & 0xf) && !character_learned_recipe.recipe_id) {
+		if ((r->must_learn & 0xf) && learned == m_learned_recipes.end()) {
 			continue;
 		}
 
-
 		auto               outapp = new EQApplicationPacket(OP_RecipeReply, sizeof(RecipeReply_Struct));
 		RecipeReply_Struct *reply = (RecipeReply_Struct *) outapp->pBuffer;
 
 		reply->object_type     = objtype;
 		reply->some_id         = someid;
-		reply->component_count = comp_count;
-		reply->recipe_id       = recipe_id;
-		reply->trivial         = trivial;
-		strn0cpy(reply->recipe_name, name, sizeof(reply->recipe_name));
+		reply->component_count = r->component_count;
+		reply->recipe_id       = r->id;
+		reply->trivial         = r->trivial;
+		strn0cpy(reply->recipe_name, r->name.c_str(), sizeof(reply->recipe_name));
 		FastQueuePacket(&outapp);
 	}
 }
@@ -1406,19 +1379,8 @@ bool ZoneDatabase::GetTradeRecipe(
 		return false;
 	}
 
-	std::string containers; // make where clause segment for container(s)
-	if (!some_id) { // world combiner so no item number
-		containers = fmt::format("= {}", c_type);
-	} else { // container in inventory
-		containers = fmt::format("IN ({}, {})", c_type, some_id);
-	}
-
-	//Could prolly watch for stacks in this loop and handle them properly...
-	//just increment sum and count accordingly
-	bool        first = true;
-	std::string buf2;
-	uint32      count = 0;
-	uint32      sum   = 0;
+	// one id per filled slot, a stack is one component like it has always been
+	std::vector<uint32> item_ids;
 
 	for (uint8 slot_id = EQ::invbag::SLOT_BEGIN; slot_id < EQ::invbag::SLOT_COUNT; slot_id++) { // <watch> TODO: need to determine if this is bound to world/item container size
 		LogTradeskills("Fetching item [{}]", slot_id);
@@ -1441,191 +1403,28 @@ bool ZoneDatabase::GetTradeRecipe(
 			continue;
 		}
 
-		if (first) {
-			buf2 += fmt::format("{}", item_id);
-			first = false;
-		} else {
-			buf2 += fmt::format(", {}", item_id);
-		}
-
-		sum += item_id;
-		count++;
+		item_ids.emplace_back(item_id);
 
 		LogTradeskills(
 			"Item in container index [{}] item [{}] found [{}]",
 			slot_id,
 			item->ID,
-			count
+			item_ids.size()
 		);
 	}
 
 	// no items == no recipe
-	if (!count) {
+	if (item_ids.empty()) {
 		return false;
 	}
 
-	std::string query = fmt::format(
-		"SELECT tre.recipe_id FROM tradeskill_recipe_entries AS tre "
-		"INNER JOIN tradeskill_recipe AS tr ON (tre.recipe_id = tr.id) "
-		"WHERE tr.enabled AND ((tre.item_id IN ({}) AND tre.componentcount > 0) "
-		"OR (tre.item_id {} AND tre.iscontainer = 1))"
-		"GROUP BY tre.recipe_id HAVING SUM(tre.componentcount) = {} "
-		"AND SUM(tre.item_id * tre.componentcount) = {}",
-		buf2,
-		containers,
-		count,
-		sum
-	);
-
-	auto results = QueryDatabase(query);
-	if (!results.Success()) {
-		LogError("Error in search, query: [{}]", query.c_str());
-		LogError("Error in search, error: [{}]", results.ErrorMessage().c_str());
+	// exactly these components, so a smaller recipe contained in a bigger one can no longer match the bigger one
+	const auto r = tradeskill_recipes.FindByComponents(item_ids, c_type, some_id);
+	if (!r) {
 		return false;
 	}
 
-	if (results.RowCount() > 1) {
-		//multiple recipes, partial match... do an extra query to get it exact.
-		//this happens when combining components for a smaller recipe
-		//which is completely contained within another recipe
-		first = true;
-		uint32 index = 0;
-		buf2 = "";
-		for (auto row : results) {
-			const uint32 recipe_id = Strings::ToUnsignedInt(row[0]);
-			if (first) {
-				buf2 += fmt::format("{}", recipe_id);
-				first = false;
-			} else {
-				buf2 += fmt::format(", {}", recipe_id);
-			}
-
-			// length limit on buf2
-			if (index == 214) { // Maximum number of recipe matches (19 * 215 = 4096)
-				LogError(
-					"Warning: Too many matches. Unable to search all recipe entries. Searched [{}] of [{}] possible entries",
-					index + 1,
-					results.RowCount());
-				break;
-			}
-
-			++index;
-		}
-
-		query = fmt::format(
-			"SELECT tre.recipe_id FROM tradeskill_recipe_entries AS tre "
-			"WHERE tre.recipe_id IN ({}) GROUP BY tre.recipe_id HAVING sum(tre.componentcount) = {} "
-			"AND sum(tre.item_id * tre.componentcount) = {}",
-			buf2,
-			count,
-			sum
-		);
-		results = QueryDatabase(query);
-		if (!results.Success()) {
-			LogError("Re-query: [{}]", query.c_str());
-			LogError("Error: [{}]", results.ErrorMessage().c_str());
-			return false;
-		}
-	}
-
-	if (results.RowCount() < 1) {
-		return false;
-	}
-
-	if (results.RowCount() > 1) { //The recipe is not unique, so we need to compare the container were using.
-		uint32 container_item_id = 0;
-
-		if (some_id) { // Standard container
-			container_item_id = some_id;
-		} else if (c_type) { // World container
-			container_item_id = c_type;
-		} else { // Invalid container
-			return false;
-		}
-
-		query = fmt::format(
-			"SELECT tre.recipe_id FROM tradeskill_recipe_entries AS tre WHERE tre.recipe_id IN ({}) AND tre.item_id = {}",
-			buf2,
-			container_item_id
-		);
-
-		results = QueryDatabase(query);
-		if (!results.Success()) {
-			LogError("Re-query: [{}]", query);
-			LogError("Error: [{}]", results.ErrorMessage());
-			return false;
-		}
-
-		if (!results.RowCount()) { //Recipe contents matched more than 1 recipe, but not in this container
-			LogError("Combine error: Incorrect container is being used!");
-			return false;
-		}
-
-		if (results.RowCount() > 1) { //Recipe contents matched more than 1 recipe in this container
-			LogError(
-				"Combine error: Recipe is not unique! [{}] matches found for container [{}]. Continuing with first recipe match",
-				results.RowCount(),
-				container_item_id
-			);
-		}
-	}
-
-	auto row = results.begin();
-	const uint32 recipe_id = Strings::ToUnsignedInt(row[0]);
-
-	//Right here we verify that we actually have ALL of the tradeskill components..
-	//instead of part which is possible with experimentation.
-	//This is here because something's up with the query above.. it needs to be rethought out
-	query = fmt::format(
-		"SELECT item_id, componentcount FROM tradeskill_recipe_entries WHERE componentcount > 0 AND recipe_id = {}",
-		recipe_id
-	);
-
-	results = QueryDatabase(query);
-	if (!results.Success() || !results.RowCount()) {
-		return GetTradeRecipe(recipe_id, c_type, some_id, c, spec);
-	}
-
-	for (auto row : results) {
-		int component_count = 0;
-
-		for (uint8 slot_id = EQ::invbag::SLOT_BEGIN; slot_id < (container->GetItem() ? container->GetItem()->BagSlots : EQ::invtype::WORLD_SIZE); slot_id++) {
-			const auto inst = container->GetItem(slot_id);
-			if (!inst || !inst->GetItem()) {
-				continue;
-			}
-
-			if (inst->IsAugmented()) {
-				*is_augmented = true;
-				return false;
-			}
-
-			int item_id = (container->GetItem() && container->GetItem()->BagSlots >= 10) ? inst->GetItem()->ID : inst->GetItem()->ID % 1000000;
-
-			const auto item = database.GetItem(item_id);
-			if (!item) {
-				continue;
-			}
-
-			if (item_id == Strings::ToUnsignedInt(row[0])) {
-				component_count++;
-			}
-
-			LogTradeskills(
-				"Component count loop [{}] item [{}] recipe component_count [{}]",
-				component_count,
-				item->ID,
-				Strings::ToInt(row[1])
-			);
-		}
-
-		if (component_count != Strings::ToInt(row[1])) {
-			LogTradeskills("Aborted due to getting component count [{}] instead of [{}] for item [{}]", component_count, row[1], row[0]);
-			return false;
-		}
-	}
-
-	return GetTradeRecipe(recipe_id, c_type, some_id, c, spec);
+	return GetTradeRecipe(r->id, c_type, some_id, c, spec);
 }
 
 bool ZoneDatabase::GetTradeRecipe(
@@ -1640,137 +1439,45 @@ bool ZoneDatabase::GetTradeRecipe(
 		return false;
 	}
 
-	std::string container_where_filter;
-	if (!some_id) { // world combiner so no item number
-		container_where_filter = fmt::format("= {}", c_type);
-	} else { // container in inventory
-		container_where_filter = fmt::format("IN ({}, {})", c_type, some_id);
-	}
-
-	std::string query = fmt::format(
-		SQL(
-			SELECT
-			tradeskill_recipe.id,
-			tradeskill_recipe.tradeskill,
-			tradeskill_recipe.skillneeded,
-			tradeskill_recipe.trivial,
-			tradeskill_recipe.nofail,
-			tradeskill_recipe.replace_container,
-			tradeskill_recipe.name,
-			tradeskill_recipe.must_learn,
-			tradeskill_recipe.quest
-			FROM
-				tradeskill_recipe
-				INNER JOIN tradeskill_recipe_entries ON tradeskill_recipe.id = tradeskill_recipe_entries.recipe_id
-			WHERE
-				tradeskill_recipe.id = {}
-				AND tradeskill_recipe_entries.item_id {}
-				AND tradeskill_recipe.enabled
-				GROUP BY
-				tradeskill_recipe.id
-		),
-		recipe_id,
-		container_where_filter
-	);
-	auto results = QueryDatabase(query);
-	if (!results.Success()) {
-		LogError("Error, query: [{}]", query.c_str());
-		LogError("Error: [{}]", results.ErrorMessage().c_str());
+	const auto r = tradeskill_recipes.GetRecipe(recipe_id);
+	if (!r || !r->enabled) {
 		return false;
 	}
 
-	if (!results.RowCount()) {
+	// world combiner has no item number, a container in inventory can be either
+	if (!r->HasEntryFor(c_type) && !(some_id && r->HasEntryFor(some_id))) {
 		return false;
 	}
 
-	auto row = results.begin();
-
-	spec->tradeskill        = static_cast<EQ::skills::SkillType>(Strings::ToUnsignedInt(row[1]));
-	spec->skill_needed      = Strings::ToInt(row[2]);
-	spec->trivial           = Strings::ToUnsignedInt(row[3]);
-	spec->nofail            = Strings::ToBool(row[4]);
-	spec->replace_container = Strings::ToBool(row[5]);
-	spec->name              = row[6];
-	spec->must_learn        = Strings::ToUnsignedInt(row[7]);
-	spec->quest             = Strings::ToBool(row[8]);
-	spec->has_learnt        = false;
-	spec->madecount         = 0;
+	spec->tradeskill        = static_cast<EQ::skills::SkillType>(r->tradeskill);
+	spec->skill_needed      = r->skill_needed;
+	spec->trivial           = r->trivial;
+	spec->nofail            = r->nofail;
+	spec->replace_container = r->replace_container;
+	spec->name              = r->name;
+	spec->must_learn        = r->must_learn;
+	spec->quest             = r->quest;
+	spec->has_learnt        = c->HasRecipeLearned(recipe_id);
+	spec->madecount         = spec->has_learnt ? c->GetRecipeMadeCount(recipe_id) : 0;
 	spec->recipe_id         = recipe_id;
 
-	auto r = CharRecipeListRepository::GetWhere(
-		database,
-		fmt::format(
-			"char_id = {} and recipe_id = {}",
-			c->CharacterID(),
-			recipe_id
-		)
-	);
-
-	if (!r.empty() && r[0].recipe_id) { //If this exists we learned it
-		LogTradeskills("made_count [{}]", r[0].madecount);
-
-		spec->has_learnt = true;
-		spec->madecount  = static_cast<uint32>(r[0].madecount);
-	}
-
-	//Pull the on-success items...
-	query = fmt::format(
-		"SELECT item_id, successcount FROM tradeskill_recipe_entries WHERE successcount > 0 AND recipe_id = {}",
-		recipe_id
-	);
-	results = QueryDatabase(query);
-	if (!results.Success()) {
-		return false;
+	if (spec->has_learnt) {
+		LogTradeskills("made_count [{}]", spec->madecount);
 	}
 
-	if (!results.RowCount() && !spec->quest) {
+	if (r->onsuccess.empty() && !spec->quest) {
 		LogError("Error in success: no success items returned");
 		return false;
 	}
 
-	spec->onsuccess.clear();
-	for(auto row : results) {
-		const uint32 item_id       = Strings::ToUnsignedInt(row[0]);
-		const uint8  success_count = Strings::ToUnsignedInt(row[1]);
-		spec->onsuccess.emplace_back(std::pair<uint32, uint8>(item_id, success_count));
-	}
-
-	spec->onfail.clear();
-
-	//Pull the on-fail items...
-	query = fmt::format(
-		"SELECT item_id, failcount FROM tradeskill_recipe_entries WHERE failcount > 0 AND recipe_id = {}",
-		recipe_id
-	);
-	results = QueryDatabase(query);
-	if (results.Success()) {
-		for (auto row : results) {
-			const uint32 item_id    = Strings::ToUnsignedInt(row[0]);
-			const uint8  fail_count = Strings::ToUnsignedInt(row[1]);
-			spec->onfail.emplace_back(std::pair<uint32, uint8>(item_id, fail_count));
-		}
-	}
+	spec->onsuccess = r->onsuccess;
+	spec->onfail    = r->onfail;
 
 	spec->salvage.clear();
 
-	// Don't bother with the query if TS is nofail
-	if (spec->nofail) {
-		return true;
-	}
-
-	// Pull the salvage list
-	query = fmt::format(
-		"SELECT item_id, salvagecount FROM tradeskill_recipe_entries WHERE salvagecount > 0 AND recipe_id = {}",
-		recipe_id
-	);
-
-	results = QueryDatabase(query);
-	if (results.Success()) {
-		for (auto row : results) {
-			const uint32 item_id    = Strings::ToUnsignedInt(row[0]);
-			const uint8  salvage_count = Strings::ToUnsignedInt(row[1]);
-			spec->salvage.emplace_back(std::pair<uint32, uint8>(item_id, salvage_count));
-		}
+	// nofail recipes never salvage
+	if (!spec->nofail) {
+		spec->salvage = r->salvage;
 	}
 
 	return true;
@@ -1778,56 +1485,49 @@ bool ZoneDatabase::GetTradeRecipe(
 
 void ZoneDatabase::UpdateRecipeMadecount(uint32 recipe_id, uint32 char_id, uint32 madeCount)
 {
-	std::string query = StringFormat("INSERT INTO char_recipe_list "
-                                    "SET recipe_id = %u, char_id = %u, madecount = %u "
-                                    "ON DUPLICATE KEY UPDATE madecount = %u;",
-                                    recipe_id, char_id, madeCount, madeCount);
-    QueryDatabase(query);
+	// auto combine writes the same row over and over, only the latest count has to land
+	database_write_queue.Enqueue(
+		char_id,
+		fmt::format("char_recipe_list:{}:{}", char_id, recipe_id),
+		[recipe_id, char_id, madeCount](Database &db) {
+			db.QueryDatabase(
+				fmt::format(
+					"INSERT INTO char_recipe_list SET recipe_id = {}, char_id = {}, madecount = {} "
+					"ON DUPLICATE KEY UPDATE madecount = {}",
+					recipe_id,
+					char_id,
+					madeCount,
+					madeCount
+				)
+			);
+		}
+	);
 }
 
 void Client::LearnRecipe(uint32 recipe_id)
 {
-	std::string query = fmt::format(
-		SQL(
-			select
-			char_id,
-			recipe_id,
-			madecount
-				from
-				char_recipe_list
-				where
-				char_id = {}
-				and recipe_id = {}
-			LIMIT 1
-		),
-		CharacterID(),
-		recipe_id
-	);
-
-	auto results = database.QueryDatabase(query);
-	if (!results.Success()) {
-		return;
-	}
-
-	auto tradeskill_recipe = TradeskillRecipeRepository::FindOne(content_db, recipe_id);
-	if (tradeskill_recipe.id == 0) {
+	const auto r = tradeskill_recipes.GetRecipe(recipe_id);
+	if (!r) {
 		LogError("Invalid recipe [{}]", recipe_id);
 		return;
 	}
 
+	LoadLearnedRecipes();
+
+	const bool learned = m_learned_recipes.find(recipe_id) != m_learned_recipes.end();
+
 	LogTradeskills(
 		"recipe_id [{}] name [{}] learned [{}]",
 		recipe_id,
-		tradeskill_recipe.name,
-		results.RowCount()
+		r->name,
+		learned
 	);
 
-	auto row = results.begin();
-	if (results.RowCount() > 0) {
+	if (learned) {
 		return;
 	}
 
-	MessageString(Chat::LightBlue, TRADESKILL_LEARN_RECIPE, tradeskill_recipe.name.c_str());
+	MessageString(Chat::LightBlue, TRADESKILL_LEARN_RECIPE, r->name.c_str());
 
 	database.QueryDatabase(
 		fmt::format(
@@ -1836,50 +1536,66 @@ void Client::LearnRecipe(uint32 recipe_id)
 			CharacterID()
 		)
 	);
+
+	m_learned_recipes[recipe_id] = 0;
 }
 
-std::vector<uint32> ZoneDatabase::GetRecipeComponentItemIDs(RecipeCountType count_type, uint32 recipe_id)
+void Client::LoadLearnedRecipes()
 {
-	std::vector<uint32> l;
-
-	const auto& tr = TradeskillRecipeRepository::FindOne(content_db, recipe_id);
-	if (!tr.id) {
-		return l;
+	if (m_learned_recipes_loaded) {
+		return;
 	}
 
-	std::string c;
-	switch (count_type) {
-		case RecipeCountType::Success:
-			c = "successcount";
-			break;
-		case RecipeCountType::Fail:
-			c = "failcount";
-			break;
-		case RecipeCountType::Component:
-			c = "componentcount";
-			break;
-		case RecipeCountType::Salvage:
-			c = "salvagecount";
-			break;
-		case RecipeCountType::Container:
-			c = "iscontainer";
-			break;
+	m_learned_recipes.clear();
+
+	for (const auto &e: CharRecipeListRepository::GetWhere(database, fmt::format("char_id = {}", CharacterID()))) {
+		m_learned_recipes[e.recipe_id] = e.madecount;
 	}
 
-	const auto& tre = TradeskillRecipeEntriesRepository::GetWhere(
-		content_db,
-		fmt::format(
-			"recipe_id = {} AND {} >= 1 ORDER BY id ASC",
-			recipe_id,
-			c
-		)
-	);
-	if (tre.empty()) {
+	m_learned_recipes_loaded = true;
+}
+
+void Client::SetRecipeMadeCount(uint32 recipe_id, uint32 made_count)
+{
+	LoadLearnedRecipes();
+
+	m_learned_recipes[recipe_id] = made_count;
+
+	database.UpdateRecipeMadecount(recipe_id, CharacterID(), made_count);
+}
+
+std::vector<uint32> ZoneDatabase::GetRecipeComponentItemIDs(RecipeCountType count_type, uint32 recipe_id)
+{
+	std::vector<uint32> l;
+
+	const auto r = tradeskill_recipes.GetRecipe(recipe_id);
+	if (!r) {
 		return l;
 	}
 
-	for (const auto& e : tre) {
-		l.emplace_back(e.item_id);
+	for (const auto& e : r->entries) {
+		int count = 0;
+		switch (count_type) {
+			case RecipeCountType::Success:
+				count = e.successcount;
+				break;
+			case RecipeCountType::Fail:
+				count = e.failcount;
+				break;
+			case RecipeCountType::Component:
+				count = e.componentcount;
+				break;
+			case RecipeCountType::Salvage:
+				count = e.salvagecount;
+				break;
+			case RecipeCountType::Container:
+				count = e.iscontainer;
+				break;
+		}
+
+		if (count >= 1) {
+			l.emplace_back(e.item_id);
+		}
 	}
 
 	return l;
@@ -1887,32 +1603,31 @@ std::vector<uint32> ZoneDatabase::GetRecipeComponentItemIDs(RecipeCountType coun
 
 int8 ZoneDatabase::GetRecipeComponentCount(RecipeCountType count_type, uint32 recipe_id, uint32 item_id)
 {
-	const auto& tr = TradeskillRecipeRepository::FindOne(content_db, recipe_id);
-	if (!tr.id) {
+	const auto r = tradeskill_recipes.GetRecipe(recipe_id);
+	if (!r) {
 		return -1;
 	}
 
-	const auto& tre = TradeskillRecipeEntriesRepository::GetWhere(
-		content_db,
-		fmt::format(
-			"recipe_id = {} AND item_id = {} ORDER BY id ASC LIMIT 1",
-			recipe_id,
-			item_id
-		)
+	const auto e = std::find_if(
+		r->entries.begin(),
+		r->entries.end(),
+		[item_id](const auto &e) {
+			return static_cast<uint32>(e.item_id) == item_id;
+		}
 	);
-	if (tre.empty()) {
+	if (e == r->entries.end()) {
 		return -1;
 	}
 
 	switch (count_type) {
 		case RecipeCountType::Success:
-			return tre[0].successcount;
+			return e->successcount;
 		case RecipeCountType::Fail:
-			return tre[0].failcount;
+			return e->failcount;
 		case RecipeCountType::Component:
-			return tre[0].componentcount;
+			return e->componentcount;
 		case RecipeCountType::Salvage:
-			return tre[0].salvagecount;
+			return e->salvagecount;
 		default:
 			return -1;
 	}
@@ -1963,34 +1678,49 @@ bool ZoneDatabase::EnableRecipe(uint32 recipe_id)
 {
 	std::string query = StringFormat("UPDATE tradeskill_recipe SET enabled = 1 "
                                     "WHERE id = %u;", recipe_id);
-    auto results = QueryDatabase(query);
-	if (!results.Success())
+	auto results = QueryDatabase(query);
+	if (!results.Success() || results.RowsAffected() == 0) {
+		return false;
+	}
 
-	return results.RowsAffected() > 0;
+	// this zone right away, every other zone through a reload of its recipe index
+	tradeskill_recipes.SetEnabled(recipe_id, true);
+	worldserver.SendReload(ServerReload::Type::TradeskillRecipes);
 
-	return false;
+	return true;
 }
 
 bool ZoneDatabase::DisableRecipe(uint32 recipe_id)
 {
 	std::string query = StringFormat("UPDATE tradeskill_recipe SET enabled = 0 "
                                     "WHERE id = %u;", recipe_id);
-    auto results = QueryDatabase(query);
-	if (!results.Success())
+	auto results = QueryDatabase(query);
+	if (!results.Success() || results.RowsAffected() == 0) {
+		return false;
+	}
 
-	return results.RowsAffected() > 0;
+	// this zone right away, every other zone through a reload of its recipe index
+	tradeskill_recipes.SetEnabled(recipe_id, false);
+	worldserver.SendReload(ServerReload::Type::TradeskillRecipes);
 
-	return false;
+	return true;
 }
 
 bool Client::CheckTradeskillLoreConflict(int32 recipe_id)
 {
-	auto recipe_entries = TradeskillRecipeEntriesRepository::GetWhere(
-		content_db,
-		fmt::format(
-			"recipe_id = {} ORDER BY componentcount DESC",
-			recipe_id
-		)
+	const auto r = tradeskill_recipes.GetRecipe(recipe_id);
+	if (!r || r->entries.empty()) {
+		return false;
+	}
+
+	// a copy, item ids get zeroed out below
+	auto recipe_entries = r->entries;
+	std::stable_sort(
+		recipe_entries.begin(),
+		recipe_entries.end(),
+		[](const auto &a, const auto &b) {
+			return a.componentcount > b.componentcount;
+		}
 	);
 	if (recipe_entries.empty()) {
 		return false;
@@ -2044,7 +1774,7 @@ bool Client::CheckTradeskillLoreConflict(int32 recipe_id)
 	return false;
 }
 
-void Client::ScribeRecipes(uint32_t item_id) const
+void Client::ScribeRecipes(uint32_t item_id)
 {
 	if (item_id == 0)
 	{
@@ -2070,5 +1800,12 @@ void Client::ScribeRecipes(uint32_t item_id) const
 		// avoid replacing madecount for recipes the client already has
 		int rows = CharRecipeListRepository::InsertUpdateMany(database, learned);
 		LogTradeskills("Client [{}] scribed [{}] recipes from [{}]", CharacterID(), rows, item_id);
+
+		// kept rather than read again, made counts still in the write queue would be missed by a reload
+		if (m_learned_recipes_loaded) {
+			for (const auto &e: learned) {
+				m_learned_recipes.try_emplace(static_cast<uint32>(e.recipe_id), 0);
+			}
+		}
 	}
 }
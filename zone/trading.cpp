@@ -35,12 +35,14 @@
 #include "string_ids.h"
 #include "worldserver.h"
 #include "../common/bazaar.h"
+#include "../common/bazaar_search_index.h"
 #include <numeric>
 
 class QueryServ;
 
 extern WorldServer worldserver;
 extern QueryServ* QServ;
+extern BazaarSearchIndex bazaar_search_index;
 
 // The maximum amount of a single bazaar/barter transaction expressed in copper.
 // Equivalent to 2 Million plat
@@ -903,6 +905,7 @@ void Client::TraderStartTrader(const EQApplicationPacket *app)
 
 	TraderRepository::DeleteWhere(database, fmt::format("`char_id` = '{}';", CharacterID()));
 	TraderRepository::ReplaceMany(database, trader_items);
+	worldserver.SendBazaarListingsChanged(CharacterID());
 	safe_delete(inv);
 
 	// This refreshes the Trader window to display the End Trader button
@@ -932,6 +935,7 @@ void Client::TraderEndTrader()
 	}
 
 	TraderRepository::DeleteWhere(database, fmt::format("`char_id` = '{}'", CharacterID()));
+	worldserver.SendBazaarListingsChanged(CharacterID());
 
 	SendBecomeTraderToWorld(this, TraderOff);
 	SendTraderMode(TraderOff);
@@ -1266,6 +1270,7 @@ void Client::FindAndNukeTraderItem(int32 serial_number, int16 quantity, Client *
 			}
 
 			TraderRepository::DeleteMany(database, delete_queue);
+			worldserver.SendBazaarListingsChanged(CharacterID());
 			if (count == 0) {
 				TraderEndTrader();
 			}
@@ -1274,6 +1279,7 @@ void Client::FindAndNukeTraderItem(int32 serial_number, int16 quantity, Client *
 		}
 		else {
 			TraderRepository::UpdateQuantity(database, CharacterID(), item->GetSerialNumber(), charges - quantity);
+			worldserver.SendBazaarListingsChanged(CharacterID());
 			NukeTraderItem(slot_id, charges, quantity, customer, trader_slot, item->GetSerialNumber(), item->GetID());
 			return;
 		}
@@ -1576,13 +1582,15 @@ void Client::SendBarterWelcome()
 
 void Client::DoBazaarSearch(BazaarSearchCriteria_Struct search_criteria)
 {
-	std::vector<BazaarSearchResultsFromDB_Struct> results = Bazaar::GetSearchResults(
-		database,
-		content_db,
-		search_criteria,
-		GetZoneID(),
-		GetInstanceID()
-	);
+	std::vector<BazaarSearchResultsFromDB_Struct> results = RuleB(Bazaar, UseSearchIndex) ?
+		bazaar_search_index.Search(search_criteria, GetZoneID(), GetInstanceID()) :
+		Bazaar::GetSearchResults(
+			database,
+			content_db,
+			search_criteria,
+			GetZoneID(),
+			GetInstanceID()
+		);
 	if (results.empty()) {
 		SendBazaarDone(GetID());
 		return;
@@ -2620,6 +2628,8 @@ void Client::TraderPriceUpdate(const EQApplicationPacket *app)
 			}
 		}
 
+		worldserver.SendBazaarListingsChanged(CharacterID());
+
 		// If we have a customer currently browsing, update them with the new items.
 		//
 		if (GetCustomerID()) {
@@ -2676,6 +2686,7 @@ void Client::TraderPriceUpdate(const EQApplicationPacket *app)
 	// them from the trader table if the new price is zero.
 	//
 	database.UpdateTraderItemPrice(CharacterID(), id_of_item_to_update, charges_on_item_to_update, tpus->NewPrice);
+	worldserver.SendBazaarListingsChanged(CharacterID());
 
 	// If a customer is browsing our goods, send them the updated prices / remove the items from the Merchant window
 	if (GetCustomerID()) {
@@ -3099,6 +3110,7 @@ void Client::BuyTraderItemOutsideBazaar(TraderBuy_Struct *tbs, const EQApplicati
 			trader_item.item_charges - tbs->quantity
 		);
 	}
+	worldserver.SendBazaarListingsChanged(trader_item.char_id);
 
 	SendParcelDeliveryToWorld(ps);
 
@@ -3254,6 +3266,7 @@ void Client::BuyTraderItemVoucher(TraderBuy_Struct* tbs, const EQApplicationPack
 			trader_item.item_charges - tbs->quantity
 		);
 	}
+	worldserver.SendBazaarListingsChanged(trader_item.char_id);
 
 	if (RuleB(Bazaar, AuditTrail)) {
 		BazaarAuditTrail(tbs->seller_name, GetName(), buy_item->GetItem()->Name, tbs->quantity, tbs->price, 0);
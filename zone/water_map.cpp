@@ -74,3 +74,15 @@ WaterMap* WaterMap::LoadWaterMapfile(std::string zone_name) {
 	LogDebug("Failed to load water map, could not open file for reading [{}]", file_path.c_str());
 	return nullptr;
 }
+
+void WaterMap::ReturnRegionTypeBatch(const glm::vec3 *locations, WaterRegionType *types, size_t count) const {
+	for (size_t i = 0; i < count; ++i) {
+		types[i] = ReturnRegionType(locations[i]);
+	}
+}
+
+void WaterMap::InLiquidBatch(const glm::vec3 *locations, uint8 *in_liquid, size_t count) const {
+	for (size_t i = 0; i < count; ++i) {
+		in_liquid[i] = InLiquid(locations[i]);
+	}
+}
@@ -36,6 +36,10 @@ public:
 	virtual bool InPvP(const glm::vec3& location) const = 0;
 	virtual bool InZoneLine(const glm::vec3& location) const = 0;
 
+	// one answer per location, for movement code that has a whole route or group of mobs to look up
+	virtual void ReturnRegionTypeBatch(const glm::vec3 *locations, WaterRegionType *types, size_t count) const;
+	virtual void InLiquidBatch(const glm::vec3 *locations, uint8 *in_liquid, size_t count) const;
+
 protected:
 	virtual bool Load(FILE *fp) { return false; }
 };
@@ -1,4 +1,13 @@
 #include "water_map_v2.h"
+#include "../common/eqemu_logsys.h"
+
+#include <glm/common.hpp>
+#include <algorithm>
+#include <cmath>
+
+// cells the grid may be split into, and how many cells it aims for per region
+static constexpr uint32 WATER_GRID_MAX_CELLS        = 256 * 256;
+static constexpr uint32 WATER_GRID_CELLS_PER_REGION = 2;
 
 WaterMapV2::WaterMapV2() {
 }
@@ -7,6 +16,10 @@ WaterMapV2::~WaterMapV2() {
 }
 
 WaterRegionType WaterMapV2::ReturnRegionType(const glm::vec3& location) const {
+	return Lookup(location);
+}
+
+WaterRegionType WaterMapV2::ReturnRegionTypeUnindexed(const glm::vec3& location) const {
 	size_t sz = regions.size();
 	for(size_t i = 0; i < sz; ++i) {
 		auto const &region = regions[i];
@@ -17,6 +30,147 @@ WaterRegionType WaterMapV2::ReturnRegionType(const glm::vec3& location) const {
 	return RegionTypeNormal;
 }
 
+inline WaterRegionType WaterMapV2::Lookup(const glm::vec3& location) const {
+	const glm::vec3 p(location.y, location.x, location.z);
+
+	// outside the grid is outside every region, this also turns away NaN
+	if (!(p.x >= grid_min.x && p.x <= grid_max.x && p.y >= grid_min.y && p.y <= grid_max.y)) {
+		return RegionTypeNormal;
+	}
+
+	const uint32 cx   = std::min(static_cast<uint32>((p.x - grid_min.x) / cell_size), grid_width - 1);
+	const uint32 cy   = std::min(static_cast<uint32>((p.y - grid_min.y) / cell_size), grid_height - 1);
+	const uint32 cell = cy * grid_width + cx;
+
+	for (uint32 k = cell_offsets[cell]; k < cell_offsets[cell + 1]; ++k) {
+		const uint32 i = cell_regions[k];
+		const auto   &b = region_bounds[i];
+		if (
+			p.x >= b.first.x && p.x <= b.second.x &&
+			p.y >= b.first.y && p.y <= b.second.y &&
+			p.z >= b.first.z && p.z <= b.second.z &&
+			regions[i].second.ContainsPoint(p)
+		) {
+			return regions[i].first;
+		}
+	}
+
+	return RegionTypeNormal;
+}
+
+void WaterMapV2::ReturnRegionTypeBatch(const glm::vec3 *locations, WaterRegionType *types, size_t count) const {
+	for (size_t i = 0; i < count; ++i) {
+		types[i] = Lookup(locations[i]);
+	}
+}
+
+void WaterMapV2::InLiquidBatch(const glm::vec3 *locations, uint8 *in_liquid, size_t count) const {
+	for (size_t i = 0; i < count; ++i) {
+		auto rt = Lookup(locations[i]);
+		in_liquid[i] = rt == RegionTypeWater || rt == RegionTypeVWater || rt == RegionTypeLava;
+	}
+}
+
+void WaterMapV2::GetRegionBounds(size_t index, glm::vec3 &min, glm::vec3 &max) const {
+	const auto &b = region_bounds[index];
+
+	// back to world space
+	min = glm::vec3(b.first.y, b.first.x, b.first.z);
+	max = glm::vec3(b.second.y, b.second.x, b.second.z);
+}
+
+void WaterMapV2::BuildIndex() {
+	region_bounds.clear();
+	cell_offsets.clear();
+	cell_regions.clear();
+	grid_width  = 0;
+	grid_height = 0;
+
+	if (regions.empty()) {
+		// an empty grid that no point falls in
+		grid_min = glm::vec2(1.0f);
+		grid_max = glm::vec2(0.0f);
+		return;
+	}
+
+	region_bounds.reserve(regions.size());
+	for (auto &r: regions) {
+		glm::vec3 min, max;
+		r.second.GetAABB(min, max);
+
+		// ContainsPoint works through the inverse transform, padding keeps its rounding from landing a point just
+		// outside bounds worked out through the forward one
+		const glm::vec3 pad = glm::vec3(0.5f) + (max - min) * 0.001f;
+		region_bounds.emplace_back(min - pad, max + pad);
+	}
+
+	grid_min = glm::vec2(region_bounds[0].first);
+	grid_max = glm::vec2(region_bounds[0].second);
+	for (auto &b: region_bounds) {
+		grid_min = glm::min(grid_min, glm::vec2(b.first));
+		grid_max = glm::max(grid_max, glm::vec2(b.second));
+	}
+
+	const glm::vec2 size = grid_max - grid_min;
+	const uint32 target_cells = std::min(
+		static_cast<uint32>(regions.size()) * WATER_GRID_CELLS_PER_REGION,
+		WATER_GRID_MAX_CELLS
+	);
+
+	cell_size = std::max(std::sqrt(size.x * size.y / target_cells), 1.0f);
+	cell_size = std::max({cell_size, size.x / 1024.0f, size.y / 1024.0f});
+
+	grid_width  = std::max(1u, static_cast<uint32>(std::ceil(size.x / cell_size)));
+	grid_height = std::max(1u, static_cast<uint32>(std::ceil(size.y / cell_size)));
+
+	auto cell_range = [&](const std::pair<glm::vec3, glm::vec3> &b, uint32 &x0, uint32 &y0, uint32 &x1, uint32 &y1) {
+		x0 = std::min(static_cast<uint32>((b.first.x - grid_min.x) / cell_size), grid_width - 1);
+		y0 = std::min(static_cast<uint32>((b.first.y - grid_min.y) / cell_size), grid_height - 1);
+		x1 = std::min(static_cast<uint32>((b.second.x - grid_min.x) / cell_size), grid_width - 1);
+		y1 = std::min(static_cast<uint32>((b.second.y - grid_min.y) / cell_size), grid_height - 1);
+	};
+
+	// counted first so every cell list sits in one array
+	std::vector<uint32> counts(static_cast<size_t>(grid_width) * grid_height + 1, 0);
+	for (auto &b: region_bounds) {
+		uint32 x0, y0, x1, y1;
+		cell_range(b, x0, y0, x1, y1);
+		for (uint32 y = y0; y <= y1; ++y) {
+			for (uint32 x = x0; x <= x1; ++x) {
+				counts[y * grid_width + x]++;
+			}
+		}
+	}
+
+	cell_offsets.resize(counts.size());
+	uint32 total = 0;
+	for (size_t c = 0; c < counts.size(); ++c) {
+		cell_offsets[c] = total;
+		total += counts[c];
+	}
+
+	cell_regions.resize(total);
+	std::vector<uint32> fill(cell_offsets.begin(), cell_offsets.end() - 1);
+	for (uint32 i = 0; i < region_bounds.size(); ++i) {
+		uint32 x0, y0, x1, y1;
+		cell_range(region_bounds[i], x0, y0, x1, y1);
+		for (uint32 y = y0; y <= y1; ++y) {
+			for (uint32 x = x0; x <= x1; ++x) {
+				cell_regions[fill[y * grid_width + x]++] = i;
+			}
+		}
+	}
+
+	LogInfo(
+		"Indexed [{}] water regions in a [{}x{}] grid of [{}] unit cells, [{:.2f}] regions per cell",
+		regions.size(),
+		grid_width,
+		grid_height,
+		cell_size,
+		static_cast<double>(total) / (static_cast<double>(grid_width) * grid_height)
+	);
+}
+
 bool WaterMapV2::InWater(const glm::vec3& location) const {
 	return ReturnRegionType(location) == RegionTypeWater;
 }
@@ -119,5 +273,7 @@ bool WaterMapV2::Load(FILE *fp) {
 			OrientedBoundingBox(glm::vec3(x, y, z), glm::vec3(x_rot, y_rot, z_rot), glm::vec3(x_scale, y_scale, z_scale), glm::vec3(x_extent, y_extent, z_extent))));
 	}
 
+	BuildIndex();
+
 	return true;
 }
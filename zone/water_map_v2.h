@@ -20,11 +20,36 @@ public:
 	virtual bool InPvP(const glm::vec3& location) const;
 	virtual bool InZoneLine(const glm::vec3& location) const;
 
+	virtual void ReturnRegionTypeBatch(const glm::vec3 *locations, WaterRegionType *types, size_t count) const;
+	virtual void InLiquidBatch(const glm::vec3 *locations, uint8 *in_liquid, size_t count) const;
+
+	// every region tested in file order, the answer the index has to agree with
+	WaterRegionType ReturnRegionTypeUnindexed(const glm::vec3& location) const;
+
+	size_t GetRegionCount() const { return regions.size(); }
+	void GetRegionBounds(size_t index, glm::vec3 &min, glm::vec3 &max) const;
+
 protected:
 	virtual bool Load(FILE *fp);
 
 	std::vector<std::pair<WaterRegionType, OrientedBoundingBox>> regions;
 	friend class WaterMap;
+
+private:
+	void BuildIndex();
+	WaterRegionType Lookup(const glm::vec3& location) const;
+
+	// Uniform grid over the regions, built once after loading. Regions are kept in the space the boxes were written in
+	// (x and y swapped from world space), each cell lists in file order every region whose padded bounds reach into it,
+	// so a lookup tests only that list and still returns the first region in the file that holds the point.
+	std::vector<std::pair<glm::vec3, glm::vec3>> region_bounds;
+	std::vector<uint32>                          cell_offsets; // grid_width * grid_height + 1 offsets into cell_regions
+	std::vector<uint32>                          cell_regions;
+	glm::vec2                                    grid_min    = {};
+	glm::vec2                                    grid_max    = {};
+	float                                        cell_size   = 1.0f;
+	uint32                                       grid_width  = 0;
+	uint32                                       grid_height = 0;
 };
 
 #endif
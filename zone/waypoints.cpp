@@ -843,26 +843,77 @@ float Mob::GetFixedZ(const glm::vec3 &destination, int32 z_find_offset) {
 	return new_z;
 }
 
-void Mob::FixZ(int32 z_find_offset /*= 5*/, bool fix_client_z /*= false*/) {
+bool Mob::CanFixZ(bool fix_client_z) {
 	if (IsClient() && !fix_client_z) {
-		return;
+		return false;
 	}
 
 	if (GetIsBoat()) {
-		return;
+		return false;
 	}
 
 	if (flymode == GravityBehavior::Flying) {
-		return;
+		return false;
 	}
 
 	if (zone->watermap && zone->watermap->InLiquid(m_Position)) {
+		return false;
+	}
+
+	return true;
+}
+
+void Mob::FixZ(int32 z_find_offset /*= 5*/, bool fix_client_z /*= false*/) {
+	if (!CanFixZ(fix_client_z)) {
 		return;
 	}
 
 	glm::vec3 current_loc(m_Position);
-	float new_z = GetFixedZ(current_loc, z_find_offset);
+	ApplyFixedZ(GetFixedZ(current_loc, z_find_offset));
+}
+
+// FixZ for a group of mobs at once, used where many are placed together; the ground under every one of them is found
+// with a single batch of rays
+void Mob::FixZBatch(const std::vector<Mob *> &mobs, int32 z_find_offset /*= 5*/) {
+	if (!zone->HasMap()) {
+		return;
+	}
+
+	std::vector<Mob *>     fixing;
+	std::vector<glm::vec3> starts;
+	for (auto m: mobs) {
+		if (!m || !m->CanFixZ(false)) {
+			continue;
+		}
+
+		// the same probe GetFixedZ sends down through FindDestGroundZ
+		glm::vec3 start(m->m_Position);
+		start.z += (-m->GetZOffset() / 2) + z_find_offset;
+
+		fixing.emplace_back(m);
+		starts.emplace_back(start);
+	}
+
+	std::vector<float> best_z(fixing.size());
+	zone->zonemap->FindBestZBatch(starts.data(), best_z.data(), fixing.size());
+
+	for (size_t i = 0; i < fixing.size(); ++i) {
+		Mob *m = fixing[i];
+
+		float new_z = best_z[i];
+		if (new_z != BEST_Z_INVALID) {
+			new_z += m->GetZOffset();
+
+			if (new_z < -2000) {
+				new_z = m->m_Position.z;
+			}
+		}
+
+		m->ApplyFixedZ(new_z);
+	}
+}
 
+void Mob::ApplyFixedZ(float new_z) {
 	// reject z if it is too far from the current z
 	if (std::abs(new_z - m_Position.z) > 100) {
 		return;
@@ -49,6 +49,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "raids.h"
 #include "string_ids.h"
 #include "titles.h"
+#include "tradeskill_recipes.h"
 #include "worldserver.h"
 #include "zone.h"
 #include "zone_config.h"
@@ -56,11 +57,13 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "shared_task_zone_messaging.h"
 #include "dialogue_window.h"
 #include "bot_command.h"
+#include "../common/bazaar_search_index.h"
 #include "../common/events/player_event_logs.h"
 #include "../common/repositories/guild_tributes_repository.h"
 #include "../common/patches/patches.h"
 #include "../common/skill_caps.h"
 #include "../common/server_reload_types.h"
+#include "../common/tick_profiler.h"
 #include "queryserv.h"
 
 extern EntityList             entity_list;
@@ -73,6 +76,7 @@ extern uint32                 numclients;
 extern volatile bool          RunLoops;
 extern QuestParserCollection *parse;
 extern QueryServ             *QServ;
+extern BazaarSearchIndex      bazaar_search_index;
 
 // QuestParserCollection *parse = 0;
 
@@ -88,6 +92,8 @@ WorldServer::~WorldServer() {
 
 void WorldServer::Process()
 {
+	TICK_PROFILE("WorldServer::Process");
+
 	if (!m_reload_queue.empty()) {
 		m_reload_mutex.lock();
 		for (auto it = m_reload_queue.begin(); it != m_reload_queue.end(); ) {
@@ -199,6 +205,9 @@ void WorldServer::OnConnected() {
 		SetZoneData(0);
 	}
 
+	// world clears the trader table when it boots, anything indexed before may be gone
+	bazaar_search_index.Reload();
+
 	pack = new ServerPacket(ServerOP_LSZoneBoot, sizeof(ZoneBoot_Struct));
 	ZoneBoot_Struct* zbs = (ZoneBoot_Struct*)pack->pBuffer;
 	strcpy(zbs->compile_time, LAST_MODIFIED);
@@ -625,6 +634,7 @@ void WorldServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p)
 		Zone::Bootup(s->zone_id, s->instance_id, s->is_static);
 		if (zone) {
 			zone->SetZoneServerId(s->zone_server_id);
+			zone->SetWarmHold(s->is_warm);
 		}
 
 		break;
@@ -3385,9 +3395,16 @@ void WorldServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p)
 		}
 
 		LogInfo("Loading spells");
-		if (!content_db.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells)) {
+		if (!content_db.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells, &spell_traits)) {
 			LogError("Loading spells failed!");
 		}
+
+		// cached focus totals point at the old items and spells
+		for (auto &e: entity_list.GetMobList()) {
+			if (e.second->IsOfClientBotMerc()) {
+				e.second->InvalidateFocusCache();
+			}
+		}
 		break;
 	}
 	case ServerOP_CZClientMessageString:
@@ -3775,6 +3792,11 @@ void WorldServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p)
 			}
 			break;
 		}
+		case ServerOP_BazaarListingsChanged: {
+			auto in = (BazaarListingsChanged_Struct *) pack->pBuffer;
+			bazaar_search_index.MarkTraderChanged(in->char_id);
+			break;
+		}
 		case ServerOP_BazaarPurchase: {
 			auto in        = (BazaarPurchaseMessaging_Struct *) pack->pBuffer;
 			auto trader_pc = entity_list.GetClientByCharID(in->trader_buy_struct.trader_id);
@@ -4509,6 +4531,17 @@ void WorldServer::SendReload(ServerReload::Type type, bool is_global)
 	SendPacket(&pack);
 }
 
+void WorldServer::SendBazaarListingsChanged(uint32 char_id)
+{
+	// every zone, this one included, reads the trader again before its next bazaar search
+	auto pack = ServerPacket(ServerOP_BazaarListingsChanged, sizeof(BazaarListingsChanged_Struct));
+	auto data = (BazaarListingsChanged_Struct *) pack.pBuffer;
+
+	data->char_id = char_id;
+
+	SendPacket(&pack);
+}
+
 void WorldServer::QueueReload(ServerReload::Request r)
 {
 	m_reload_mutex.lock();
@@ -4574,6 +4607,7 @@ void WorldServer::ProcessReload(const ServerReload::Request& request)
 
 		case ServerReload::Type::ContentFlags:
 			content_service.SetExpansionContext()->ReloadContentFlags();
+			tradeskill_recipes.Reload();
 			break;
 
 		case ServerReload::Type::DzTemplates:
@@ -4666,6 +4700,10 @@ void WorldServer::ProcessReload(const ServerReload::Request& request)
 			title_manager.LoadTitles();
 			break;
 
+		case ServerReload::Type::TradeskillRecipes:
+			tradeskill_recipes.Reload();
+			break;
+
 		case ServerReload::Type::Traps:
 			entity_list.UpdateAllTraps(true, true);
 			break;
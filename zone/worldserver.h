@@ -87,5 +87,6 @@ public:
 	ZoneEventScheduler *GetScheduler() const;
 	void SetScheduler(ZoneEventScheduler *scheduler);
 	void SendReload(ServerReload::Type type, bool is_global = true);
+	void SendBazaarListingsChanged(uint32 char_id);
 };
 #endif
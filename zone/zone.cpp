@@ -35,6 +35,7 @@
 #include "../common/seperator.h"
 #include "../common/strings.h"
 #include "../common/eqemu_logsys.h"
+#include "../common/tick_profiler.h"
 
 #include "dynamic_zone.h"
 #include "guild_mgr.h"
@@ -1139,6 +1140,7 @@ Zone::~Zone() {
 	safe_delete(Weather_Timer);
 	safe_delete(zonemap);
 	safe_delete(watermap);
+	MobMovementManager::Get().WaitForPathRequests();
 	safe_delete(pathing);
 	safe_delete(Instance_Timer);
 	safe_delete(Instance_Shutdown_Timer);
@@ -1540,6 +1542,8 @@ uint32 Zone::CountAuth() {
 }
 
 bool Zone::Process() {
+	TICK_PROFILE("Zone::Process");
+
 	spawn_conditions.Process();
 
 	if (spawn2_timer.Check()) {
@@ -1595,7 +1599,11 @@ bool Zone::Process() {
 		}
 	}
 
-	if (!staticzone) {
+	if (m_warm_hold && numclients > 0) {
+		m_warm_hold = false;
+	}
+
+	if (!staticzone && !m_warm_hold) {
 		if (autoshutdown_timer.Check()) {
 			ResetShutdownTimer();
 			if (numclients == 0) {
@@ -3346,6 +3354,10 @@ void Zone::ReloadMaps()
 {
 	zonemap  = Map::LoadMapFile(map_name);
 	watermap = WaterMap::LoadWaterMapfile(map_name);
+
+	// the old pathfinder's route cache refers to polys of the mesh being replaced, and workers may still be searching it
+	MobMovementManager::Get().WaitForPathRequests();
+	safe_delete(pathing);
 	pathing  = IPathfinder::Load(map_name);
 }
 
@@ -479,6 +479,10 @@ public:
 	inline void SetZoneServerId(uint32 id) { m_zone_server_id = id; }
 	inline uint32 GetZoneServerId() const { return m_zone_server_id; }
 
+	// booted by world's warm zone pool, the zone does not shut down while empty until its first client has come in
+	inline void SetWarmHold(bool hold) { m_warm_hold = hold; }
+	inline bool IsWarmHold() const { return m_warm_hold; }
+
 	// zone state
 	bool LoadZoneState(
 		std::unordered_map<uint32, uint32> spawn_times,
@@ -499,6 +503,7 @@ private:
 	bool      pers_instance;
 	bool      pvpzone;
 	bool      m_ucss_available;
+	bool      m_warm_hold = false;
 	bool      staticzone;
 	bool      zone_has_current_time;
 	bool      quest_hot_reload_queued;
@@ -17,6 +17,11 @@ bool ZoneCLI::RanTestCommand(int argc, char **argv)
 	return argc > 1 && (strstr(argv[1], "tests:") != nullptr);
 }
 
+bool ZoneCLI::RanBenchmarkCommand(int argc, char **argv)
+{
+	return argc > 1 && (strstr(argv[1], "benchmark:") != nullptr);
+}
+
 void ZoneCLI::CommandHandler(int argc, char **argv)
 {
 	if (argc == 1) { return; }
@@ -29,9 +34,23 @@ void ZoneCLI::CommandHandler(int argc, char **argv)
 	auto function_map = EQEmuCommand::function_map;
 
 	// Register commands
+	function_map["benchmark:bazaar"]             = &ZoneCLI::BenchmarkBazaar;
+	function_map["benchmark:bot-ai"]             = &ZoneCLI::BenchmarkBotAI;
+	function_map["benchmark:close-scan"]         = &ZoneCLI::BenchmarkCloseScan;
 	function_map["benchmark:databuckets"]        = &ZoneCLI::BenchmarkDatabuckets;
+	function_map["benchmark:daybreak"]           = &ZoneCLI::BenchmarkDaybreak;
+	function_map["benchmark:profanity"]          = &ZoneCLI::BenchmarkProfanity;
+	function_map["benchmark:raycast"]            = &ZoneCLI::BenchmarkRaycast;
+	function_map["benchmark:repositories"]       = &ZoneCLI::BenchmarkRepositories;
+	function_map["benchmark:spell-traits"]       = &ZoneCLI::BenchmarkSpellTraits;
+	function_map["benchmark:timers"]             = &ZoneCLI::BenchmarkTimers;
+	function_map["benchmark:tradeskills"]        = &ZoneCLI::BenchmarkTradeskills;
+	function_map["benchmark:watermap"]           = &ZoneCLI::BenchmarkWatermap;
 	function_map["sidecar:serve-http"]           = &ZoneCLI::SidecarServeHttp;
 	function_map["instances:purge-expired"] = &ZoneCLI::PurgeExpiredInstances;
+	function_map["maps:convert"]                 = &ZoneCLI::MapsConvert;
+	function_map["tests:bazaar-search"]          = &ZoneCLI::TestBazaarSearch;
+	function_map["tests:bonus-layers"]           = &ZoneCLI::TestBonusLayers;
 	function_map["tests:databuckets"]            = &ZoneCLI::TestDataBuckets;
 	function_map["tests:npc-handins"]            = &ZoneCLI::TestNpcHandins;
 	function_map["tests:npc-handins-multiquest"] = &ZoneCLI::TestNpcHandinsMultiQuest;
@@ -41,11 +60,25 @@ void ZoneCLI::CommandHandler(int argc, char **argv)
 }
 
 // cli
+#include "cli/benchmark_bazaar.cpp"
+#include "cli/benchmark_bot_ai.cpp"
+#include "cli/benchmark_close_scan.cpp"
 #include "cli/benchmark_databuckets.cpp"
+#include "cli/benchmark_daybreak.cpp"
+#include "cli/benchmark_profanity.cpp"
+#include "cli/benchmark_raycast.cpp"
+#include "cli/benchmark_repositories.cpp"
+#include "cli/benchmark_spell_traits.cpp"
+#include "cli/benchmark_timers.cpp"
+#include "cli/benchmark_tradeskills.cpp"
+#include "cli/benchmark_watermap.cpp"
+#include "cli/maps_convert.cpp"
 #include "cli/sidecar_serve_http.cpp"
 
 // tests
 #include "cli/tests/_test_util.cpp"
+#include "cli/tests/bazaar_search.cpp"
+#include "cli/tests/bonus_layers.cpp"
 #include "cli/tests/databuckets.cpp"
 #include "cli/tests/npc_handins.cpp"
 #include "cli/tests/npc_handins_multiquest.cpp"
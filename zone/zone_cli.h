@@ -7,12 +7,27 @@
 class ZoneCLI {
 public:
 	static void CommandHandler(int argc, char **argv);
+	static void BenchmarkBazaar(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkBotAI(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkCloseScan(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void BenchmarkDatabuckets(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkDaybreak(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkProfanity(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkRaycast(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkRepositories(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkSpellTraits(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkTimers(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkTradeskills(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkWatermap(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void SidecarServeHttp(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void MapsConvert(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void PurgeExpiredInstances(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static bool RanConsoleCommand(int argc, char **argv);
 	static bool RanSidecarCommand(int argc, char **argv);
 	static bool RanTestCommand(int argc, char **argv);
+	static bool RanBenchmarkCommand(int argc, char **argv);
+	static void TestBazaarSearch(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void TestBonusLayers(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void TestDataBuckets(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void TestNpcHandins(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void TestNpcHandinsMultiQuest(int argc, char **argv, argh::parser &cmd, std::string &description);
@@ -2,6 +2,7 @@
 #include "../common/eqemu_logsys.h"
 #include "../common/extprofile.h"
 #include "../common/rulesys.h"
+#include "../common/database/database_write_queue.h"
 #include "../common/strings.h"
 
 #include "client.h"
@@ -1198,30 +1199,35 @@ bool ZoneDatabase::SaveCharacterCurrency(uint32 character_id, PlayerProfile_Stru
 {
 	ZeroPlayerProfileCurrency(pp);
 
-	auto e = CharacterCurrencyRepository::NewEntity();
-
-	return CharacterCurrencyRepository::ReplaceOne(
-		*this,
-		CharacterCurrencyRepository::CharacterCurrency{
-			.id                      = character_id,
-			.platinum                = static_cast<uint32_t>(pp->platinum),
-			.gold                    = static_cast<uint32_t>(pp->gold),
-			.silver                  = static_cast<uint32_t>(pp->silver),
-			.copper                  = static_cast<uint32_t>(pp->copper),
-			.platinum_bank           = static_cast<uint32_t>(pp->platinum_bank),
-			.gold_bank               = static_cast<uint32_t>(pp->gold_bank),
-			.silver_bank             = static_cast<uint32_t>(pp->silver_bank),
-			.copper_bank             = static_cast<uint32_t>(pp->copper_bank),
-			.platinum_cursor         = static_cast<uint32_t>(pp->platinum_cursor),
-			.gold_cursor             = static_cast<uint32_t>(pp->gold_cursor),
-			.silver_cursor           = static_cast<uint32_t>(pp->silver_cursor),
-			.copper_cursor           = static_cast<uint32_t>(pp->copper_cursor),
-			.radiant_crystals        = pp->currentRadCrystals,
-			.career_radiant_crystals = pp->careerRadCrystals,
-			.ebon_crystals           = pp->currentEbonCrystals,
-			.career_ebon_crystals    = pp->careerEbonCrystals
+	const auto e = CharacterCurrencyRepository::CharacterCurrency{
+		.id                      = character_id,
+		.platinum                = static_cast<uint32_t>(pp->platinum),
+		.gold                    = static_cast<uint32_t>(pp->gold),
+		.silver                  = static_cast<uint32_t>(pp->silver),
+		.copper                  = static_cast<uint32_t>(pp->copper),
+		.platinum_bank           = static_cast<uint32_t>(pp->platinum_bank),
+		.gold_bank               = static_cast<uint32_t>(pp->gold_bank),
+		.silver_bank             = static_cast<uint32_t>(pp->silver_bank),
+		.copper_bank             = static_cast<uint32_t>(pp->copper_bank),
+		.platinum_cursor         = static_cast<uint32_t>(pp->platinum_cursor),
+		.gold_cursor             = static_cast<uint32_t>(pp->gold_cursor),
+		.silver_cursor           = static_cast<uint32_t>(pp->silver_cursor),
+		.copper_cursor           = static_cast<uint32_t>(pp->copper_cursor),
+		.radiant_crystals        = pp->currentRadCrystals,
+		.career_radiant_crystals = pp->careerRadCrystals,
+		.ebon_crystals           = pp->currentEbonCrystals,
+		.career_ebon_crystals    = pp->careerEbonCrystals
+	};
+
+	database_write_queue.Enqueue(
+		character_id,
+		fmt::format("character_currency:{}", character_id),
+		[e](Database &db) {
+			CharacterCurrencyRepository::ReplaceOne(db, e);
 		}
 	);
+
+	return true;
 }
 
 bool ZoneDatabase::SaveCharacterMemorizedSpell(uint32 character_id, uint32 spell_id, uint32 slot_id){
@@ -2905,13 +2911,7 @@ void ZoneDatabase::UpdateAltCurrencyValue(uint32 char_id, uint32 currency_id, ui
 
 void ZoneDatabase::SaveBuffs(Client *client)
 {
-	CharacterBuffsRepository::DeleteWhere(
-		database,
-		fmt::format(
-			"`character_id` = {}",
-			client->CharacterID()
-		)
-	);
+	const uint32 character_id = client->CharacterID();
 
 	auto      buffs          = client->GetBuffs();
 	const int max_buff_slots = client->GetMaxBuffSlots();
@@ -2958,9 +2958,17 @@ void ZoneDatabase::SaveBuffs(Client *client)
 		v.emplace_back(e);
 	}
 
-	if (!v.empty()) {
-		CharacterBuffsRepository::ReplaceMany(database, v);
-	}
+	database_write_queue.Enqueue(
+		character_id,
+		fmt::format("character_buffs:{}", character_id),
+		[character_id, v = std::move(v)](Database &db) {
+			CharacterBuffsRepository::DeleteWhere(db, fmt::format("`character_id` = {}", character_id));
+
+			if (!v.empty()) {
+				CharacterBuffsRepository::ReplaceMany(db, v);
+			}
+		}
+	);
 }
 
 void ZoneDatabase::LoadBuffs(Client *client)
@@ -4136,7 +4144,13 @@ void ZoneDatabase::SaveCharacterBinds(Client *c)
 	}
 
 	if (bind_count > 0) {
-		CharacterBindRepository::ReplaceMany(database, v);
+		database_write_queue.Enqueue(
+			c->CharacterID(),
+			fmt::format("character_bind:{}", c->CharacterID()),
+			[v = std::move(v)](Database &db) {
+				CharacterBindRepository::ReplaceMany(db, v);
+			}
+		);
 	}
 }
 